@@ -719,6 +719,72 @@ if (NOT WINDOWS)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (CMAKE_SYSTEM_NAME MATCHES "Linux")
+  option (HDF5_ENABLE_IOURING_VFD "Build the io_uring Virtual File Driver" OFF)
+  if (HDF5_ENABLE_IOURING_VFD)
+    CHECK_INCLUDE_FILES ("linux/io_uring.h;sys/syscall.h" HAVE_LINUX_IO_URING_H)
+    if (HAVE_LINUX_IO_URING_H)
+      set (${HDF_PREFIX}_HAVE_IOURING_VFD 1)
+    else ()
+      message (WARNING "The io_uring VFD was requested but cannot be built.\nThe linux/io_uring.h kernel header is not available.")
+    endif ()
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+#  Check if the read-only mmap driver can be built
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_MMAP_VFD "Build the read-only mmap Virtual File Driver" OFF)
+  if (HDF5_ENABLE_MMAP_VFD)
+    CHECK_INCLUDE_FILES ("sys/mman.h" HAVE_SYS_MMAN_H)
+    if (HAVE_SYS_MMAN_H)
+      set (${HDF_PREFIX}_HAVE_MMAP_VFD 1)
+    else ()
+      message (WARNING "The mmap VFD was requested but cannot be built.\nThe sys/mman.h header is not available.")
+    endif ()
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+#  Check if the striping driver can be built
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_STRIPE_VFD "Build the striping Virtual File Driver" OFF)
+  if (HDF5_ENABLE_STRIPE_VFD)
+    if (NOT DEFINED Threads_FOUND)
+      set (THREADS_PREFER_PTHREAD_FLAG ON)
+      find_package (Threads)
+    endif ()
+    if (Threads_FOUND AND CMAKE_USE_PTHREADS_INIT)
+      set (${HDF_PREFIX}_HAVE_STRIPE_VFD 1)
+    else ()
+      message (WARNING "The striping VFD was requested but cannot be built.\nThe pthreads library is not available.")
+    endif ()
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+#  Check if the write-behind driver can be built
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_WRITEBEHIND_VFD "Build the write-behind Virtual File Driver" OFF)
+  if (HDF5_ENABLE_WRITEBEHIND_VFD)
+    if (NOT DEFINED Threads_FOUND)
+      set (THREADS_PREFER_PTHREAD_FLAG ON)
+      find_package (Threads)
+    endif ()
+    if (Threads_FOUND AND CMAKE_USE_PTHREADS_INIT)
+      set (${HDF_PREFIX}_HAVE_WRITEBEHIND_VFD 1)
+    else ()
+      message (WARNING "The write-behind VFD was requested but cannot be built.\nThe pthreads library is not available.")
+    endif ()
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 #  Check if ROS3 driver can be built
 #-----------------------------------------------------------------------------
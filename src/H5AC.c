@@ -337,13 +337,22 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
 #endif /* H5_HAVE_PARALLEL */
 
     /* Turn on metadata cache logging, if being used
-     * This will be JSON until we create a special API call. Trace output
-     * is generated when logging is controlled by the struct.
+     * This will be JSON until we create a special API call, unless the
+     * HDF5_MDC_LOG_STYLE environment variable asks for the low-overhead
+     * binary format. Trace output is generated when logging is controlled
+     * by the struct.
      */
-    if (H5F_USE_MDC_LOGGING(f))
-        if (H5C_log_set_up(f->shared->cache, H5F_MDC_LOG_LOCATION(f), H5C_LOG_STYLE_JSON,
+    if (H5F_USE_MDC_LOGGING(f)) {
+        H5C_log_style_t log_style = H5C_LOG_STYLE_JSON;
+        const char     *style_env = HDgetenv(HDF5_MDC_LOG_STYLE);
+
+        if (style_env && !HDstrcmp(style_env, "binary"))
+            log_style = H5C_LOG_STYLE_BINARY;
+
+        if (H5C_log_set_up(f->shared->cache, H5F_MDC_LOG_LOCATION(f), log_style,
                            H5F_START_MDC_LOG_ON_ACCESS(f)) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "mdc logging setup failed");
+    }
 
     /* Set the cache parameters */
     if (H5AC_set_cache_auto_resize_config(f->shared->cache, config_ptr) < 0)
@@ -1638,6 +1647,8 @@ H5AC_get_cache_auto_resize_config(const H5AC_t *cache_ptr, H5AC_cache_config_t *
     config_ptr->epochs_before_eviction = (int)(internal_config.epochs_before_eviction);
     config_ptr->apply_empty_reserve    = internal_config.apply_empty_reserve;
     config_ptr->empty_reserve          = internal_config.empty_reserve;
+    config_ptr->mrc_sample_rate        = internal_config.mrc_sample_rate;
+    config_ptr->mrc_knee_threshold     = internal_config.mrc_knee_threshold;
 #ifdef H5_HAVE_PARALLEL
     {
         H5AC_aux_t *aux_ptr;
@@ -1730,6 +1741,29 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_get_cache_hit_rate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_get_cache_mrc
+ *
+ * Purpose:     Wrapper function for H5C_get_cache_mrc().
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_get_cache_mrc(const H5AC_t *cache_ptr, size_t *npoints, size_t cache_sizes[], double miss_ratios[])
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if (H5C_get_cache_mrc((const H5C_t *)cache_ptr, npoints, cache_sizes, miss_ratios) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_cache_mrc() failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_get_cache_mrc() */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5AC_reset_cache_hit_rate_stats()
@@ -2065,6 +2099,9 @@ H5AC__ext_config_2_int_config(const H5AC_cache_config_t *ext_conf_ptr, H5C_auto_
     int_conf_ptr->apply_empty_reserve    = ext_conf_ptr->apply_empty_reserve;
     int_conf_ptr->empty_reserve          = ext_conf_ptr->empty_reserve;
 
+    int_conf_ptr->mrc_sample_rate    = ext_conf_ptr->mrc_sample_rate;
+    int_conf_ptr->mrc_knee_threshold = ext_conf_ptr->mrc_knee_threshold;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC__ext_config_2_int_config() */
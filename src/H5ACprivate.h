@@ -254,7 +254,9 @@ typedef struct H5AC_proxy_entry_t {
   /* double      empty_reserve          = */ 0.1,                            \
   /* size_t      dirty_bytes_threshold  = */ (256 * 1024),                    \
   /* int         metadata_write_strategy = */                                  \
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY  \
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY, \
+  /* double      mrc_sample_rate        = */ H5C__DEF_AR_MRC_SAMPLE_RATE,     \
+  /* double      mrc_knee_threshold     = */ H5C__DEF_AR_MRC_KNEE_THRESHOLD   \
 }
 #else /* H5_HAVE_PARALLEL */
 #define H5AC__DEFAULT_CACHE_CONFIG                                            \
@@ -290,7 +292,9 @@ typedef struct H5AC_proxy_entry_t {
   /* double      empty_reserve          = */ 0.1,                             \
   /* size_t      dirty_bytes_threshold  = */ (256 * 1024),                    \
   /* int         metadata_write_strategy = */                                 \
-                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY  \
+                    H5AC__DEFAULT_METADATA_WRITE_STRATEGY, \
+  /* double      mrc_sample_rate        = */ H5C__DEF_AR_MRC_SAMPLE_RATE,     \
+  /* double      mrc_knee_threshold     = */ H5C__DEF_AR_MRC_KNEE_THRESHOLD   \
 }
 #endif /* H5_HAVE_PARALLEL */
 
@@ -405,6 +409,8 @@ H5_DLL herr_t H5AC_get_cache_size(const H5AC_t *cache_ptr, size_t *max_size_ptr,
                                   size_t *cur_size_ptr, uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5AC_get_cache_flush_in_progress(H5AC_t *cache_ptr, hbool_t *flush_in_progress_ptr);
 H5_DLL herr_t H5AC_get_cache_hit_rate(const H5AC_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL herr_t H5AC_get_cache_mrc(const H5AC_t *cache_ptr, size_t *npoints, size_t cache_sizes[],
+                                 double miss_ratios[]);
 H5_DLL herr_t H5AC_reset_cache_hit_rate_stats(H5AC_t *cache_ptr);
 H5_DLL herr_t H5AC_set_cache_auto_resize_config(H5AC_t *cache_ptr, const H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t H5AC_validate_config(const H5AC_cache_config_t *config_ptr);
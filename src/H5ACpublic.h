@@ -171,6 +171,18 @@
  *              at its maximum size, or if the cache is not already using
  *              all available space.
  *
+ *      H5C_incr__mrc: Maintain a spatially sampled ghost LRU list of
+ *              recently accessed entries, and use it to estimate the
+ *              miss ratio curve of the workload.  At the end of each
+ *              epoch, set the maximum cache size to the smallest size in
+ *              [min_size, max_size] whose estimated miss ratio is within
+ *              mrc_knee_threshold of the miss ratio at max_size.
+ *
+ *              This mode both increases and decreases the cache size, so
+ *              decr_mode must be H5C_decr__off when it is selected.  The
+ *              remaining increment and decrement fields are ignored, but
+ *              flash increases are still performed if enabled.
+ *
  *      Note that you must set decr_mode to H5C_incr__off if you
  *      disable metadata cache entry evictions.
  *
@@ -426,6 +438,21 @@
  *    To avoid possible messages from the past/future, all caches must
  *    wait until all caches are done before leaving the sync point.
  *
+ *
+ * Miss ratio curve configuration fields:
+ *
+ * These fields are only used when incr_mode is H5C_incr__mrc.
+ *
+ * mrc_sample_rate: Fraction of the metadata address space tracked in the
+ *    ghost list used to estimate the miss ratio curve.  Addresses are
+ *    selected by hashing, so an entry is either always or never sampled,
+ *    and stack distances observed in the sample are scaled by the inverse
+ *    of the rate.  Must lie in the interval (0.0, 1.0].
+ *
+ * mrc_knee_threshold: The cache is sized to the smallest size whose
+ *    estimated miss ratio exceeds the miss ratio at max_size by no more
+ *    than this amount.  Must lie in the interval [0.0, 1.0].
+ *
  ****************************************************************************/
 
 #define H5AC__CURR_CACHE_CONFIG_VERSION 1
@@ -579,8 +606,12 @@ typedef struct H5AC_cache_config_t {
     //! <!-- [H5AC_cache_config_t_incr_snip] -->
     enum H5C_cache_incr_mode incr_mode;
     /**< Enumerated value indicating the operational mode of the automatic
-     * cache size increase code. At present, only two values listed in
-     * #H5C_cache_incr_mode are legal. */
+     * cache size increase code. At present, the values listed in
+     * #H5C_cache_incr_mode are legal.\n
+     * When set to #H5C_incr__mrc, the cache size is chosen from an online
+     * estimate of the miss ratio curve (see \ref H5AC_cache_config_t.mrc_sample_rate
+     * "mrc_sample_rate" and \ref H5AC_cache_config_t.mrc_knee_threshold
+     * "mrc_knee_threshold"), and \p decr_mode must be #H5C_decr__off. */
 
     double lower_hr_threshold;
     /**< Hit rate threshold used by the hit rate threshold cache size
@@ -714,6 +745,26 @@ typedef struct H5AC_cache_config_t {
      * the extent possible.\n The src/H5ACpublic.h include file in the HDF5
      * library has detailed information on each strategy. */
     //! <!-- [H5AC_cache_config_t_parallel_snip] -->
+
+    /* miss ratio curve configuration fields: */
+    //! <!-- [H5AC_cache_config_t_mrc_snip] -->
+    double mrc_sample_rate;
+    /**< Fraction of metadata cache addresses tracked by the ghost list used
+     * to estimate the miss ratio curve when \p incr_mode is #H5C_incr__mrc.
+     * Sampling is done on a hash of the entry address, so a given entry is
+     * either always or never tracked.\n
+     * This field must lie in the interval (0.0, 1.0] when the miss ratio
+     * curve mode is selected, and is ignored otherwise. 0.1 is a good place
+     * to start. */
+
+    double mrc_knee_threshold;
+    /**< Largest increase in estimated miss ratio, relative to the miss ratio
+     * at \p max_size, that the miss ratio curve sizing algorithm will accept
+     * in return for a smaller cache.\n
+     * This field must lie in the interval [0.0, 1.0] when the miss ratio curve
+     * mode is selected, and is ignored otherwise. 0.01 is a good place to
+     * start. */
+    //! <!-- [H5AC_cache_config_t_mrc_snip] -->
 } H5AC_cache_config_t;
 //! <!-- [H5AC_cache_config_t_snip] -->
 
@@ -294,6 +294,10 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
     cache_ptr->resize_ctl.apply_empty_reserve    = TRUE;
     cache_ptr->resize_ctl.empty_reserve          = H5C__DEF_AR_EMPTY_RESERVE;
 
+    cache_ptr->resize_ctl.mrc_sample_rate    = H5C__DEF_AR_MRC_SAMPLE_RATE;
+    cache_ptr->resize_ctl.mrc_knee_threshold = H5C__DEF_AR_MRC_KNEE_THRESHOLD;
+    cache_ptr->mrc                           = NULL;
+
     cache_ptr->epoch_markers_active = 0;
 
     /* no need to initialize the ring buffer itself */
@@ -522,6 +526,10 @@ H5C_dest(H5F_t *f)
         item = H5FL_FREE(H5C_tag_info_t, item);
     }
 
+    if (cache_ptr->mrc != NULL)
+        if (H5C__mrc_dest(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard miss ratio curve state");
+
     if (cache_ptr->log_info != NULL)
         H5MM_xfree(cache_ptr->log_info);
 
@@ -857,6 +865,12 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_p
                 cache_ptr->size_increase_possible = FALSE;
             break;
 
+        case H5C_incr__mrc:
+            /* the miss ratio curve mode handles size decreases as well --
+             * size_decrease_possible is set after the decr_mode switch below.
+             */
+            break;
+
         default: /* should be unreachable */
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Unknown incr_mode?!?!?");
     } /* end switch */
@@ -894,6 +908,9 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_p
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Unknown decr_mode?!?!?");
     } /* end switch */
 
+    if (config_ptr->incr_mode == H5C_incr__mrc)
+        cache_ptr->size_decrease_possible = TRUE;
+
     if (config_ptr->max_size == config_ptr->min_size) {
         cache_ptr->size_increase_possible       = FALSE;
         cache_ptr->flash_size_increase_possible = FALSE;
@@ -945,6 +962,16 @@ H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_p
         /* this should be impossible... */
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_reset_cache_hit_rate_stats failed");
 
+    /* (re)start the miss ratio curve estimate, or discard it if the new
+     * configuration doesn't use it.
+     */
+    if (cache_ptr->mrc != NULL)
+        if (H5C__mrc_dest(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard miss ratio curve state");
+    if (cache_ptr->resize_enabled && (config_ptr->incr_mode == H5C_incr__mrc))
+        if (H5C__mrc_create(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't set up miss ratio curve state");
+
     /* remove excess epoch markers if any */
     if ((config_ptr->decr_mode == H5C_decr__age_out_with_threshold) ||
         (config_ptr->decr_mode == H5C_decr__age_out)) {
@@ -1251,7 +1278,8 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t *config_ptr, unsigned int tests)
     } /* H5C_RESIZE_CFG__VALIDATE_GENERAL */
 
     if ((tests & H5C_RESIZE_CFG__VALIDATE_INCREMENT) != 0) {
-        if ((config_ptr->incr_mode != H5C_incr__off) && (config_ptr->incr_mode != H5C_incr__threshold))
+        if ((config_ptr->incr_mode != H5C_incr__off) && (config_ptr->incr_mode != H5C_incr__threshold) &&
+            (config_ptr->incr_mode != H5C_incr__mrc))
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid incr_mode");
 
         if (config_ptr->incr_mode == H5C_incr__threshold) {
@@ -1266,6 +1294,15 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t *config_ptr, unsigned int tests)
              */
         } /* H5C_incr__threshold */
 
+        if (config_ptr->incr_mode == H5C_incr__mrc) {
+            if ((config_ptr->mrc_sample_rate <= 0.0) || (config_ptr->mrc_sample_rate > 1.0))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                            "mrc_sample_rate must be in the interval (0.0, 1.0]");
+            if ((config_ptr->mrc_knee_threshold < 0.0) || (config_ptr->mrc_knee_threshold > 1.0))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                            "mrc_knee_threshold must be in the interval [0.0, 1.0]");
+        } /* H5C_incr__mrc */
+
         switch (config_ptr->flash_incr_mode) {
             case H5C_flash_incr__off:
                 /* nothing to do here */
@@ -1330,6 +1367,8 @@ H5C_validate_resize_config(H5C_auto_size_ctl_t *config_ptr, unsigned int tests)
              (config_ptr->decr_mode == H5C_decr__age_out_with_threshold)) &&
             (config_ptr->lower_hr_threshold >= config_ptr->upper_hr_threshold))
             HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "conflicting threshold fields in config");
+        if ((config_ptr->incr_mode == H5C_incr__mrc) && (config_ptr->decr_mode != H5C_decr__off))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "decr_mode must be H5C_decr__off in miss ratio curve mode");
     } /* H5C_RESIZE_CFG__VALIDATE_INTERACTIONS */
 
 done:
@@ -245,6 +245,8 @@ typedef struct H5CX_t {
     hbool_t                 vl_alloc_info_valid;  /* Whether VL datatype alloc info is valid */
     H5T_conv_cb_t           dt_conv_cb;           /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
     hbool_t                 dt_conv_cb_valid;     /* Whether datatype conversion struct is valid */
+    unsigned                dt_conv_nthreads;     /* Conversion threads (H5D_XFER_CONV_NTHREADS_NAME) */
+    hbool_t                 dt_conv_nthreads_valid; /* Whether conversion threads is valid */
     H5D_selection_io_mode_t selection_io_mode;    /* Selection I/O mode (H5D_XFER_SELECTION_IO_MODE_NAME) */
     hbool_t                 selection_io_mode_valid; /* Whether selection I/O mode is valid */
     hbool_t                 modify_write_buf;        /* Whether the library can modify write buffers */
@@ -301,6 +303,8 @@ typedef struct H5CX_t {
                                           (H5D_XFER_NO_SELECTION_IO_CAUSE_NAME) */
     hbool_t no_selection_io_cause_set;   /* Whether reason for not performing selection I/O is set */
     hbool_t no_selection_io_cause_valid; /* Whether reason for not performing selection I/O is valid */
+    uint32_t actual_type_conv;           /* Where data was converted (H5D_XFER_ACTUAL_TYPE_CONV_NAME) */
+    hbool_t  actual_type_conv_set;       /* Whether where data was converted is set */
 
     /* Cached LCPL properties */
     H5T_cset_t encoding;                 /* Link name character encoding */
@@ -380,6 +384,7 @@ typedef struct H5CX_dxpl_cache_t {
     H5Z_data_xform_t       *data_transform;        /* Data transform info (H5D_XFER_XFORM_NAME) */
     H5T_vlen_alloc_info_t   vl_alloc_info;         /* VL datatype alloc info (H5D_XFER_VLEN_*_NAME) */
     H5T_conv_cb_t           dt_conv_cb;            /* Datatype conversion struct (H5D_XFER_CONV_CB_NAME) */
+    unsigned                dt_conv_nthreads;      /* Conversion threads (H5D_XFER_CONV_NTHREADS_NAME) */
     H5D_selection_io_mode_t selection_io_mode;     /* Selection I/O mode (H5D_XFER_SELECTION_IO_MODE_NAME) */
     uint32_t                no_selection_io_cause; /* Reasons for not performing selection I/O
                                                             (H5D_XFER_NO_SELECTION_IO_CAUSE_NAME) */
@@ -572,6 +577,10 @@ H5CX_init(void)
     if (H5P_get(dx_plist, H5D_XFER_CONV_CB_NAME, &H5CX_def_dxpl_cache.dt_conv_cb) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve datatype conversion exception callback");
 
+    /* Get datatype conversion threads */
+    if (H5P_get(dx_plist, H5D_XFER_CONV_NTHREADS_NAME, &H5CX_def_dxpl_cache.dt_conv_nthreads) < 0)
+        HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve datatype conversion threads");
+
     /* Get the selection I/O mode */
     if (H5P_get(dx_plist, H5D_XFER_SELECTION_IO_MODE_NAME, &H5CX_def_dxpl_cache.selection_io_mode) < 0)
         HGOTO_ERROR(H5E_CONTEXT, H5E_CANTGET, FAIL, "Can't retrieve parallel transfer method");
@@ -2455,6 +2464,38 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5CX_get_dt_conv_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_dt_conv_nthreads
+ *
+ * Purpose:     Retrieves the number of datatype conversion threads for the current API call context.
+ *
+ * Return:      Non-negative on success / Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5CX_get_dt_conv_nthreads(unsigned *dt_conv_nthreads)
+{
+    H5CX_node_t **head      = NULL;    /* Pointer to head of API context list */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    assert(dt_conv_nthreads);
+    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+    assert(head && *head);
+    assert(H5P_DEFAULT != (*head)->ctx.dxpl_id);
+
+    H5CX_RETRIEVE_PROP_VALID(dxpl, H5P_DATASET_XFER_DEFAULT, H5D_XFER_CONV_NTHREADS_NAME, dt_conv_nthreads)
+
+    /* Get the value */
+    *dt_conv_nthreads = (*head)->ctx.dt_conv_nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5CX_get_dt_conv_nthreads() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_selection_io_mode
  *
@@ -3482,6 +3523,38 @@ H5CX_set_no_selection_io_cause(uint32_t no_selection_io_cause)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_set_no_selectiion_io_cause() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_actual_type_conv
+ *
+ * Purpose:     Sets where the data was converted for the current API call
+ *              context.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_actual_type_conv(uint32_t actual_type_conv)
+{
+    H5CX_node_t **head = NULL; /* Pointer to head of API context list */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    head = H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+    assert(head && *head);
+    assert((*head)->ctx.dxpl_id != H5P_DEFAULT);
+
+    /* If we're using the default DXPL, don't modify it */
+    if ((*head)->ctx.dxpl_id != H5P_DATASET_XFER_DEFAULT) {
+        /* Cache the value for later, marking it to set in DXPL when context popped */
+        (*head)->ctx.actual_type_conv     = actual_type_conv;
+        (*head)->ctx.actual_type_conv_set = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_actual_type_conv() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_ohdr_flags
  *
@@ -3538,6 +3611,7 @@ H5CX__pop_common(hbool_t update_dxpl_props)
     /* Check for cached DXPL properties to return to application */
     if (update_dxpl_props) {
         H5CX_SET_PROP(H5D_XFER_NO_SELECTION_IO_CAUSE_NAME, no_selection_io_cause)
+        H5CX_SET_PROP(H5D_XFER_ACTUAL_TYPE_CONV_NAME, actual_type_conv)
 #ifdef H5_HAVE_PARALLEL
         H5CX_SET_PROP(H5D_MPIO_ACTUAL_CHUNK_OPT_MODE_NAME, mpio_actual_chunk_opt)
         H5CX_SET_PROP(H5D_MPIO_ACTUAL_IO_MODE_NAME, mpio_actual_io_mode)
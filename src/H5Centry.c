@@ -3265,6 +3265,10 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
     H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, hit);
     H5C__UPDATE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit);
 
+    if (cache_ptr->mrc != NULL)
+        if (H5C__mrc_record_access(cache_ptr, addr, entry_ptr->size) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, NULL, "can't update miss ratio curve estimate");
+
     ret_value = thing;
 
     if (cache_ptr->evictions_enabled &&
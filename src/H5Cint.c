@@ -162,6 +162,25 @@ H5C__auto_adjust_cache_size(H5F_t *f, hbool_t write_permitted)
             }
             break;
 
+        case H5C_incr__mrc:
+            assert(cache_ptr->mrc);
+
+            if (H5C__mrc_end_epoch(cache_ptr, &new_max_cache_size) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't compute miss ratio curve target size");
+
+            /* Leave the cache alone if there isn't enough data yet, or if
+             * the knee hasn't moved by at least a histogram bucket.
+             */
+            if ((new_max_cache_size == 0) ||
+                ((new_max_cache_size < cache_ptr->max_cache_size + cache_ptr->mrc->bucket_width) &&
+                 (new_max_cache_size + cache_ptr->mrc->bucket_width > cache_ptr->max_cache_size)))
+                new_max_cache_size = 0;
+            else if (new_max_cache_size > cache_ptr->max_cache_size)
+                status = cache_ptr->size_increase_possible ? increase : increase_disabled;
+            else
+                status = cache_ptr->size_decrease_possible ? decrease : decrease_disabled;
+            break;
+
         default:
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "unknown incr_mode");
     }
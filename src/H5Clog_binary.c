@@ -0,0 +1,997 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Clog_binary.c
+ *
+ * Purpose:     Cache log implementation that emits compact, fixed-size
+ *              binary records into an in-memory buffer which is written
+ *              to the log file in large blocks.  Intended to be cheap
+ *              enough to leave enabled in production; the h5mdclog tool
+ *              converts the output to JSON and analyzes it offline.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+#include "H5Cmodule.h" /* This source code file is part of the H5C module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Cpkg.h"      /* Cache                                    */
+#include "H5Clog.h"      /* Cache logging                            */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5MMprivate.h" /* Memory management                        */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of records buffered in memory before they are written out */
+#define H5C_BINARY_LOG_NRECORDS 8192
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+typedef struct H5C_log_binary_udata_t {
+    int      fd;       /* Log file descriptor                  */
+    uint8_t *buf;      /* Record buffer                        */
+    size_t   nrecords; /* # of records currently in the buffer */
+} H5C_log_binary_udata_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/* Internal record handling calls */
+static herr_t H5C__binary_flush_records(H5C_log_binary_udata_t *binary_udata);
+static herr_t H5C__binary_add_record(H5C_log_binary_udata_t *binary_udata, H5C_log_binary_action_t action,
+                                     haddr_t addr, uint64_t aux, int type_id, unsigned flags,
+                                     herr_t fxn_ret_value);
+
+/* Log message callbacks */
+static herr_t H5C__binary_tear_down_logging(H5C_log_info_t *log_info);
+static herr_t H5C__binary_stop_logging(H5C_log_info_t *log_info);
+static herr_t H5C__binary_write_start_log_msg(void *udata);
+static herr_t H5C__binary_write_stop_log_msg(void *udata);
+static herr_t H5C__binary_write_create_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_destroy_cache_log_msg(void *udata);
+static herr_t H5C__binary_write_evict_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_expunge_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                      herr_t fxn_ret_value);
+static herr_t H5C__binary_write_flush_cache_log_msg(void *udata, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_insert_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                     unsigned flags, size_t size, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_entry_dirty_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_entry_clean_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_unserialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                                herr_t fxn_ret_value);
+static herr_t H5C__binary_write_mark_serialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                              herr_t fxn_ret_value);
+static herr_t H5C__binary_write_move_entry_log_msg(void *udata, haddr_t old_addr, haddr_t new_addr,
+                                                   int type_id, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_pin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                  herr_t fxn_ret_value);
+static herr_t H5C__binary_write_create_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                                  const H5C_cache_entry_t *child, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_protect_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                      int type_id, unsigned flags, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_resize_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                     size_t new_size, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_unpin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                    herr_t fxn_ret_value);
+static herr_t H5C__binary_write_destroy_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                                   const H5C_cache_entry_t *child, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_unprotect_entry_log_msg(void *udata, haddr_t address, int type_id,
+                                                        unsigned flags, herr_t fxn_ret_value);
+static herr_t H5C__binary_write_set_cache_config_log_msg(void *udata, const H5AC_cache_config_t *config,
+                                                         herr_t fxn_ret_value);
+static herr_t H5C__binary_write_remove_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                     herr_t fxn_ret_value);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Note that there's no cache set up call since that's the
+ * place where this struct is wired into the cache.
+ */
+static const H5C_log_class_t H5C_binary_log_class_g = {"binary",
+                                                       H5C__binary_tear_down_logging,
+                                                       NULL, /* start logging */
+                                                       H5C__binary_stop_logging,
+                                                       H5C__binary_write_start_log_msg,
+                                                       H5C__binary_write_stop_log_msg,
+                                                       H5C__binary_write_create_cache_log_msg,
+                                                       H5C__binary_write_destroy_cache_log_msg,
+                                                       H5C__binary_write_evict_cache_log_msg,
+                                                       H5C__binary_write_expunge_entry_log_msg,
+                                                       H5C__binary_write_flush_cache_log_msg,
+                                                       H5C__binary_write_insert_entry_log_msg,
+                                                       H5C__binary_write_mark_entry_dirty_log_msg,
+                                                       H5C__binary_write_mark_entry_clean_log_msg,
+                                                       H5C__binary_write_mark_unserialized_entry_log_msg,
+                                                       H5C__binary_write_mark_serialized_entry_log_msg,
+                                                       H5C__binary_write_move_entry_log_msg,
+                                                       H5C__binary_write_pin_entry_log_msg,
+                                                       H5C__binary_write_create_fd_log_msg,
+                                                       H5C__binary_write_protect_entry_log_msg,
+                                                       H5C__binary_write_resize_entry_log_msg,
+                                                       H5C__binary_write_unpin_entry_log_msg,
+                                                       H5C__binary_write_destroy_fd_log_msg,
+                                                       H5C__binary_write_unprotect_entry_log_msg,
+                                                       H5C__binary_write_set_cache_config_log_msg,
+                                                       H5C__binary_write_remove_entry_log_msg};
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_flush_records
+ *
+ * Purpose:     Write all buffered records to the log file and empty the
+ *              record buffer.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_flush_records(H5C_log_binary_udata_t *binary_udata)
+{
+    const uint8_t *p;
+    size_t         nbytes;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(binary_udata);
+    assert(binary_udata->fd >= 0);
+    assert(binary_udata->buf);
+
+    p      = binary_udata->buf;
+    nbytes = binary_udata->nrecords * H5C_LOG_BINARY_RECORD_SIZE;
+    while (nbytes > 0) {
+        h5_posix_io_ret_t bytes_wrote;
+
+        do {
+            bytes_wrote = HDwrite(binary_udata->fd, p, (h5_posix_io_t)nbytes);
+        } while (-1 == bytes_wrote && EINTR == errno);
+        if (bytes_wrote <= 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "error writing log records");
+
+        p += bytes_wrote;
+        nbytes -= (size_t)bytes_wrote;
+    }
+
+done:
+    /* Drop the records even on failure so a bad log can't wedge the cache */
+    binary_udata->nrecords = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_flush_records() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_add_record
+ *
+ * Purpose:     Encode a record into the record buffer, writing the buffer
+ *              out when it fills.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_add_record(H5C_log_binary_udata_t *binary_udata, H5C_log_binary_action_t action, haddr_t addr,
+                       uint64_t aux, int type_id, unsigned flags, herr_t fxn_ret_value)
+{
+    uint8_t *p;
+    uint64_t now       = H5_now_usec();
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(binary_udata);
+    assert(binary_udata->buf);
+    assert(binary_udata->nrecords < H5C_BINARY_LOG_NRECORDS);
+
+    /* Encode the record */
+    p = binary_udata->buf + (binary_udata->nrecords * H5C_LOG_BINARY_RECORD_SIZE);
+    UINT64ENCODE(p, now);
+    UINT64ENCODE(p, (uint64_t)addr);
+    UINT64ENCODE(p, aux);
+    UINT32ENCODE(p, flags);
+    *p++ = (uint8_t)action;
+    *p++ = (uint8_t)((type_id < 0 || type_id >= H5C_LOG_BINARY_NO_TYPE) ? H5C_LOG_BINARY_NO_TYPE : type_id);
+    *p++ = (uint8_t)(fxn_ret_value < 0 ? 1 : 0);
+    *p++ = 0;
+
+    /* Write out the buffer when it's full */
+    if (++binary_udata->nrecords == H5C_BINARY_LOG_NRECORDS)
+        if (H5C__binary_flush_records(binary_udata) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_add_record() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__log_binary_set_up
+ *
+ * Purpose:     Setup for metadata cache logging.
+ *
+ *              Opens the log file, writes the file header and allocates
+ *              the record buffer.  See H5C__log_json_set_up() for a
+ *              description of how setup and start/stop interact.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__log_binary_set_up(H5C_log_info_t *log_info, const char log_location[], int mpi_rank)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    char                   *file_name    = NULL;
+    uint8_t                 header[H5C_LOG_BINARY_HEADER_SIZE];
+    uint8_t                *p;
+    size_t                  n_chars;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(log_info);
+    assert(log_location);
+
+    /* Set up the class struct */
+    log_info->cls = &H5C_binary_log_class_g;
+
+    /* Allocate memory for the binary-specific data */
+    if (NULL == (log_info->udata = H5MM_calloc(sizeof(H5C_log_binary_udata_t))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed");
+    binary_udata     = (H5C_log_binary_udata_t *)(log_info->udata);
+    binary_udata->fd = -1;
+
+    /* Allocate memory for the record buffer */
+    if (NULL == (binary_udata->buf = (uint8_t *)H5MM_malloc(H5C_BINARY_LOG_NRECORDS *
+                                                             H5C_LOG_BINARY_RECORD_SIZE)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed");
+
+    /* Possibly fix up the log file name.
+     * The extra 39 characters are for adding the rank to the file name
+     * under parallel HDF5. 39 characters allows > 2^127 processes which
+     * should be enough for anybody.
+     *
+     * allocation size = <path length> + dot + <rank # length> + \0
+     */
+    n_chars = HDstrlen(log_location) + 1 + 39 + 1;
+    if (NULL == (file_name = (char *)H5MM_calloc(n_chars * sizeof(char))))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL,
+                    "can't allocate memory for mdc log file name manipulation");
+
+    /* Add the rank to the log file name when MPI is in use */
+    if (-1 == mpi_rank)
+        HDsnprintf(file_name, n_chars, "%s", log_location);
+    else
+        HDsnprintf(file_name, n_chars, "%s.%d", log_location, mpi_rank);
+
+    /* Open log file */
+    if ((binary_udata->fd = HDopen(file_name, O_WRONLY | O_CREAT | O_TRUNC, H5_POSIX_CREATE_MODE_RW)) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "can't create mdc log file");
+
+    /* Write the header */
+    p = header;
+    H5MM_memcpy(p, H5C_LOG_BINARY_SIGNATURE, (size_t)H5C_LOG_BINARY_SIGNATURE_LEN);
+    p += H5C_LOG_BINARY_SIGNATURE_LEN;
+    UINT32ENCODE(p, H5C_LOG_BINARY_VERSION);
+    UINT32ENCODE(p, H5C_LOG_BINARY_RECORD_SIZE);
+    if (HDwrite(binary_udata->fd, header, (h5_posix_io_t)sizeof(header)) != (h5_posix_io_ret_t)sizeof(header))
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "can't write mdc log file header");
+
+done:
+    if (file_name)
+        H5MM_xfree(file_name);
+
+    /* Free and reset the log info struct on errors */
+    if (FAIL == ret_value) {
+        /* Free */
+        if (binary_udata) {
+            if (binary_udata->fd >= 0)
+                HDclose(binary_udata->fd);
+            H5MM_xfree(binary_udata->buf);
+            H5MM_xfree(binary_udata);
+        }
+
+        /* Reset */
+        log_info->udata = NULL;
+        log_info->cls   = NULL;
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__log_binary_set_up() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_tear_down_logging
+ *
+ * Purpose:     Tear-down for metadata cache logging.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_tear_down_logging(H5C_log_info_t *log_info)
+{
+    H5C_log_binary_udata_t *binary_udata = NULL;
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(log_info);
+
+    /* Alias */
+    binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+
+    /* Write out any remaining records */
+    if (binary_udata->nrecords > 0)
+        if (H5C__binary_flush_records(binary_udata) < 0)
+            HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records");
+
+    /* Close log file */
+    if (HDclose(binary_udata->fd) < 0)
+        HDONE_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "problem closing mdc log file");
+    binary_udata->fd = -1;
+
+    /* Free the record buffer and the udata */
+    H5MM_xfree(binary_udata->buf);
+    H5MM_xfree(binary_udata);
+
+    /* Reset the log class info and udata */
+    log_info->cls   = NULL;
+    log_info->udata = NULL;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_tear_down_logging() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_stop_logging
+ *
+ * Purpose:     Write out buffered records when logging is paused, so the
+ *              log is complete up to that point.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_stop_logging(H5C_log_info_t *log_info)
+{
+    H5C_log_binary_udata_t *binary_udata = (H5C_log_binary_udata_t *)(log_info->udata);
+    herr_t                  ret_value    = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(binary_udata);
+
+    if (binary_udata->nrecords > 0)
+        if (H5C__binary_flush_records(binary_udata) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to write log records");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_stop_logging() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_start_log_msg
+ *
+ * Purpose:     Write a log record when logging starts.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_start_log_msg(void *udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_START, HADDR_UNDEF, 0, -1, 0,
+                               SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_start_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_stop_log_msg
+ *
+ * Purpose:     Write a log record when logging ends.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_stop_log_msg(void *udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_STOP, HADDR_UNDEF, 0, -1, 0,
+                               SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_stop_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_create_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache creation.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_create_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_CREATE_CACHE, HADDR_UNDEF, 0,
+                               -1, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_create_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_destroy_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache destruction.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_destroy_cache_log_msg(void *udata)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_DESTROY_CACHE, HADDR_UNDEF,
+                               0, -1, 0, SUCCEED) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_destroy_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_evict_cache_log_msg
+ *
+ * Purpose:     Write a log record for eviction of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_evict_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_EVICT_CACHE, HADDR_UNDEF, 0,
+                               -1, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_evict_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_expunge_entry_log_msg
+ *
+ * Purpose:     Write a log record for expunge of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_expunge_entry_log_msg(void *udata, haddr_t address, int type_id, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_EXPUNGE, address, 0, type_id,
+                               0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_expunge_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_flush_cache_log_msg
+ *
+ * Purpose:     Write a log record for cache flushes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_flush_cache_log_msg(void *udata, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_FLUSH_CACHE, HADDR_UNDEF, 0,
+                               -1, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_flush_cache_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_insert_entry_log_msg
+ *
+ * Purpose:     Write a log record for insertion of cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_insert_entry_log_msg(void *udata, haddr_t address, int type_id, unsigned flags, size_t size,
+                                       herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_INSERT, address,
+                               (uint64_t)size, type_id, flags, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_insert_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_entry_dirty_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as dirty.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_entry_dirty_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(entry);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_DIRTY, entry->addr,
+                               (uint64_t)entry->size, entry->type->id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_entry_dirty_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_entry_clean_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as clean.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_entry_clean_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(entry);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_CLEAN, entry->addr,
+                               (uint64_t)entry->size, entry->type->id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_entry_clean_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_unserialized_entry_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as unserialized.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_unserialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                  herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(entry);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_UNSERIALIZED, entry->addr,
+                               (uint64_t)entry->size, entry->type->id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_unserialized_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_mark_serialized_entry_log_msg
+ *
+ * Purpose:     Write a log record for marking cache entries as serialized.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_mark_serialized_entry_log_msg(void *udata, const H5C_cache_entry_t *entry,
+                                                herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(entry);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_SERIALIZED, entry->addr,
+                               (uint64_t)entry->size, entry->type->id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_mark_serialized_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_move_entry_log_msg
+ *
+ * Purpose:     Write a log record for moving a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_move_entry_log_msg(void *udata, haddr_t old_addr, haddr_t new_addr, int type_id,
+                                     herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_MOVE, old_addr,
+                               (uint64_t)new_addr, type_id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_move_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_pin_entry_log_msg
+ *
+ * Purpose:     Write a log record for pinning a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_pin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(entry);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_PIN, entry->addr,
+                               (uint64_t)entry->size, entry->type->id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_pin_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_create_fd_log_msg
+ *
+ * Purpose:     Write a log record for creating a flush dependency between
+ *              two cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_create_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                    const H5C_cache_entry_t *child, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(parent);
+    assert(child);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_CREATE_FD, parent->addr,
+                               (uint64_t)child->addr, -1, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_create_fd_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_protect_entry_log_msg
+ *
+ * Purpose:     Write a log record for protecting a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_protect_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, int type_id,
+                                        unsigned flags, herr_t fxn_ret_value)
+{
+    haddr_t  addr      = HADDR_UNDEF;
+    uint64_t size      = 0;
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* The entry is NULL when the protect call failed */
+    if (entry) {
+        addr = entry->addr;
+        size = (uint64_t)entry->size;
+    }
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_PROTECT, addr, size, type_id,
+                               flags, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_protect_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_resize_entry_log_msg
+ *
+ * Purpose:     Write a log record for resizing a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_resize_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, size_t new_size,
+                                       herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(entry);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_RESIZE, entry->addr,
+                               (uint64_t)new_size, entry->type->id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_resize_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_unpin_entry_log_msg
+ *
+ * Purpose:     Write a log record for unpinning a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_unpin_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(entry);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_UNPIN, entry->addr,
+                               (uint64_t)entry->size, entry->type->id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_unpin_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_destroy_fd_log_msg
+ *
+ * Purpose:     Write a log record for destroying a flush dependency
+ *              between two cache entries.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_destroy_fd_log_msg(void *udata, const H5C_cache_entry_t *parent,
+                                     const H5C_cache_entry_t *child, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(parent);
+    assert(child);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_DESTROY_FD, parent->addr,
+                               (uint64_t)child->addr, -1, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_destroy_fd_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_unprotect_entry_log_msg
+ *
+ * Purpose:     Write a log record for unprotecting a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_unprotect_entry_log_msg(void *udata, haddr_t address, int type_id, unsigned flags,
+                                          herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_UNPROTECT, address, 0,
+                               type_id, flags, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_unprotect_entry_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_set_cache_config_log_msg
+ *
+ * Purpose:     Write a log record for setting the cache configuration.
+ *              Only the maximum cache size is recorded.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_set_cache_config_log_msg(void *udata, const H5AC_cache_config_t *config,
+                                           herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(config);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_SET_CONFIG, HADDR_UNDEF,
+                               (uint64_t)config->max_size, -1, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_set_cache_config_log_msg() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__binary_write_remove_entry_log_msg
+ *
+ * Purpose:     Write a log record for removing a cache entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__binary_write_remove_entry_log_msg(void *udata, const H5C_cache_entry_t *entry, herr_t fxn_ret_value)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(entry);
+
+    if (H5C__binary_add_record((H5C_log_binary_udata_t *)udata, H5C_LOG_BINARY_REMOVE, entry->addr,
+                               (uint64_t)entry->size, entry->type->id, 0, fxn_ret_value) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_LOGGING, FAIL, "unable to emit log record");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__binary_write_remove_entry_log_msg() */
@@ -0,0 +1,481 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Cmrc.c
+ *
+ * Purpose:     Online estimation of the metadata cache miss ratio curve,
+ *              used by the H5C_incr__mrc automatic resize mode.
+ *
+ *              The estimate follows the SHARDS approach: only accesses to
+ *              addresses whose hash falls below a threshold are tracked,
+ *              and the reuse distances observed in the resulting ghost
+ *              LRU list are scaled up by the inverse of the sampling rate.
+ *              This keeps the ghost list small enough to walk, while still
+ *              giving a usable picture of how the miss ratio would change
+ *              at every cache size between zero and max_size.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Cmodule.h" /* This source code file is part of the H5C module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                    */
+#include "H5Cpkg.h"      /* Cache                                */
+#include "H5Eprivate.h"  /* Error handling                       */
+#include "H5FLprivate.h" /* Free Lists                           */
+#include "H5MMprivate.h" /* Memory management                    */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/********************/
+/* Local Prototypes */
+/********************/
+static uint64_t H5C__mrc_hash(haddr_t addr);
+static void     H5C__mrc_remove_node(H5C_mrc_t *mrc, H5C_mrc_node_t *node);
+static void     H5C__mrc_halve_rate(H5C_mrc_t *mrc);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare free lists to manage the miss ratio curve state and ghost nodes */
+H5FL_DEFINE_STATIC(H5C_mrc_t);
+H5FL_DEFINE_STATIC(H5C_mrc_node_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_hash
+ *
+ * Purpose:     Mix the bits of an address so that the sampling decision
+ *              is independent of the address layout of the file.  This is
+ *              the splitmix64 finalizer.
+ *
+ * Return:      The hash of addr
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5C__mrc_hash(haddr_t addr)
+{
+    uint64_t x = (uint64_t)addr;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+
+    FUNC_LEAVE_NOAPI(x)
+} /* H5C__mrc_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_remove_node
+ *
+ * Purpose:     Unlink a node from the ghost list and the index, and free it.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__mrc_remove_node(H5C_mrc_t *mrc, H5C_mrc_node_t *node)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(mrc);
+    assert(node);
+    assert(mrc->nnodes > 0);
+    assert(mrc->ghost_size >= node->size);
+
+    if (node->prev)
+        node->prev->next = node->next;
+    else
+        mrc->head = node->next;
+    if (node->next)
+        node->next->prev = node->prev;
+    else
+        mrc->tail = node->prev;
+
+    HASH_DELETE(hh, mrc->index, node);
+
+    mrc->nnodes--;
+    mrc->ghost_size -= node->size;
+
+    node = H5FL_FREE(H5C_mrc_node_t, node);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__mrc_remove_node() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_halve_rate
+ *
+ * Purpose:     Halve the sampling threshold, and drop the ghost list nodes
+ *              whose addresses are no longer sampled.  Since the sampling
+ *              hash is uniform, this removes about half the nodes.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5C__mrc_halve_rate(H5C_mrc_t *mrc)
+{
+    H5C_mrc_node_t *node;
+    H5C_mrc_node_t *next;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(mrc);
+
+    mrc->threshold /= 2;
+    mrc->rate /= 2.0;
+
+    for (node = mrc->head; node != NULL; node = next) {
+        next = node->next;
+        if (node->hash >= mrc->threshold)
+            H5C__mrc_remove_node(mrc, node);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__mrc_halve_rate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_create
+ *
+ * Purpose:     Allocate and initialize the miss ratio curve state for the
+ *              current automatic resize configuration.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_create(H5C_t *cache_ptr)
+{
+    H5C_mrc_t *mrc       = NULL;
+    herr_t     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(cache_ptr);
+    assert(cache_ptr->mrc == NULL);
+    assert(cache_ptr->resize_ctl.incr_mode == H5C_incr__mrc);
+    assert(cache_ptr->resize_ctl.mrc_sample_rate > 0.0);
+    assert(cache_ptr->resize_ctl.mrc_sample_rate <= 1.0);
+
+    if (NULL == (mrc = H5FL_CALLOC(H5C_mrc_t)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't allocate miss ratio curve state");
+
+    mrc->rate = cache_ptr->resize_ctl.mrc_sample_rate;
+    if (mrc->rate >= 1.0)
+        mrc->threshold = UINT64_MAX;
+    else
+        mrc->threshold = (uint64_t)(mrc->rate * 18446744073709551616.0); /* 2^64 */
+    mrc->bucket_width =
+        (cache_ptr->resize_ctl.max_size + H5C__MRC_NUM_BUCKETS - 1) / H5C__MRC_NUM_BUCKETS;
+    mrc->index = NULL;
+    mrc->head  = NULL;
+    mrc->tail  = NULL;
+
+    cache_ptr->mrc = mrc;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__mrc_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_dest
+ *
+ * Purpose:     Free the ghost list and the miss ratio curve state.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_dest(H5C_t *cache_ptr)
+{
+    H5C_mrc_t *mrc;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(cache_ptr);
+    assert(cache_ptr->mrc);
+
+    mrc = cache_ptr->mrc;
+    while (mrc->head)
+        H5C__mrc_remove_node(mrc, mrc->head);
+    assert(mrc->index == NULL);
+    assert(mrc->nnodes == 0);
+
+    cache_ptr->mrc = H5FL_FREE(H5C_mrc_t, mrc);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__mrc_dest() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_record_access
+ *
+ * Purpose:     Record an access to the entry at addr in the miss ratio
+ *              curve estimate, if addr is sampled.
+ *
+ *              The stack distance of the access is the number of bytes
+ *              of distinct entries accessed since the previous access to
+ *              addr, including the entry itself -- a cache of at least
+ *              that size would have hit.  It is computed on the sampled
+ *              ghost list and scaled by the inverse of the sampling rate.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_record_access(H5C_t *cache_ptr, haddr_t addr, size_t size)
+{
+    H5C_mrc_t      *mrc;
+    H5C_mrc_node_t *node = NULL;
+    uint64_t        hash;
+    double          weight;
+    size_t          limit;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(cache_ptr);
+    assert(cache_ptr->mrc);
+
+    mrc  = cache_ptr->mrc;
+    hash = H5C__mrc_hash(addr);
+    if (hash >= mrc->threshold)
+        HGOTO_DONE(SUCCEED);
+
+    weight = 1.0 / mrc->rate;
+
+    /* The ghost list need only cover max_size bytes of (unsampled) cache --
+     * reuses at greater distances land in the 'beyond' count regardless.
+     */
+    limit = (size_t)((double)cache_ptr->resize_ctl.max_size * mrc->rate);
+
+    HASH_FIND(hh, mrc->index, &addr, sizeof(haddr_t), node);
+    if (node) {
+        H5C_mrc_node_t *curr;
+        size_t          dist = size;
+
+        for (curr = mrc->head; curr != node && dist <= limit; curr = curr->next)
+            dist += curr->size;
+
+        if (dist <= limit) {
+            size_t scaled = (size_t)((double)dist / mrc->rate);
+            size_t bucket = (scaled > 0 ? scaled - 1 : 0) / mrc->bucket_width;
+
+            if (bucket >= H5C__MRC_NUM_BUCKETS)
+                bucket = H5C__MRC_NUM_BUCKETS - 1;
+            mrc->hist[bucket] += weight;
+        } /* end if */
+        else
+            mrc->beyond += weight;
+
+        /* Move the node to the head of the ghost list */
+        if (node != mrc->head) {
+            node->prev->next = node->next;
+            if (node->next)
+                node->next->prev = node->prev;
+            else
+                mrc->tail = node->prev;
+            node->prev       = NULL;
+            node->next       = mrc->head;
+            mrc->head->prev  = node;
+            mrc->head        = node;
+        } /* end if */
+
+        mrc->ghost_size -= node->size;
+        mrc->ghost_size += size;
+        node->size = size;
+    } /* end if */
+    else {
+        /* First reference (or too long since the last one) */
+        mrc->beyond += weight;
+
+        if (NULL == (node = H5FL_MALLOC(H5C_mrc_node_t)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't allocate ghost list node");
+        node->addr = addr;
+        node->size = size;
+        node->hash = hash;
+        node->prev = NULL;
+        node->next = mrc->head;
+        if (mrc->head)
+            mrc->head->prev = node;
+        else
+            mrc->tail = node;
+        mrc->head = node;
+        HASH_ADD(hh, mrc->index, addr, sizeof(haddr_t), node);
+
+        mrc->nnodes++;
+        mrc->ghost_size += size;
+    } /* end else */
+
+    mrc->total += weight;
+    mrc->nsamples += 1.0;
+
+    /* Trim nodes that are too far down the ghost list to ever count as hits */
+    while (mrc->ghost_size > limit && mrc->tail != mrc->head)
+        H5C__mrc_remove_node(mrc, mrc->tail);
+
+    /* Keep the cost of the ghost list walk bounded by sampling less */
+    if (mrc->nnodes > H5C__MRC_MAX_NODES)
+        H5C__mrc_halve_rate(mrc);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__mrc_record_access() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__mrc_end_epoch
+ *
+ * Purpose:     Compute the cache size at the knee of the estimated miss
+ *              ratio curve, and then age the estimate so that it tracks
+ *              changes in the workload.
+ *
+ *              The knee is taken to be the smallest size in
+ *              [min_size, max_size] whose estimated miss ratio is no more
+ *              than mrc_knee_threshold above the estimated miss ratio at
+ *              max_size.
+ *
+ *              If too few references have been sampled for the estimate
+ *              to be meaningful, *target_size_ptr is set to zero.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__mrc_end_epoch(H5C_t *cache_ptr, size_t *target_size_ptr)
+{
+    H5C_mrc_t *mrc;
+    size_t     target_size = 0;
+    int        i;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(cache_ptr);
+    assert(cache_ptr->mrc);
+    assert(target_size_ptr);
+
+    mrc = cache_ptr->mrc;
+
+    if (mrc->nsamples >= H5C__MRC_MIN_SAMPLES && mrc->total > 0.0) {
+        double max_size_mr = mrc->beyond / mrc->total;
+        double hits        = 0.0;
+
+        target_size = cache_ptr->resize_ctl.max_size;
+        for (i = 0; i < H5C__MRC_NUM_BUCKETS; i++) {
+            size_t bucket_size = (size_t)(i + 1) * mrc->bucket_width;
+
+            hits += mrc->hist[i];
+            if (bucket_size < cache_ptr->resize_ctl.min_size)
+                continue;
+            if ((1.0 - hits / mrc->total) <= max_size_mr + cache_ptr->resize_ctl.mrc_knee_threshold) {
+                target_size = MIN(bucket_size, cache_ptr->resize_ctl.max_size);
+                break;
+            } /* end if */
+        }     /* end for */
+    }         /* end if */
+
+    /* Age the estimate */
+    for (i = 0; i < H5C__MRC_NUM_BUCKETS; i++)
+        mrc->hist[i] /= 2.0;
+    mrc->beyond /= 2.0;
+    mrc->total /= 2.0;
+    mrc->nsamples /= 2.0;
+
+    *target_size_ptr = target_size;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__mrc_end_epoch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_cache_mrc
+ *
+ * Purpose:     Return the current estimate of the miss ratio curve.
+ *
+ *              On entry, *npoints is the number of elements in the
+ *              cache_sizes and miss_ratios arrays.  Up to that many
+ *              points of the curve are returned, in increasing order of
+ *              cache size, and *npoints is set to the number of points
+ *              available.  Either array may be NULL.
+ *
+ *              If the cache isn't in the H5C_incr__mrc resize mode, or
+ *              no references have been sampled yet, *npoints is set to
+ *              zero.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_get_cache_mrc(const H5C_t *cache_ptr, size_t *npoints, size_t cache_sizes[], double miss_ratios[])
+{
+    const H5C_mrc_t *mrc;
+    double           hits = 0.0;
+    size_t           u;
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if (cache_ptr == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.");
+    if (npoints == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad npoints on entry.");
+
+    mrc = cache_ptr->mrc;
+    if (mrc == NULL || mrc->total <= 0.0) {
+        *npoints = 0;
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
+
+    for (u = 0; u < H5C__MRC_NUM_BUCKETS && u < *npoints; u++) {
+        hits += mrc->hist[u];
+        if (cache_sizes)
+            cache_sizes[u] = MIN((u + 1) * mrc->bucket_width, cache_ptr->resize_ctl.max_size);
+        if (miss_ratios)
+            miss_ratios[u] = MAX(0.0, 1.0 - hits / mrc->total);
+    } /* end for */
+
+    *npoints = H5C__MRC_NUM_BUCKETS;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_get_cache_mrc() */
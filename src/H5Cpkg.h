@@ -1917,6 +1917,98 @@ typedef struct H5C_tag_info_t {
     UT_hash_handle hh;          /* Hash table handle (must be LAST) */
 } H5C_tag_info_t;
 
+/****************************************************************************
+ *
+ * structure H5C_mrc_node_t
+ *
+ * Ghost list node used to estimate the miss ratio curve.  There is one of
+ * these for each sampled address recently accessed in the cache, whether
+ * or not the corresponding entry is still resident.
+ *
+ * addr:        Address of the entry.
+ *
+ * size:        Size of the entry the last time it was accessed.
+ *
+ * hash:        Sampling hash of addr.  The node is only kept while this is
+ *              below the current sampling threshold.
+ *
+ * next / prev: Links in the ghost LRU list.
+ *
+ * hh:          uthash hash table handle (must be last)
+ *
+ ****************************************************************************/
+typedef struct H5C_mrc_node_t {
+    haddr_t addr;                   /* Address of the entry (must be first) */
+    size_t size;                    /* Size of the entry */
+    uint64_t hash;                  /* Sampling hash of the address */
+    struct H5C_mrc_node_t *next;    /* Next (less recently used) node */
+    struct H5C_mrc_node_t *prev;    /* Previous (more recently used) node */
+
+    /* Hash table fields */
+    UT_hash_handle hh;              /* Hash table handle (must be LAST) */
+} H5C_mrc_node_t;
+
+/****************************************************************************
+ *
+ * structure H5C_mrc_t
+ *
+ * State of the online miss ratio curve estimate used by the H5C_incr__mrc
+ * automatic resize mode.
+ *
+ * Addresses are sampled spatially as in SHARDS: an access is tracked iff
+ * a hash of its address falls below threshold.  Each tracked access finds
+ * its reuse (stack) distance in bytes by walking the ghost LRU list, scales
+ * it by the inverse of the sampling rate, and adds its (likewise scaled)
+ * weight to the bucket of the histogram covering that distance.  If the
+ * ghost list outgrows H5C__MRC_MAX_NODES, the threshold is halved and the
+ * nodes no longer covered by it are dropped.
+ *
+ * threshold:   Addresses whose hash is below this value are sampled.
+ *
+ * rate:        Current sampling rate, i.e. threshold / 2^64.
+ *
+ * bucket_width: Width in bytes of each histogram bucket.  Bucket i counts
+ *              references with stack distance in (i * bucket_width,
+ *              (i + 1) * bucket_width].
+ *
+ * hist:        Weighted reference counts per bucket.
+ *
+ * beyond:      Weighted count of references whose stack distance exceeds
+ *              the maximum cache size, including first references.
+ *
+ * total:       Sum of hist[] and beyond.
+ *
+ * nsamples:    Number of (unweighted) sampled references behind the current
+ *              estimate.  Aged along with the histogram.
+ *
+ * index:       uthash table of the ghost list nodes, keyed on address.
+ *
+ * head / tail: Most / least recently used nodes of the ghost list.
+ *
+ * nnodes:      Number of nodes on the ghost list.
+ *
+ * ghost_size:  Sum of the sizes of the nodes on the ghost list.
+ *
+ ****************************************************************************/
+#define H5C__MRC_NUM_BUCKETS 64
+#define H5C__MRC_MAX_NODES   8192
+#define H5C__MRC_MIN_SAMPLES 64.0
+
+typedef struct H5C_mrc_t {
+    uint64_t threshold;
+    double rate;
+    size_t bucket_width;
+    double hist[H5C__MRC_NUM_BUCKETS];
+    double beyond;
+    double total;
+    double nsamples;
+    H5C_mrc_node_t *index;
+    H5C_mrc_node_t *head;
+    H5C_mrc_node_t *tail;
+    size_t nnodes;
+    size_t ghost_size;
+} H5C_mrc_t;
+
 
 /****************************************************************************
  *
@@ -2570,6 +2662,11 @@ typedef struct H5C_tag_info_t {
  *        were reset.  Note that when automatic cache re-sizing is enabled,
  *        this field will be reset every automatic resize epoch.
  *
+ * mrc: Pointer to the state of the sampled miss ratio curve estimate, or
+ *        NULL if the H5C_incr__mrc automatic resize mode is not in use.
+ *        Unlike the hit rate stats, the estimate is not reset at the end
+ *        of each epoch -- its history is aged by half instead.
+ *
  *
  * Metadata cache image management related fields.
  *
@@ -3117,6 +3214,7 @@ struct H5C_t {
     /* Fields for cache hit rate collection */
     int64_t             cache_hits;
     int64_t             cache_accesses;
+    H5C_mrc_t *         mrc;
 
     /* fields supporting generation of a cache image on file close */
     H5C_cache_image_ctl_t image_ctl;
@@ -3251,6 +3349,10 @@ H5_DLL herr_t H5C__prep_image_for_file_close(H5F_t *f, hbool_t *image_generated)
 H5_DLL herr_t H5C__auto_adjust_cache_size(H5F_t *f, hbool_t write_permitted);
 H5_DLL herr_t H5C__autoadjust__ageout__remove_all_markers(H5C_t *cache_ptr);
 H5_DLL herr_t H5C__autoadjust__ageout__remove_excess_markers(H5C_t *cache_ptr);
+H5_DLL herr_t H5C__mrc_create(H5C_t *cache_ptr);
+H5_DLL herr_t H5C__mrc_dest(H5C_t *cache_ptr);
+H5_DLL herr_t H5C__mrc_record_access(H5C_t *cache_ptr, haddr_t addr, size_t size);
+H5_DLL herr_t H5C__mrc_end_epoch(H5C_t *cache_ptr, size_t *target_size_ptr);
 H5_DLL herr_t H5C__flash_increase_cache_size(H5C_t *cache_ptr, size_t old_entry_size, size_t new_entry_size);
 H5_DLL herr_t H5C__flush_invalidate_cache(H5F_t *f, unsigned flags);
 H5_DLL herr_t H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags);
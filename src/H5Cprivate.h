@@ -123,6 +123,8 @@
 #define H5C__MIN_AR_EPOCH_LENGTH     100
 #define H5C__DEF_AR_EPOCH_LENGTH     50000
 #define H5C__MAX_AR_EPOCH_LENGTH     1000000
+#define H5C__DEF_AR_MRC_SAMPLE_RATE    0.1
+#define H5C__DEF_AR_MRC_KNEE_THRESHOLD 0.01
 
 /* #defines of flags used in the flags parameters in some of the
  * following function calls.  Note that not all flags are applicable
@@ -2016,6 +2018,23 @@ typedef struct H5C_image_entry_t {
  *    The value of this field must be in the range [0.0, 1.0].  I would
  *    expect typical values to be in the range of 0.01 to 0.1.
  *
+ *
+ * Miss ratio curve control fields:
+ *
+ * These fields are only used when incr_mode is H5C_incr__mrc.  In this
+ * mode the cache keeps a ghost LRU list of a hash-sampled subset of the
+ * entry addresses it sees (the SHARDS technique), and from the stack
+ * distances observed in that list builds a histogram that approximates
+ * the miss ratio curve of the workload.  At the end of each epoch, the
+ * maximum cache size is set to the knee of that curve.
+ *
+ * mrc_sample_rate: Fraction of addresses tracked in the ghost list.  Must
+ *    lie in the interval (0.0, 1.0].
+ *
+ * mrc_knee_threshold: The cache is sized to the smallest size whose
+ *    estimated miss ratio is no more than this amount above the estimated
+ *    miss ratio at max_size.  Must lie in the interval [0.0, 1.0].
+ *
  ****************************************************************************/
 
 enum H5C_resize_status {
@@ -2065,6 +2084,10 @@ typedef struct H5C_auto_size_ctl_t {
     int32_t                  epochs_before_eviction;
     hbool_t                  apply_empty_reserve;
     double                   empty_reserve;
+
+    /* miss ratio curve control fields: */
+    double mrc_sample_rate;
+    double mrc_knee_threshold;
 } H5C_auto_size_ctl_t;
 
 /****************************************************************************
@@ -2154,7 +2177,63 @@ typedef struct H5C_cache_image_ctl_t {
 } H5C_cache_image_ctl_t;
 
 /* The cache logging output style */
-typedef enum H5C_log_style_t { H5C_LOG_STYLE_JSON, H5C_LOG_STYLE_TRACE } H5C_log_style_t;
+typedef enum H5C_log_style_t {
+    H5C_LOG_STYLE_JSON,
+    H5C_LOG_STYLE_TRACE,
+    H5C_LOG_STYLE_BINARY
+} H5C_log_style_t;
+
+/* Binary cache log file layout
+ *
+ * The binary log starts with a fixed header (signature, version, record
+ * size) followed by fixed-size records.  All multi-byte fields are encoded
+ * little-endian.  Record layout:
+ *
+ *      0   uint64  timestamp (microseconds)
+ *      8   uint64  address (old address for moves, parent for flush deps)
+ *     16   uint64  auxiliary value (entry size, new size, new address,
+ *                  child address or max cache size, depending on action)
+ *     24   uint32  flags
+ *     28   uint8   action (H5C_log_binary_action_t)
+ *     29   uint8   type id (H5C_LOG_BINARY_NO_TYPE if not applicable)
+ *     30   uint8   return value (0 = SUCCEED, 1 = FAIL)
+ *     31   uint8   reserved
+ *
+ * These are shared with the offline analysis tool (h5mdclog), so changes
+ * here must bump H5C_LOG_BINARY_VERSION.
+ */
+#define H5C_LOG_BINARY_SIGNATURE      "\211H5CLOG\n"
+#define H5C_LOG_BINARY_SIGNATURE_LEN  8
+#define H5C_LOG_BINARY_VERSION        1
+#define H5C_LOG_BINARY_HEADER_SIZE    (H5C_LOG_BINARY_SIGNATURE_LEN + 4 + 4)
+#define H5C_LOG_BINARY_RECORD_SIZE    32
+#define H5C_LOG_BINARY_NO_TYPE        0xFF
+
+typedef enum H5C_log_binary_action_t {
+    H5C_LOG_BINARY_START = 0,
+    H5C_LOG_BINARY_STOP,
+    H5C_LOG_BINARY_CREATE_CACHE,
+    H5C_LOG_BINARY_DESTROY_CACHE,
+    H5C_LOG_BINARY_EVICT_CACHE,
+    H5C_LOG_BINARY_EXPUNGE,
+    H5C_LOG_BINARY_FLUSH_CACHE,
+    H5C_LOG_BINARY_INSERT,
+    H5C_LOG_BINARY_DIRTY,
+    H5C_LOG_BINARY_CLEAN,
+    H5C_LOG_BINARY_UNSERIALIZED,
+    H5C_LOG_BINARY_SERIALIZED,
+    H5C_LOG_BINARY_MOVE,
+    H5C_LOG_BINARY_PIN,
+    H5C_LOG_BINARY_CREATE_FD,
+    H5C_LOG_BINARY_PROTECT,
+    H5C_LOG_BINARY_RESIZE,
+    H5C_LOG_BINARY_UNPIN,
+    H5C_LOG_BINARY_DESTROY_FD,
+    H5C_LOG_BINARY_UNPROTECT,
+    H5C_LOG_BINARY_SET_CONFIG,
+    H5C_LOG_BINARY_REMOVE,
+    H5C_LOG_BINARY_NUM_ACTIONS /* Must be last */
+} H5C_log_binary_action_t;
 
 /***************************************/
 /* Library-private Function Prototypes */
@@ -2185,6 +2264,8 @@ H5_DLL herr_t H5C_get_cache_size(const H5C_t *cache_ptr, size_t *max_size_ptr, s
                                  size_t *cur_size_ptr, uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5C_get_cache_flush_in_progress(const H5C_t *cache_ptr, hbool_t *flush_in_progress_ptr);
 H5_DLL herr_t H5C_get_cache_hit_rate(const H5C_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL herr_t H5C_get_cache_mrc(const H5C_t *cache_ptr, size_t *npoints, size_t cache_sizes[],
+                                double miss_ratios[]);
 H5_DLL herr_t H5C_get_entry_status(const H5F_t *f, haddr_t addr, size_t *size_ptr, hbool_t *in_cache_ptr,
                                    hbool_t *is_dirty_ptr, hbool_t *is_protected_ptr, hbool_t *is_pinned_ptr,
                                    hbool_t *is_corked_ptr, hbool_t *is_flush_dep_parent_ptr,
@@ -27,8 +27,12 @@ enum H5C_cache_incr_mode {
     H5C_incr__off,
     /**<Automatic cache size increase is disabled, and the remaining increment fields are ignored.*/
 
-    H5C_incr__threshold
+    H5C_incr__threshold,
     /**<Automatic cache size increase is enabled using the hit rate threshold algorithm.*/
+
+    H5C_incr__mrc
+    /**<Automatic cache size increase and decrease are both driven by a sampled
+     * miss ratio curve, and the cache is sized to the knee of that curve.*/
 };
 
 enum H5C_cache_flash_incr_mode {
@@ -0,0 +1,255 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Arena for the temporary objects of a dataset I/O operation.
+ *
+ *          H5D__read() and H5D__write() set up an arena for each operation,
+ *          which the piece info structs and selection iterators of the
+ *          operation are allocated from.  Allocating from the arena bumps
+ *          a pointer in its current block.  Freeing the object allocated
+ *          last moves the pointer back, so temporaries freed in reverse
+ *          order of allocation (e.g. the iterators for each chunk) reuse
+ *          the same memory.  Other objects stay until the arena is reset
+ *          at the end of the operation, which releases all the blocks.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Dmodule.h" /* This source code file is part of the H5D module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5Dpkg.h"      /* Datasets				*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5FLprivate.h" /* Free Lists                           */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Size of the arena blocks, unless an object needs a larger one */
+#define H5D_ARENA_BLOCK_SIZE (8 * 1024)
+
+/* Alignment of the objects in the arena (the alignment of free list blocks) */
+#define H5D_ARENA_ALIGNMENT 8
+#define H5D_ARENA_ALIGN(s)  (((s) + (H5D_ARENA_ALIGNMENT - 1)) & ~((size_t)H5D_ARENA_ALIGNMENT - 1))
+
+/* Offset of the objects in a block, from its header */
+#define H5D_ARENA_BLOCK_HDR_SIZE H5D_ARENA_ALIGN(sizeof(H5D_arena_block_t))
+
+/* Start of the objects in a block */
+#define H5D_ARENA_BLOCK_DATA(b) ((uint8_t *)(b) + H5D_ARENA_BLOCK_HDR_SIZE)
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Header of a block of an arena */
+struct H5D_arena_block_t {
+    struct H5D_arena_block_t *next; /* Next block */
+    struct H5D_arena_block_t *prev; /* Previous block */
+    size_t                    size; /* Bytes for objects in the block */
+    size_t                    used; /* Bytes used by objects in the block */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* Totals for all the arenas that have been reset */
+H5D_arena_stats_t H5D_arena_stats_g = {0, 0};
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the arena blocks */
+H5FL_BLK_DEFINE_STATIC(io_arena_blk);
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__arena_init
+ *
+ * Purpose:	Initialize an empty arena
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D__arena_init(H5D_arena_t *arena)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(arena);
+
+    memset(arena, 0, sizeof(*arena));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__arena_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__arena_malloc
+ *
+ * Purpose:	Allocate an object of SIZE bytes from an arena.  When it
+ *      doesn't fit in the current block, the next block is used if it is
+ *      large enough, or a new block is added after the current one.
+ *
+ * Return:	Success:	Pointer to the object
+ * 		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5D__arena_malloc(H5D_arena_t *arena, size_t size)
+{
+    H5D_arena_block_t *cur;              /* Block for the object */
+    void              *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(arena);
+    assert(size > 0);
+
+    size = H5D_ARENA_ALIGN(size);
+
+    /* Find a block with room for the object */
+    cur = arena->cur;
+    if (NULL == cur || cur->used + size > cur->size) {
+        if (cur && cur->next && size <= cur->next->size) {
+            /* Blocks after the current one are empty */
+            cur       = cur->next;
+            cur->used = 0;
+        } /* end if */
+        else {
+            size_t             blk_size = MAX(H5D_ARENA_BLOCK_SIZE, size); /* Bytes for objects */
+            void              *mem;                                        /* Memory for the block */
+            H5D_arena_block_t *blk;                                        /* New block */
+
+            if (NULL == (mem = H5FL_BLK_MALLOC(io_arena_blk, H5D_ARENA_BLOCK_HDR_SIZE + blk_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate arena block");
+            blk       = (H5D_arena_block_t *)mem;
+            blk->size = blk_size;
+            blk->used = 0;
+
+            /* Link the new block after the current one */
+            blk->prev = cur;
+            if (cur) {
+                blk->next = cur->next;
+                cur->next = blk;
+            } /* end if */
+            else {
+                blk->next    = arena->first;
+                arena->first = blk;
+            } /* end else */
+            if (blk->next)
+                blk->next->prev = blk;
+
+            arena->nblocks++;
+            cur = blk;
+        } /* end else */
+        arena->cur = cur;
+    } /* end if */
+
+    /* Bump the pointer */
+    ret_value = H5D_ARENA_BLOCK_DATA(cur) + cur->used;
+    cur->used += size;
+
+    arena->nallocs++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__arena_malloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__arena_free
+ *
+ * Purpose:	Free an object of SIZE bytes allocated from an arena.  Only
+ *      the memory of the object allocated last is reused; the memory of
+ *      other objects is reused after the arena is reset.
+ *
+ * Return:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5D__arena_free(H5D_arena_t *arena, void *obj, size_t size)
+{
+    H5D_arena_block_t *cur; /* Current block */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(arena);
+    assert(obj);
+
+    size = H5D_ARENA_ALIGN(size);
+
+    /* Skip back over empty blocks */
+    cur = arena->cur;
+    while (cur && 0 == cur->used && cur->prev)
+        cur = cur->prev;
+    arena->cur = cur;
+
+    /* Move the pointer back, if the object is the last one */
+    if (cur && cur->used >= size && (uint8_t *)obj == H5D_ARENA_BLOCK_DATA(cur) + (cur->used - size))
+        cur->used -= size;
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5D__arena_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__arena_reset
+ *
+ * Purpose:	Release all the objects and blocks of an arena, and add its
+ *      counts to the totals.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D__arena_reset(H5D_arena_t *arena)
+{
+    H5D_arena_block_t *blk; /* Block to release */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(arena);
+
+    blk = arena->first;
+    while (blk) {
+        H5D_arena_block_t *next = blk->next; /* Next block */
+
+        (void)H5FL_BLK_FREE(io_arena_blk, blk);
+        blk = next;
+    } /* end while */
+
+    /* Update the totals */
+    H5D_arena_stats_g.nallocs += arena->nallocs;
+    H5D_arena_stats_g.nblocks += arena->nblocks;
+
+    memset(arena, 0, sizeof(*arena));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__arena_reset() */
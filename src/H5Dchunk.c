@@ -119,6 +119,9 @@
     0x02U /* Filters have been disabled since                                                                \
            * the last flush */
 
+/* Most pieces in a piece map kept for the next I/O with the same selections */
+#define H5D_CHUNK_MAP_CACHE_MAX_PIECES 256
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -297,6 +300,9 @@ static herr_t   H5D__create_piece_file_map_all(H5D_dset_io_info_t *di, H5D_io_in
 static herr_t   H5D__create_piece_file_map_hyper(H5D_dset_io_info_t *di, H5D_io_info_t *io_info);
 static herr_t   H5D__create_piece_mem_map_1d(const H5D_dset_io_info_t *di);
 static herr_t   H5D__create_piece_mem_map_hyper(const H5D_dset_io_info_t *di);
+static htri_t   H5D__chunk_map_cache_space_equal(H5S_t *space, H5S_t *cached);
+static herr_t   H5D__chunk_map_cache_lookup(H5D_io_info_t *io_info, H5D_dset_io_info_t *di, hbool_t *found);
+static herr_t   H5D__chunk_map_cache_store(H5D_dset_io_info_t *di);
 static herr_t   H5D__piece_file_cb(void *elem, const H5T_t *type, unsigned ndims, const hsize_t *coords,
                                    void *_opdata);
 static herr_t   H5D__piece_mem_cb(void *elem, const H5T_t *type, unsigned ndims, const hsize_t *coords,
@@ -737,6 +743,10 @@ H5D__chunk_set_info(const H5D_t *dset)
         (dset->shared->layout.storage.u.chunk.ops->resize)(&dset->shared->layout.u.chunk) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to resize chunk index information");
 
+    /* The chunk indices of the cached piece map may have changed */
+    if (H5D__chunk_map_cache_reset(&dset->shared->cache.chunk.map_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release cached piece map");
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_set_info() */
@@ -1093,9 +1103,10 @@ H5D__chunk_io_init(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
         if (H5D__chunk_may_use_select_io(io_info, dinfo) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check if selection I/O is possible");
 
-    /* Calculate type conversion buffer size if necessary.  Currently only implemented for selection I/O. */
-    if (io_info->use_select_io != H5D_SELECTION_IO_MODE_OFF &&
-        !(dinfo->type_info.is_xform_noop && dinfo->type_info.is_conv_noop)) {
+    /* Calculate type conversion buffer size and check for in-place conversion of each chunk if necessary.
+     * In-place conversion is used by scalar I/O as well, for the chunks whose memory selection is
+     * contiguous. */
+    if (!(dinfo->type_info.is_xform_noop && dinfo->type_info.is_conv_noop)) {
         H5SL_node_t *chunk_node; /* Current node in chunk skip list */
 
         /* Iterate through nodes in chunk skip list */
@@ -1199,7 +1210,8 @@ H5D__chunk_io_init_selections(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
                         "unable to create chunk selections for single element");
     } /* end if */
     else {
-        hbool_t sel_hyper_flag; /* Whether file selection is a hyperslab */
+        hbool_t sel_hyper_flag;     /* Whether file selection is a hyperslab */
+        hbool_t map_found = FALSE; /* Whether the piece map of the last I/O was reused */
 
         /* Initialize skip list for chunk selections */
         if (NULL == dataset->shared->cache.chunk.sel_chunks)
@@ -1217,6 +1229,12 @@ H5D__chunk_io_init_selections(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
         if ((fm->msel_type = H5S_GET_SELECT_TYPE(dinfo->mem_space)) < H5S_SEL_NONE)
             HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection");
 
+        /* Reuse the piece map of the last I/O, if it was for the same selections */
+        if (H5D__chunk_map_cache_lookup(io_info, dinfo, &map_found) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't check cached piece map");
+        if (map_found)
+            HGOTO_DONE(SUCCEED);
+
         /* If the selection is NONE or POINTS, set the flag to FALSE */
         if (fm->fsel_type == H5S_SEL_POINTS || fm->fsel_type == H5S_SEL_NONE)
             sel_hyper_flag = FALSE;
@@ -1313,7 +1331,11 @@ H5D__chunk_io_init_selections(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
             if (H5S_select_iterate(&bogus, file_type, dinfo->file_space, &iter_op, &io_info_wrap) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create memory chunk selections");
         } /* end else */
-    }     /* end else */
+
+        /* Keep the piece map for the next I/O */
+        if (H5D__chunk_map_cache_store(dinfo) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't cache piece map");
+    } /* end else */
 
 done:
     /* Release the [potentially partially built] chunk mapping information if an error occurs */
@@ -1334,6 +1356,264 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_io_init_selections() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_map_cache_space_equal
+ *
+ * Purpose:     Check if a dataspace has the same extent and selection as
+ *              the copy of a dataspace in the cached piece map.  The
+ *              selections are the same if they have the same shape and the
+ *              same bounds, with their offsets.
+ *
+ * Return:      TRUE/FALSE/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_map_cache_space_equal(H5S_t *space, H5S_t *cached)
+{
+    H5S_sel_type sel_type;         /* Type of the selections */
+    htri_t       ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(space);
+    assert(cached);
+
+    /* Check the extents */
+    if (!H5S_extent_equal(space, cached))
+        HGOTO_DONE(FALSE);
+
+    /* Check the types & numbers of elements of the selections */
+    sel_type = H5S_GET_SELECT_TYPE(space);
+    if (sel_type != H5S_GET_SELECT_TYPE(cached) ||
+        H5S_GET_SELECT_NPOINTS(space) != H5S_GET_SELECT_NPOINTS(cached))
+        HGOTO_DONE(FALSE);
+
+    /* Compare the bounds & shapes of hyperslab & point selections */
+    if (sel_type == H5S_SEL_HYPERSLABS || sel_type == H5S_SEL_POINTS) {
+        hsize_t start[H5S_MAX_RANK], end[H5S_MAX_RANK];               /* Bounds of selection */
+        hsize_t cached_start[H5S_MAX_RANK], cached_end[H5S_MAX_RANK]; /* Bounds of cached selection */
+        size_t  rank = (size_t)H5S_GET_EXTENT_NDIMS(space);           /* Rank of dataspaces */
+
+        if (H5S_SELECT_BOUNDS(space, start, end) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds");
+        if (H5S_SELECT_BOUNDS(cached, cached_start, cached_end) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get cached selection bounds");
+        if (memcmp(start, cached_start, rank * sizeof(hsize_t)) != 0 ||
+            memcmp(end, cached_end, rank * sizeof(hsize_t)) != 0)
+            HGOTO_DONE(FALSE);
+
+        /* Selections with the same shape & bounds are the same */
+        if ((ret_value = H5S_SELECT_SHAPE_SAME(space, cached)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOMPARE, FAIL, "can't compare selections");
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_cache_space_equal() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_map_cache_lookup
+ *
+ * Purpose:     Check if the piece map of the last I/O on the dataset was
+ *              for the same file & memory selections, and if so, add its
+ *              pieces to the I/O operation.  The pieces use the cached
+ *              dataspaces, so the selections aren't mapped to the chunks
+ *              again.  The chunk addresses are still looked up for each
+ *              operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_map_cache_lookup(H5D_io_info_t *io_info, H5D_dset_io_info_t *di, hbool_t *found)
+{
+    H5D_chunk_map_cache_t *cache = &di->dset->shared->cache.chunk.map_cache; /* Cached piece map */
+    H5D_chunk_map_t       *fm    = di->layout_io_info.chunk_map;             /* Chunk map */
+    htri_t                 equal;                                            /* Whether the spaces match */
+    size_t                 u;                                                /* Local index variable */
+    herr_t                 ret_value = SUCCEED;                              /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(found);
+    assert(fm->dset_sel_pieces);
+    assert(H5SL_count(fm->dset_sel_pieces) == 0);
+
+    *found = FALSE;
+
+    /* Check for a cached map */
+    if (NULL == cache->file_space)
+        HGOTO_DONE(SUCCEED);
+
+    /* Check the selections */
+    if ((equal = H5D__chunk_map_cache_space_equal(di->file_space, cache->file_space)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't compare file dataspaces");
+    if (equal && (equal = H5D__chunk_map_cache_space_equal(di->mem_space, cache->mem_space)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't compare memory dataspaces");
+    if (!equal)
+        HGOTO_DONE(SUCCEED);
+
+    /* Add the cached pieces to the operation */
+    for (u = 0; u < cache->npieces; u++) {
+        const H5D_chunk_map_piece_t *cached_piece = &cache->pieces[u]; /* Cached piece */
+        H5D_piece_info_t            *piece_info;                       /* Piece information */
+
+        if (NULL == (piece_info = H5D_IO_TMP_MALLOC(io_info, H5D_piece_info_t)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate piece info");
+        piece_info->from_arena = (io_info->arena != NULL);
+        piece_info->map_cached = TRUE;
+
+        /* Initialize the piece information from the cached piece */
+        piece_info->index         = cached_piece->index;
+        piece_info->piece_points  = cached_piece->piece_points;
+        piece_info->fspace        = cached_piece->fspace;
+        piece_info->fspace_shared = FALSE;
+        piece_info->mspace        = cached_piece->mspace ? cached_piece->mspace : cache->mem_space;
+        piece_info->mspace_shared = FALSE;
+        H5MM_memcpy(piece_info->scaled, cached_piece->scaled, sizeof(piece_info->scaled));
+
+        /* make connection to related dset info from this piece_info */
+        piece_info->dset_info = di;
+
+        /* Initialize in-place type conversion info. Start with it disabled. */
+        piece_info->in_place_tconv = FALSE;
+        piece_info->buf_off        = 0;
+
+        /* Insert the piece into the skip list */
+        if (H5SL_insert(fm->dset_sel_pieces, piece_info, &piece_info->index) < 0) {
+            H5D__free_piece_info(piece_info, NULL, NULL);
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert piece into skip list");
+        } /* end if */
+
+        /* Add piece to global piece_count */
+        io_info->piece_count++;
+    } /* end for */
+
+    cache->nhits++;
+    *found = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_cache_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_map_cache_store
+ *
+ * Purpose:     Replace the dataset's cached piece map with the piece map of
+ *              the current I/O operation, if it doesn't have too many
+ *              pieces.  The pieces' dataspaces are moved to the cached map,
+ *              and the pieces are marked to leave them there.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_map_cache_store(H5D_dset_io_info_t *di)
+{
+    H5D_chunk_map_cache_t *cache = &di->dset->shared->cache.chunk.map_cache; /* Cached piece map */
+    H5D_chunk_map_t       *fm    = di->layout_io_info.chunk_map;             /* Chunk map */
+    H5SL_node_t           *piece_node;                                       /* Current piece node */
+    size_t                 npieces;                                          /* Number of pieces */
+    herr_t                 ret_value = SUCCEED;                              /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Release the previous map */
+    if (H5D__chunk_map_cache_reset(cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release cached piece map");
+
+    /* Don't keep large maps */
+    npieces = H5SL_count(fm->dset_sel_pieces);
+    if (npieces > H5D_CHUNK_MAP_CACHE_MAX_PIECES)
+        HGOTO_DONE(SUCCEED);
+
+    /* Copy the selections the map is for */
+    if (NULL == (cache->file_space = H5S_copy(di->file_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space");
+    if (NULL == (cache->mem_space = H5S_copy(di->mem_space, FALSE, TRUE)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space");
+
+    /* Move the pieces' dataspaces to the map */
+    if (npieces > 0 && NULL == (cache->pieces = (H5D_chunk_map_piece_t *)H5MM_malloc(
+                                    npieces * sizeof(H5D_chunk_map_piece_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate cached pieces");
+    piece_node = H5SL_first(fm->dset_sel_pieces);
+    while (piece_node) {
+        H5D_piece_info_t      *piece_info   = (H5D_piece_info_t *)H5SL_item(piece_node); /* Piece info */
+        H5D_chunk_map_piece_t *cached_piece = &cache->pieces[cache->npieces];           /* Cached piece */
+
+        assert(!piece_info->fspace_shared);
+        assert(piece_info->mspace);
+
+        cached_piece->index        = piece_info->index;
+        cached_piece->piece_points = piece_info->piece_points;
+        H5MM_memcpy(cached_piece->scaled, piece_info->scaled, sizeof(cached_piece->scaled));
+        cached_piece->fspace = piece_info->fspace;
+        cached_piece->mspace = piece_info->mspace_shared ? NULL : piece_info->mspace;
+
+        piece_info->map_cached = TRUE;
+        cache->npieces++;
+
+        piece_node = H5SL_next(piece_node);
+    } /* end while */
+
+done:
+    if (ret_value < 0) {
+        /* (No pieces were moved to the map yet) */
+        assert(cache->npieces == 0);
+        if (H5D__chunk_map_cache_reset(cache) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't release cached piece map");
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_cache_store() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_map_cache_reset
+ *
+ * Purpose:     Release a dataset's cached piece map.  Must not be called
+ *              while an I/O operation uses the map's pieces.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_map_cache_reset(H5D_chunk_map_cache_t *cache)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(cache);
+
+    for (u = 0; u < cache->npieces; u++) {
+        if (H5S_close(cache->pieces[u].fspace) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release piece file dataspace");
+        if (cache->pieces[u].mspace && H5S_close(cache->pieces[u].mspace) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release piece memory dataspace");
+    } /* end for */
+    cache->pieces  = (H5D_chunk_map_piece_t *)H5MM_xfree(cache->pieces);
+    cache->npieces = 0;
+
+    if (cache->file_space) {
+        if (H5S_close(cache->file_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release file dataspace");
+        cache->file_space = NULL;
+    } /* end if */
+    if (cache->mem_space) {
+        if (H5S_close(cache->mem_space) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "can't release memory dataspace");
+        cache->mem_space = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_cache_reset() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_mem_alloc
  *
@@ -1462,18 +1742,22 @@ H5D__free_piece_info(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *
 
     assert(piece_info);
 
-    /* Close the piece's file dataspace, if it's not shared */
-    if (!piece_info->fspace_shared)
-        (void)H5S_close(piece_info->fspace);
-    else
-        H5S_select_all(piece_info->fspace, TRUE);
+    /* The dataspaces of a piece from the dataset's cached piece map stay with the map */
+    if (!piece_info->map_cached) {
+        /* Close the piece's file dataspace, if it's not shared */
+        if (!piece_info->fspace_shared)
+            (void)H5S_close(piece_info->fspace);
+        else
+            H5S_select_all(piece_info->fspace, TRUE);
 
-    /* Close the piece's memory dataspace, if it's not shared */
-    if (!piece_info->mspace_shared && piece_info->mspace)
-        (void)H5S_close((H5S_t *)piece_info->mspace);
+        /* Close the piece's memory dataspace, if it's not shared */
+        if (!piece_info->mspace_shared && piece_info->mspace)
+            (void)H5S_close((H5S_t *)piece_info->mspace);
+    } /* end if */
 
-    /* Free the actual piece info */
-    piece_info = H5FL_FREE(H5D_piece_info_t, piece_info);
+    /* Free the actual piece info, unless the I/O operation's arena releases it */
+    if (!piece_info->from_arena)
+        piece_info = H5FL_FREE(H5D_piece_info_t, piece_info);
 
     FUNC_LEAVE_NOAPI(0)
 } /* H5D__free_piece_info() */
@@ -1514,8 +1798,11 @@ H5D__create_piece_map_single(H5D_dset_io_info_t *di, H5D_io_info_t *io_info)
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info");
 
     /* Initialize the 'single piece' file & memory piece information */
+    /* (It's kept with the dataset, not in the I/O operation's arena) */
     piece_info               = fm->single_piece_info;
     piece_info->piece_points = 1;
+    piece_info->from_arena   = FALSE;
+    piece_info->map_cached   = FALSE;
 
     /* Set chunk location & hyperslab size */
     for (u = 0; u < fm->f_ndims; u++) {
@@ -1652,8 +1939,10 @@ H5D__create_piece_file_map_all(H5D_dset_io_info_t *di, H5D_io_info_t *io_info)
         /* Add temporary chunk to the list of pieces */
 
         /* Allocate the file & memory chunk information */
-        if (NULL == (new_piece_info = H5FL_MALLOC(H5D_piece_info_t)))
+        if (NULL == (new_piece_info = H5D_IO_TMP_MALLOC(io_info, H5D_piece_info_t)))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate piece info");
+        new_piece_info->from_arena = (io_info->arena != NULL);
+        new_piece_info->map_cached = FALSE;
 
         /* Initialize the chunk information */
 
@@ -1857,8 +2146,10 @@ H5D__create_piece_file_map_hyper(H5D_dset_io_info_t *dinfo, H5D_io_info_t *io_in
             /* Add temporary chunk to the list of chunks */
 
             /* Allocate the file & memory chunk information */
-            if (NULL == (new_piece_info = H5FL_MALLOC(H5D_piece_info_t)))
+            if (NULL == (new_piece_info = H5D_IO_TMP_MALLOC(io_info, H5D_piece_info_t)))
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk info");
+            new_piece_info->from_arena = (io_info->arena != NULL);
+            new_piece_info->map_cached = FALSE;
 
             /* Initialize the chunk information */
 
@@ -2217,8 +2508,10 @@ H5D__piece_file_cb(void H5_ATTR_UNUSED *elem, const H5T_t H5_ATTR_UNUSED *type,
             H5S_t *fspace; /* Memory chunk's dataspace */
 
             /* Allocate the file & memory chunk information */
-            if (NULL == (piece_info = H5FL_MALLOC(H5D_piece_info_t)))
+            if (NULL == (piece_info = H5D_IO_TMP_MALLOC(io_info, H5D_piece_info_t)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info");
+            piece_info->from_arena = (io_info->arena != NULL);
+            piece_info->map_cached = FALSE;
 
             /* Initialize the chunk information */
 
@@ -2227,14 +2520,14 @@ H5D__piece_file_cb(void H5_ATTR_UNUSED *elem, const H5T_t H5_ATTR_UNUSED *type,
 
             /* Create a dataspace for the chunk */
             if ((fspace = H5S_create_simple(fm->f_ndims, fm->chunk_dim, NULL)) == NULL) {
-                piece_info = H5FL_FREE(H5D_piece_info_t, piece_info);
+                piece_info = H5D_IO_TMP_FREE(io_info, H5D_piece_info_t, piece_info);
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create dataspace for chunk");
             } /* end if */
 
             /* De-select the chunk space */
             if (H5S_select_none(fspace) < 0) {
                 (void)H5S_close(fspace);
-                piece_info = H5FL_FREE(H5D_piece_info_t, piece_info);
+                piece_info = H5D_IO_TMP_FREE(io_info, H5D_piece_info_t, piece_info);
                 HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to de-select dataspace");
             } /* end if */
 
@@ -241,6 +241,10 @@ H5D__compact_io_init(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
     io_info->use_select_io = H5D_SELECTION_IO_MODE_OFF;
     io_info->no_selection_io_cause |= H5D_SEL_IO_NOT_CONTIGUOUS_OR_CHUNKED_DATASET;
 
+    /* Without pieces, any type conversion uses the type conversion buffer */
+    if (!(dinfo->type_info.is_xform_noop && dinfo->type_info.is_conv_noop))
+        io_info->actual_type_conv |= H5D_TYPE_CONV_BUFFER;
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5D__compact_io_init() */
 
@@ -65,6 +65,13 @@ typedef struct H5D_contig_readvv_ud_t {
     unsigned char *rbuf;      /* Pointer to buffer to fill */
 } H5D_contig_readvv_ud_t;
 
+/* Callback info for readvv operation from a buffer borrowed from the file driver */
+typedef struct H5D_contig_readvv_borrow_ud_t {
+    const unsigned char *src;     /* Driver's copy of the data, starting at 'src_off' */
+    hsize_t              src_off; /* Offset within the dataset of 'src' */
+    unsigned char       *rbuf;    /* Pointer to buffer to fill */
+} H5D_contig_readvv_borrow_ud_t;
+
 /* Callback info for sieve buffer writevv operation */
 typedef struct H5D_contig_writevv_sieve_ud_t {
     H5F_shared_t               *f_sh;         /* Shared file for dataset */
@@ -604,10 +611,12 @@ H5D__contig_io_init(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
         /* Add temporary chunk to the list of pieces */
         /* collect piece_info into Skip List */
         /* Allocate the file & memory chunk information */
-        if (NULL == (new_piece_info = H5FL_MALLOC(H5D_piece_info_t))) {
+        if (NULL == (new_piece_info = H5D_IO_TMP_MALLOC(io_info, H5D_piece_info_t))) {
             (void)H5S_close(tmp_fspace);
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info");
         } /* end if */
+        new_piece_info->from_arena = (io_info->arena != NULL);
+        new_piece_info->map_cached = FALSE;
 
         /* Set the piece index */
         new_piece_info->index = 0;
@@ -644,10 +653,10 @@ H5D__contig_io_init(H5D_io_info_t *io_info, H5D_dset_io_info_t *dinfo)
         new_piece_info->in_place_tconv = FALSE;
         new_piece_info->buf_off        = 0;
 
-        /* Calculate type conversion buffer size and check for in-place conversion if necessary.  Currently
-         * only implemented for selection I/O. */
-        if (io_info->use_select_io != H5D_SELECTION_IO_MODE_OFF &&
-            !(dinfo->type_info.is_xform_noop && dinfo->type_info.is_conv_noop))
+        /* Calculate type conversion buffer size and check for in-place conversion if necessary.  In-place
+         * conversion is used by scalar I/O as well, which then reads a contiguous memory selection
+         * straight into the application buffer and converts it there. */
+        if (!(dinfo->type_info.is_xform_noop && dinfo->type_info.is_conv_noop))
             H5D_INIT_PIECE_TCONV(io_info, dinfo, new_piece_info)
 
         /* Save piece to dataset info struct so it is freed at the end of the
@@ -1141,6 +1150,29 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_readvv_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_readvv_borrow_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_readvv() when copying out
+ *		of a buffer borrowed from the file driver.
+ *
+ * Return:	Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_readvv_borrow_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+{
+    H5D_contig_readvv_borrow_ud_t *udata =
+        (H5D_contig_readvv_borrow_ud_t *)_udata; /* User data for H5VM_opvv() operator */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    H5MM_memcpy(udata->rbuf + src_off, udata->src + (dst_off - udata->src_off), len);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__contig_readvv_borrow_cb() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv
  *
@@ -1161,7 +1193,9 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_
                    size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[], size_t mem_max_nseq,
                    size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
-    ssize_t ret_value = -1; /* Return value */
+    const void *borrowed  = NULL; /* In-memory copy of the data lent by the file driver */
+    hsize_t     first_off = 0;    /* Start of the dataset range touched by the sequences */
+    ssize_t     ret_value = -1;   /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -1175,8 +1209,43 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_
     assert(mem_len_arr);
     assert(mem_off_arr);
 
+    /* Check if the file driver can lend out the range of the dataset touched
+     * by the sequences (e.g. the mmap driver), so it can be copied directly
+     * into the buffer without going through the sieve buffer or a read call.
+     */
+    if (*dset_curr_seq < dset_max_nseq) {
+        hsize_t end_off = 0; /* End of the dataset range touched by the sequences */
+        size_t  u;
+
+        first_off = dset_off_arr[*dset_curr_seq];
+        for (u = *dset_curr_seq; u < dset_max_nseq; u++) {
+            first_off = MIN(first_off, dset_off_arr[u]);
+            end_off   = MAX(end_off, dset_off_arr[u] + dset_len_arr[u]);
+        }
+
+        if (end_off - first_off <= (hsize_t)SIZE_MAX &&
+            H5F_shared_block_borrow(io_info->f_sh, H5FD_MEM_DRAW,
+                                    dset_info->store->contig.dset_addr + first_off,
+                                    (size_t)(end_off - first_off), &borrowed) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't borrow buffer from file driver");
+    }
+
+    if (borrowed) {
+        H5D_contig_readvv_borrow_ud_t udata; /* User data for H5VM_opvv() operator */
+
+        /* Set up user data for H5VM_opvv() */
+        udata.src     = (const unsigned char *)borrowed;
+        udata.src_off = first_off;
+        udata.rbuf    = (unsigned char *)dset_info->buf.vp;
+
+        /* Call generic sequence operation routine */
+        if ((ret_value =
+                 H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
+                           mem_curr_seq, mem_len_arr, mem_off_arr, H5D__contig_readvv_borrow_cb, &udata)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized borrowed buffer read");
+    } /* end if */
     /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    else if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
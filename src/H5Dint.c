@@ -1916,6 +1916,10 @@ H5D_close(H5D_t *dataset)
                         H5FL_FREE(H5D_piece_info_t, dataset->shared->cache.chunk.single_piece_info);
                     dataset->shared->cache.chunk.single_piece_info = NULL;
                 } /* end if */
+
+                /* Release the cached piece map */
+                if (H5D__chunk_map_cache_reset(&dataset->shared->cache.chunk.map_cache) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release cached piece map");
                 break;
 
             case H5D_COMPACT:
@@ -2110,6 +2114,10 @@ H5D_mult_refresh_close(hid_t dset_id)
                         H5FL_FREE(H5D_piece_info_t, dataset->shared->cache.chunk.single_piece_info);
                     dataset->shared->cache.chunk.single_piece_info = NULL;
                 } /* end if */
+
+                /* Release the cached piece map */
+                if (H5D__chunk_map_cache_reset(&dataset->shared->cache.chunk.map_cache) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release cached piece map");
                 break;
 
             case H5D_COMPACT:
@@ -79,6 +79,7 @@ herr_t
 H5D__read(size_t count, H5D_dset_io_info_t *dset_info)
 {
     H5D_io_info_t io_info;                    /* Dataset I/O info  for multi dsets */
+    H5D_arena_t   arena;                      /* Arena for the temporary objects of the I/O */
     H5S_t        *orig_mem_space_local;       /* Local buffer for orig_mem_space */
     H5S_t       **orig_mem_space = NULL;      /* If not NULL, ptr to an array of dataspaces       */
                                               /* containing the original memory spaces contained  */
@@ -108,8 +109,10 @@ H5D__read(size_t count, H5D_dset_io_info_t *dset_info)
     FUNC_ENTER_NOAPI(FAIL)
 
     /* Init io_info */
+    H5D__arena_init(&arena);
     if (H5D__ioinfo_init(count, H5D_IO_OP_READ, dset_info, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize I/O info");
+    io_info.arena = &arena;
 
     /* Allocate store buffer if necessary */
     if (count > 1)
@@ -307,6 +310,7 @@ H5D__read(size_t count, H5D_dset_io_info_t *dset_info)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info (third phase)");
 
     H5CX_set_no_selection_io_cause(io_info.no_selection_io_cause);
+    H5CX_set_actual_type_conv(io_info.actual_type_conv);
 
     /* If multi dataset I/O callback is not provided, perform read IO via
      * single-dset path with looping */
@@ -434,6 +438,9 @@ done:
             (*dset_info[i].layout_ops.io_term)(&io_info, &(dset_info[i])) < 0)
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down I/O op info");
 
+    /* Release the temporary objects of the operation */
+    H5D__arena_reset(&arena);
+
     /* Shut down datatype info for operation */
     if (H5D__typeinfo_term(&io_info) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info");
@@ -486,6 +493,7 @@ herr_t
 H5D__write(size_t count, H5D_dset_io_info_t *dset_info)
 {
     H5D_io_info_t io_info;                    /* Dataset I/O info for multi dsets */
+    H5D_arena_t   arena;                      /* Arena for the temporary objects of the I/O */
     H5S_t        *orig_mem_space_local;       /* Local buffer for orig_mem_space */
     H5S_t       **orig_mem_space = NULL;      /* If not NULL, ptr to an array of dataspaces       */
                                               /* containing the original memory spaces contained  */
@@ -513,8 +521,10 @@ H5D__write(size_t count, H5D_dset_io_info_t *dset_info)
     FUNC_ENTER_NOAPI(FAIL)
 
     /* Init io_info */
+    H5D__arena_init(&arena);
     if (H5D__ioinfo_init(count, H5D_IO_OP_WRITE, dset_info, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize I/O info");
+    io_info.arena = &arena;
 
     /* Allocate store buffer if necessary */
     if (count > 1)
@@ -720,6 +730,7 @@ H5D__write(size_t count, H5D_dset_io_info_t *dset_info)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info (third phase)");
 
     H5CX_set_no_selection_io_cause(io_info.no_selection_io_cause);
+    H5CX_set_actual_type_conv(io_info.actual_type_conv);
 
     /* If multi dataset I/O callback is not provided, perform write IO via
      * single-dset path with looping */
@@ -847,6 +858,9 @@ done:
             HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down I/O op info");
     }
 
+    /* Release the temporary objects of the operation */
+    H5D__arena_reset(&arena);
+
     /* Shut down datatype info for operation */
     if (H5D__typeinfo_term(&io_info) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info");
@@ -106,11 +106,23 @@
                                                                                                              \
         /* If we're not using in-place type conversion, add this piece to global type conversion buffer      \
          * size.  This will only be used if we must allocate a type conversion buffer for the entire I/O. */ \
-        if (!(PIECE_INFO)->in_place_tconv)                                                                   \
+        if ((PIECE_INFO)->in_place_tconv)                                                                    \
+            (IO_INFO)->actual_type_conv |= H5D_TYPE_CONV_IN_PLACE;                                           \
+        else {                                                                                               \
             (IO_INFO)->tconv_buf_size += (PIECE_INFO)->piece_points * MAX((DINFO)->type_info.src_type_size,  \
                                                                           (DINFO)->type_info.dst_type_size); \
+            (IO_INFO)->actual_type_conv |= H5D_TYPE_CONV_BUFFER;                                             \
+        }                                                                                                    \
     }
 
+/* Allocate and free a temporary object of type T for an I/O operation, from
+ * the operation's arena when it has one
+ */
+#define H5D_IO_TMP_MALLOC(IO_INFO, T)                                                                        \
+    ((IO_INFO)->arena ? (T *)H5D__arena_malloc((IO_INFO)->arena, sizeof(T)) : H5FL_MALLOC(T))
+#define H5D_IO_TMP_FREE(IO_INFO, T, OBJ)                                                                     \
+    ((IO_INFO)->arena ? (T *)H5D__arena_free((IO_INFO)->arena, (OBJ), sizeof(T)) : H5FL_FREE(T, OBJ))
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -242,6 +254,23 @@ typedef enum H5D_io_op_type_t {
     H5D_IO_OP_WRITE /* Write operation */
 } H5D_io_op_type_t;
 
+/* Arena for the temporary objects of an I/O operation (see H5Darena.c) */
+typedef struct H5D_arena_block_t H5D_arena_block_t;
+typedef struct H5D_arena_t {
+    H5D_arena_block_t *first;   /* First block */
+    H5D_arena_block_t *cur;     /* Block objects are allocated from */
+    size_t             nallocs; /* Number of objects allocated */
+    size_t             nblocks; /* Number of blocks allocated */
+} H5D_arena_t;
+
+/* Totals for the arenas of all I/O operations.  Each object allocated from
+ * an arena but not each block saves an allocation.
+ */
+typedef struct H5D_arena_stats_t {
+    size_t nallocs; /* Number of objects allocated */
+    size_t nblocks; /* Number of blocks allocated */
+} H5D_arena_stats_t;
+
 /* Piece info for a data chunk/block during I/O */
 typedef struct H5D_piece_info_t {
     haddr_t  faddr;                    /* File address */
@@ -254,7 +283,9 @@ typedef struct H5D_piece_info_t {
     unsigned mspace_shared;  /* Indicate that the memory space for a chunk is shared and shouldn't be freed */
     hbool_t  in_place_tconv; /* Whether to perform type conversion in-place */
     size_t   buf_off;        /* Buffer offset for in-place type conversion */
-    struct H5D_dset_io_info_t *dset_info; /* Pointer to dset_info */
+    struct H5D_dset_io_info_t *dset_info;  /* Pointer to dset_info */
+    hbool_t                    from_arena; /* Whether the piece info is in the I/O operation's arena */
+    hbool_t map_cached; /* Whether the file & memory spaces belong to the dataset's cached piece map */
 } H5D_piece_info_t;
 
 /* I/O info for a single dataset */
@@ -321,7 +352,9 @@ typedef struct H5D_io_info_t {
 #ifdef H5_HAVE_PARALLEL
     H5D_mpio_actual_io_mode_t actual_io_mode; /* Actual type of collective or independent I/O */
 #endif                                        /* H5_HAVE_PARALLEL */
-    unsigned no_selection_io_cause;           /* "No selection I/O cause" flags */
+    unsigned     no_selection_io_cause;       /* "No selection I/O cause" flags */
+    uint32_t     actual_type_conv;            /* Where data is converted (H5D_TYPE_CONV_* flags) */
+    H5D_arena_t *arena;                       /* Arena for temporary objects, or NULL */
 } H5D_io_info_t;
 
 /* Created to pass both at once for callback func */
@@ -473,6 +506,27 @@ typedef struct H5D_virtual_held_file_t {
     struct H5D_virtual_held_file_t *next; /* Pointer to next node in list */
 } H5D_virtual_held_file_t;
 
+/* Piece of a cached chunk piece map */
+typedef struct H5D_chunk_map_piece_t {
+    hsize_t index;                    /* "Index" of chunk in dataset */
+    hsize_t piece_points;             /* Number of elements selected in piece */
+    hsize_t scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of chunk */
+    H5S_t  *fspace;                   /* Dataspace describing chunk & selection in it */
+    H5S_t  *mspace; /* Selection in memory for the chunk, or NULL for the whole memory selection */
+} H5D_chunk_map_piece_t;
+
+/* Piece map of the last I/O on a chunked dataset with more than one element.
+ * The next I/O with the same file & memory selections reuses the pieces'
+ * dataspaces instead of mapping the selections to the chunks again.
+ */
+typedef struct H5D_chunk_map_cache_t {
+    H5S_t                 *file_space; /* Copy of the (normalized) file dataspace & selection */
+    H5S_t                 *mem_space;  /* Copy of the memory dataspace & selection */
+    size_t                 npieces;    /* Number of pieces in map */
+    H5D_chunk_map_piece_t *pieces;     /* Pieces, in chunk index order */
+    unsigned               nhits;      /* Number of I/O operations that reused a map */
+} H5D_chunk_map_cache_t;
+
 /* The raw data chunk cache */
 struct H5D_rdcc_ent_t; /* Forward declaration of struct used below */
 typedef struct H5D_rdcc_t {
@@ -497,6 +551,7 @@ typedef struct H5D_rdcc_t {
     H5SL_t                 *sel_chunks;        /* Skip list containing information for each chunk selected */
     H5S_t                  *single_space;      /* Dataspace for single element I/O on chunks */
     H5D_piece_info_t       *single_piece_info; /* Pointer to single piece's info */
+    H5D_chunk_map_cache_t   map_cache;         /* Piece map of the last I/O */
 
     /* Cached information about scaled dataspace dimensions */
     hsize_t  scaled_dims[H5S_MAX_RANK];        /* The scaled dim sizes */
@@ -627,6 +682,9 @@ H5_DLLVAR const H5B2_class_t H5D_BT2_FILT[1];
 /*  Array of versions for Layout */
 H5_DLLVAR const unsigned H5O_layout_ver_bounds[H5F_LIBVER_NBOUNDS];
 
+/* Totals for the I/O operation arenas */
+H5_DLLVAR H5D_arena_stats_t H5D_arena_stats_g;
+
 /******************************/
 /* Package Private Prototypes */
 /******************************/
@@ -667,6 +725,12 @@ H5_DLL herr_t H5D__format_convert(H5D_t *dataset);
 H5_DLL herr_t H5D__read(size_t count, H5D_dset_io_info_t *dset_info);
 H5_DLL herr_t H5D__write(size_t count, H5D_dset_io_info_t *dset_info);
 
+/* Functions that operate on I/O operation arenas */
+H5_DLL void  H5D__arena_init(H5D_arena_t *arena);
+H5_DLL void *H5D__arena_malloc(H5D_arena_t *arena, size_t size);
+H5_DLL void *H5D__arena_free(H5D_arena_t *arena, void *obj, size_t size);
+H5_DLL void  H5D__arena_reset(H5D_arena_t *arena);
+
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info);
 H5_DLL herr_t H5D__select_write(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info);
@@ -726,6 +790,7 @@ H5_DLL hbool_t H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims, const uint3
                                                 const hsize_t *chunk_scaled, const hsize_t *dset_dims);
 H5_DLL herr_t  H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim);
 H5_DLL herr_t  H5D__chunk_set_sizes(H5D_t *dset);
+H5_DLL herr_t  H5D__chunk_map_cache_reset(H5D_chunk_map_cache_t *cache);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_t *dset, haddr_t chunk_addr[]);
 #endif /* H5_HAVE_PARALLEL */
@@ -820,6 +885,8 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__arena_stats_test(size_t *nallocs, size_t *nblocks);
+H5_DLL herr_t H5D__chunk_map_cache_test(hid_t did, size_t *npieces, unsigned *nhits);
 #endif /* H5D_TESTING */
 
 #endif /*H5Dpkg_H*/
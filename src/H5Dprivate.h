@@ -51,6 +51,7 @@
 #define H5D_ACS_PREEMPT_READ_CHUNKS_NAME  "rdcc_w0"              /* Preemption read chunks first */
 #define H5D_ACS_VDS_VIEW_NAME             "vds_view"             /* VDS view option */
 #define H5D_ACS_VDS_PRINTF_GAP_NAME       "vds_printf_gap"       /* VDS printf gap size */
+#define H5D_ACS_VDS_MAX_OPEN_SOURCES_NAME "vds_max_open_sources" /* Max # of open VDS source datasets */
 #define H5D_ACS_VDS_PREFIX_NAME           "vds_prefix"           /* VDS file prefix */
 #define H5D_ACS_APPEND_FLUSH_NAME         "append_flush"         /* Append flush actions */
 #define H5D_ACS_EFILE_PREFIX_NAME         "external file prefix" /* External file prefix */
@@ -82,10 +83,12 @@
 #define H5D_XFER_EDC_NAME                   "err_detect" /* EDC */
 #define H5D_XFER_FILTER_CB_NAME             "filter_cb"  /* Filter callback function */
 #define H5D_XFER_CONV_CB_NAME               "type_conv_cb"          /* Type conversion callback function */
+#define H5D_XFER_CONV_NTHREADS_NAME         "type_conv_nthreads"    /* Type conversion threads */
 #define H5D_XFER_XFORM_NAME                 "data_transform"        /* Data transform */
 #define H5D_XFER_DSET_IO_SEL_NAME           "dset_io_selection"     /* Dataset I/O selection */
 #define H5D_XFER_SELECTION_IO_MODE_NAME     "selection_io_mode"     /* Selection I/O mode */
 #define H5D_XFER_NO_SELECTION_IO_CAUSE_NAME "no_selection_io_cause" /* Cause for no selection I/O */
+#define H5D_XFER_ACTUAL_TYPE_CONV_NAME      "actual_type_conv"      /* Where data was converted */
 #define H5D_XFER_MODIFY_WRITE_BUF_NAME      "modify_write_buf"      /* Modify write buffers */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
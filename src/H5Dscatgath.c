@@ -26,6 +26,7 @@
 #include "H5FLprivate.h" /* Free Lists                           */
 #include "H5Iprivate.h"  /* IDs                                  */
 #include "H5MMprivate.h" /* Memory management			*/
+#include "H5VMprivate.h" /* Vector and array functions		*/
 
 /****************/
 /* Local Macros */
@@ -322,20 +323,33 @@ H5D__scatter_mem(const void *_tscat_buf, H5S_sel_iter_t *iter, size_t nelmts, vo
 
     /* Loop until all elements are written */
     while (nelmts > 0) {
-        /* Get list of sequences for selection to write */
-        if (H5S_SELECT_ITER_GET_SEQ_LIST(iter, vec_size, nelmts, &nseq, &nelem, off, len) < 0)
-            HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "sequence length generation failed");
-
-        /* Loop, while sequences left to process */
-        for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
-            /* Get the number of bytes in sequence */
-            curr_len = len[curr_seq];
+        hsize_t seq_off;    /* Offset of the first sequence of a run */
+        hsize_t seq_stride; /* Stride between the sequences of a run */
 
-            H5MM_memcpy(buf + off[curr_seq], tscat_buf, curr_len);
+        /* Scatter a run of sequences at a constant stride at once */
+        if (H5S_select_iter_get_strided_seq(iter, nelmts, &nseq, &nelem, &seq_off, &curr_len, &seq_stride) >
+            0) {
+            H5VM_memcpy_strided(buf + seq_off, (size_t)seq_stride, tscat_buf, curr_len, curr_len, nseq);
 
             /* Advance offset in destination buffer */
-            tscat_buf += curr_len;
-        } /* end for */
+            tscat_buf += nseq * curr_len;
+        } /* end if */
+        else {
+            /* Get list of sequences for selection to write */
+            if (H5S_SELECT_ITER_GET_SEQ_LIST(iter, vec_size, nelmts, &nseq, &nelem, off, len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "sequence length generation failed");
+
+            /* Loop, while sequences left to process */
+            for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
+                /* Get the number of bytes in sequence */
+                curr_len = len[curr_seq];
+
+                H5MM_memcpy(buf + off[curr_seq], tscat_buf, curr_len);
+
+                /* Advance offset in destination buffer */
+                tscat_buf += curr_len;
+            } /* end for */
+        }     /* end else */
 
         /* Decrement number of elements left to process */
         nelmts -= nelem;
@@ -404,20 +418,33 @@ H5D__gather_mem(const void *_buf, H5S_sel_iter_t *iter, size_t nelmts, void *_tg
 
     /* Loop until all elements are written */
     while (nelmts > 0) {
-        /* Get list of sequences for selection to write */
-        if (H5S_SELECT_ITER_GET_SEQ_LIST(iter, vec_size, nelmts, &nseq, &nelem, off, len) < 0)
-            HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "sequence length generation failed");
-
-        /* Loop, while sequences left to process */
-        for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
-            /* Get the number of bytes in sequence */
-            curr_len = len[curr_seq];
+        hsize_t seq_off;    /* Offset of the first sequence of a run */
+        hsize_t seq_stride; /* Stride between the sequences of a run */
 
-            H5MM_memcpy(tgath_buf, buf + off[curr_seq], curr_len);
+        /* Gather a run of sequences at a constant stride at once */
+        if (H5S_select_iter_get_strided_seq(iter, nelmts, &nseq, &nelem, &seq_off, &curr_len, &seq_stride) >
+            0) {
+            H5VM_memcpy_strided(tgath_buf, curr_len, buf + seq_off, (size_t)seq_stride, curr_len, nseq);
 
             /* Advance offset in gather buffer */
-            tgath_buf += curr_len;
-        } /* end for */
+            tgath_buf += nseq * curr_len;
+        } /* end if */
+        else {
+            /* Get list of sequences for selection to write */
+            if (H5S_SELECT_ITER_GET_SEQ_LIST(iter, vec_size, nelmts, &nseq, &nelem, off, len) < 0)
+                HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, 0, "sequence length generation failed");
+
+            /* Loop, while sequences left to process */
+            for (curr_seq = 0; curr_seq < nseq; curr_seq++) {
+                /* Get the number of bytes in sequence */
+                curr_len = len[curr_seq];
+
+                H5MM_memcpy(tgath_buf, buf + off[curr_seq], curr_len);
+
+                /* Advance offset in gather buffer */
+                tgath_buf += curr_len;
+            } /* end for */
+        }     /* end else */
 
         /* Decrement number of elements left to process */
         nelmts -= nelem;
@@ -479,11 +506,11 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_
                      dset_info->layout_io_info.contig_piece_info->in_place_tconv;
 
     /* Allocate the iterators */
-    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+    if (NULL == (mem_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator");
-    if (NULL == (bkg_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+    if (NULL == (bkg_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate background iterator");
-    if (NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+    if (NULL == (file_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate file iterator");
 
     /* Figure out the strip mine size. */
@@ -591,19 +618,19 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_
     }     /* end for */
 
 done:
-    /* Release selection iterators */
+    /* Release selection iterators, in reverse order of allocation */
     if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
     if (file_iter)
-        file_iter = H5FL_FREE(H5S_sel_iter_t, file_iter);
-    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
-        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
-    if (mem_iter)
-        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+        file_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, file_iter);
     if (bkg_iter_init && H5S_SELECT_ITER_RELEASE(bkg_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
     if (bkg_iter)
-        bkg_iter = H5FL_FREE(H5S_sel_iter_t, bkg_iter);
+        bkg_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, bkg_iter);
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
+    if (mem_iter)
+        mem_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, mem_iter);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__scatgath_read() */
@@ -654,11 +681,11 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset
                      dset_info->layout_io_info.contig_piece_info->in_place_tconv;
 
     /* Allocate the iterators */
-    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+    if (NULL == (mem_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator");
-    if (NULL == (bkg_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+    if (NULL == (bkg_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate background iterator");
-    if (NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+    if (NULL == (file_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate file iterator");
 
     /* Figure out the strip mine size. */
@@ -766,19 +793,19 @@ H5D__scatgath_write(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset
     } /* end for */
 
 done:
-    /* Release selection iterators */
+    /* Release selection iterators, in reverse order of allocation */
     if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
     if (file_iter)
-        file_iter = H5FL_FREE(H5S_sel_iter_t, file_iter);
-    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
-        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
-    if (mem_iter)
-        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+        file_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, file_iter);
     if (bkg_iter_init && H5S_SELECT_ITER_RELEASE(bkg_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
     if (bkg_iter)
-        bkg_iter = H5FL_FREE(H5S_sel_iter_t, bkg_iter);
+        bkg_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, bkg_iter);
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
+    if (mem_iter)
+        mem_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, mem_iter);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__scatgath_write() */
@@ -821,7 +848,7 @@ H5D__scatgath_read_select(H5D_io_info_t *io_info)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for temporary buffer list");
 
     /* Allocate the iterator */
-    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+    if (NULL == (mem_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator");
 
     /* Allocate list of block memory spaces */
@@ -995,7 +1022,7 @@ done:
     if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
     if (mem_iter)
-        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+        mem_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, mem_iter);
 
     /* Free tmp_bufs */
     H5MM_free(tmp_bufs);
@@ -1058,7 +1085,7 @@ H5D__scatgath_write_select(H5D_io_info_t *io_info)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for temporary buffer list");
 
     /* Allocate the iterator */
-    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+    if (NULL == (mem_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator");
 
     /* Allocate list of block memory spaces */
@@ -1298,7 +1325,7 @@ done:
     if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release selection iterator");
     if (mem_iter)
-        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+        mem_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, mem_iter);
 
     /* Free write_bufs */
     H5MM_free(write_bufs);
@@ -1352,8 +1379,17 @@ done:
  *                  };                             TYPE4 D;
  *                                                 TYPE5 E;
  *                                             };
+ *              or, when the members need no conversion but are in
+ *              another order or at other offsets, for example when
+ *              reading a few members of a large compound type:
+ *                  struct destination {       struct source {
+ *                      TYPE3 C;      <--          TYPE1 A;
+ *                      TYPE1 A;      <--          TYPE2 B;
+ *                  };                             TYPE3 C;
+ *                                             };
  *              The optimization is simply moving data to the appropriate
- *              places in the buffer.
+ *              places in the buffer, a run of adjacent members at a time
+ *              in the last case.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1380,7 +1416,8 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_
     assert(type_info);
     assert(type_info->cmpd_subset);
     assert(H5T_SUBSET_SRC == type_info->cmpd_subset->subset ||
-           H5T_SUBSET_DST == type_info->cmpd_subset->subset);
+           H5T_SUBSET_DST == type_info->cmpd_subset->subset ||
+           H5T_SUBSET_MEMBS == type_info->cmpd_subset->subset);
     assert(user_buf);
 
     /* Get info from API context */
@@ -1421,7 +1458,6 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_
             size_t   curr_len;    /* Length of bytes left to process in sequence */
             size_t   curr_nelmts; /* Number of elements to process in sequence   */
             uint8_t *xubuf;
-            size_t   i; /* Local index variable */
 
             /* Get the number of bytes and offset in sequence */
             curr_len = len[curr_seq];
@@ -1433,14 +1469,22 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_
             xubuf       = ubuf + curr_off;
 
             /* Copy the data into the right place. */
-            for (i = 0; i < curr_nelmts; i++) {
-                memmove(xubuf, xdbuf, copy_size);
+            if (H5T_SUBSET_MEMBS == type_info->cmpd_subset->subset) {
+                size_t u; /* Local index variable */
 
-                /* Update pointers */
-                xdbuf += src_stride;
-                xubuf += dst_stride;
-            } /* end for */
-        }     /* end for */
+                for (u = 0; u < type_info->cmpd_subset->nruns; u++) {
+                    const H5T_subset_run_t *run = &type_info->cmpd_subset->runs[u];
+
+                    H5VM_memcpy_strided(xubuf + run->dst_offset, dst_stride, xdbuf + run->src_offset,
+                                        src_stride, run->size, curr_nelmts);
+                } /* end for */
+            }     /* end if */
+            else
+                H5VM_memcpy_strided(xubuf, dst_stride, xdbuf, src_stride, copy_size, curr_nelmts);
+
+            /* Update pointer */
+            xdbuf += curr_nelmts * src_stride;
+        } /* end for */
 
         /* Decrement number of elements left to process */
         nelmts -= elmtno;
@@ -167,9 +167,9 @@ H5D__select_io(const H5D_io_info_t *io_info, const H5D_dset_io_info_t *dset_info
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O offset vector array");
 
         /* Allocate the iterators */
-        if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        if (NULL == (mem_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate memory iterator");
-        if (NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        if (NULL == (file_iter = H5D_IO_TMP_MALLOC(io_info, H5S_sel_iter_t)))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate file iterator");
 
         /* Initialize file iterator */
@@ -237,11 +237,11 @@ done:
     if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release selection iterator");
     if (file_iter)
-        file_iter = H5FL_FREE(H5S_sel_iter_t, file_iter);
+        file_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, file_iter);
     if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release selection iterator");
     if (mem_iter)
-        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+        mem_iter = H5D_IO_TMP_FREE(io_info, H5S_sel_iter_t, mem_iter);
 
     /* Release vector arrays, if allocated */
     if (file_len)
@@ -292,3 +292,82 @@ H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__current_cache_size_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__arena_stats_test
+ PURPOSE
+    Retrieve the totals for the I/O operation arenas
+ USAGE
+    herr_t H5D__arena_stats_test(nallocs, nblocks)
+        size_t *nallocs;        OUT: Number of objects allocated from arenas
+        size_t *nblocks;        OUT: Number of blocks allocated for arenas
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Retrieves the number of temporary objects allocated from the arenas of
+    all the dataset I/O operations so far, and the number of blocks the
+    arenas allocated for them.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__arena_stats_test(size_t *nallocs, size_t *nblocks)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (nallocs)
+        *nallocs = H5D_arena_stats_g.nallocs;
+    if (nblocks)
+        *nblocks = H5D_arena_stats_g.nblocks;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5D__arena_stats_test() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__chunk_map_cache_test
+ PURPOSE
+    Retrieve information about a chunked dataset's cached piece map
+ USAGE
+    herr_t H5D__chunk_map_cache_test(did, npieces, nhits)
+        hid_t did;              IN: Dataset to query
+        size_t *npieces;        OUT: Number of pieces in the cached map
+        unsigned *nhits;        OUT: Number of I/O operations that reused a map
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Retrieves the number of pieces in the dataset's cached piece map (0 if
+    there's no map) and the number of times the dataset's I/O operations
+    reused a map.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__chunk_map_cache_test(hid_t did, size_t *npieces, unsigned *nhits)
+{
+    H5D_t *dset;                /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if (NULL == (dset = (H5D_t *)H5VL_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset");
+    if (H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset is not chunked");
+
+    if (npieces)
+        *npieces = dset->shared->cache.chunk.map_cache.npieces;
+    if (nhits)
+        *nhits = dset->shared->cache.chunk.map_cache.nhits;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_map_cache_test() */
@@ -28,8 +28,18 @@
  *      that of the virtual selection with the unlimited count set to 1.
  *
  *      Source datasets are opened lazily (only when needed for I/O or to
- *      determine the size of the virtual dataset), and are currently held open
- *      until the virtual dataset is closed.
+ *      determine the size of the virtual dataset), and are held open until
+ *      the virtual dataset is closed, unless H5Pset_virtual_max_open_sources()
+ *      limits the number of source datasets of limited mappings kept open
+ *      between I/O operations, in which case the least recently used ones are
+ *      closed.
+ *
+ *      The limited mappings are indexed by the bounds of their virtual
+ *      selections, sorted on one dimension, so an I/O operation only examines
+ *      the mappings whose bounds intersect those of its selection.  When all
+ *      the mappings are limited and their bounds are disjoint, a read gathers
+ *      the source datasets of each source file into one multi-dataset read,
+ *      which selection I/O turns into one request to the file driver.
  */
 
 /*
@@ -70,10 +80,28 @@
 /* Default size for sub_dset array */
 #define H5D_VIRTUAL_DEF_SUB_DSET_SIZE 128
 
+/* Average # of bounds comparisons per mapping allowed when checking that the
+ * bounds of the mappings are disjoint, after which they are assumed not to be */
+#define H5D_VIRTUAL_DISJOINT_MAX_CMP 64
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Mapping with a limited selection, for sorting the mappings in the index */
+typedef struct H5D_virtual_index_ent_t {
+    hsize_t start; /* Start of the virtual selection bounds in the index dimension */
+    size_t  idx;   /* Index of the mapping in the list */
+    size_t  pos;   /* Position of the mapping's bounds in the temporary bounds array */
+} H5D_virtual_index_ent_t;
+
+/* Source dataset to read, for sorting the source datasets by file */
+typedef struct H5D_virtual_source_ent_t {
+    uintptr_t                      file;        /* Shared file struct of the source dataset, as a key */
+    uintptr_t                      dset;        /* Shared dataset struct of the source dataset, as a key */
+    H5O_storage_virtual_srcdset_t *source_dset; /* Source dataset */
+} H5D_virtual_source_ent_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -99,11 +127,22 @@ static herr_t H5D__virtual_build_source_name(char
                                              size_t static_strlen, size_t nsubs, hsize_t blockno,
                                              char **built_name);
 static herr_t H5D__virtual_init_all(const H5D_t *dset);
+static int    H5D__virtual_cmp_hsize(const void *_h1, const void *_h2);
+static int    H5D__virtual_cmp_index_ent(const void *_ent1, const void *_ent2);
+static int    H5D__virtual_cmp_size(const void *_s1, const void *_s2);
+static herr_t H5D__virtual_build_index(const H5D_t *dset);
+static void   H5D__virtual_free_index(H5O_storage_virtual_t *storage);
+static herr_t H5D__virtual_find_io_mappings(H5O_storage_virtual_t *storage, int rank, H5S_t *file_space);
+static void   H5D__virtual_touch_source_dset(H5O_storage_virtual_t     *storage,
+                                             H5O_storage_virtual_ent_t *virtual_ent);
+static herr_t H5D__virtual_close_lru_source_dsets(H5O_storage_virtual_t *storage);
 static herr_t H5D__virtual_pre_io(H5D_dset_io_info_t *dset_info, H5O_storage_virtual_t *storage,
                                   H5S_t *file_space, H5S_t *mem_space, hsize_t *tot_nelmts);
 static herr_t H5D__virtual_post_io(H5O_storage_virtual_t *storage);
 static herr_t H5D__virtual_read_one(H5D_dset_io_info_t            *dset_info,
                                     H5O_storage_virtual_srcdset_t *source_dset);
+static int    H5D__virtual_cmp_source_ent(const void *_ent1, const void *_ent2);
+static herr_t H5D__virtual_read_sources(H5D_dset_io_info_t *dset_info, H5O_storage_virtual_t *storage);
 static herr_t H5D__virtual_write_one(H5D_dset_io_info_t            *dset_info,
                                      H5O_storage_virtual_srcdset_t *source_dset);
 
@@ -553,6 +592,20 @@ H5D__virtual_copy_layout(H5O_layout_t *layout)
     orig_list         = virt->list;
     virt->list        = NULL;
 
+    /* The index and the list of open source datasets belong to the original
+     * layout, and are rebuilt when the copy is initialized */
+    virt->index_nlimited = 0;
+    virt->index_dim      = 0;
+    virt->index_disjoint = FALSE;
+    virt->index          = NULL;
+    virt->index_bounds   = NULL;
+    virt->index_max_end  = NULL;
+    virt->io_list        = NULL;
+    virt->io_nused       = 0;
+    virt->nopen          = 0;
+    virt->open_head      = NULL;
+    virt->open_tail      = NULL;
+
     /* Copy entry list */
     if (virt->list_nused > 0) {
         assert(orig_list);
@@ -737,6 +790,12 @@ H5D__virtual_reset_layout(H5O_layout_t *layout)
     virt->list_nused  = (size_t)0;
     (void)memset(virt->min_dims, 0, sizeof(virt->min_dims));
 
+    /* Free the index, and forget the source datasets closed above */
+    H5D__virtual_free_index(virt);
+    virt->nopen     = (size_t)0;
+    virt->open_head = NULL;
+    virt->open_tail = NULL;
+
     /* Close access property lists */
     if (virt->source_fapl >= 0) {
         if (H5I_dec_ref(virt->source_fapl) < 0)
@@ -2115,6 +2174,467 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_init_all() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_cmp_hsize
+ *
+ * Purpose:     Compares two hsize_t values, for qsort().
+ *
+ * Return:      -1, 0 or 1 if the first value is less than, equal to or
+ *              greater than the second
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_cmp_hsize(const void *_h1, const void *_h2)
+{
+    hsize_t h1 = *(const hsize_t *)_h1;
+    hsize_t h2 = *(const hsize_t *)_h2;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(h1 < h2 ? -1 : (h1 > h2 ? 1 : 0))
+} /* end H5D__virtual_cmp_hsize() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_cmp_index_ent
+ *
+ * Purpose:     Compares two mappings by the start of their virtual
+ *              selection bounds, then by their order in the list, for
+ *              qsort().
+ *
+ * Return:      -1, 0 or 1 if the first mapping sorts before, with or
+ *              after the second
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_cmp_index_ent(const void *_ent1, const void *_ent2)
+{
+    const H5D_virtual_index_ent_t *ent1      = (const H5D_virtual_index_ent_t *)_ent1;
+    const H5D_virtual_index_ent_t *ent2      = (const H5D_virtual_index_ent_t *)_ent2;
+    int                            ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (ent1->start != ent2->start)
+        ret_value = ent1->start < ent2->start ? -1 : 1;
+    else if (ent1->idx != ent2->idx)
+        ret_value = ent1->idx < ent2->idx ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_cmp_index_ent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_cmp_size
+ *
+ * Purpose:     Compares two size_t values, for qsort().
+ *
+ * Return:      -1, 0 or 1 if the first value is less than, equal to or
+ *              greater than the second
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_cmp_size(const void *_s1, const void *_s2)
+{
+    size_t s1 = *(const size_t *)_s1;
+    size_t s2 = *(const size_t *)_s2;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(s1 < s2 ? -1 : (s1 > s2 ? 1 : 0))
+} /* end H5D__virtual_cmp_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_build_index
+ *
+ * Purpose:     Indexes the mappings with limited, non-empty virtual
+ *              selections by the bounds of those selections, sorted by
+ *              their start in the dimension where the starts take the
+ *              most distinct values.  The other mappings follow them in
+ *              the index, and are examined for every I/O operation.
+ *              Also allocates io_list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_build_index(const H5D_t *dset)
+{
+    H5O_storage_virtual_t   *storage;
+    H5D_virtual_index_ent_t *sort_ent   = NULL; /* Mappings with limited selections, to sort */
+    hsize_t                 *tmp_bounds = NULL; /* Bounds of those mappings, in list order */
+    hsize_t                 *starts     = NULL; /* Starts of the bounds in one dimension, to sort */
+    size_t                   nlimited   = 0;    /* # of mappings with limited selections */
+    size_t                   max_distinct;      /* Most distinct starts in a dimension */
+    size_t                   n;                 /* Position in index */
+    int                      rank;
+    int                      dim = 0; /* Dimension to sort the mappings on */
+    int                      d;
+    size_t                   i;
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(dset);
+    storage = &dset->shared->layout.storage.u.virt;
+
+    /* Release any previous index */
+    H5D__virtual_free_index(storage);
+
+    if (0 == storage->list_nused)
+        HGOTO_DONE(SUCCEED);
+
+    /* Get rank of VDS */
+    if ((rank = H5S_GET_EXTENT_NDIMS(dset->shared->space)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get number of dimensions");
+
+    /* Allocate the index and the list of mappings for I/O */
+    if (NULL == (storage->index = (size_t *)H5MM_malloc(storage->list_nused * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate index of virtual mappings");
+    if (NULL == (storage->io_list = (size_t *)H5MM_malloc(storage->list_nused * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate list of mappings for I/O");
+
+    /* Get the bounds of the mappings with limited selections */
+    if (rank > 0) {
+        if (NULL == (sort_ent = (H5D_virtual_index_ent_t *)H5MM_malloc(storage->list_nused *
+                                                                         sizeof(H5D_virtual_index_ent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate temporary index");
+        if (NULL == (tmp_bounds = (hsize_t *)H5MM_malloc(storage->list_nused * 2 * (size_t)rank *
+                                                          sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate temporary bounds");
+
+        for (i = 0; i < storage->list_nused; i++) {
+            H5S_t *virtual_select = storage->list[i].source_dset.virtual_select;
+
+            if (storage->list[i].unlim_dim_virtual < 0 && H5S_GET_SELECT_NPOINTS(virtual_select) > 0) {
+                hsize_t *bounds = &tmp_bounds[nlimited * 2 * (size_t)rank];
+
+                if (H5S_SELECT_BOUNDS(virtual_select, bounds, bounds + rank) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds");
+                sort_ent[nlimited].idx = i;
+                sort_ent[nlimited].pos = nlimited;
+                nlimited++;
+            } /* end if */
+        }     /* end for */
+    }         /* end if */
+
+    if (nlimited > 0) {
+        /* Choose the dimension where the mappings' starts take the most
+         * distinct values, to sort on */
+        if (rank > 1 && nlimited > 1) {
+            if (NULL == (starts = (hsize_t *)H5MM_malloc(nlimited * sizeof(hsize_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate temporary starts");
+            max_distinct = 0;
+            for (d = 0; d < rank; d++) {
+                size_t ndistinct = 1;
+
+                for (n = 0; n < nlimited; n++)
+                    starts[n] = tmp_bounds[n * 2 * (size_t)rank + (size_t)d];
+                qsort(starts, nlimited, sizeof(hsize_t), H5D__virtual_cmp_hsize);
+                for (n = 1; n < nlimited; n++)
+                    if (starts[n] != starts[n - 1])
+                        ndistinct++;
+                if (ndistinct > max_distinct) {
+                    max_distinct = ndistinct;
+                    dim          = d;
+                } /* end if */
+            }     /* end for */
+        }         /* end if */
+
+        /* Sort the mappings by the start of their bounds in that dimension */
+        for (n = 0; n < nlimited; n++)
+            sort_ent[n].start = tmp_bounds[n * 2 * (size_t)rank + (size_t)dim];
+        qsort(sort_ent, nlimited, sizeof(H5D_virtual_index_ent_t), H5D__virtual_cmp_index_ent);
+
+        /* Fill in the index */
+        if (NULL == (storage->index_bounds =
+                         (hsize_t *)H5MM_malloc(nlimited * 2 * (size_t)rank * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate index bounds");
+        if (NULL == (storage->index_max_end = (hsize_t *)H5MM_malloc(nlimited * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate index bounds");
+        for (n = 0; n < nlimited; n++) {
+            hsize_t *bounds = &storage->index_bounds[n * 2 * (size_t)rank];
+
+            storage->index[n] = sort_ent[n].idx;
+            H5MM_memcpy(bounds, &tmp_bounds[sort_ent[n].pos * 2 * (size_t)rank],
+                        2 * (size_t)rank * sizeof(hsize_t));
+            storage->index_max_end[n] = bounds[rank + dim];
+            if (n > 0 && storage->index_max_end[n - 1] > storage->index_max_end[n])
+                storage->index_max_end[n] = storage->index_max_end[n - 1];
+        } /* end for */
+
+        /* Check whether the bounds of all the mappings are disjoint, comparing
+         * each mapping with the ones before it which may overlap it in the
+         * sorted dimension */
+        if (nlimited == storage->list_nused) {
+            size_t ncmp = 0; /* # of bounds compared */
+
+            storage->index_disjoint = TRUE;
+            for (n = 1; n < nlimited && storage->index_disjoint; n++) {
+                const hsize_t *bounds = &storage->index_bounds[n * 2 * (size_t)rank];
+                size_t         m;
+
+                for (m = n; m > 0 && storage->index_max_end[m - 1] >= bounds[dim]; m--) {
+                    const hsize_t *prev_bounds = &storage->index_bounds[(m - 1) * 2 * (size_t)rank];
+
+                    /* Give up if this takes too long */
+                    if (++ncmp > H5D_VIRTUAL_DISJOINT_MAX_CMP * nlimited) {
+                        storage->index_disjoint = FALSE;
+                        break;
+                    } /* end if */
+
+                    for (d = 0; d < rank; d++)
+                        if (prev_bounds[d] > bounds[rank + d] || prev_bounds[rank + d] < bounds[d])
+                            break;
+                    if (d == rank) {
+                        storage->index_disjoint = FALSE;
+                        break;
+                    } /* end if */
+                }     /* end for */
+            }         /* end for */
+        }             /* end if */
+    }                 /* end if */
+
+    /* Add the other mappings, in list order */
+    n = nlimited;
+    for (i = 0; i < storage->list_nused; i++)
+        if (storage->list[i].unlim_dim_virtual >= 0 || rank <= 0 ||
+            H5S_GET_SELECT_NPOINTS(storage->list[i].source_dset.virtual_select) == 0)
+            storage->index[n++] = i;
+    assert(n == storage->list_nused);
+
+    storage->index_nlimited = nlimited;
+    storage->index_dim      = dim;
+
+done:
+    H5MM_xfree(sort_ent);
+    H5MM_xfree(tmp_bounds);
+    H5MM_xfree(starts);
+    if (ret_value < 0)
+        H5D__virtual_free_index(storage);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_build_index() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_free_index
+ *
+ * Purpose:     Frees the index of the mappings and the list of mappings
+ *              for I/O.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__virtual_free_index(H5O_storage_virtual_t *storage)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(storage);
+
+    storage->index          = (size_t *)H5MM_xfree(storage->index);
+    storage->index_bounds   = (hsize_t *)H5MM_xfree(storage->index_bounds);
+    storage->index_max_end  = (hsize_t *)H5MM_xfree(storage->index_max_end);
+    storage->io_list        = (size_t *)H5MM_xfree(storage->io_list);
+    storage->index_nlimited = 0;
+    storage->index_dim      = 0;
+    storage->index_disjoint = FALSE;
+    storage->io_nused       = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_free_index() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_find_io_mappings
+ *
+ * Purpose:     Fills io_list with the mappings whose virtual selection
+ *              bounds intersect the bounds of file_space, found with the
+ *              index, and the mappings which are not indexed, in list
+ *              order.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_find_io_mappings(H5O_storage_virtual_t *storage, int rank, H5S_t *file_space)
+{
+    size_t i;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(storage);
+    assert(storage->index || 0 == storage->list_nused);
+    assert(file_space);
+
+    storage->io_nused = 0;
+
+    /* Look up the limited mappings intersecting the selection */
+    if (storage->index_nlimited > 0 && H5S_GET_SELECT_NPOINTS(file_space) > 0) {
+        hsize_t  sel_start[H5S_MAX_RANK]; /* Selection bounds start */
+        hsize_t  sel_end[H5S_MAX_RANK];   /* Selection bounds end */
+        size_t   stride = 2 * (size_t)rank;
+        unsigned dim    = (unsigned)storage->index_dim;
+        size_t   lo, hi, mid, end;
+        int      d;
+
+        if (H5S_SELECT_BOUNDS(file_space, sel_start, sel_end) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds");
+
+        /* Find the first mapping that starts after the selection */
+        lo = 0;
+        hi = storage->index_nlimited;
+        while (lo < hi) {
+            mid = lo + (hi - lo) / 2;
+            if (storage->index_bounds[mid * stride + dim] > sel_end[dim])
+                hi = mid;
+            else
+                lo = mid + 1;
+        } /* end while */
+        end = lo;
+
+        /* Find the first mapping before which none of the mappings end in
+         * or after the selection */
+        lo = 0;
+        hi = end;
+        while (lo < hi) {
+            mid = lo + (hi - lo) / 2;
+            if (storage->index_max_end[mid] >= sel_start[dim])
+                hi = mid;
+            else
+                lo = mid + 1;
+        } /* end while */
+
+        /* Check the bounds of the mappings in between */
+        for (i = lo; i < end; i++) {
+            const hsize_t *bounds = &storage->index_bounds[i * stride];
+
+            for (d = 0; d < rank; d++)
+                if (bounds[d] > sel_end[d] || bounds[rank + d] < sel_start[d])
+                    break;
+            if (d == rank)
+                storage->io_list[storage->io_nused++] = storage->index[i];
+        } /* end for */
+    }     /* end if */
+
+    /* Add the mappings which are not indexed */
+    for (i = storage->index_nlimited; i < storage->list_nused; i++)
+        storage->io_list[storage->io_nused++] = storage->index[i];
+
+    /* Keep the order of the list, which decides the result of overlapping
+     * mappings */
+    if (storage->io_nused > 1)
+        qsort(storage->io_list, storage->io_nused, sizeof(size_t), H5D__virtual_cmp_size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_find_io_mappings() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_touch_source_dset
+ *
+ * Purpose:     Moves a limited mapping whose source dataset is open to the
+ *              front of the list of open source datasets, adding it if it
+ *              was not in the list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__virtual_touch_source_dset(H5O_storage_virtual_t *storage, H5O_storage_virtual_ent_t *virtual_ent)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    assert(storage);
+    assert(virtual_ent);
+    assert(virtual_ent->unlim_dim_virtual < 0);
+    assert(virtual_ent->source_dset.dset);
+
+    if (storage->open_head != virtual_ent) {
+        /* Unlink the mapping if it is in the list */
+        if (virtual_ent->open_prev) {
+            virtual_ent->open_prev->open_next = virtual_ent->open_next;
+            if (virtual_ent->open_next)
+                virtual_ent->open_next->open_prev = virtual_ent->open_prev;
+            else
+                storage->open_tail = virtual_ent->open_prev;
+        } /* end if */
+        else
+            storage->nopen++;
+
+        /* Link it at the front */
+        virtual_ent->open_prev = NULL;
+        virtual_ent->open_next = storage->open_head;
+        if (storage->open_head)
+            storage->open_head->open_prev = virtual_ent;
+        else
+            storage->open_tail = virtual_ent;
+        storage->open_head = virtual_ent;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__virtual_touch_source_dset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_close_lru_source_dsets
+ *
+ * Purpose:     Closes the least recently used source datasets of limited
+ *              mappings, until no more than max_open are open.  Their
+ *              selections are kept, and they are opened again when an
+ *              I/O operation needs them.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_close_lru_source_dsets(H5O_storage_virtual_t *storage)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(storage);
+    assert(storage->max_open > 0);
+
+    while (storage->nopen > storage->max_open) {
+        H5O_storage_virtual_ent_t *virtual_ent = storage->open_tail;
+
+        assert(virtual_ent);
+        assert(!virtual_ent->source_dset.projected_mem_space);
+
+        /* Unlink the mapping */
+        storage->open_tail = virtual_ent->open_prev;
+        if (storage->open_tail)
+            storage->open_tail->open_next = NULL;
+        else
+            storage->open_head = NULL;
+        virtual_ent->open_prev = NULL;
+        virtual_ent->open_next = NULL;
+        storage->nopen--;
+
+        /* Close the source dataset */
+        if (virtual_ent->source_dset.dset) {
+            if (H5D_close(virtual_ent->source_dset.dset) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "unable to close source dataset");
+            virtual_ent->source_dset.dset = NULL;
+        } /* end if */
+    }     /* end while */
+
+    /* Note the lack of a done: label.  This is because there are no HGOTO_ERROR
+     * calls.  If one is added, a done: label must also be added */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_close_lru_source_dsets() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__virtual_init
  *
@@ -2227,6 +2747,14 @@ H5D__virtual_init(H5F_t *f, const H5D_t *dset, hid_t dapl_id)
         if ((storage->source_dapl = H5P_copy_plist(dapl, FALSE)) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dapl");
 
+    /* Get max # of source datasets of limited mappings to keep open */
+    if (H5P_get(dapl, H5D_ACS_VDS_MAX_OPEN_SOURCES_NAME, &storage->max_open) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get max # of open source datasets");
+
+    /* Index the mappings by the bounds of their virtual selections */
+    if (H5D__virtual_build_index(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't build index of virtual mappings");
+
     /* Mark layout as not fully initialized (must be done prior to I/O for
      * unlimited/printf selections) */
     storage->init = FALSE;
@@ -2350,8 +2878,8 @@ H5D__virtual_pre_io(H5D_dset_io_info_t *dset_info, H5O_storage_virtual_t *storag
     hsize_t      bounds_start[H5S_MAX_RANK]; /* Selection bounds start */
     hsize_t      bounds_end[H5S_MAX_RANK];   /* Selection bounds end */
     int          rank        = 0;
-    hbool_t      bounds_init = FALSE; /* Whether bounds_start, bounds_end, and rank are valid */
-    size_t       i, j, k;             /* Local index variables */
+    hbool_t      bounds_init = FALSE; /* Whether bounds_start and bounds_end are valid */
+    size_t       i, j, k, u;          /* Local index variables */
     herr_t       ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -2370,8 +2898,18 @@ H5D__virtual_pre_io(H5D_dset_io_info_t *dset_info, H5O_storage_virtual_t *storag
     /* Initialize tot_nelmts */
     *tot_nelmts = 0;
 
+    /* Get rank of VDS */
+    if ((rank = H5S_GET_EXTENT_NDIMS(dset->shared->space)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get number of dimensions");
+
+    /* Find the mappings which may intersect the selection */
+    if (H5D__virtual_find_io_mappings(storage, rank, file_space) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to find virtual mappings for I/O");
+
     /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
+    for (u = 0; u < storage->io_nused; u++) {
+        i = storage->io_list[u];
+
         /* Sanity check that the virtual space has been patched by now */
         assert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
 
@@ -2383,10 +2921,6 @@ H5D__virtual_pre_io(H5D_dset_io_info_t *dset_info, H5O_storage_virtual_t *storag
 
             /* Get selection bounds if necessary */
             if (!bounds_init) {
-                /* Get rank of VDS */
-                if ((rank = H5S_GET_EXTENT_NDIMS(dset->shared->space)) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get number of dimensions");
-
                 /* Get selection bounds */
                 if (H5S_SELECT_BOUNDS(file_space, bounds_start, bounds_end) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get selection bounds");
@@ -2567,6 +3101,9 @@ H5D__virtual_pre_io(H5D_dset_io_info_t *dset_info, H5O_storage_virtual_t *storag
                      * as zero so projected_mem_space is freed */
                     if (!storage->list[i].source_dset.dset)
                         select_nelmts = (hssize_t)0;
+                    else if (storage->list[i].unlim_dim_virtual < 0)
+                        /* Mark the source dataset as most recently used */
+                        H5D__virtual_touch_source_dset(storage, &storage->list[i]);
                 } /* end if */
 
                 /* If there are not elements selected in this mapping, free
@@ -2607,7 +3144,7 @@ done:
 static herr_t
 H5D__virtual_post_io(H5O_storage_virtual_t *storage)
 {
-    size_t i, j;                /* Local index variables */
+    size_t i, j, u;             /* Local index variables */
     herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -2616,7 +3153,9 @@ H5D__virtual_post_io(H5O_storage_virtual_t *storage)
     assert(storage);
 
     /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++)
+    for (u = 0; u < storage->io_nused; u++) {
+        i = storage->io_list[u];
+
         /* Check for "printf" source dataset resolution */
         if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
             /* Iterate over sub-source dsets */
@@ -2635,6 +3174,13 @@ H5D__virtual_post_io(H5O_storage_virtual_t *storage)
                     HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close temporary space");
                 storage->list[i].source_dset.projected_mem_space = NULL;
             } /* end if */
+    }         /* end for */
+    storage->io_nused = 0;
+
+    /* Close the least recently used source datasets over the limit */
+    if (storage->max_open > 0 && storage->nopen > storage->max_open)
+        if (H5D__virtual_close_lru_source_dsets(storage) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close source datasets");
 
     /* Note the lack of a done: label.  This is because there are no HGOTO_ERROR
      * calls.  If one is added, a done: label must also be added */
@@ -2706,6 +3252,169 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__virtual_read_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_cmp_source_ent
+ *
+ * Purpose:     Compares two source datasets to read by their file, then by
+ *              their dataset, for qsort().
+ *
+ * Return:      -1, 0 or 1 if the first source dataset sorts before, with
+ *              or after the second
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__virtual_cmp_source_ent(const void *_ent1, const void *_ent2)
+{
+    const H5D_virtual_source_ent_t *ent1      = (const H5D_virtual_source_ent_t *)_ent1;
+    const H5D_virtual_source_ent_t *ent2      = (const H5D_virtual_source_ent_t *)_ent2;
+    int                             ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (ent1->file != ent2->file)
+        ret_value = ent1->file < ent2->file ? -1 : 1;
+    else if (ent1->dset != ent2->dset)
+        ret_value = ent1->dset < ent2->dset ? -1 : 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_cmp_source_ent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__virtual_read_sources
+ *
+ * Purpose:     Reads the source datasets of the mappings involved in the
+ *              I/O, with one multi-dataset read of the source datasets in
+ *              each source file.  With selection I/O, each of those reads
+ *              reaches the file driver as a single request, which drivers
+ *              with vector I/O can carry out concurrently.  Unless the
+ *              application turned selection I/O on, the source datasets in
+ *              files without vector or selection I/O, where this would only
+ *              add overhead, are read one at a time.
+ *
+ *              Only valid when the bounds of the mappings are disjoint, as
+ *              the order of the reads into the buffer is not defined.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__virtual_read_sources(H5D_dset_io_info_t *dset_info, H5O_storage_virtual_t *storage)
+{
+    H5D_virtual_source_ent_t *source_ent   = NULL; /* Source datasets to read together, sorted by file */
+    H5D_dset_io_info_t       *source_dinfo = NULL; /* Dataset info for the source dataset reads */
+    size_t                    nsources     = 0;    /* # of source datasets to read together */
+    size_t                    nprojected   = 0;    /* # of source spaces projected */
+    size_t                    start, end;          /* Source datasets of the current read */
+    H5D_selection_io_mode_t   selection_io_mode;   /* Selection I/O mode of the transfer */
+    size_t                    u;                   /* Local index variable */
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(dset_info);
+    assert(storage);
+    assert(storage->index_disjoint);
+
+    /* Get the selection I/O mode, as without selection I/O the source datasets
+     * are not read together */
+    if (H5CX_get_selection_io_mode(&selection_io_mode) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selection I/O mode");
+
+    if (NULL == (source_ent = (H5D_virtual_source_ent_t *)H5MM_malloc(storage->io_nused *
+                                                                        sizeof(H5D_virtual_source_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate source dataset list");
+
+    /* Collect the source datasets with elements selected */
+    for (u = 0; u < storage->io_nused; u++) {
+        H5O_storage_virtual_ent_t     *virtual_ent = &storage->list[storage->io_list[u]];
+        H5O_storage_virtual_srcdset_t *source_dset = &virtual_ent->source_dset;
+        const H5F_shared_t            *f_sh;
+
+        /* Sanity check that the virtual space has been patched by now, and
+         * that the mapping is limited */
+        assert(virtual_ent->virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
+        assert(virtual_ent->unlim_dim_virtual < 0);
+
+        /* Skip the source datasets with no elements in the projection or
+         * which could not be opened */
+        if (!source_dset->projected_mem_space)
+            continue;
+        assert(source_dset->dset);
+        assert(source_dset->clipped_source_select);
+
+        /* Read the source dataset now if its file driver can't take the
+         * reads together */
+        if (selection_io_mode == H5D_SELECTION_IO_MODE_OFF ||
+            (selection_io_mode == H5D_SELECTION_IO_MODE_DEFAULT &&
+             !H5F_has_vector_select_io(source_dset->dset->oloc.file, FALSE))) {
+            if (H5D__virtual_read_one(dset_info, source_dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read source dataset");
+            continue;
+        } /* end if */
+
+        f_sh                             = H5F_SHARED(source_dset->dset->oloc.file);
+        source_ent[nsources].file        = (uintptr_t)f_sh;
+        source_ent[nsources].dset        = (uintptr_t)source_dset->dset->shared;
+        source_ent[nsources].source_dset = source_dset;
+        nsources++;
+    } /* end for */
+
+    /* Check for nothing left to read */
+    if (nsources == 0)
+        HGOTO_DONE(SUCCEED);
+
+    /* Sort the source datasets by file, as a multi-dataset read must be
+     * within one file */
+    qsort(source_ent, nsources, sizeof(H5D_virtual_source_ent_t), H5D__virtual_cmp_source_ent);
+
+    /* Set up the read of each source dataset */
+    if (NULL == (source_dinfo = (H5D_dset_io_info_t *)H5MM_calloc(nsources * sizeof(H5D_dset_io_info_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate source dataset I/O info");
+    for (nprojected = 0; nprojected < nsources; nprojected++) {
+        H5O_storage_virtual_srcdset_t *source_dset = source_ent[nprojected].source_dset;
+
+        /* Project intersection of file space and mapping virtual space onto
+         * mapping source space */
+        if (H5S_select_project_intersection(source_dset->clipped_virtual_select,
+                                            source_dset->clipped_source_select, dset_info->file_space,
+                                            &source_dinfo[nprojected].file_space, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL,
+                        "can't project virtual intersection onto source space");
+
+        source_dinfo[nprojected].dset        = source_dset->dset;
+        source_dinfo[nprojected].mem_space   = source_dset->projected_mem_space;
+        source_dinfo[nprojected].buf.vp      = dset_info->buf.vp;
+        source_dinfo[nprojected].mem_type_id = dset_info->type_info.dst_type_id;
+    } /* end for */
+
+    /* Read the source datasets of each file together.  A dataset opened by
+     * more than one mapping goes to separate reads. */
+    for (start = 0; start < nsources; start = end) {
+        for (end = start + 1; end < nsources; end++)
+            if (source_ent[end].file != source_ent[start].file ||
+                source_ent[end].dset == source_ent[end - 1].dset)
+                break;
+
+        if (H5D__read(end - start, &source_dinfo[start]) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read source datasets");
+    } /* end for */
+
+done:
+    /* Release allocated resources */
+    if (source_dinfo) {
+        for (u = 0; u < nprojected; u++)
+            if (H5S_close(source_dinfo[u].file_space) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close projected source space");
+        H5MM_xfree(source_dinfo);
+    } /* end if */
+    H5MM_xfree(source_ent);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__virtual_read_sources() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__virtual_read
  *
@@ -2722,7 +3431,7 @@ H5D__virtual_read(H5D_io_info_t H5_ATTR_NDEBUG_UNUSED *io_info, H5D_dset_io_info
     hsize_t                tot_nelmts;          /* Total number of elements mapped to mem_space */
     H5S_t                 *fill_space = NULL;   /* Space to fill with fill value */
     size_t                 nelmts;              /* Number of elements to process */
-    size_t                 i, j;                /* Local index variables */
+    size_t                 i, j, u;             /* Local index variables */
     herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -2750,23 +3459,32 @@ H5D__virtual_read(H5D_io_info_t H5_ATTR_NDEBUG_UNUSED *io_info, H5D_dset_io_info
     if (H5D__virtual_pre_io(dset_info, storage, dset_info->file_space, dset_info->mem_space, &tot_nelmts) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to prepare for I/O operation");
 
-    /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
-        /* Sanity check that the virtual space has been patched by now */
-        assert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
+    /* Read the source datasets of each source file together if the mappings
+     * are disjoint */
+    if (storage->index_disjoint && storage->io_nused > 1) {
+        if (H5D__virtual_read_sources(dset_info, storage) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read source datasets");
+    } /* end if */
+    else
+        /* Iterate over mappings */
+        for (u = 0; u < storage->io_nused; u++) {
+            i = storage->io_list[u];
 
-        /* Check for "printf" source dataset resolution */
-        if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
-            /* Iterate over sub-source dsets */
-            for (j = storage->list[i].sub_dset_io_start; j < storage->list[i].sub_dset_io_end; j++)
-                if (H5D__virtual_read_one(dset_info, &storage->list[i].sub_dset[j]) < 0)
+            /* Sanity check that the virtual space has been patched by now */
+            assert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
+
+            /* Check for "printf" source dataset resolution */
+            if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
+                /* Iterate over sub-source dsets */
+                for (j = storage->list[i].sub_dset_io_start; j < storage->list[i].sub_dset_io_end; j++)
+                    if (H5D__virtual_read_one(dset_info, &storage->list[i].sub_dset[j]) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read source dataset");
+            } /* end if */
+            else
+                /* Read from source dataset */
+                if (H5D__virtual_read_one(dset_info, &storage->list[i].source_dset) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read source dataset");
-        } /* end if */
-        else
-            /* Read from source dataset */
-            if (H5D__virtual_read_one(dset_info, &storage->list[i].source_dset) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read source dataset");
-    } /* end for */
+        } /* end for */
 
     /* Fill unmapped part of buffer with fill value */
     if (tot_nelmts < nelmts) {
@@ -2783,7 +3501,9 @@ H5D__virtual_read(H5D_io_info_t H5_ATTR_NDEBUG_UNUSED *io_info, H5D_dset_io_info
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "unable to copy memory selection");
 
             /* Iterate over mappings */
-            for (i = 0; i < storage->list_nused; i++)
+            for (u = 0; u < storage->io_nused; u++) {
+                i = storage->io_list[u];
+
                 /* Check for "printf" source dataset resolution */
                 if (storage->list[i].psfn_nsubs || storage->list[i].psdn_nsubs) {
                     /* Iterate over sub-source dsets */
@@ -2797,6 +3517,7 @@ H5D__virtual_read(H5D_io_info_t H5_ATTR_NDEBUG_UNUSED *io_info, H5D_dset_io_info
                     /* Subtract projected memory space from fill space */
                     if (H5S_select_subtract(fill_space, storage->list[i].source_dset.projected_mem_space) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTCLIP, FAIL, "unable to clip fill selection");
+            } /* end for */
 
             /* Write fill values to memory buffer */
             if (H5D__fill(dset_info->dset->shared->dcpl_cache.fill.buf, dset_info->dset->shared->type,
@@ -2918,7 +3639,7 @@ H5D__virtual_write(H5D_io_info_t H5_ATTR_NDEBUG_UNUSED *io_info, H5D_dset_io_inf
     H5O_storage_virtual_t *storage;             /* Convenient pointer into layout struct */
     hsize_t                tot_nelmts;          /* Total number of elements mapped to mem_space */
     size_t                 nelmts;              /* Number of elements to process */
-    size_t                 i, j;                /* Local index variables */
+    size_t                 i, j, u;             /* Local index variables */
     herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -2953,7 +3674,9 @@ H5D__virtual_write(H5D_io_info_t H5_ATTR_NDEBUG_UNUSED *io_info, H5D_dset_io_inf
                     "write requested to unmapped portion of virtual dataset");
 
     /* Iterate over mappings */
-    for (i = 0; i < storage->list_nused; i++) {
+    for (u = 0; u < storage->io_nused; u++) {
+        i = storage->io_list[u];
+
         /* Sanity check that virtual space has been patched by now */
         assert(storage->list[i].virtual_space_status == H5O_VIRTUAL_STATUS_CORRECT);
 
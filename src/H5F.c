@@ -1911,6 +1911,50 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_mdc_hit_rate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_mdc_mrc
+ *
+ * Purpose:     Retrieves the metadata cache's current estimate of its
+ *              miss ratio curve, as maintained by the H5C_incr__mrc
+ *              automatic resize mode.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_mdc_mrc(hid_t file_id, size_t *npoints /*in,out*/, size_t cache_sizes[] /*out*/,
+               double miss_ratios[] /*out*/)
+{
+    H5VL_object_t                   *vol_obj;
+    H5VL_optional_args_t             vol_cb_args;         /* Arguments to VOL callback */
+    H5VL_native_file_optional_args_t file_opt_args;       /* Arguments for optional operation */
+    herr_t                           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "i*zxx", file_id, npoints, cache_sizes, miss_ratios);
+
+    /* Check args */
+    if (NULL == npoints)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL npoints pointer");
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID");
+
+    /* Set up VOL callback arguments */
+    file_opt_args.get_mdc_mrc.npoints     = npoints;
+    file_opt_args.get_mdc_mrc.cache_sizes = cache_sizes;
+    file_opt_args.get_mdc_mrc.miss_ratios = miss_ratios;
+    vol_cb_args.op_type                   = H5VL_NATIVE_FILE_GET_MDC_MRC;
+    vol_cb_args.args                      = &file_opt_args;
+
+    /* Get the estimated miss ratio curve */
+    if (H5VL_file_optional(vol_obj, &vol_cb_args, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to get MDC miss ratio curve");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_mdc_mrc() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_size
  *
@@ -2586,6 +2630,46 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_page_buffering_stats() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_metadata_accum_stats
+ *
+ * Purpose:     Retrieves statistics for the metadata accumulator.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_metadata_accum_stats(hid_t file_id, unsigned *flushes /*out*/, unsigned *flushed_regions /*out*/,
+                            unsigned *evictions /*out*/)
+{
+    H5VL_object_t                   *vol_obj;             /* File object */
+    H5VL_optional_args_t             vol_cb_args;         /* Arguments to VOL callback */
+    H5VL_native_file_optional_args_t file_opt_args;       /* Arguments for optional operation */
+    herr_t                           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", file_id, flushes, flushed_regions, evictions);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID");
+
+    /* Set up VOL callback arguments */
+    file_opt_args.get_metadata_accum_stats.flushes         = flushes;
+    file_opt_args.get_metadata_accum_stats.flushed_regions = flushed_regions;
+    file_opt_args.get_metadata_accum_stats.evictions       = evictions;
+    vol_cb_args.op_type                                    = H5VL_NATIVE_FILE_GET_METADATA_ACCUM_STATS;
+    vol_cb_args.args                                       = &file_opt_args;
+
+    /* Get the statistics */
+    if (H5VL_file_optional(vol_obj, &vol_cb_args, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for metadata accumulator");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_metadata_accum_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_image_info
  *
@@ -27,6 +27,7 @@
 #include "H5Iprivate.h"  /* IDs                          */
 #include "H5MMprivate.h" /* Memory management            */
 #include "H5Pprivate.h"  /* Property lists               */
+#include "H5Sprivate.h"  /* Dataspaces                   */
 #include "H5SLprivate.h" /* Skip lists                   */
 
 /* The driver identification number, initialized at runtime */
@@ -103,6 +104,17 @@ typedef struct H5FD_core_fapl_t {
 #define H5FD_CORE_WRITE_TRACKING_FLAG      FALSE
 #define H5FD_CORE_WRITE_TRACKING_PAGE_SIZE 524288
 
+/* Largest clean gap between two dirty regions that a flush writes over,
+ * in order to write both regions with a single call
+ */
+#define H5FD_CORE_FLUSH_MAX_GAP 65536
+
+/* Number of vector pieces whose dirty regions are tracked on the stack */
+#define H5FD_CORE_LOCAL_VECTOR_LEN 8
+
+/* Length of the sequence lists used for selection reads */
+#define H5FD_CORE_SEQ_LIST_LEN 128
+
 /* These macros check for overflow of various quantities.  These macros
  * assume that file_offset_t is signed and haddr_t and size_t are unsigned.
  *
@@ -124,6 +136,11 @@ typedef struct H5FD_core_fapl_t {
 
 /* Prototypes */
 static herr_t  H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
+static herr_t  H5FD__core_add_dirty_regions(H5FD_core_t *file, uint32_t count, const haddr_t addrs[],
+                                            const size_t sizes[]);
+static int     H5FD__core_region_cmp(const void *_r1, const void *_r2);
+static herr_t  H5FD__core_extend(H5FD_core_t *file, haddr_t end);
+static void    H5FD__core_copy_out(const H5FD_core_t *file, haddr_t addr, size_t size, void *buf);
 static herr_t  H5FD__core_destroy_dirty_list(H5FD_core_t *file);
 static herr_t  H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
 static herr_t  H5FD__core_term(void);
@@ -140,6 +157,13 @@ static herr_t  H5FD__core_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
                                void *buf);
 static herr_t  H5FD__core_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                 const void *buf);
+static herr_t  H5FD__core_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                      haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__core_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                       haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__core_read_selection(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+                                         hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                                         size_t element_sizes[], void *bufs[]);
 static herr_t  H5FD__core_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__core_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__core_lock(H5FD_t *_file, hbool_t rw);
@@ -148,46 +172,46 @@ static herr_t  H5FD__core_delete(const char *filename, hid_t fapl_id);
 static inline const H5FD_core_fapl_t *H5FD__core_get_default_config(void);
 
 static const H5FD_class_t H5FD_core_g = {
-    H5FD_CLASS_VERSION,       /* struct version       */
-    H5FD_CORE_VALUE,          /* value                */
-    "core",                   /* name                 */
-    MAXADDR,                  /* maxaddr              */
-    H5F_CLOSE_WEAK,           /* fc_degree            */
-    H5FD__core_term,          /* terminate            */
-    NULL,                     /* sb_size              */
-    NULL,                     /* sb_encode            */
-    NULL,                     /* sb_decode            */
-    sizeof(H5FD_core_fapl_t), /* fapl_size            */
-    H5FD__core_fapl_get,      /* fapl_get             */
-    NULL,                     /* fapl_copy            */
-    NULL,                     /* fapl_free            */
-    0,                        /* dxpl_size            */
-    NULL,                     /* dxpl_copy            */
-    NULL,                     /* dxpl_free            */
-    H5FD__core_open,          /* open                 */
-    H5FD__core_close,         /* close                */
-    H5FD__core_cmp,           /* cmp                  */
-    H5FD__core_query,         /* query                */
-    NULL,                     /* get_type_map         */
-    NULL,                     /* alloc                */
-    NULL,                     /* free                 */
-    H5FD__core_get_eoa,       /* get_eoa              */
-    H5FD__core_set_eoa,       /* set_eoa              */
-    H5FD__core_get_eof,       /* get_eof              */
-    H5FD__core_get_handle,    /* get_handle           */
-    H5FD__core_read,          /* read                 */
-    H5FD__core_write,         /* write                */
-    NULL,                     /* read_vector          */
-    NULL,                     /* write_vector         */
-    NULL,                     /* read_selection       */
-    NULL,                     /* write_selection      */
-    H5FD__core_flush,         /* flush                */
-    H5FD__core_truncate,      /* truncate             */
-    H5FD__core_lock,          /* lock                 */
-    H5FD__core_unlock,        /* unlock               */
-    H5FD__core_delete,        /* del                  */
-    NULL,                     /* ctl                  */
-    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+    H5FD_CLASS_VERSION,        /* struct version       */
+    H5FD_CORE_VALUE,           /* value                */
+    "core",                    /* name                 */
+    MAXADDR,                   /* maxaddr              */
+    H5F_CLOSE_WEAK,            /* fc_degree            */
+    H5FD__core_term,           /* terminate            */
+    NULL,                      /* sb_size              */
+    NULL,                      /* sb_encode            */
+    NULL,                      /* sb_decode            */
+    sizeof(H5FD_core_fapl_t),  /* fapl_size            */
+    H5FD__core_fapl_get,       /* fapl_get             */
+    NULL,                      /* fapl_copy            */
+    NULL,                      /* fapl_free            */
+    0,                         /* dxpl_size            */
+    NULL,                      /* dxpl_copy            */
+    NULL,                      /* dxpl_free            */
+    H5FD__core_open,           /* open                 */
+    H5FD__core_close,          /* close                */
+    H5FD__core_cmp,            /* cmp                  */
+    H5FD__core_query,          /* query                */
+    NULL,                      /* get_type_map         */
+    NULL,                      /* alloc                */
+    NULL,                      /* free                 */
+    H5FD__core_get_eoa,        /* get_eoa              */
+    H5FD__core_set_eoa,        /* set_eoa              */
+    H5FD__core_get_eof,        /* get_eof              */
+    H5FD__core_get_handle,     /* get_handle           */
+    H5FD__core_read,           /* read                 */
+    H5FD__core_write,          /* write                */
+    H5FD__core_read_vector,    /* read_vector          */
+    H5FD__core_write_vector,   /* write_vector         */
+    H5FD__core_read_selection, /* read_selection       */
+    NULL,                      /* write_selection      */
+    H5FD__core_flush,          /* flush                */
+    H5FD__core_truncate,       /* truncate             */
+    H5FD__core_lock,           /* lock                 */
+    H5FD__core_unlock,         /* unlock               */
+    H5FD__core_delete,         /* del                  */
+    NULL,                      /* ctl                  */
+    H5FD_FLMAP_DICHOTOMY       /* fl_map               */
 };
 
 /* Default configurations, if none provided */
@@ -198,6 +222,9 @@ static const H5FD_core_fapl_t H5FD_core_default_paged_config_g = {(size_t)H5_MB,
 /* Define a free list to manage the region type */
 H5FL_DEFINE(H5FD_core_region_t);
 
+/* Declare extern free list to manage the H5S_sel_iter_t struct */
+H5FL_EXTERN(H5S_sel_iter_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_add_dirty_region
  *
@@ -304,6 +331,123 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_add_dirty_region() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_region_cmp
+ *
+ * Purpose:     Compares two dirty regions by their starting address, for
+ *              sorting with qsort().
+ *
+ * Return:      <0, 0, >0, like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__core_region_cmp(const void *_r1, const void *_r2)
+{
+    const H5FD_core_region_t *r1 = (const H5FD_core_region_t *)_r1;
+    const H5FD_core_region_t *r2 = (const H5FD_core_region_t *)_r2;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI((r1->start > r2->start) - (r1->start < r2->start))
+} /* end H5FD__core_region_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_add_dirty_regions
+ *
+ * Purpose:     Add the regions written by a vector write to the dirty
+ *              list.  The pieces are sorted by address and pieces that
+ *              touch or overlap once rounded out to the backing store
+ *              page size are merged, so that the skip list is only
+ *              updated once per resulting range instead of once per
+ *              piece.
+ *
+ *              The size vector follows the vector I/O convention that a
+ *              size of 0 means "same as the previous size" for the rest
+ *              of the vector.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_add_dirty_regions(H5FD_core_t *file, uint32_t count, const haddr_t addrs[], const size_t sizes[])
+{
+    H5FD_core_region_t  local_regions[H5FD_CORE_LOCAL_VECTOR_LEN]; /* Regions for short vectors */
+    H5FD_core_region_t *regions      = local_regions; /* Regions being added */
+    size_t              nregions     = 0;             /* Number of regions */
+    size_t              size         = 0;             /* Size of current piece */
+    hbool_t             extend_sizes = FALSE;         /* Whether the remaining sizes repeat the last one */
+    hbool_t             sorted       = TRUE;          /* Whether regions are in order */
+    hsize_t             page_size;                    /* Backing store page size */
+    uint32_t            i;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+    assert(file->dirty_list);
+    assert(count == 0 || (addrs && sizes));
+
+    page_size = (hsize_t)file->bstore_page_size;
+
+    if (count > H5FD_CORE_LOCAL_VECTOR_LEN)
+        if (NULL == (regions = (H5FD_core_region_t *)H5MM_malloc(count * sizeof(H5FD_core_region_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate dirty region array");
+
+    /* Build the list of non-empty regions, rounded out to page boundaries */
+    for (i = 0; i < count; i++) {
+        if (!extend_sizes) {
+            if (sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                size = sizes[i];
+        } /* end if */
+        if (size == 0)
+            continue;
+
+        regions[nregions].start = (addrs[i] / page_size) * page_size;
+        regions[nregions].end   = (((addrs[i] + size - 1) / page_size) + 1) * page_size - 1;
+        if (nregions > 0 && regions[nregions].start < regions[nregions - 1].start)
+            sorted = FALSE;
+        nregions++;
+    } /* end for */
+
+    if (nregions > 0) {
+        size_t merged = 0;
+        size_t u;
+
+        if (!sorted)
+            qsort(regions, nregions, sizeof(H5FD_core_region_t), H5FD__core_region_cmp);
+
+        /* Merge adjacent and overlapping regions in place */
+        for (u = 1; u < nregions; u++) {
+            if (regions[u].start <= regions[merged].end + 1) {
+                if (regions[u].end > regions[merged].end)
+                    regions[merged].end = regions[u].end;
+            } /* end if */
+            else
+                regions[++merged] = regions[u];
+        } /* end for */
+
+        /* Insert the merged regions into the skip list */
+        for (u = 0; u <= merged; u++) {
+            if (regions[u].end >= file->eof)
+                regions[u].end = file->eof - 1;
+            if (H5FD__core_add_dirty_region(file, regions[u].start, regions[u].end) != SUCCEED)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL,
+                            "unable to add core VFD dirty region - addresses: start=%llu end=%llu",
+                            (unsigned long long)regions[u].start, (unsigned long long)regions[u].end);
+        } /* end for */
+    }     /* end if */
+
+done:
+    if (regions != local_regions)
+        H5MM_xfree(regions);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_add_dirty_regions() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_destroy_dirty_list
  *
@@ -1260,6 +1404,109 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_get_handle() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_copy_out
+ *
+ * Purpose:     Copies SIZE bytes at address ADDR out of the memory image
+ *              into BUF.  The part of the range that lies beyond the end
+ *              of the image is returned as zeros.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__core_copy_out(const H5FD_core_t *file, haddr_t addr, size_t size, void *buf)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(file);
+    assert(buf || size == 0);
+
+    /* Read the part which is before the EOF marker */
+    if (addr < file->eof) {
+        size_t nbytes;
+#ifndef NDEBUG
+        hsize_t temp_nbytes;
+
+        temp_nbytes = file->eof - addr;
+        H5_CHECK_OVERFLOW(temp_nbytes, hsize_t, size_t);
+        nbytes = MIN(size, (size_t)temp_nbytes);
+#else  /* NDEBUG */
+        nbytes = MIN(size, (size_t)(file->eof - addr));
+#endif /* NDEBUG */
+
+        H5MM_memcpy(buf, file->mem + addr, nbytes);
+        size -= nbytes;
+        buf = (char *)buf + nbytes;
+    }
+
+    /* Read zeros for the part which is after the EOF markers */
+    if (size > 0)
+        memset(buf, 0, size);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__core_copy_out() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_extend
+ *
+ * Purpose:     Grows the memory image so that it covers at least END
+ *              bytes, rounding the new size up to a multiple of the
+ *              allocation increment.  The new part of the image is
+ *              zero-filled.  If the allocation fails the file is left
+ *              in a usable state.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_extend(H5FD_core_t *file, haddr_t end)
+{
+    unsigned char *x;
+    size_t         new_eof;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (end <= file->eof)
+        HGOTO_DONE(SUCCEED);
+
+    /* Determine new size of memory buffer */
+    H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * (end / file->increment), hsize_t);
+    if (end % file->increment)
+        new_eof += file->increment;
+
+    /*
+     * Be careful of non-Posix realloc() that doesn't understand what to do
+     * when the first argument is null.
+     */
+    /* (Re)allocate memory for the file buffer, using callbacks if available */
+    if (file->fi_callbacks.image_realloc) {
+        if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
+                         file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                        "unable to allocate memory block of %llu bytes with callback",
+                        (unsigned long long)new_eof);
+    } /* end if */
+    else {
+        if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes",
+                        (unsigned long long)new_eof);
+    } /* end else */
+
+    memset(x + file->eof, 0, (size_t)(new_eof - file->eof));
+    file->mem = x;
+
+    file->eof = new_eof;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_extend() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_read
  *
@@ -1291,28 +1538,8 @@ H5FD__core_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed");
 
-    /* Read the part which is before the EOF marker */
-    if (addr < file->eof) {
-        size_t nbytes;
-#ifndef NDEBUG
-        hsize_t temp_nbytes;
-
-        temp_nbytes = file->eof - addr;
-        H5_CHECK_OVERFLOW(temp_nbytes, hsize_t, size_t);
-        nbytes = MIN(size, (size_t)temp_nbytes);
-#else  /* NDEBUG */
-        nbytes = MIN(size, (size_t)(file->eof - addr));
-#endif /* NDEBUG */
-
-        H5MM_memcpy(buf, file->mem + addr, nbytes);
-        size -= nbytes;
-        addr += nbytes;
-        buf = (char *)buf + nbytes;
-    }
-
-    /* Read zeros for the part which is after the EOF markers */
-    if (size > 0)
-        memset(buf, 0, size);
+    /* Copy the data out of the memory image */
+    H5FD__core_copy_out(file, addr, size, buf);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1345,40 +1572,9 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed");
 
-    /*
-     * Allocate more memory if necessary, careful of overflow. Also, if the
-     * allocation fails then the file should remain in a usable state.  Be
-     * careful of non-Posix realloc() that doesn't understand what to do when
-     * the first argument is null.
-     */
-    if (addr + size > file->eof) {
-        unsigned char *x;
-        size_t         new_eof;
-
-        /* Determine new size of memory buffer */
-        H5_CHECKED_ASSIGN(new_eof, size_t, file->increment * ((addr + size) / file->increment), hsize_t);
-        if ((addr + size) % file->increment)
-            new_eof += file->increment;
-
-        /* (Re)allocate memory for the file buffer, using callbacks if available */
-        if (file->fi_callbacks.image_realloc) {
-            if (NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(
-                             file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes with callback",
-                            (unsigned long long)new_eof);
-        } /* end if */
-        else {
-            if (NULL == (x = (unsigned char *)H5MM_realloc(file->mem, new_eof)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                            "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof);
-        } /* end else */
-
-        memset(x + file->eof, 0, (size_t)(new_eof - file->eof));
-        file->mem = x;
-
-        file->eof = new_eof;
-    } /* end if */
+    /* Allocate more memory if necessary */
+    if (H5FD__core_extend(file, addr + size) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to extend memory image");
 
     /* Add the buffer region to the dirty list if using that optimization */
     if (file->dirty_list) {
@@ -1402,6 +1598,301 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_vector
+ *
+ * Purpose:     Reads a vector of pieces from the memory image in a single
+ *              pass.  Parts of pieces beyond the end of the image are
+ *              returned as zeros, as with H5FD__core_read().
+ *
+ *              The sizes and types vectors follow the usual convention
+ *              that a size of 0 or a type of H5FD_MEM_NOLIST means "same
+ *              as the previous entry" for the rest of the vector.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                       H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                       void *bufs[] /*out*/)
+{
+    H5FD_core_t *file         = (H5FD_core_t *)_file;
+    size_t       size         = 0;     /* Size of current piece */
+    hbool_t      extend_sizes = FALSE; /* Whether the remaining sizes repeat the last one */
+    uint32_t     i;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || (addrs && sizes && bufs));
+
+    /* Validate all the pieces before touching any buffer */
+    for (i = 0; i < count; i++) {
+        if (!extend_sizes) {
+            if (sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                size = sizes[i];
+        } /* end if */
+        if (HADDR_UNDEF == addrs[i] || REGION_OVERFLOW(addrs[i], size))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed");
+    } /* end for */
+
+    /* Copy each piece out of the memory image */
+    size         = 0;
+    extend_sizes = FALSE;
+    for (i = 0; i < count; i++) {
+        if (!extend_sizes) {
+            if (sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                size = sizes[i];
+        } /* end if */
+        H5FD__core_copy_out(file, addrs[i], size, bufs[i]);
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_write_vector
+ *
+ * Purpose:     Writes a vector of pieces to the memory image in a single
+ *              pass.  The image is grown at most once, to cover the
+ *              furthest piece, and the pieces' dirty regions are sorted
+ *              and merged before being added to the dirty list.
+ *
+ *              Pieces are copied in vector order, so when pieces overlap
+ *              the later one wins, as if they had been written one at a
+ *              time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                        H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                        const void *bufs[])
+{
+    H5FD_core_t *file         = (H5FD_core_t *)_file;
+    haddr_t      max_end      = 0;     /* End of the furthest piece */
+    size_t       size         = 0;     /* Size of current piece */
+    hbool_t      extend_sizes = FALSE; /* Whether the remaining sizes repeat the last one */
+    uint32_t     i;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || (addrs && sizes && bufs));
+
+    /* Validate all the pieces and find the furthest one */
+    for (i = 0; i < count; i++) {
+        if (!extend_sizes) {
+            if (sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                size = sizes[i];
+        } /* end if */
+        if (HADDR_UNDEF == addrs[i] || REGION_OVERFLOW(addrs[i], size))
+            HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed");
+        if (addrs[i] + size > max_end)
+            max_end = addrs[i] + size;
+    } /* end for */
+
+    /* Allocate more memory if necessary, once for the whole vector */
+    if (H5FD__core_extend(file, max_end) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to extend memory image");
+
+    /* Add the written regions to the dirty list if using that optimization */
+    if (file->dirty_list)
+        if (H5FD__core_add_dirty_regions(file, count, addrs, sizes) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL,
+                        "unable to add core VFD dirty regions during vector write call");
+
+    /* Write each piece from its buffer to memory */
+    size         = 0;
+    extend_sizes = FALSE;
+    for (i = 0; i < count; i++) {
+        if (!extend_sizes) {
+            if (sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                size = sizes[i];
+        } /* end if */
+        if (size > 0)
+            H5MM_memcpy(file->mem + addrs[i], bufs[i], size);
+    } /* end for */
+
+    /* Mark memory buffer as modified */
+    if (count > 0)
+        file->dirty = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_selection
+ *
+ * Purpose:     Reads a set of selections from the memory image.  Since
+ *              the whole file is in memory, each pair of file and memory
+ *              sequences is copied directly between the image and the
+ *              caller's buffer, without first being turned into a vector
+ *              of addresses.
+ *
+ *              The element_sizes and bufs arrays follow the selection I/O
+ *              convention that a value of 0 or NULL means "same as the
+ *              previous entry" for the rest of the arrays.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_selection(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                          size_t count, hid_t mem_space_ids[], hid_t file_space_ids[], haddr_t offsets[],
+                          size_t element_sizes[], void *bufs[] /*out*/)
+{
+    H5FD_core_t    *file        = (H5FD_core_t *)_file;
+    H5S_sel_iter_t *file_iter      = NULL;  /* File selection iterator */
+    H5S_sel_iter_t *mem_iter       = NULL;  /* Memory selection iterator */
+    hbool_t         file_iter_init = FALSE; /* Whether file_iter is initialized */
+    hbool_t         mem_iter_init  = FALSE; /* Whether mem_iter is initialized */
+    hsize_t         file_off[H5FD_CORE_SEQ_LIST_LEN]; /* File sequence offsets */
+    size_t          file_len[H5FD_CORE_SEQ_LIST_LEN]; /* File sequence lengths */
+    hsize_t         mem_off[H5FD_CORE_SEQ_LIST_LEN];  /* Memory sequence offsets */
+    size_t          mem_len[H5FD_CORE_SEQ_LIST_LEN];  /* Memory sequence lengths */
+    size_t          element_size = 0;
+    void           *buf          = NULL;
+    hbool_t         extend_sizes = FALSE; /* Whether the remaining element sizes repeat the last one */
+    hbool_t         extend_bufs  = FALSE; /* Whether the remaining buffers repeat the last one */
+    size_t          i;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || (mem_space_ids && file_space_ids && offsets && element_sizes && bufs));
+
+    /* Allocate the selection iterators */
+    if (NULL == (file_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "couldn't allocate file selection iterator");
+    if (NULL == (mem_iter = H5FL_MALLOC(H5S_sel_iter_t)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "couldn't allocate memory selection iterator");
+
+    for (i = 0; i < count; i++) {
+        H5S_t *file_space;
+        H5S_t *mem_space;
+        size_t file_seq_i = 0, mem_seq_i = 0; /* Current positions in the sequence lists */
+        size_t file_nseq = 0, mem_nseq = 0;   /* Number of sequences in the lists */
+        size_t seq_nelem;                      /* Number of elements in a sequence list */
+
+        /* Pick up this selection's element size and buffer */
+        if (!extend_sizes) {
+            if (element_sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                element_size = element_sizes[i];
+        } /* end if */
+        if (!extend_bufs) {
+            if (bufs[i] == NULL)
+                extend_bufs = TRUE;
+            else
+                buf = bufs[i];
+        } /* end if */
+
+        if (NULL == (file_space = (H5S_t *)H5I_object_verify(file_space_ids[i], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, FAIL, "file dataspace ID is not a dataspace");
+        if (NULL == (mem_space = (H5S_t *)H5I_object_verify(mem_space_ids[i], H5I_DATASPACE)))
+            HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, FAIL, "memory dataspace ID is not a dataspace");
+
+        /* Initialize the selection iterators */
+        if (H5S_select_iter_init(file_iter, file_space, element_size, 0) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize file selection iterator");
+        file_iter_init = TRUE;
+        if (H5S_select_iter_init(mem_iter, mem_space, element_size, 0) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize memory selection iterator");
+        mem_iter_init = TRUE;
+
+        /* Walk the file and memory sequences together */
+        for (;;) {
+            size_t io_len;
+
+            /* Refill the sequence lists as they are used up */
+            if (file_seq_i == file_nseq) {
+                file_seq_i = file_nseq = 0;
+                if (file_iter->elmt_left > 0 &&
+                    H5S_SELECT_ITER_GET_SEQ_LIST(file_iter, H5FD_CORE_SEQ_LIST_LEN, SIZE_MAX, &file_nseq,
+                                                 &seq_nelem, file_off, file_len) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "sequence length generation failed");
+            } /* end if */
+            if (mem_seq_i == mem_nseq) {
+                mem_seq_i = mem_nseq = 0;
+                if (mem_iter->elmt_left > 0 &&
+                    H5S_SELECT_ITER_GET_SEQ_LIST(mem_iter, H5FD_CORE_SEQ_LIST_LEN, SIZE_MAX, &mem_nseq,
+                                                 &seq_nelem, mem_off, mem_len) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "sequence length generation failed");
+            } /* end if */
+
+            /* Both selections must run out together */
+            if (file_nseq == 0 || mem_nseq == 0) {
+                if (file_nseq != mem_nseq)
+                    HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL,
+                                "file and memory selections have different numbers of elements");
+                break;
+            } /* end if */
+
+            /* Copy the overlap of the current file and memory sequences */
+            io_len = MIN(file_len[file_seq_i], mem_len[mem_seq_i]);
+            if (REGION_OVERFLOW(offsets[i] + file_off[file_seq_i], io_len))
+                HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed");
+            H5FD__core_copy_out(file, offsets[i] + file_off[file_seq_i], io_len,
+                                (uint8_t *)buf + mem_off[mem_seq_i]);
+
+            /* Advance past the copied bytes */
+            if (file_len[file_seq_i] == io_len)
+                file_seq_i++;
+            else {
+                file_off[file_seq_i] += io_len;
+                file_len[file_seq_i] -= io_len;
+            } /* end else */
+            if (mem_len[mem_seq_i] == io_len)
+                mem_seq_i++;
+            else {
+                mem_off[mem_seq_i] += io_len;
+                mem_len[mem_seq_i] -= io_len;
+            } /* end else */
+        }     /* end for */
+
+        /* Release the selection iterators */
+        file_iter_init = FALSE;
+        if (H5S_SELECT_ITER_RELEASE(file_iter) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "can't release file selection iterator");
+        mem_iter_init = FALSE;
+        if (H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "can't release memory selection iterator");
+    } /* end for */
+
+done:
+    /* Cleanup on error */
+    if (file_iter_init && H5S_SELECT_ITER_RELEASE(file_iter) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "can't release file selection iterator");
+    if (file_iter)
+        file_iter = H5FL_FREE(H5S_sel_iter_t, file_iter);
+    if (mem_iter_init && H5S_SELECT_ITER_RELEASE(mem_iter) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "can't release memory selection iterator");
+    if (mem_iter)
+        mem_iter = H5FL_FREE(H5S_sel_iter_t, mem_iter);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_selection() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__core_flush
  *
@@ -1425,27 +1916,50 @@ H5FD__core_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UN
 
         /* Use the dirty list, if available */
         if (file->dirty_list) {
-            H5FD_core_region_t *item = NULL;
-            size_t              size;
-
+            H5FD_core_region_t *item      = NULL;
+            haddr_t             run_start = HADDR_UNDEF; /* Start of the range waiting to be written */
+            haddr_t             run_end   = 0;           /* End of the range waiting to be written */
+
+            /* The regions come out of the skip list in address order.  Dirty
+             * regions separated by only a small clean gap are coalesced into
+             * a single range, since the image is contiguous and the gap holds
+             * the same bytes as the backing store, and one larger write is
+             * much cheaper than several small ones.
+             */
             while (NULL != (item = (H5FD_core_region_t *)H5SL_remove_first(file->dirty_list))) {
+                haddr_t start = item->start;
+                haddr_t end   = item->end;
+
+                item = H5FL_FREE(H5FD_core_region_t, item);
 
                 /* The file may have been truncated, so check for that
                  * and skip or adjust as necessary.
                  */
-                if (item->start < file->eof) {
-                    if (item->end >= file->eof)
-                        item->end = file->eof - 1;
-
-                    size = (size_t)((item->end - item->start) + 1);
-
-                    if (H5FD__core_write_to_bstore(file, item->start, size) != SUCCEED)
-                        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store");
+                if (start >= file->eof)
+                    continue;
+                if (end >= file->eof)
+                    end = file->eof - 1;
+
+                if (H5_addr_defined(run_start) && start <= run_end + 1 + H5FD_CORE_FLUSH_MAX_GAP) {
+                    if (end > run_end)
+                        run_end = end;
                 } /* end if */
-
-                item = H5FL_FREE(H5FD_core_region_t, item);
-            } /* end while */
-
+                else {
+                    if (H5_addr_defined(run_start))
+                        if (H5FD__core_write_to_bstore(file, run_start,
+                                                       (size_t)((run_end - run_start) + 1)) != SUCCEED)
+                            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store");
+
+                    run_start = start;
+                    run_end   = end;
+                } /* end else */
+            }     /* end while */
+
+            /* Write out the last range */
+            if (H5_addr_defined(run_start))
+                if (H5FD__core_write_to_bstore(file, run_start, (size_t)((run_end - run_start) + 1)) !=
+                    SUCCEED)
+                    HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store");
         } /* end if */
         /* Otherwise, write the entire file out at once */
         else {
@@ -41,6 +41,23 @@ static htri_t ignore_disabled_file_locks_s = FAIL;
 #define OP_READ    1
 #define OP_WRITE   2
 
+/* Number of free bounce buffers kept for reuse */
+#define H5FD_DIRECT_BOUNCE_POOL_LEN 4
+
+/* Whether an I/O request is aligned well enough to be done directly from
+ * the application's buffer
+ */
+#define H5FD_DIRECT_IS_ALIGNED(F, A, Z, B)                                                                  \
+    (((A) % (F)->fa.fbsize == 0) && ((Z) % (F)->fa.fbsize == 0) && ((size_t)(B) % (F)->fa.mboundary == 0))
+
+/* Round an address up to the next file block boundary */
+#define H5FD_DIRECT_BLOCK_CEIL(A, BS) ((((A) + (BS)-1) / (BS)) * (BS))
+
+/* Size of entry I of a vector I/O size array, whose first N entries are
+ * non-zero, with the last of those repeating for the rest of the vector
+ */
+#define H5FD_DIRECT_VEC_SIZE(S, N, I) ((I) < (N) ? (S)[I] : (S)[(N)-1])
+
 /* Driver-specific file access properties */
 typedef struct H5FD_direct_fapl_t {
     size_t  mboundary;  /* Memory boundary for alignment    */
@@ -93,6 +110,13 @@ typedef struct H5FD_direct_t {
 
 } H5FD_direct_t;
 
+/* A free aligned bounce buffer, kept for reuse by later unaligned I/O */
+typedef struct H5FD_direct_bounce_t {
+    void  *buf;      /* Aligned buffer, NULL if the slot is empty */
+    size_t size;     /* Size of the buffer */
+    size_t boundary; /* Memory alignment of the buffer */
+} H5FD_direct_bounce_t;
+
 /*
  * These macros check for overflow of various quantities.  These macros
  * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
@@ -132,6 +156,21 @@ static herr_t  H5FD__direct_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id,
                                  void *buf);
 static herr_t  H5FD__direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                   const void *buf);
+static herr_t  H5FD__direct_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                        haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__direct_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                         haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__direct_bounce_acquire(size_t boundary, size_t size, void **buf, size_t *buf_size);
+static void    H5FD__direct_bounce_release(void *buf, size_t buf_size, size_t boundary);
+static void    H5FD__direct_split(const H5FD_direct_t *file, haddr_t addr, size_t size, const void *buf,
+                                  size_t *head, size_t *mid);
+static herr_t  H5FD__direct_read_aligned(H5FD_direct_t *file, haddr_t addr, size_t size, void *buf);
+static herr_t  H5FD__direct_read_bounce(H5FD_direct_t *file, haddr_t addr, size_t size, void *buf);
+static herr_t  H5FD__direct_write_aligned(H5FD_direct_t *file, haddr_t addr, size_t size, const void *buf);
+static herr_t  H5FD__direct_write_bounce(H5FD_direct_t *file, haddr_t addr, size_t size, const void *buf);
+static uint32_t H5FD__direct_vector_run(const H5FD_direct_t *file, uint32_t start, uint32_t count,
+                                        const haddr_t addrs[], const size_t sizes[], uint32_t nsizes,
+                                        haddr_t *span_addr, size_t *span_size);
 static herr_t  H5FD__direct_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__direct_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__direct_unlock(H5FD_t *_file);
@@ -167,8 +206,8 @@ static const H5FD_class_t H5FD_direct_g = {
     H5FD__direct_get_handle,    /* get_handle           */
     H5FD__direct_read,          /* read                 */
     H5FD__direct_write,         /* write                */
-    NULL,                       /* read_vector          */
-    NULL,                       /* write_vector         */
+    H5FD__direct_read_vector,   /* read_vector          */
+    H5FD__direct_write_vector,  /* write_vector         */
     NULL,                       /* read_selection       */
     NULL,                       /* write_selection      */
     NULL,                       /* flush                */
@@ -183,6 +222,9 @@ static const H5FD_class_t H5FD_direct_g = {
 /* Declare a free list to manage the H5FD_direct_t struct */
 H5FL_DEFINE_STATIC(H5FD_direct_t);
 
+/* Free bounce buffers, shared by all files opened with this driver */
+static H5FD_direct_bounce_t H5FD_direct_bounce_pool_g[H5FD_DIRECT_BOUNCE_POOL_LEN];
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_direct_init
  *
@@ -236,8 +278,18 @@ done:
 static herr_t
 H5FD__direct_term(void)
 {
+    size_t u;
+
     FUNC_ENTER_PACKAGE_NOERR
 
+    /* Release the pooled bounce buffers */
+    /* (Free with free since they came from posix_memalign) */
+    for (u = 0; u < H5FD_DIRECT_BOUNCE_POOL_LEN; u++) {
+        free(H5FD_direct_bounce_pool_g[u].buf);
+        H5FD_direct_bounce_pool_g[u].buf  = NULL;
+        H5FD_direct_bounce_pool_g[u].size = 0;
+    } /* end for */
+
     /* Reset VFL ID */
     H5FD_DIRECT_g = 0;
 
@@ -801,6 +853,308 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_bounce_acquire
+ *
+ * Purpose:  Gets an aligned bounce buffer of at least SIZE bytes for
+ *    copying unaligned data.  The smallest suitable buffer in the
+ *    pool is reused if there is one, otherwise a new buffer is
+ *    allocated.  The buffer's actual size is returned in BUF_SIZE
+ *    and must be passed back to H5FD__direct_bounce_release.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_bounce_acquire(size_t boundary, size_t size, void **buf, size_t *buf_size)
+{
+    H5FD_direct_bounce_t *best = NULL; /* Best fitting pooled buffer */
+    size_t                u;
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(buf);
+    assert(buf_size);
+
+    /* Look for the smallest pooled buffer that is big enough and aligned well enough */
+    for (u = 0; u < H5FD_DIRECT_BOUNCE_POOL_LEN; u++) {
+        H5FD_direct_bounce_t *slot = &H5FD_direct_bounce_pool_g[u];
+
+        if (slot->buf && slot->size >= size && (slot->boundary % boundary) == 0 &&
+            (!best || slot->size < best->size))
+            best = slot;
+    } /* end for */
+
+    if (best) {
+        *buf       = best->buf;
+        *buf_size  = best->size;
+        best->buf  = NULL;
+        best->size = 0;
+    } /* end if */
+    else {
+        /* NOTE: Use posix_memalign here, the buffer must be released with free() */
+        if (posix_memalign(buf, boundary, size) != 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "posix_memalign failed");
+        *buf_size = size;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_bounce_acquire() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_bounce_release
+ *
+ * Purpose:  Returns a bounce buffer from H5FD__direct_bounce_acquire to
+ *    the pool.  If the pool is full, the buffer replaces the
+ *    smallest pooled buffer if it is bigger, and is freed
+ *    otherwise.
+ *
+ * Return:  void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__direct_bounce_release(void *buf, size_t buf_size, size_t boundary)
+{
+    H5FD_direct_bounce_t *slot = NULL; /* Pool slot to keep the buffer in */
+    size_t                u;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(buf);
+
+    for (u = 0; u < H5FD_DIRECT_BOUNCE_POOL_LEN; u++) {
+        if (NULL == H5FD_direct_bounce_pool_g[u].buf) {
+            slot = &H5FD_direct_bounce_pool_g[u];
+            break;
+        } /* end if */
+        if (H5FD_direct_bounce_pool_g[u].size < buf_size &&
+            (!slot || H5FD_direct_bounce_pool_g[u].size < slot->size))
+            slot = &H5FD_direct_bounce_pool_g[u];
+    } /* end for */
+
+    /* Free with free since they came from posix_memalign */
+    if (slot) {
+        free(slot->buf);
+        slot->buf      = buf;
+        slot->size     = buf_size;
+        slot->boundary = boundary;
+    } /* end if */
+    else
+        free(buf);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__direct_bounce_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_split
+ *
+ * Purpose:  Splits an unaligned request into a head in the partial file
+ *    block at its start, a middle made of whole file blocks, and
+ *    a tail in the partial block at its end.  The middle is only
+ *    reported (MID > 0) if its place in BUF is aligned on the
+ *    memory boundary, so that it can be transferred without a
+ *    bounce buffer.
+ *
+ * Return:  void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__direct_split(const H5FD_direct_t *file, haddr_t addr, size_t size, const void *buf, size_t *head,
+                   size_t *mid)
+{
+    size_t offset = (size_t)(addr % file->fa.fbsize); /* Offset of ADDR in its file block */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    *head = offset ? MIN(size, file->fa.fbsize - offset) : 0;
+    *mid  = ((size - *head) / file->fa.fbsize) * file->fa.fbsize;
+    if (*mid > 0 && ((size_t)((const unsigned char *)buf + *head) % file->fa.mboundary) != 0)
+        *mid = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__direct_split() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_read_aligned
+ *
+ * Purpose:  Reads SIZE bytes at ADDR straight into BUF.  The request
+ *    must be aligned, unless the file system doesn't require it.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_read_aligned(H5FD_direct_t *file, haddr_t addr, size_t size, void *buf)
+{
+    ssize_t nbytes;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Seek to the correct location */
+    if ((addr != file->pos || OP_READ != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+
+    /* Read the aligned data in file first, being careful of interrupted
+     * system calls and partial results. */
+    while (size > 0) {
+        do {
+            nbytes = HDread(file->fd, buf, size);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        if (0 == nbytes) {
+            /* end of file but not end of format address space */
+            memset(buf, 0, size);
+            break;
+        }
+        assert(nbytes >= 0);
+        assert((size_t)nbytes <= size);
+        H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
+        size -= (size_t)nbytes;
+        H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
+        addr += (haddr_t)nbytes;
+        buf = (char *)buf + nbytes;
+
+        /* A partial result from an aligned read only happens at the end of
+         * the file, and the next read would not be aligned */
+        if (file->fa.must_align && size > 0) {
+            memset(buf, 0, size);
+            break;
+        }
+    }
+
+    /* Update current position */
+    file->pos = addr;
+    file->op  = OP_READ;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_read_aligned() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_read_bounce
+ *
+ * Purpose:  Reads SIZE bytes at ADDR into BUF by reading the file
+ *    blocks that contain them into an aligned bounce buffer and
+ *    copying the requested data out of it.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_read_bounce(H5FD_direct_t *file, haddr_t addr, size_t size, void *buf)
+{
+    ssize_t nbytes;
+    size_t  alloc_size;
+    void   *copy_buf      = NULL, *p2;
+    size_t  copy_buf_size = 0; /* Actual size of the bounce buffer */
+    size_t  _boundary;
+    size_t  _fbsize;
+    size_t  _cbsize;
+    haddr_t read_size;        /* Size to read into copy buffer */
+    size_t  copy_size = size; /* Size remaining to read when using copy buffer */
+    size_t  copy_offset;      /* Offset into copy buffer of the requested data */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Get the memory boundary for alignment, file system block size, and maximal
+     * copy buffer size.
+     */
+    _boundary = file->fa.mboundary;
+    _fbsize   = file->fa.fbsize;
+    _cbsize   = file->fa.cbsize;
+
+    /* Calculate where we will begin copying from the copy buffer */
+    copy_offset = (size_t)(addr % _fbsize);
+
+    /* Get a buffer for the Direct IO option, up to the maximal copy buffer
+     * size. Use a bigger buffer for aligned I/O if size is smaller than
+     * maximal copy buffer. */
+    alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
+    if (alloc_size > _cbsize)
+        alloc_size = _cbsize;
+    assert(!(alloc_size % _fbsize));
+    if (H5FD__direct_bounce_acquire(_boundary, alloc_size, &copy_buf, &copy_buf_size) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get bounce buffer");
+
+    /* look for the aligned position for reading the data */
+    assert(!(((addr / _fbsize) * _fbsize) % _fbsize));
+    if (HDlseek(file->fd, (HDoff_t)((addr / _fbsize) * _fbsize), SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+
+    /*
+     * Read the aligned data in file into aligned buffer first, then copy the data
+     * into the final buffer.  If the data size is bigger than maximal copy buffer
+     * size, do the reading by segment (the outer while loop).  If not, do one step
+     * reading.
+     */
+    do {
+        /* Read the aligned data in file first.  Not able to handle interrupted
+         * system calls and partial results like sec2 driver does because the
+         * data may no longer be aligned. It's especially true when the data in
+         * file is smaller than ALLOC_SIZE. */
+        memset(copy_buf, 0, alloc_size);
+
+        /* Calculate how much data we have to read in this iteration
+         * (including unused parts of blocks) */
+        if ((copy_size + copy_offset) < alloc_size)
+            read_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
+        else
+            read_size = alloc_size;
+
+        assert(!(read_size % _fbsize));
+        do {
+            nbytes = HDread(file->fd, copy_buf, read_size);
+        } while (-1 == nbytes && EINTR == errno);
+
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+        /* Copy the needed data from the copy buffer to the output
+         * buffer, and update copy_size.  If the copy buffer does not
+         * contain the rest of the data, just copy what's in the copy
+         * buffer and also update read_addr and copy_offset to read the
+         * next section of data. */
+        p2 = (unsigned char *)copy_buf + copy_offset;
+        if ((copy_size + copy_offset) <= alloc_size) {
+            H5MM_memcpy(buf, p2, copy_size);
+            buf       = (unsigned char *)buf + copy_size;
+            copy_size = 0;
+        } /* end if */
+        else {
+            H5MM_memcpy(buf, p2, alloc_size - copy_offset);
+            buf = (unsigned char *)buf + alloc_size - copy_offset;
+            copy_size -= alloc_size - copy_offset;
+            copy_offset = 0;
+        } /* end else */
+    } while (copy_size > 0);
+
+    /* Update current position */
+    file->pos = (haddr_t)(((addr + size - 1) / _fbsize + 1) * _fbsize);
+    file->op  = OP_READ;
+
+done:
+    if (copy_buf)
+        H5FD__direct_bounce_release(copy_buf, copy_buf_size, _boundary);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_read_bounce() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_read
  *
@@ -820,17 +1174,9 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
                   size_t size, void *buf /*out*/)
 {
     H5FD_direct_t *file = (H5FD_direct_t *)_file;
-    ssize_t        nbytes;
-    hbool_t        _must_align = TRUE;
-    herr_t         ret_value   = SUCCEED; /* Return value */
-    size_t         alloc_size;
-    void          *copy_buf = NULL, *p2;
-    size_t         _boundary;
-    size_t         _fbsize;
-    size_t         _cbsize;
-    haddr_t        read_size;        /* Size to read into copy buffer */
-    size_t         copy_size = size; /* Size remaining to read when using copy buffer */
-    size_t         copy_offset;      /* Offset into copy buffer of the requested data */
+    size_t         head;                 /* Size of the partial block at the start */
+    size_t         mid;                  /* Size of the whole blocks read directly */
+    herr_t         ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -843,10 +1189,123 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow");
 
-    /* If the system doesn't require data to be aligned, read the data in
-     * the same way as sec2 driver.
+    /* If the data is aligned or the system doesn't require data to be aligned,
+     * read it directly from the file.  If not, read the whole file blocks in
+     * the middle of the request directly, when their place in the buffer is
+     * aligned, and read everything else through a bounce buffer.
      */
-    _must_align = file->fa.must_align;
+    if (!file->fa.must_align || H5FD_DIRECT_IS_ALIGNED(file, addr, size, buf)) {
+        if (H5FD__direct_read_aligned(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read aligned data");
+    }
+    else {
+        H5FD__direct_split(file, addr, size, buf, &head, &mid);
+
+        if (mid > 0) {
+            if (head > 0 && H5FD__direct_read_bounce(file, addr, head, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read unaligned data");
+            if (H5FD__direct_read_aligned(file, addr + head, mid, (unsigned char *)buf + head) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read aligned data");
+            if (size > head + mid && H5FD__direct_read_bounce(file, addr + head + mid, size - (head + mid),
+                                                             (unsigned char *)buf + head + mid) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read unaligned data");
+        } /* end if */
+        else if (H5FD__direct_read_bounce(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read unaligned data");
+    } /* end else */
+
+done:
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_write_aligned
+ *
+ * Purpose:  Writes SIZE bytes from BUF straight to ADDR.  The request
+ *    must be aligned, unless the file system doesn't require it.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_write_aligned(H5FD_direct_t *file, haddr_t addr, size_t size, const void *buf)
+{
+    ssize_t nbytes;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Seek to the correct location */
+    if ((addr != file->pos || OP_WRITE != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+
+    while (size > 0) {
+        do {
+            nbytes = HDwrite(file->fd, buf, size);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        assert(nbytes > 0);
+        assert((size_t)nbytes <= size);
+        H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
+        size -= (size_t)nbytes;
+        H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
+        addr += (haddr_t)nbytes;
+        buf = (const char *)buf + nbytes;
+    }
+
+    /* Update current position and eof */
+    file->pos = addr;
+    file->op  = OP_WRITE;
+    if (file->pos > file->eof)
+        file->eof = file->pos;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_write_aligned() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_write_bounce
+ *
+ * Purpose:  Writes SIZE bytes from BUF to ADDR by copying them into an
+ *    aligned bounce buffer holding the file blocks that contain
+ *    them, and writing those blocks.  Partial blocks at either end
+ *    are read from the file first.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_write_bounce(H5FD_direct_t *file, haddr_t addr, size_t size, const void *buf)
+{
+    ssize_t     nbytes;
+    size_t      alloc_size;
+    void       *copy_buf      = NULL, *p1;
+    size_t      copy_buf_size = 0; /* Actual size of the bounce buffer */
+    const void *p3;
+    size_t      _boundary;
+    size_t      _fbsize;
+    size_t      _cbsize;
+    haddr_t     write_addr;          /* Address to write copy buffer */
+    haddr_t     write_size;          /* Size to write from copy buffer */
+    haddr_t     read_size;           /* Size to read into copy buffer */
+    size_t      copy_size = size;    /* Size remaining to write when using copy buffer */
+    size_t      copy_offset;         /* Offset into copy buffer of the data to write */
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
 
     /* Get the memory boundary for alignment, file system block size, and maximal
      * copy buffer size.
@@ -855,129 +1314,132 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     _fbsize   = file->fa.fbsize;
     _cbsize   = file->fa.cbsize;
 
-    /* if the data is aligned or the system doesn't require data to be aligned,
-     * read it directly from the file.  If not, read a bigger
-     * and aligned data first, then copy the data into memory buffer.
-     */
-    if (!_must_align || ((addr % _fbsize == 0) && (size % _fbsize == 0) && ((size_t)buf % _boundary == 0))) {
-        /* Seek to the correct location */
-        if ((addr != file->pos || OP_READ != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-        /* Read the aligned data in file first, being careful of interrupted
-         * system calls and partial results. */
-        while (size > 0) {
-            do {
-                nbytes = HDread(file->fd, buf, size);
-            } while (-1 == nbytes && EINTR == errno);
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-            if (0 == nbytes) {
-                /* end of file but not end of format address space */
-                memset(buf, 0, size);
-                break;
-            }
-            assert(nbytes >= 0);
-            assert((size_t)nbytes <= size);
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
-            size -= (size_t)nbytes;
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
-            addr += (haddr_t)nbytes;
-            buf = (char *)buf + nbytes;
-        }
-    }
-    else {
-        /* Calculate where we will begin copying from the copy buffer */
-        copy_offset = (size_t)(addr % _fbsize);
-
-        /* allocate memory needed for the Direct IO option up to the maximal
-         * copy buffer size. Make a bigger buffer for aligned I/O if size is
-         * smaller than maximal copy buffer. */
-        alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-        if (alloc_size > _cbsize)
-            alloc_size = _cbsize;
-        assert(!(alloc_size % _fbsize));
-        if (posix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "posix_memalign failed");
+    /* Calculate where we will begin reading from (on disk) and where we
+     * will begin copying from the copy buffer */
+    write_addr  = (addr / _fbsize) * _fbsize;
+    copy_offset = (size_t)(addr % _fbsize);
 
-        /* look for the aligned position for reading the data */
-        assert(!(((addr / _fbsize) * _fbsize) % _fbsize));
-        if (HDlseek(file->fd, (HDoff_t)((addr / _fbsize) * _fbsize), SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    /* Get a buffer for the Direct IO option, up to the maximal copy buffer
+     * size. Use a bigger buffer for aligned I/O if size is smaller than
+     * maximal copy buffer.
+     */
+    alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
+    if (alloc_size > _cbsize)
+        alloc_size = _cbsize;
+    assert(!(alloc_size % _fbsize));
+
+    if (H5FD__direct_bounce_acquire(_boundary, alloc_size, &copy_buf, &copy_buf_size) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get bounce buffer");
+
+    /* look for the right position for reading or writing the data */
+    if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+
+    p3 = buf;
+    do {
+        /* Calculate how much data we have to write in this iteration
+         * (including unused parts of blocks) */
+        if ((copy_size + copy_offset) < alloc_size)
+            write_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
+        else
+            write_size = alloc_size;
 
         /*
-         * Read the aligned data in file into aligned buffer first, then copy the data
-         * into the final buffer.  If the data size is bigger than maximal copy buffer
-         * size, do the reading by segment (the outer while loop).  If not, do one step
-         * reading.
+         * Read the aligned data first if the aligned region doesn't fall
+         * entirely in the range to be written.  Not able to handle interrupted
+         * system calls and partial results like sec2 driver does because the
+         * data may no longer be aligned. It's especially true when the data in
+         * file is smaller than ALLOC_SIZE.  Only read the entire section if
+         * both ends are misaligned, otherwise only read the block on the
+         * misaligned end.
          */
-        do {
-            /* Read the aligned data in file first.  Not able to handle interrupted
-             * system calls and partial results like sec2 driver does because the
-             * data may no longer be aligned. It's especially true when the data in
-             * file is smaller than ALLOC_SIZE. */
-            memset(copy_buf, 0, alloc_size);
-
-            /* Calculate how much data we have to read in this iteration
-             * (including unused parts of blocks) */
-            if ((copy_size + copy_offset) < alloc_size)
-                read_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
-            else
-                read_size = alloc_size;
+        memset(copy_buf, 0, _fbsize);
+
+        if (copy_offset > 0) {
+            if ((write_addr + write_size) > (addr + size)) {
+                assert((write_addr + write_size) - (addr + size) < _fbsize);
+                read_size = write_size;
+                p1        = copy_buf;
+            } /* end if */
+            else {
+                read_size = _fbsize;
+                p1        = copy_buf;
+            } /* end else */
+        }     /* end if */
+        else if ((write_addr + write_size) > (addr + size)) {
+            assert((write_addr + write_size) - (addr + size) < _fbsize);
+            read_size = _fbsize;
+            p1        = (unsigned char *)copy_buf + write_size - _fbsize;
+
+            /* Seek to the last block, for reading */
+            assert(!((write_addr + write_size - _fbsize) % _fbsize));
+            if (HDlseek(file->fd, (HDoff_t)(write_addr + write_size - _fbsize), SEEK_SET) < 0)
+                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+        } /* end if */
+        else
+            p1 = NULL;
 
+        if (p1) {
             assert(!(read_size % _fbsize));
             do {
-                nbytes = HDread(file->fd, copy_buf, read_size);
+                nbytes = HDread(file->fd, p1, read_size);
             } while (-1 == nbytes && EINTR == errno);
 
             if (-1 == nbytes) /* error */
                 HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        } /* end if */
 
-            /* Copy the needed data from the copy buffer to the output
-             * buffer, and update copy_size.  If the copy buffer does not
-             * contain the rest of the data, just copy what's in the copy
-             * buffer and also update read_addr and copy_offset to read the
-             * next section of data. */
-            p2 = (unsigned char *)copy_buf + copy_offset;
-            if ((copy_size + copy_offset) <= alloc_size) {
-                H5MM_memcpy(buf, p2, copy_size);
-                buf       = (unsigned char *)buf + copy_size;
-                copy_size = 0;
-            } /* end if */
-            else {
-                H5MM_memcpy(buf, p2, alloc_size - copy_offset);
-                buf = (unsigned char *)buf + alloc_size - copy_offset;
-                copy_size -= alloc_size - copy_offset;
-                copy_offset = 0;
-            } /* end else */
-        } while (copy_size > 0);
+        /* look for the right position and append or copy the data to be written to
+         * the aligned buffer.
+         * Consider all possible situations here: file address is not aligned on
+         * file block size; the end of data address is not aligned; the end of data
+         * address is aligned; data size is smaller or bigger than maximal copy size.
+         */
+        p1 = (unsigned char *)copy_buf + copy_offset;
+        if ((copy_size + copy_offset) <= alloc_size) {
+            H5MM_memcpy(p1, p3, copy_size);
+            copy_size = 0;
+        } /* end if */
+        else {
+            H5MM_memcpy(p1, p3, alloc_size - copy_offset);
+            p3 = (const unsigned char *)p3 + (alloc_size - copy_offset);
+            copy_size -= alloc_size - copy_offset;
+            copy_offset = 0;
+        } /* end else */
+
+        /*look for the aligned position for writing the data*/
+        assert(!(write_addr % _fbsize));
+        if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
 
-        /*Final step: update address*/
-        addr = (haddr_t)(((addr + size - 1) / _fbsize + 1) * _fbsize);
+        /*
+         * Write the data. It doesn't truncate the extra data introduced by
+         * alignment because that step is done in H5FD_direct_flush.
+         */
+        assert(!(write_size % _fbsize));
+        do {
+            nbytes = HDwrite(file->fd, copy_buf, write_size);
+        } while (-1 == nbytes && EINTR == errno);
 
-        if (copy_buf) {
-            /* Free with free since it came from posix_memalign */
-            free(copy_buf);
-            copy_buf = NULL;
-        } /* end if */
-    }
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
-    /* Update current position */
-    file->pos = addr;
-    file->op  = OP_READ;
+        /* update the write address */
+        write_addr += write_size;
+    } while (copy_size > 0);
 
-done:
-    if (ret_value < 0) {
-        /* Free with free since it came from posix_memalign */
-        if (copy_buf)
-            free(copy_buf);
+    /* Update current position and eof */
+    file->pos = write_addr;
+    file->op  = OP_WRITE;
+    if (file->pos > file->eof)
+        file->eof = file->pos;
 
-        /* Reset last file I/O information */
-        file->pos = HADDR_UNDEF;
-        file->op  = OP_UNKNOWN;
-    } /* end if */
+done:
+    if (copy_buf)
+        H5FD__direct_bounce_release(copy_buf, copy_buf_size, _boundary);
 
     FUNC_LEAVE_NOAPI(ret_value)
-}
+} /* end H5FD__direct_write_bounce() */
 
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_write
@@ -997,20 +1459,9 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
                    size_t size, const void *buf)
 {
     H5FD_direct_t *file = (H5FD_direct_t *)_file;
-    ssize_t        nbytes;
-    hbool_t        _must_align = TRUE;
-    herr_t         ret_value   = SUCCEED; /* Return value */
-    size_t         alloc_size;
-    void          *copy_buf = NULL, *p1;
-    const void    *p3;
-    size_t         _boundary;
-    size_t         _fbsize;
-    size_t         _cbsize;
-    haddr_t        write_addr;       /* Address to write copy buffer */
-    haddr_t        write_size;       /* Size to write from copy buffer */
-    haddr_t        read_size;        /* Size to read into copy buffer */
-    size_t         copy_size = size; /* Size remaining to write when using copy buffer */
-    size_t         copy_offset;      /* Offset into copy buffer of the data to write */
+    size_t         head;                 /* Size of the partial block at the start */
+    size_t         mid;                  /* Size of the whole blocks written directly */
+    herr_t         ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -1023,187 +1474,309 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow");
 
-    /* If the system doesn't require data to be aligned, read the data in
-     * the same way as sec2 driver.
+    /* If the data is aligned or the system doesn't require data to be aligned,
+     * write it directly to the file.  If not, write the whole file blocks in
+     * the middle of the request directly, when their place in the buffer is
+     * aligned, and write everything else through a bounce buffer, after
+     * reading the partial blocks at either end.
      */
-    _must_align = file->fa.must_align;
+    if (!file->fa.must_align || H5FD_DIRECT_IS_ALIGNED(file, addr, size, buf)) {
+        if (H5FD__direct_write_aligned(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write aligned data");
+    }
+    else {
+        H5FD__direct_split(file, addr, size, buf, &head, &mid);
+
+        if (mid > 0) {
+            if (head > 0 && H5FD__direct_write_bounce(file, addr, head, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write unaligned data");
+            if (H5FD__direct_write_aligned(file, addr + head, mid, (const unsigned char *)buf + head) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write aligned data");
+            if (size > head + mid &&
+                H5FD__direct_write_bounce(file, addr + head + mid, size - (head + mid),
+                                          (const unsigned char *)buf + head + mid) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write unaligned data");
+        } /* end if */
+        else if (H5FD__direct_write_bounce(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write unaligned data");
+    } /* end else */
 
-    /* Get the memory boundary for alignment, file system block size, and maximal
-     * copy buffer size.
-     */
-    _boundary = file->fa.mboundary;
-    _fbsize   = file->fa.fbsize;
-    _cbsize   = file->fa.cbsize;
+done:
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
 
-    /* if the data is aligned or the system doesn't require data to be aligned,
-     * write it directly to the file.  If not, read a bigger and aligned data
-     * first, update buffer with user data, then write the data out.
-     */
-    if (!_must_align || ((addr % _fbsize == 0) && (size % _fbsize == 0) && ((size_t)buf % _boundary == 0))) {
-        /* Seek to the correct location */
-        if ((addr != file->pos || OP_WRITE != file->op) && HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    FUNC_LEAVE_NOAPI(ret_value)
+}
 
-        while (size > 0) {
-            do {
-                nbytes = HDwrite(file->fd, buf, size);
-            } while (-1 == nbytes && EINTR == errno);
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-            assert(nbytes > 0);
-            assert((size_t)nbytes <= size);
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, size_t);
-            size -= (size_t)nbytes;
-            H5_CHECK_OVERFLOW(nbytes, ssize_t, haddr_t);
-            addr += (haddr_t)nbytes;
-            buf = (const char *)buf + nbytes;
-        }
-    }
-    else {
-        /* Calculate where we will begin reading from (on disk) and where we
-         * will begin copying from the copy buffer */
-        write_addr  = (addr / _fbsize) * _fbsize;
-        copy_offset = (size_t)(addr % _fbsize);
-
-        /* allocate memory needed for the Direct IO option up to the maximal
-         * copy buffer size. Make a bigger buffer for aligned I/O if size is
-         * smaller than maximal copy buffer.
-         */
-        alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-        if (alloc_size > _cbsize)
-            alloc_size = _cbsize;
-        assert(!(alloc_size % _fbsize));
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_vector_run
+ *
+ * Purpose:  Finds the run of vector entries, beginning with entry START,
+ *    that can be transferred together as one span of whole file
+ *    blocks through a single bounce buffer.  An entry joins the
+ *    run if its address is not below the previous entry's, if no
+ *    whole file block separates it from the run, and if the span
+ *    still fits in the copy buffer.
+ *
+ *    NSIZES is the index of the first 0 in SIZES, from where on
+ *    all entries have the size of the last non-zero one.
+ *
+ * Return:  The index of the first entry after the run.  The span's
+ *    address and size are returned in SPAN_ADDR and SPAN_SIZE.
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5FD__direct_vector_run(const H5FD_direct_t *file, uint32_t start, uint32_t count, const haddr_t addrs[],
+                        const size_t sizes[], uint32_t nsizes, haddr_t *span_addr, size_t *span_size)
+{
+    haddr_t  fbsize = (haddr_t)file->fa.fbsize;
+    haddr_t  run_addr;  /* Start of the first block of the run */
+    haddr_t  run_end;   /* End of the data in the run */
+    uint32_t u;
 
-        if (posix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "posix_memalign failed");
+    FUNC_ENTER_PACKAGE_NOERR
 
-        /* look for the right position for reading or writing the data */
-        if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    run_addr = (addrs[start] / fbsize) * fbsize;
+    run_end  = addrs[start] + H5FD_DIRECT_VEC_SIZE(sizes, nsizes, start);
+
+    for (u = start + 1; u < count; u++) {
+        haddr_t end = addrs[u] + H5FD_DIRECT_VEC_SIZE(sizes, nsizes, u);
 
-        p3 = buf;
+        if (addrs[u] < addrs[u - 1])
+            break;
+        if ((addrs[u] / fbsize) * fbsize > H5FD_DIRECT_BLOCK_CEIL(run_end, fbsize))
+            break;
+        if (H5FD_DIRECT_BLOCK_CEIL(MAX(run_end, end), fbsize) - run_addr > (haddr_t)file->fa.cbsize)
+            break;
+
+        run_end = MAX(run_end, end);
+    } /* end for */
+
+    *span_addr = run_addr;
+    *span_size = (size_t)(H5FD_DIRECT_BLOCK_CEIL(run_end, fbsize) - run_addr);
+
+    FUNC_LEAVE_NOAPI(u)
+} /* end H5FD__direct_vector_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_read_vector
+ *
+ * Purpose:  Reads a vector of pieces.  When the file system requires
+ *    aligned I/O, runs of pieces that lie in the same or adjacent
+ *    file blocks are read with one aligned read into a bounce
+ *    buffer and copied out from there.  Other pieces are read with
+ *    H5FD__direct_read.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t H5_ATTR_UNUSED types[],
+                         haddr_t addrs[], size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_direct_t *file          = (H5FD_direct_t *)_file;
+    void          *copy_buf      = NULL; /* Bounce buffer for a run of pieces */
+    size_t         copy_buf_size = 0;    /* Actual size of the bounce buffer */
+    uint32_t       nsizes;               /* Number of sizes before they start to repeat */
+    uint32_t       i, u;
+    uint32_t       end;
+    ssize_t        nbytes;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || (addrs && sizes && bufs));
+
+    /* Find where the sizes start to repeat, and check the pieces */
+    for (nsizes = 0; nsizes < count && sizes[nsizes] != 0; nsizes++)
+        ;
+    if (count > 0 && nsizes == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "sizes[0] is zero");
+    for (i = 0; i < count; i++)
+        if (HADDR_UNDEF == addrs[i] || REGION_OVERFLOW(addrs[i], H5FD_DIRECT_VEC_SIZE(sizes, nsizes, i)))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow");
+
+    for (i = 0; i < count; i = end) {
+        haddr_t span_addr;
+        size_t  span_size;
+
+        end = file->fa.must_align
+                  ? H5FD__direct_vector_run(file, i, count, addrs, sizes, nsizes, &span_addr, &span_size)
+                  : i + 1;
+
+        /* Single pieces are read on their own, which avoids copying them when they are aligned */
+        if (end == i + 1) {
+            if (H5FD__direct_read(_file, H5FD_MEM_DEFAULT, dxpl_id, addrs[i],
+                                  H5FD_DIRECT_VEC_SIZE(sizes, nsizes, i), bufs[i]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed");
+            continue;
+        } /* end if */
+
+        if (H5FD__direct_bounce_acquire(file->fa.mboundary, span_size, &copy_buf, &copy_buf_size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get bounce buffer");
+
+        /* Read the whole span, past the end of the file reads as zeros */
+        memset(copy_buf, 0, span_size);
+        if (HDlseek(file->fd, (HDoff_t)span_addr, SEEK_SET) < 0)
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
         do {
-            /* Calculate how much data we have to write in this iteration
-             * (including unused parts of blocks) */
-            if ((copy_size + copy_offset) < alloc_size)
-                write_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
-            else
-                write_size = alloc_size;
-
-            /*
-             * Read the aligned data first if the aligned region doesn't fall
-             * entirely in the range to be written.  Not able to handle interrupted
-             * system calls and partial results like sec2 driver does because the
-             * data may no longer be aligned. It's especially true when the data in
-             * file is smaller than ALLOC_SIZE.  Only read the entire section if
-             * both ends are misaligned, otherwise only read the block on the
-             * misaligned end.
-             */
-            memset(copy_buf, 0, _fbsize);
-
-            if (copy_offset > 0) {
-                if ((write_addr + write_size) > (addr + size)) {
-                    assert((write_addr + write_size) - (addr + size) < _fbsize);
-                    read_size = write_size;
-                    p1        = copy_buf;
-                } /* end if */
-                else {
-                    read_size = _fbsize;
-                    p1        = copy_buf;
-                } /* end else */
-            }     /* end if */
-            else if ((write_addr + write_size) > (addr + size)) {
-                assert((write_addr + write_size) - (addr + size) < _fbsize);
-                read_size = _fbsize;
-                p1        = (unsigned char *)copy_buf + write_size - _fbsize;
+            nbytes = HDread(file->fd, copy_buf, span_size);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
 
-                /* Seek to the last block, for reading */
-                assert(!((write_addr + write_size - _fbsize) % _fbsize));
-                if (HDlseek(file->fd, (HDoff_t)(write_addr + write_size - _fbsize), SEEK_SET) < 0)
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-            } /* end if */
-            else
-                p1 = NULL;
+        /* Copy the pieces out */
+        for (u = i; u < end; u++)
+            H5MM_memcpy(bufs[u], (unsigned char *)copy_buf + (addrs[u] - span_addr),
+                        H5FD_DIRECT_VEC_SIZE(sizes, nsizes, u));
 
-            if (p1) {
-                assert(!(read_size % _fbsize));
-                do {
-                    nbytes = HDread(file->fd, p1, read_size);
-                } while (-1 == nbytes && EINTR == errno);
+        H5FD__direct_bounce_release(copy_buf, copy_buf_size, file->fa.mboundary);
+        copy_buf = NULL;
 
-                if (-1 == nbytes) /* error */
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-            } /* end if */
+        /* Update current position */
+        file->pos = span_addr + (haddr_t)nbytes;
+        file->op  = OP_READ;
+    } /* end for */
 
-            /* look for the right position and append or copy the data to be written to
-             * the aligned buffer.
-             * Consider all possible situations here: file address is not aligned on
-             * file block size; the end of data address is not aligned; the end of data
-             * address is aligned; data size is smaller or bigger than maximal copy size.
-             */
-            p1 = (unsigned char *)copy_buf + copy_offset;
-            if ((copy_size + copy_offset) <= alloc_size) {
-                H5MM_memcpy(p1, p3, copy_size);
-                copy_size = 0;
-            } /* end if */
-            else {
-                H5MM_memcpy(p1, p3, alloc_size - copy_offset);
-                p3 = (const unsigned char *)p3 + (alloc_size - copy_offset);
-                copy_size -= alloc_size - copy_offset;
-                copy_offset = 0;
-            } /* end else */
+done:
+    if (copy_buf)
+        H5FD__direct_bounce_release(copy_buf, copy_buf_size, file->fa.mboundary);
 
-            /*look for the aligned position for writing the data*/
-            assert(!(write_addr % _fbsize));
-            if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
 
-            /*
-             * Write the data. It doesn't truncate the extra data introduced by
-             * alignment because that step is done in H5FD_direct_flush.
-             */
-            assert(!(write_size % _fbsize));
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_write_vector
+ *
+ * Purpose:  Writes a vector of pieces.  When the file system requires
+ *    aligned I/O, runs of pieces that lie in the same or adjacent
+ *    file blocks are gathered into a bounce buffer and written
+ *    with one aligned write.  The span is read from the file
+ *    first, unless the pieces cover it completely.  Other pieces
+ *    are written with H5FD__direct_write.
+ *
+ *    Pieces are copied in vector order, so when pieces overlap the
+ *    later one wins, as if they had been written one at a time.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t H5_ATTR_UNUSED types[],
+                          haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    H5FD_direct_t *file          = (H5FD_direct_t *)_file;
+    void          *copy_buf      = NULL; /* Bounce buffer for a run of pieces */
+    size_t         copy_buf_size = 0;    /* Actual size of the bounce buffer */
+    uint32_t       nsizes;               /* Number of sizes before they start to repeat */
+    uint32_t       i, u;
+    uint32_t       end;
+    ssize_t        nbytes;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || (addrs && sizes && bufs));
+
+    /* Find where the sizes start to repeat, and check the pieces */
+    for (nsizes = 0; nsizes < count && sizes[nsizes] != 0; nsizes++)
+        ;
+    if (count > 0 && nsizes == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "sizes[0] is zero");
+    for (i = 0; i < count; i++)
+        if (HADDR_UNDEF == addrs[i] || REGION_OVERFLOW(addrs[i], H5FD_DIRECT_VEC_SIZE(sizes, nsizes, i)))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow");
+
+    for (i = 0; i < count; i = end) {
+        haddr_t span_addr;
+        size_t  span_size;
+        haddr_t covered; /* End of the part of the span covered by the pieces */
+
+        end = file->fa.must_align
+                  ? H5FD__direct_vector_run(file, i, count, addrs, sizes, nsizes, &span_addr, &span_size)
+                  : i + 1;
+
+        /* Single pieces are written on their own, which avoids copying them when they are aligned */
+        if (end == i + 1) {
+            if (H5FD__direct_write(_file, H5FD_MEM_DEFAULT, dxpl_id, addrs[i],
+                                   H5FD_DIRECT_VEC_SIZE(sizes, nsizes, i), bufs[i]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed");
+            continue;
+        } /* end if */
+
+        if (H5FD__direct_bounce_acquire(file->fa.mboundary, span_size, &copy_buf, &copy_buf_size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get bounce buffer");
+
+        /* Check whether the pieces cover the whole span without gaps */
+        covered = span_addr;
+        for (u = i; u < end && addrs[u] <= covered; u++)
+            covered = MAX(covered, addrs[u] + H5FD_DIRECT_VEC_SIZE(sizes, nsizes, u));
+
+        /* If not, read the span first, so that the gaps keep their contents */
+        if (covered < span_addr + span_size) {
+            memset(copy_buf, 0, span_size);
+            if (HDlseek(file->fd, (HDoff_t)span_addr, SEEK_SET) < 0)
+                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
             do {
-                nbytes = HDwrite(file->fd, copy_buf, write_size);
+                nbytes = HDread(file->fd, copy_buf, span_size);
             } while (-1 == nbytes && EINTR == errno);
-
             if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        } /* end if */
 
-            /* update the write address */
-            write_addr += write_size;
-        } while (copy_size > 0);
+        /* Copy the pieces in and write the span */
+        for (u = i; u < end; u++)
+            H5MM_memcpy((unsigned char *)copy_buf + (addrs[u] - span_addr), bufs[u],
+                        H5FD_DIRECT_VEC_SIZE(sizes, nsizes, u));
 
-        /*Update the address and size*/
-        addr = write_addr;
-        buf  = (const char *)buf + size;
+        if (HDlseek(file->fd, (HDoff_t)span_addr, SEEK_SET) < 0)
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+        do {
+            nbytes = HDwrite(file->fd, copy_buf, span_size);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
-        if (copy_buf) {
-            /* Free with free since it came from posix_memalign */
-            free(copy_buf);
-            copy_buf = NULL;
-        } /* end if */
-    }
+        H5FD__direct_bounce_release(copy_buf, copy_buf_size, file->fa.mboundary);
+        copy_buf = NULL;
 
-    /* Update current position and eof */
-    file->pos = addr;
-    file->op  = OP_WRITE;
-    if (file->pos > file->eof)
-        file->eof = file->pos;
+        /* Update current position and eof */
+        file->pos = span_addr + span_size;
+        file->op  = OP_WRITE;
+        if (file->pos > file->eof)
+            file->eof = file->pos;
+    } /* end for */
 
 done:
-    if (ret_value < 0) {
-        /* Free with free since it came from posix_memalign */
-        if (copy_buf)
-            free(copy_buf);
+    if (copy_buf)
+        H5FD__direct_bounce_release(copy_buf, copy_buf_size, file->fa.mboundary);
 
+    if (ret_value < 0) {
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op  = OP_UNKNOWN;
     } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
-}
+} /* end H5FD__direct_write_vector() */
 
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_truncate
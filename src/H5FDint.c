@@ -261,6 +261,66 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_borrow_buffer
+ *
+ * Purpose:     Asks the driver for a pointer to its own in-memory copy of
+ *              SIZE bytes of the file at ADDR (relative to the base
+ *              address), which the caller may read from instead of
+ *              calling H5FD_read().  *BUF is set to NULL if the driver
+ *              doesn't keep the range in memory.
+ *
+ *              Only drivers that answer H5FD_CTL_BORROW_BUFFER_OPCODE can
+ *              lend out buffers.  The pointer stays valid until the file
+ *              is closed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_borrow_buffer(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size, const void **buf /*out*/)
+{
+    H5FD_ctl_borrow_buffer_args_t args;                /* Arguments for the ctl call */
+    void                         *ptr       = NULL;    /* Pointer lent by the driver */
+    herr_t                        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    assert(file);
+    assert(file->cls);
+    assert(buf);
+
+    *buf = NULL;
+
+    /* Nothing to lend if the driver has no ctl callback or the range is empty */
+    if (NULL == file->cls->ctl || 0 == size)
+        HGOTO_DONE(SUCCEED);
+
+    /* Leave reads past the allocated space to H5FD_read(), which reports them */
+    if (!(file->access_flags & H5F_ACC_SWMR_READ)) {
+        haddr_t eoa;
+
+        if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed");
+        if ((addr + file->base_addr + size) > eoa)
+            HGOTO_DONE(SUCCEED);
+    }
+
+    /* Ask the driver, without failing if it doesn't understand the request */
+    args.type = type;
+    args.addr = addr + file->base_addr;
+    args.size = size;
+    if (H5FD_ctl(file, H5FD_CTL_BORROW_BUFFER_OPCODE, 0, &args, &ptr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_FCNTL, FAIL, "driver borrow buffer request failed");
+
+    *buf = ptr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_borrow_buffer() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_write
  *
@@ -0,0 +1,1481 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The io_uring file driver.  Files are laid out exactly as with
+ *          the POSIX (sec2) driver, but every transfer goes through a
+ *          Linux io_uring instance owned by the open file.  Vector reads
+ *          and writes place all of their pieces on the submission queue
+ *          at once (up to the configured queue depth) and complete them
+ *          concurrently.  The driver has no selection callbacks: the
+ *          library translates selection I/O into a single vector call,
+ *          which is then submitted as one batch.
+ *
+ *          Pieces that fit in a buffer of the registered staging pool are
+ *          transferred with the *_FIXED opcodes, so the kernel doesn't
+ *          have to map the caller's pages for every small request.
+ *
+ *          The ring is driven through the raw system calls so there is no
+ *          dependency on liburing.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"     /* Generic Functions        */
+#include "H5Eprivate.h"    /* Error handling           */
+#include "H5Fprivate.h"    /* File access              */
+#include "H5FDprivate.h"   /* File drivers             */
+#include "H5FDiouring.h"   /* io_uring file driver     */
+#include "H5FLprivate.h"   /* Free Lists               */
+#include "H5Iprivate.h"    /* IDs                      */
+#include "H5MMprivate.h"   /* Memory management        */
+#include "H5Pprivate.h"    /* Property lists           */
+
+#ifdef H5_HAVE_IOURING_VFD
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Largest transfer placed in a single submission queue entry */
+#define H5FD_IOURING_MAX_IO ((size_t)1 << 30)
+
+/* Number of requests tracked on the stack before allocating */
+#define H5FD_IOURING_LOCAL_REQS 8
+
+/* Locates a field of a ring mapping from its offset */
+#define H5FD_IOURING_RING_PTR(T, B, O) ((T *)(void *)((unsigned char *)(B) + (O)))
+
+/* End of the pending request list */
+#define H5FD_IOURING_NO_REQ UINT32_MAX
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned queue_depth;    /* Requests kept in flight          */
+    unsigned nfixed_bufs;    /* Registered staging buffers       */
+    size_t   fixed_buf_size; /* Size of each staging buffer      */
+} H5FD_iouring_fapl_t;
+
+/* The submission and completion rings shared with the kernel */
+typedef struct H5FD_iouring_ring_t {
+    int                  fd;          /* io_uring file descriptor                */
+    unsigned             entries;     /* Submission queue entries                */
+    void                *sq_ptr;      /* Mapped submission ring                  */
+    size_t               sq_size;     /* Size of the submission ring mapping     */
+    void                *cq_ptr;      /* Mapped completion ring                  */
+    size_t               cq_size;     /* Size of the completion ring mapping     */
+    struct io_uring_sqe *sqes;        /* Mapped submission queue entries         */
+    size_t               sqes_size;   /* Size of the entry mapping               */
+    unsigned            *sq_head;     /* Submission ring head (kernel owned)     */
+    unsigned            *sq_tail;     /* Submission ring tail (driver owned)     */
+    unsigned             sq_mask;     /* Submission ring index mask              */
+    unsigned            *cq_head;     /* Completion ring head (driver owned)     */
+    unsigned            *cq_tail;     /* Completion ring tail (kernel owned)     */
+    unsigned             cq_mask;     /* Completion ring index mask              */
+    struct io_uring_cqe *cqes;        /* Completion queue entries                */
+} H5FD_iouring_ring_t;
+
+/*
+ * The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).  The
+ * staging pool is one allocation of 'nfixed' buffers of 'fixed_size' bytes,
+ * registered with the ring; 'free_slots' is a stack of the unused ones.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub;  /* public stuff, must be first      */
+    int                 fd;   /* the filesystem file descriptor   */
+    haddr_t             eoa;  /* end of allocated region          */
+    haddr_t             eof;  /* end of file; current file size   */
+    H5FD_iouring_fapl_t fa;   /* file access properties           */
+    H5FD_iouring_ring_t ring; /* the io_uring instance            */
+    hbool_t             ignore_disabled_file_locks;
+    char                filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+
+    /* Registered staging pool */
+    unsigned char *fixed_pool; /* Start of the pool, NULL if not registered */
+    unsigned       nfixed;     /* Number of buffers in the pool             */
+    size_t         fixed_size; /* Size of each buffer                       */
+    unsigned      *free_slots; /* Stack of unused buffer indices            */
+    unsigned       nfree;      /* Number of entries on the stack            */
+
+    /* On Linux the combination of device and i-node number uniquely
+     * identify a file.
+     */
+    dev_t device; /* file device number   */
+    ino_t inode;  /* file i-node number   */
+} H5FD_iouring_t;
+
+/* State of one piece of a vector transfer */
+typedef struct H5FD_iouring_req_t {
+    haddr_t        addr; /* File address of the next transfer           */
+    size_t         left; /* Bytes still to transfer                     */
+    unsigned char *ptr;  /* Buffer position of the next transfer        */
+    unsigned char *user; /* Caller's buffer for the piece               */
+    size_t         size; /* Total size of the piece                     */
+    int            slot; /* Staging buffer in use, or -1                */
+    uint32_t       next; /* Next request on the pending list            */
+} H5FD_iouring_req_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__iouring_term(void);
+static herr_t  H5FD__iouring_populate_config(unsigned queue_depth, unsigned nfixed_bufs,
+                                             size_t fixed_buf_size, H5FD_iouring_fapl_t *fa_out);
+static void   *H5FD__iouring_fapl_get(H5FD_t *file);
+static void   *H5FD__iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__iouring_close(H5FD_t *_file);
+static int     H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                  void *buf);
+static herr_t  H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                   const void *buf);
+static herr_t  H5FD__iouring_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                         haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__iouring_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                          haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__iouring_unlock(H5FD_t *_file);
+static herr_t  H5FD__iouring_delete(const char *filename, hid_t fapl_id);
+
+static herr_t H5FD__iouring_ring_init(H5FD_iouring_ring_t *ring, unsigned entries);
+static void   H5FD__iouring_ring_term(H5FD_iouring_ring_t *ring);
+static herr_t H5FD__iouring_pool_init(H5FD_iouring_t *file);
+static herr_t H5FD__iouring_transfer(H5FD_iouring_t *file, hbool_t do_write, uint32_t count, haddr_t addrs[],
+                                     size_t sizes[], H5_flexible_const_ptr_t bufs[]);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    H5FD_CLASS_VERSION,          /* struct version       */
+    H5FD_IOURING_VALUE,          /* value                */
+    "iouring",                   /* name                 */
+    MAXADDR,                     /* maxaddr              */
+    H5F_CLOSE_WEAK,              /* fc_degree            */
+    H5FD__iouring_term,          /* terminate            */
+    NULL,                        /* sb_size              */
+    NULL,                        /* sb_encode            */
+    NULL,                        /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size            */
+    H5FD__iouring_fapl_get,      /* fapl_get             */
+    H5FD__iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                        /* fapl_free            */
+    0,                           /* dxpl_size            */
+    NULL,                        /* dxpl_copy            */
+    NULL,                        /* dxpl_free            */
+    H5FD__iouring_open,          /* open                 */
+    H5FD__iouring_close,         /* close                */
+    H5FD__iouring_cmp,           /* cmp                  */
+    H5FD__iouring_query,         /* query                */
+    NULL,                        /* get_type_map         */
+    NULL,                        /* alloc                */
+    NULL,                        /* free                 */
+    H5FD__iouring_get_eoa,       /* get_eoa              */
+    H5FD__iouring_set_eoa,       /* set_eoa              */
+    H5FD__iouring_get_eof,       /* get_eof              */
+    H5FD__iouring_get_handle,    /* get_handle           */
+    H5FD__iouring_read,          /* read                 */
+    H5FD__iouring_write,         /* write                */
+    H5FD__iouring_read_vector,   /* read_vector          */
+    H5FD__iouring_write_vector,  /* write_vector         */
+    NULL,                        /* read_selection       */
+    NULL,                        /* write_selection      */
+    NULL,                        /* flush                */
+    H5FD__iouring_truncate,      /* truncate             */
+    H5FD__iouring_lock,          /* lock                 */
+    H5FD__iouring_unlock,        /* unlock               */
+    H5FD__iouring_delete,        /* del                  */
+    NULL,                        /* ctl                  */
+    H5FD_FLMAP_DICHOTOMY         /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    char *lock_env_var = NULL;            /* Environment variable pointer */
+    hid_t ret_value    = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv(HDF5_USE_FILE_LOCKING);
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5I_VFL != H5I_get_type(H5FD_IOURING_g)) {
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+        if (H5I_INVALID_HID == H5FD_IOURING_g)
+            HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, H5I_INVALID_HID, "unable to register iouring");
+    }
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_term(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, unsigned nfixed_bufs, size_t fixed_buf_size)
+{
+    H5P_genplist_t     *plist; /* Property list pointer */
+    H5FD_iouring_fapl_t fa;
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIuIuz", fapl_id, queue_depth, nfixed_bufs, fixed_buf_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if (H5FD__iouring_populate_config(queue_depth, nfixed_bufs, fixed_buf_size, &fa) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa, NULL);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access
+ *              property list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/, unsigned *nfixed_bufs /*out*/,
+                    size_t *fixed_buf_size /*out*/)
+{
+    H5P_genplist_t            *plist; /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, queue_depth, nfixed_bufs, fixed_buf_size);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list");
+    if (H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (fa = H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info");
+    if (queue_depth)
+        *queue_depth = fa->queue_depth;
+    if (nfixed_bufs)
+        *nfixed_bufs = fa->nfixed_bufs;
+    if (fixed_buf_size)
+        *fixed_buf_size = fa->fixed_buf_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_populate_config
+ *
+ * Purpose:     Populates a H5FD_iouring_fapl_t structure with the provided
+ *              values, supplying defaults where values are not provided.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_populate_config(unsigned queue_depth, unsigned nfixed_bufs, size_t fixed_buf_size,
+                              H5FD_iouring_fapl_t *fa_out)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    assert(fa_out);
+
+    memset(fa_out, 0, sizeof(H5FD_iouring_fapl_t));
+
+    if (queue_depth > H5FD_IOURING_QUEUE_DEPTH_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth may not exceed %u",
+                    (unsigned)H5FD_IOURING_QUEUE_DEPTH_MAX);
+    if (fixed_buf_size > H5FD_IOURING_MAX_IO)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "staging buffer size too large");
+
+    fa_out->queue_depth    = queue_depth ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    fa_out->nfixed_bufs    = nfixed_bufs;
+    fa_out->fixed_buf_size = fixed_buf_size ? fixed_buf_size : H5FD_IOURING_FIXED_BUF_SIZE_DEF;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_populate_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    void           *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t *old_fa    = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t       *new_fa    = NULL;
+    void                      *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (NULL == (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed");
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_init
+ *
+ * Purpose:     Creates an io_uring instance with room for ENTRIES
+ *              requests and maps its rings into this process.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_init(H5FD_iouring_ring_t *ring, unsigned entries)
+{
+    struct io_uring_params p;
+    unsigned              *sq_array;
+    unsigned               u;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(ring);
+    assert(entries > 0);
+
+    memset(ring, 0, sizeof(H5FD_iouring_ring_t));
+    ring->fd     = -1;
+    ring->sq_ptr = MAP_FAILED;
+    ring->cq_ptr = MAP_FAILED;
+    ring->sqes   = MAP_FAILED;
+
+    memset(&p, 0, sizeof(p));
+    if ((ring->fd = (int)syscall(__NR_io_uring_setup, entries, &p)) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to set up io_uring instance")
+
+    ring->entries = p.sq_entries;
+    ring->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ring->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+
+    /* Newer kernels place both rings in one mapping */
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_size > ring->sq_size)
+            ring->sq_size = ring->cq_size;
+        ring->cq_size = ring->sq_size;
+    }
+
+    if (MAP_FAILED == (ring->sq_ptr = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE,
+                                           MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map submission ring")
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ptr = ring->sq_ptr;
+    else if (MAP_FAILED == (ring->cq_ptr = mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE,
+                                                MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map completion ring")
+
+    ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    if (MAP_FAILED == (ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map submission queue entries")
+
+    ring->sq_head = H5FD_IOURING_RING_PTR(unsigned, ring->sq_ptr, p.sq_off.head);
+    ring->sq_tail = H5FD_IOURING_RING_PTR(unsigned, ring->sq_ptr, p.sq_off.tail);
+    ring->sq_mask = *H5FD_IOURING_RING_PTR(unsigned, ring->sq_ptr, p.sq_off.ring_mask);
+    ring->cq_head = H5FD_IOURING_RING_PTR(unsigned, ring->cq_ptr, p.cq_off.head);
+    ring->cq_tail = H5FD_IOURING_RING_PTR(unsigned, ring->cq_ptr, p.cq_off.tail);
+    ring->cq_mask = *H5FD_IOURING_RING_PTR(unsigned, ring->cq_ptr, p.cq_off.ring_mask);
+    ring->cqes    = H5FD_IOURING_RING_PTR(struct io_uring_cqe, ring->cq_ptr, p.cq_off.cqes);
+
+    /* Submission queue entries are always filled in ring order, so the
+     * indirection array can map each slot to itself once, here.
+     */
+    sq_array = H5FD_IOURING_RING_PTR(unsigned, ring->sq_ptr, p.sq_off.array);
+    for (u = 0; u < p.sq_entries; u++)
+        sq_array[u] = u;
+
+done:
+    if (ret_value < 0)
+        H5FD__iouring_ring_term(ring);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_term
+ *
+ * Purpose:     Unmaps the rings and closes the io_uring instance.  Closing
+ *              the instance also unregisters the staging pool.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_ring_term(H5FD_iouring_ring_t *ring)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(ring);
+
+    if (MAP_FAILED != (void *)ring->sqes)
+        munmap(ring->sqes, ring->sqes_size);
+    if (MAP_FAILED != ring->cq_ptr && ring->cq_ptr != ring->sq_ptr)
+        munmap(ring->cq_ptr, ring->cq_size);
+    if (MAP_FAILED != ring->sq_ptr)
+        munmap(ring->sq_ptr, ring->sq_size);
+    if (ring->fd >= 0)
+        HDclose(ring->fd);
+
+    ring->fd     = -1;
+    ring->sq_ptr = MAP_FAILED;
+    ring->cq_ptr = MAP_FAILED;
+    ring->sqes   = MAP_FAILED;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_ring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_pool_init
+ *
+ * Purpose:     Allocates the staging pool and registers it with the ring.
+ *              The pool is an optimization only: if it can't be allocated
+ *              or the kernel refuses to register it (typically because of
+ *              RLIMIT_MEMLOCK), the file is left without one and every
+ *              piece is transferred directly, so callers may ignore
+ *              the return value.
+ *
+ * Return:      SUCCEED if a pool was registered or none was requested,
+ *              FAIL otherwise (no error is pushed)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_pool_init(H5FD_iouring_t *file)
+{
+    struct iovec *iov       = NULL;
+    void         *pool      = NULL;
+    unsigned      u;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(file);
+
+    if (0 == file->fa.nfixed_bufs)
+        HGOTO_DONE(SUCCEED);
+
+    if (0 != posix_memalign(&pool, (size_t)4096, (size_t)file->fa.nfixed_bufs * file->fa.fixed_buf_size))
+        HGOTO_DONE(FAIL);
+    if (NULL == (iov = (struct iovec *)H5MM_malloc(file->fa.nfixed_bufs * sizeof(struct iovec))))
+        HGOTO_DONE(FAIL);
+    if (NULL == (file->free_slots = (unsigned *)H5MM_malloc(file->fa.nfixed_bufs * sizeof(unsigned))))
+        HGOTO_DONE(FAIL);
+
+    for (u = 0; u < file->fa.nfixed_bufs; u++) {
+        iov[u].iov_base = (unsigned char *)pool + (size_t)u * file->fa.fixed_buf_size;
+        iov[u].iov_len  = file->fa.fixed_buf_size;
+    }
+
+    if (syscall(__NR_io_uring_register, file->ring.fd, IORING_REGISTER_BUFFERS, iov, file->fa.nfixed_bufs) <
+        0)
+        HGOTO_DONE(FAIL);
+
+    /* Every buffer starts out unused */
+    for (u = 0; u < file->fa.nfixed_bufs; u++)
+        file->free_slots[u] = file->fa.nfixed_bufs - u - 1;
+    file->nfree      = file->fa.nfixed_bufs;
+    file->nfixed     = file->fa.nfixed_bufs;
+    file->fixed_size = file->fa.fixed_buf_size;
+    file->fixed_pool = (unsigned char *)pool;
+    pool             = NULL;
+
+done:
+    /* Free with free since it came from posix_memalign */
+    if (pool) {
+        free(pool);
+        file->free_slots = H5MM_xfree(file->free_slots);
+    }
+    H5MM_xfree(iov);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_pool_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t            *file = NULL; /* io_uring VFD info        */
+    int                        fd   = -1;   /* File descriptor          */
+    int                        o_flags;     /* Flags for open() call    */
+    const H5FD_iouring_fapl_t *fa;
+    H5FD_iouring_fapl_t        default_fa;
+    h5_stat_t                  sb;
+    H5P_genplist_t            *plist;            /* Property list pointer */
+    H5FD_t                    *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name");
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr");
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (H5FD__iouring_populate_config(0, H5FD_IOURING_NFIXED_BUFS_DEF, 0, &default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, NULL, "can't initialize driver configuration info");
+        fa = &default_fa;
+    }
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct");
+
+    file->fd      = fd;
+    file->ring.fd = -1;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set up the ring and the staging pool */
+    if (H5FD__iouring_ring_init(&file->ring, file->fa.queue_depth) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to set up io_uring for file");
+    (void)H5FD__iouring_pool_init(file);
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property");
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (fd >= 0)
+            HDclose(fd);
+        if (file) {
+            if (file->ring.fd >= 0)
+                H5FD__iouring_ring_term(&file->ring);
+            if (file->fixed_pool)
+                free(file->fixed_pool);
+            H5MM_xfree(file->free_slots);
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        }
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(file);
+
+    /* Tear down the ring before releasing the pool registered with it */
+    H5FD__iouring_ring_term(&file->ring);
+    if (file->fixed_pool)
+        free(file->fixed_pool);
+    H5MM_xfree(file->free_slots);
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t *f1        = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t *f2        = (const H5FD_iouring_t *)_f2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1);
+    if (f1->device > f2->device)
+        HGOTO_DONE(1);
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (memcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1);
+    if (memcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1);
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1);
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |=
+            H5FD_FEAT_SUPPORTS_SWMR_IO; /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+    }                                               /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__iouring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__iouring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_handle
+ *
+ * Purpose:     Returns the file handle of the io_uring file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid");
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_transfer
+ *
+ * Purpose:     Reads or writes COUNT pieces through the ring.  All pieces
+ *              are queued up front and submitted QUEUE_DEPTH at a time;
+ *              each completion either finishes its piece or requeues the
+ *              remainder of a short transfer.  Reads that reach the end
+ *              of the file are zero-filled, as with the sec2 driver.
+ *
+ *              SIZES follows the vector I/O convention: a zero entry means
+ *              the previous size applies to the rest of the vector.
+ *
+ *              On error, the function still waits for every request it
+ *              submitted to complete, since they refer to the caller's
+ *              buffers.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_transfer(H5FD_iouring_t *file, hbool_t do_write, uint32_t count, haddr_t addrs[],
+                       size_t sizes[], H5_flexible_const_ptr_t bufs[])
+{
+    H5FD_iouring_ring_t *ring = &file->ring;                /* The file's ring                   */
+    H5FD_iouring_req_t   local_reqs[H5FD_IOURING_LOCAL_REQS]; /* Request array for short vectors   */
+    H5FD_iouring_req_t  *reqs         = local_reqs;          /* Request for each piece            */
+    uint32_t             pend_head    = H5FD_IOURING_NO_REQ; /* Pending list head                 */
+    uint32_t             pend_tail    = H5FD_IOURING_NO_REQ; /* Pending list tail                 */
+    uint32_t             remaining    = count;               /* Pieces not yet finished           */
+    unsigned             inflight     = 0;                   /* Requests owned by the kernel      */
+    unsigned             queued       = 0;                   /* Entries not yet submitted         */
+    int                  io_errno     = 0;                   /* First error reported by a request */
+    haddr_t              max_addr     = 0;                   /* End of the highest write          */
+    size_t               size         = 0;                   /* Size of the current piece         */
+    hbool_t              extend_sizes = FALSE;               /* Whether the last size repeats     */
+    uint32_t             i;                                  /* Local index variable              */
+    herr_t               ret_value    = SUCCEED;             /* Return value                      */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+    assert(count == 0 || (addrs && sizes && bufs));
+
+    if (count > H5FD_IOURING_LOCAL_REQS)
+        if (NULL == (reqs = (H5FD_iouring_req_t *)H5MM_malloc(count * sizeof(H5FD_iouring_req_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate request array");
+
+    /* Build the pending list, in vector order */
+    for (i = 0; i < count; i++) {
+        if (!extend_sizes) {
+            if (sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                size = sizes[i];
+        }
+
+        if (!H5_addr_defined(addrs[i]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                        (unsigned long long)addrs[i]);
+        if (REGION_OVERFLOW(addrs[i], size))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                        (unsigned long long)addrs[i], (unsigned long long)size);
+
+        reqs[i].addr = addrs[i];
+        reqs[i].left = size;
+        reqs[i].ptr  = (unsigned char *)bufs[i].vp;
+        reqs[i].user = (unsigned char *)bufs[i].vp;
+        reqs[i].size = size;
+        reqs[i].slot = -1;
+        reqs[i].next = H5FD_IOURING_NO_REQ;
+
+        if (0 == size) {
+            remaining--;
+            continue;
+        }
+
+        if (H5FD_IOURING_NO_REQ == pend_tail)
+            pend_head = i;
+        else
+            reqs[pend_tail].next = i;
+        pend_tail = i;
+    }
+
+    while (remaining > 0 || inflight > 0) {
+        unsigned cq_head, cq_tail;
+        int      ret;
+
+        /* Fill the submission queue, unless a request has already failed */
+        while (0 == io_errno && H5FD_IOURING_NO_REQ != pend_head &&
+               inflight + queued < file->fa.queue_depth) {
+            H5FD_iouring_req_t  *req  = &reqs[pend_head];
+            unsigned             tail = *ring->sq_tail;
+            struct io_uring_sqe *sqe  = &ring->sqes[tail & ring->sq_mask];
+            size_t               len;
+
+            pend_head = req->next;
+            if (H5FD_IOURING_NO_REQ == pend_head)
+                pend_tail = H5FD_IOURING_NO_REQ;
+            req->next = H5FD_IOURING_NO_REQ;
+
+            /* Stage small pieces through a registered buffer the first time
+             * they are submitted.
+             */
+            if (req->slot < 0 && req->left == req->size && req->size <= file->fixed_size && file->nfree > 0) {
+                req->slot = (int)file->free_slots[--file->nfree];
+                req->ptr  = file->fixed_pool + (size_t)req->slot * file->fixed_size;
+                if (do_write)
+                    H5MM_memcpy(req->ptr, req->user, req->size);
+            }
+
+            len = MIN(req->left, H5FD_IOURING_MAX_IO);
+
+            memset(sqe, 0, sizeof(*sqe));
+            if (req->slot >= 0) {
+                sqe->opcode    = do_write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+                sqe->buf_index = (__u16)req->slot;
+            }
+            else
+                sqe->opcode = do_write ? IORING_OP_WRITE : IORING_OP_READ;
+            sqe->fd        = file->fd;
+            sqe->off       = (__u64)req->addr;
+            sqe->addr      = (__u64)(uintptr_t)req->ptr;
+            sqe->len       = (__u32)len;
+            sqe->user_data = (__u64)(req - reqs);
+
+            __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+            queued++;
+        }
+
+        /* Once a request has failed, take back whatever hasn't been
+         * handed to the kernel yet.
+         */
+        if (io_errno && queued > 0) {
+            __atomic_store_n(ring->sq_tail, __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE),
+                             __ATOMIC_RELEASE);
+            queued = 0;
+        }
+        if (0 == inflight && 0 == queued)
+            break;
+
+        /* Submit the new entries and wait for at least one completion */
+        ret = (int)syscall(__NR_io_uring_enter, ring->fd, queued, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+        if (ret < 0) {
+            if (EINTR == errno || EAGAIN == errno || EBUSY == errno)
+                continue;
+            if (0 == io_errno)
+                io_errno = errno;
+            continue;
+        }
+        queued -= (unsigned)ret;
+        inflight += (unsigned)ret;
+
+        /* Reap the completions */
+        cq_head = *ring->cq_head;
+        cq_tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        while (cq_head != cq_tail) {
+            struct io_uring_cqe *cqe = &ring->cqes[cq_head & ring->cq_mask];
+            H5FD_iouring_req_t  *req = &reqs[cqe->user_data];
+            int                  res = cqe->res;
+            hbool_t              done_req = FALSE;
+
+            cq_head++;
+            inflight--;
+
+            if (res < 0) {
+                if (-res != EINTR && -res != EAGAIN) {
+                    if (0 == io_errno)
+                        io_errno = -res;
+                    done_req = TRUE;
+                }
+            }
+            else if (0 == res) {
+                if (do_write) {
+                    if (0 == io_errno)
+                        io_errno = EIO;
+                }
+                else
+                    /* end of file but not end of format address space */
+                    memset(req->ptr, 0, req->left);
+                done_req = TRUE;
+            }
+            else {
+                assert((size_t)res <= req->left);
+                req->left -= (size_t)res;
+                req->addr += (haddr_t)res;
+                req->ptr += res;
+                done_req = (0 == req->left);
+            }
+
+            if (done_req) {
+                if (req->slot >= 0) {
+                    if (!do_write && 0 == io_errno)
+                        H5MM_memcpy(req->user, file->fixed_pool + (size_t)req->slot * file->fixed_size,
+                                    req->size);
+                    file->free_slots[file->nfree++] = (unsigned)req->slot;
+                    req->slot                       = -1;
+                }
+                if (do_write && req->addr > max_addr)
+                    max_addr = req->addr;
+                remaining--;
+            }
+            else {
+                /* Requeue the rest of a short transfer at the front */
+                req->next = pend_head;
+                pend_head = (uint32_t)(req - reqs);
+                if (H5FD_IOURING_NO_REQ == pend_tail)
+                    pend_tail = pend_head;
+            }
+        }
+        __atomic_store_n(ring->cq_head, cq_head, __ATOMIC_RELEASE);
+
+        if (io_errno && 0 == inflight)
+            break;
+    }
+
+    /* Return any staging buffers held by pieces that never completed */
+    for (i = 0; i < count; i++)
+        if (reqs[i].slot >= 0)
+            file->free_slots[file->nfree++] = (unsigned)reqs[i].slot;
+
+    if (io_errno) {
+        time_t mytime = HDtime(NULL);
+
+        if (do_write)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "file write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, "
+                        "error message = '%s', pieces = %llu",
+                        HDctime(&mytime), file->filename, file->fd, io_errno, HDstrerror(io_errno),
+                        (unsigned long long)count);
+        else
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, "
+                        "error message = '%s', pieces = %llu",
+                        HDctime(&mytime), file->filename, file->fd, io_errno, HDstrerror(io_errno),
+                        (unsigned long long)count);
+    }
+
+    /* Update the eof */
+    if (do_write && max_addr > file->eof)
+        file->eof = max_addr;
+
+done:
+    if (reqs != local_reqs)
+        H5MM_xfree(reqs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_transfer() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                   size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t         *file = (H5FD_iouring_t *)_file;
+    H5_flexible_const_ptr_t fbuf;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    if (0 == size)
+        HGOTO_DONE(SUCCEED);
+
+    fbuf.vp = buf;
+    if (H5FD__iouring_transfer(file, FALSE, 1, &addr, &size, &fbuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "io_uring read failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                    size_t size, const void *buf)
+{
+    H5FD_iouring_t         *file = (H5FD_iouring_t *)_file;
+    H5_flexible_const_ptr_t fbuf;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    if (0 == size)
+        HGOTO_DONE(SUCCEED);
+
+    fbuf.cvp = buf;
+    if (H5FD__iouring_transfer(file, TRUE, 1, &addr, &size, &fbuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "io_uring write failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read_vector
+ *
+ * Purpose:     Reads the COUNT pieces described by ADDRS and SIZES into
+ *              BUFS, submitting them to the kernel as one batch.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                          H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                          void *bufs[] /* out */)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || sizes[0] != 0);
+
+    if (H5FD__iouring_transfer(file, FALSE, count, addrs, sizes, (H5_flexible_const_ptr_t *)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "io_uring vector read failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write_vector
+ *
+ * Purpose:     Writes the COUNT pieces described by ADDRS and SIZES from
+ *              BUFS, submitting them to the kernel as one batch.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                           H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                           const void *bufs[] /* in */)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || sizes[0] != 0);
+
+    if (H5FD__iouring_transfer(file, TRUE, count, addrs, sizes, (H5_flexible_const_ptr_t *)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "io_uring vector write failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same (or larger)
+ *              than the end-of-address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Extend the file to make sure it's large enough */
+    if (!H5_addr_eq(file->eoa, file->eof)) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    int             lock_flags;                     /* file locking flags       */
+    herr_t          ret_value = SUCCEED;            /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    herr_t          ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_delete
+ *
+ * Purpose:     Delete a file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_delete(const char *filename, hid_t H5_ATTR_UNUSED fapl_id)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(filename);
+
+    if (HDremove(filename) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTDELETEFILE, FAIL, "unable to delete file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_delete() */
+
+#endif /* H5_HAVE_IOURING_VFD */
@@ -0,0 +1,111 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the io_uring driver.
+ */
+#ifndef H5FDiouring_H
+#define H5FDiouring_H
+
+#ifdef H5_HAVE_IOURING_VFD
+#define H5FD_IOURING       (H5FDperform_init(H5FD_iouring_init))
+#define H5FD_IOURING_VALUE H5_VFD_IOURING
+#else
+#define H5FD_IOURING       (H5I_INVALID_HID)
+#define H5FD_IOURING_VALUE H5_VFD_INVALID
+#endif /* H5_HAVE_IOURING_VFD */
+
+#ifdef H5_HAVE_IOURING_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default values for the submission queue depth and the registered buffer
+ * pool.  Application can set these values through H5Pset_fapl_iouring. */
+#define H5FD_IOURING_QUEUE_DEPTH_DEF    64
+#define H5FD_IOURING_NFIXED_BUFS_DEF    16
+#define H5FD_IOURING_FIXED_BUF_SIZE_DEF (64 * 1024)
+
+/* Largest queue depth accepted by H5Pset_fapl_iouring */
+#define H5FD_IOURING_QUEUE_DEPTH_MAX 4096
+
+H5_DLL hid_t H5FD_iouring_init(void);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets up use of the io_uring driver
+ *
+ * \fapl_id
+ * \param[in] queue_depth Number of requests the driver keeps in flight
+ * \param[in] nfixed_bufs Number of registered staging buffers
+ * \param[in] fixed_buf_size Size of each registered staging buffer
+ * \returns \herr_t
+ *
+ * \details H5Pset_fapl_iouring() sets the file access property list, \p
+ *          fapl_id, to use the Linux io_uring driver, #H5FD_IOURING. The
+ *          driver lays out files exactly like the POSIX (sec2) driver, but
+ *          services vector and selection I/O requests by submitting all of
+ *          their pieces to the kernel as a batch of io_uring requests and
+ *          completing them concurrently, instead of issuing one blocking
+ *          \c pread or \c pwrite call at a time.
+ *
+ *          \p queue_depth is the number of requests kept in flight at once.
+ *          A value of 0 (zero) selects the default of 64; values above 4096
+ *          are rejected.
+ *
+ *          \p nfixed_bufs and \p fixed_buf_size describe a pool of staging
+ *          buffers that the driver registers with the kernel when the file
+ *          is opened. Pieces no larger than \p fixed_buf_size are transferred
+ *          through these buffers, which saves the kernel from mapping the
+ *          application's pages on every request. Passing 0 (zero) for \p
+ *          fixed_buf_size selects the default of 64 KiB. Passing 0 (zero)
+ *          for \p nfixed_bufs disables the pool. If the kernel refuses to
+ *          register the pool (for example because of the locked memory
+ *          limit), the driver silently transfers all pieces directly.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, unsigned nfixed_bufs,
+                                  size_t fixed_buf_size);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves io_uring driver settings
+ *
+ * \fapl_id
+ * \param[out] queue_depth Number of requests the driver keeps in flight
+ * \param[out] nfixed_bufs Number of registered staging buffers
+ * \param[out] fixed_buf_size Size of each registered staging buffer
+ * \returns \herr_t
+ *
+ * \details H5Pget_fapl_iouring() retrieves the queue depth and the
+ *          registered buffer pool settings for the io_uring driver,
+ *          #H5FD_IOURING, from the file access property list \p fapl_id.
+ *
+ *          See H5Pset_fapl_iouring() for a discussion of these values.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/, unsigned *nfixed_bufs /*out*/,
+                                  size_t *fixed_buf_size /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_IOURING_VFD */
+
+#endif
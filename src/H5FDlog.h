@@ -210,7 +210,9 @@ H5_DLL hid_t H5FD_log_init(void);
  * logged while the log driver is in use.\n
  * One buffer of size buf_size will be created for each of #H5FD_LOG_FILE_READ,
  * #H5FD_LOG_FILE_WRITE and #H5FD_LOG_FLAVOR when those flags are set; these
- * buffers will not grow as the file increases in size.
+ * buffers will not grow as the file increases in size. For large files, or to
+ * observe a driver other than sec2, the profiling driver set up with
+ * H5Pset_fapl_profile() records fixed-size request histograms instead.
  *
  * \par Output:
  * This section describes the logging driver (LOG VFD) output.\n
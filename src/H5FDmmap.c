@@ -0,0 +1,987 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The read-only mmap file driver.  Like the core driver with a
+ *          backing store, the whole file is kept as one in-memory image
+ *          and every read is a memcpy() out of it, but the image is a
+ *          shared, read-only mapping of the file instead of a private
+ *          copy read in at open time.  Pages are only brought in when
+ *          they are touched, and they stay in the page cache rather than
+ *          on the heap.
+ *
+ *          Because the image never moves while the file is open, the
+ *          driver answers the H5FD_CTL_BORROW_BUFFER_OPCODE ctl request,
+ *          which lets the contiguous dataset read path copy straight out
+ *          of the mapping.
+ *
+ *          Raw data reads (including borrowed ranges) are classified as
+ *          sequential or random and the result is passed on to the
+ *          kernel with madvise().
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDmmap.h"    /* Read-only mmap driver    */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_MMAP_VFD
+
+#include <sys/mman.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_MMAP_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Number of adjacent raw data reads before the stream counts as sequential */
+#define H5FD_MMAP_SEQ_THRESHOLD 2
+
+/* Number of non-adjacent raw data reads before the stream counts as random */
+#define H5FD_MMAP_RANDOM_THRESHOLD 4
+
+/* Driver-specific file access properties */
+typedef struct H5FD_mmap_fapl_t {
+    size_t readahead; /* Window prefetched ahead of sequential reads */
+} H5FD_mmap_fapl_t;
+
+/*
+ * The description of a file belonging to this driver.  'eof' is the size
+ * of the file, and of the mapping, when it was opened; 'image' is NULL for
+ * an empty file.  The remaining fields track the raw data access pattern:
+ * 'next_addr' is where the previous read ended, 'seq_count'/'rand_count'
+ * count the adjacent and non-adjacent reads since the pattern last
+ * changed, 'advice' is the madvise() advice in effect for the whole
+ * mapping, and 'ra_end' is the end of the range already prefetched.
+ */
+typedef struct H5FD_mmap_t {
+    H5FD_t           pub;   /* public stuff, must be first      */
+    int              fd;    /* the filesystem file descriptor   */
+    unsigned char   *image; /* the mapping of the file          */
+    haddr_t          eoa;   /* end of allocated region          */
+    haddr_t          eof;   /* size of the file and the mapping */
+    H5FD_mmap_fapl_t fa;    /* file access properties           */
+    hbool_t          ignore_disabled_file_locks;
+
+    /* Access pattern tracking */
+    size_t   page_size;  /* System page size                       */
+    haddr_t  next_addr;  /* End of the previous raw data read      */
+    unsigned seq_count;  /* Adjacent reads in a row                */
+    unsigned rand_count; /* Non-adjacent reads in a row            */
+    int      advice;     /* Advice currently applied to the image  */
+    haddr_t  ra_end;     /* End of the prefetched window           */
+
+    /* On most systems the combination of device and i-node number uniquely
+     * identify a file.
+     */
+    dev_t device; /* file device number   */
+    ino_t inode;  /* file i-node number   */
+} H5FD_mmap_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__mmap_term(void);
+static void   *H5FD__mmap_fapl_get(H5FD_t *file);
+static void   *H5FD__mmap_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__mmap_close(H5FD_t *_file);
+static int     H5FD__mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__mmap_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__mmap_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__mmap_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__mmap_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__mmap_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                               void *buf);
+static herr_t  H5FD__mmap_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                const void *buf);
+static herr_t  H5FD__mmap_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__mmap_unlock(H5FD_t *_file);
+static herr_t  H5FD__mmap_delete(const char *filename, hid_t fapl_id);
+static herr_t  H5FD__mmap_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input,
+                              void **output);
+
+static void H5FD__mmap_advise(H5FD_mmap_t *file, haddr_t addr, size_t size);
+
+static const H5FD_class_t H5FD_mmap_g = {
+    H5FD_CLASS_VERSION,       /* struct version       */
+    H5FD_MMAP_VALUE,          /* value                */
+    "mmap",                   /* name                 */
+    MAXADDR,                  /* maxaddr              */
+    H5F_CLOSE_WEAK,           /* fc_degree            */
+    H5FD__mmap_term,          /* terminate            */
+    NULL,                     /* sb_size              */
+    NULL,                     /* sb_encode            */
+    NULL,                     /* sb_decode            */
+    sizeof(H5FD_mmap_fapl_t), /* fapl_size            */
+    H5FD__mmap_fapl_get,      /* fapl_get             */
+    H5FD__mmap_fapl_copy,     /* fapl_copy            */
+    NULL,                     /* fapl_free            */
+    0,                        /* dxpl_size            */
+    NULL,                     /* dxpl_copy            */
+    NULL,                     /* dxpl_free            */
+    H5FD__mmap_open,          /* open                 */
+    H5FD__mmap_close,         /* close                */
+    H5FD__mmap_cmp,           /* cmp                  */
+    H5FD__mmap_query,         /* query                */
+    NULL,                     /* get_type_map         */
+    NULL,                     /* alloc                */
+    NULL,                     /* free                 */
+    H5FD__mmap_get_eoa,       /* get_eoa              */
+    H5FD__mmap_set_eoa,       /* set_eoa              */
+    H5FD__mmap_get_eof,       /* get_eof              */
+    H5FD__mmap_get_handle,    /* get_handle           */
+    H5FD__mmap_read,          /* read                 */
+    H5FD__mmap_write,         /* write                */
+    NULL,                     /* read_vector          */
+    NULL,                     /* write_vector         */
+    NULL,                     /* read_selection       */
+    NULL,                     /* write_selection      */
+    NULL,                     /* flush                */
+    NULL,                     /* truncate             */
+    H5FD__mmap_lock,          /* lock                 */
+    H5FD__mmap_unlock,        /* unlock               */
+    H5FD__mmap_delete,        /* del                  */
+    H5FD__mmap_ctl,           /* ctl                  */
+    H5FD_FLMAP_DICHOTOMY      /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_mmap_t struct */
+H5FL_DEFINE_STATIC(H5FD_mmap_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the mmap driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_mmap_init(void)
+{
+    char *lock_env_var = NULL;            /* Environment variable pointer */
+    hid_t ret_value    = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv(HDF5_USE_FILE_LOCKING);
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5I_VFL != H5I_get_type(H5FD_MMAP_g)) {
+        H5FD_MMAP_g = H5FD_register(&H5FD_mmap_g, sizeof(H5FD_class_t), FALSE);
+        if (H5I_INVALID_HID == H5FD_MMAP_g)
+            HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, H5I_INVALID_HID, "unable to register mmap");
+    }
+
+    /* Set return value */
+    ret_value = H5FD_MMAP_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__mmap_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_term(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Reset VFL ID */
+    H5FD_MMAP_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_mmap
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_MMAP
+ *              driver defined in this source file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_mmap(hid_t fapl_id, size_t readahead)
+{
+    H5P_genplist_t  *plist; /* Property list pointer */
+    H5FD_mmap_fapl_t fa;
+    herr_t           ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", fapl_id, readahead);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    memset(&fa, 0, sizeof(H5FD_mmap_fapl_t));
+    fa.readahead = readahead ? readahead : H5FD_MMAP_READAHEAD_DEF;
+
+    ret_value = H5P_set_driver(plist, H5FD_MMAP, &fa, NULL);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_mmap
+ *
+ * Purpose:     Returns information about the mmap file access property
+ *              list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_mmap(hid_t fapl_id, size_t *readahead /*out*/)
+{
+    H5P_genplist_t         *plist; /* Property list pointer */
+    const H5FD_mmap_fapl_t *fa;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, readahead);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list");
+    if (H5FD_MMAP != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (fa = H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info");
+    if (readahead)
+        *readahead = fa->readahead;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__mmap_fapl_get(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    void        *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__mmap_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_fapl_copy
+ *
+ * Purpose:     Copies the mmap-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__mmap_fapl_copy(const void *_old_fa)
+{
+    const H5FD_mmap_fapl_t *old_fa    = (const H5FD_mmap_fapl_t *)_old_fa;
+    H5FD_mmap_fapl_t       *new_fa    = NULL;
+    void                   *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (NULL == (new_fa = (H5FD_mmap_fapl_t *)H5MM_malloc(sizeof(H5FD_mmap_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed");
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_mmap_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_open
+ *
+ * Purpose:     Opens an existing HDF5 file read-only and maps it into
+ *              memory.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_mmap_t            *file  = NULL; /* mmap VFD info            */
+    int                     fd    = -1;   /* File descriptor          */
+    void                   *image = NULL; /* Mapping of the file      */
+    haddr_t                 eof   = 0;    /* Size of the file         */
+    const H5FD_mmap_fapl_t *fa;
+    H5FD_mmap_fapl_t        default_fa;
+    h5_stat_t               sb;
+    long                    page_size;
+    H5P_genplist_t         *plist;            /* Property list pointer */
+    H5FD_t                 *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name");
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr");
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
+    if (flags & (H5F_ACC_RDWR | H5F_ACC_TRUNC | H5F_ACC_CREAT | H5F_ACC_EXCL))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "the mmap driver only supports read-only access");
+
+    /* Open the file */
+    if ((fd = HDopen(name, O_RDONLY, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL,
+                    "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x", name,
+                    myerrno, HDstrerror(myerrno), flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+    H5_CHECKED_ASSIGN(eof, haddr_t, sb.st_size, h5_stat_size_t);
+    if (eof > (haddr_t)SIZE_MAX)
+        HGOTO_ERROR(H5E_FILE, H5E_OVERFLOW, NULL, "file is too large to map");
+
+    /* Map the file.  An empty file has no image. */
+    if (eof > 0)
+        if (MAP_FAILED == (image = mmap(NULL, (size_t)eof, PROT_READ, MAP_SHARED, fd, 0))) {
+            image = NULL;
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to map file")
+        }
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_mmap_fapl_t *)H5P_peek_driver_info(plist))) {
+        default_fa.readahead = H5FD_MMAP_READAHEAD_DEF;
+        fa                   = &default_fa;
+    }
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_mmap_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct");
+
+    file->fd     = fd;
+    file->image  = (unsigned char *)image;
+    file->eof    = eof;
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_mmap_fapl_t));
+
+    /* The kernel starts out with its default readahead for the mapping */
+    page_size       = sysconf(_SC_PAGESIZE);
+    file->page_size = page_size > 0 ? (size_t)page_size : 4096;
+    file->next_addr = HADDR_UNDEF;
+    file->advice    = MADV_NORMAL;
+    file->ra_end    = 0;
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property");
+    }
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (image)
+            munmap(image, (size_t)eof);
+        if (fd >= 0)
+            HDclose(fd);
+        if (file)
+            file = H5FL_FREE(H5FD_mmap_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_close
+ *
+ * Purpose:     Unmaps and closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_close(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(file);
+
+    /* Release the image */
+    if (file->image && munmap(file->image, (size_t)file->eof) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to unmap file")
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_mmap_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_mmap_t *f1        = (const H5FD_mmap_t *)_f1;
+    const H5FD_mmap_t *f2        = (const H5FD_mmap_t *)_f2;
+    int                ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1);
+    if (f1->device > f2->device)
+        HGOTO_DONE(1);
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (memcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1);
+    if (memcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1);
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1);
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              Data sieving is not offered: it exists to save system
+ *              calls, and here it would only add a copy.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+    }                                               /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__mmap_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__mmap_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the size of the
+ *              file when it was mapped.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              mapping.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__mmap_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__mmap_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_get_handle
+ *
+ * Purpose:     Returns the file handle of the mmap file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid");
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_advise
+ *
+ * Purpose:     Records a raw data read of SIZE bytes at ADDR and updates
+ *              the kernel's view of the access pattern.
+ *
+ *              A read that starts where the previous one ended is
+ *              adjacent.  After H5FD_MMAP_SEQ_THRESHOLD adjacent reads in
+ *              a row the whole image is advised MADV_SEQUENTIAL and the
+ *              driver keeps the next 'readahead' bytes past the reader
+ *              prefetched with MADV_WILLNEED, topping the window up once
+ *              the reader has consumed half of it.  After
+ *              H5FD_MMAP_RANDOM_THRESHOLD non-adjacent reads in a row the
+ *              image is advised MADV_RANDOM, which stops the kernel from
+ *              reading around each fault.
+ *
+ *              The advice is only a hint, so failures are ignored.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__mmap_advise(H5FD_mmap_t *file, haddr_t addr, size_t size)
+{
+    haddr_t end = addr + size;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (file->image && size > 0) {
+        /* Classify the read */
+        if (H5_addr_eq(addr, file->next_addr)) {
+            file->seq_count++;
+            file->rand_count = 0;
+        }
+        else {
+            file->rand_count++;
+            file->seq_count = 0;
+        }
+        file->next_addr = end;
+
+        if (file->seq_count >= H5FD_MMAP_SEQ_THRESHOLD) {
+            if (file->advice != MADV_SEQUENTIAL) {
+                (void)madvise(file->image, (size_t)file->eof, MADV_SEQUENTIAL);
+                file->advice = MADV_SEQUENTIAL;
+                file->ra_end = 0;
+            }
+
+            /* Top up the prefetched window once half of it has been consumed */
+            if (end < file->eof && (file->ra_end < end || file->ra_end - end < file->fa.readahead / 2)) {
+                haddr_t start = MAX(file->ra_end, end);
+                haddr_t stop  = MIN(end + file->fa.readahead, file->eof);
+
+                /* madvise() wants a page aligned start */
+                start -= start % file->page_size;
+                if (start < stop)
+                    (void)madvise(file->image + start, (size_t)(stop - start), MADV_WILLNEED);
+                file->ra_end = stop;
+            }
+        }
+        else if (file->rand_count >= H5FD_MMAP_RANDOM_THRESHOLD && file->advice != MADV_RANDOM) {
+            (void)madvise(file->image, (size_t)file->eof, MADV_RANDOM);
+            file->advice = MADV_RANDOM;
+            file->ra_end = 0;
+        }
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__mmap_advise() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF.  The part of the request past the end of
+ *              the mapping is zero-filled, as with the sec2 driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr, size_t size,
+                void *buf /*out*/)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr);
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr);
+
+    if (H5FD_MEM_DRAW == type)
+        H5FD__mmap_advise(file, addr, size);
+
+    /* Copy the part of the request that lies within the image */
+    if (addr < file->eof) {
+        size_t nbytes = (size_t)MIN(size, file->eof - addr);
+
+        H5MM_memcpy(buf, file->image + addr, nbytes);
+        size -= nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    }
+
+    /* Zero-fill the rest */
+    if (size > 0)
+        memset(buf, 0, size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_write
+ *
+ * Purpose:     Fails; the mmap driver is read-only.
+ *
+ * Return:      FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_write(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                 haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED size, const void H5_ATTR_UNUSED *buf)
+{
+    herr_t ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "the mmap driver is read-only");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file; /* VFD file struct          */
+    int          lock_flags;                  /* file locking flags       */
+    herr_t       ret_value = SUCCEED;         /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_unlock(H5FD_t *_file)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file; /* VFD file struct          */
+    herr_t       ret_value = SUCCEED;              /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_delete
+ *
+ * Purpose:     Delete a file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_delete(const char *filename, hid_t H5_ATTR_UNUSED fapl_id)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(filename);
+
+    if (HDremove(filename) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTDELETEFILE, FAIL, "unable to delete file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_delete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mmap_ctl
+ *
+ * Purpose:     Perform an optional "ctl" operation.  The only operation
+ *              understood is H5FD_CTL_BORROW_BUFFER_OPCODE, which hands
+ *              back a pointer to the requested range of the image, or
+ *              NULL if the range isn't entirely within the image.  The
+ *              range is recorded as a raw data read.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mmap_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input, void **output)
+{
+    H5FD_mmap_t *file      = (H5FD_mmap_t *)_file;
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(file);
+
+    switch (op_code) {
+        case H5FD_CTL_BORROW_BUFFER_OPCODE: {
+            const H5FD_ctl_borrow_buffer_args_t *args = (const H5FD_ctl_borrow_buffer_args_t *)input;
+
+            if (!args || !output)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid borrow buffer arguments");
+
+            *output = NULL;
+            if (file->image && H5_addr_defined(args->addr) && args->addr < file->eof &&
+                args->size <= file->eof - args->addr) {
+                if (H5FD_MEM_DRAW == args->type)
+                    H5FD__mmap_advise(file, args->addr, args->size);
+                *output = file->image + args->addr;
+            }
+        } break;
+
+        /* Unknown op code */
+        default:
+            if (flags & H5FD_CTL_FAIL_IF_UNKNOWN_FLAG)
+                HGOTO_ERROR(H5E_VFL, H5E_FCNTL, FAIL, "unknown op_code and fail if unknown flag is set");
+            break;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mmap_ctl() */
+
+#endif /* H5_HAVE_MMAP_VFD */
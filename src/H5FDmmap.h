@@ -0,0 +1,95 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the read-only mmap driver.
+ */
+#ifndef H5FDmmap_H
+#define H5FDmmap_H
+
+#ifdef H5_HAVE_MMAP_VFD
+#define H5FD_MMAP       (H5FDperform_init(H5FD_mmap_init))
+#define H5FD_MMAP_VALUE H5_VFD_MMAP
+#else
+#define H5FD_MMAP       (H5I_INVALID_HID)
+#define H5FD_MMAP_VALUE H5_VFD_INVALID
+#endif /* H5_HAVE_MMAP_VFD */
+
+#ifdef H5_HAVE_MMAP_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default size of the window the driver asks the kernel to prefetch ahead
+ * of a sequential reader.  Application can set this value through
+ * H5Pset_fapl_mmap. */
+#define H5FD_MMAP_READAHEAD_DEF (4 * 1024 * 1024)
+
+H5_DLL hid_t H5FD_mmap_init(void);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets up use of the read-only mmap driver
+ *
+ * \fapl_id
+ * \param[in] readahead Size of the window prefetched ahead of sequential reads
+ * \returns \herr_t
+ *
+ * \details H5Pset_fapl_mmap() sets the file access property list, \p
+ *          fapl_id, to use the read-only memory-mapped driver, #H5FD_MMAP.
+ *          The driver maps the whole file into the address space of the
+ *          process when it is opened and services all reads from the
+ *          mapping.  Files can only be opened with #H5F_ACC_RDONLY; create
+ *          and read-write opens fail.
+ *
+ *          Reads of contiguous and unfiltered chunked datasets copy
+ *          directly from the mapping into the application's buffer,
+ *          bypassing the library's data sieve buffer.
+ *
+ *          The driver watches the pattern of raw data reads and passes it
+ *          on to the kernel with \c madvise().  Once reads are found to be
+ *          sequential, the driver keeps a window of \p readahead bytes
+ *          ahead of the reader prefetched.  Random reads switch off the
+ *          kernel's own readahead.  Passing 0 (zero) for \p readahead
+ *          selects the default of 4 MiB.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pset_fapl_mmap(hid_t fapl_id, size_t readahead);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves mmap driver settings
+ *
+ * \fapl_id
+ * \param[out] readahead Size of the window prefetched ahead of sequential reads
+ * \returns \herr_t
+ *
+ * \details H5Pget_fapl_mmap() retrieves the readahead window size for the
+ *          mmap driver, #H5FD_MMAP, from the file access property list \p
+ *          fapl_id.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pget_fapl_mmap(hid_t fapl_id, size_t *readahead /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_MMAP_VFD */
+
+#endif
@@ -164,6 +164,8 @@ static herr_t  H5FD__onion_term(void);
 static herr_t  H5FD__onion_write(H5FD_t *, H5FD_mem_t, hid_t, haddr_t, size_t, const void *);
 
 static herr_t  H5FD__onion_open_rw(H5FD_onion_t *, unsigned int, haddr_t, bool new_open);
+static herr_t  H5FD__onion_read_run(H5FD_onion_t *file, H5FD_mem_t type, hbool_t in_onion, haddr_t addr,
+                                    size_t size, unsigned char *buf);
 static herr_t  H5FD__onion_sb_encode(H5FD_t *_file, char *name /*out*/, unsigned char *buf /*out*/);
 static herr_t  H5FD__onion_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf);
 static hsize_t H5FD__onion_sb_size(H5FD_t *_file);
@@ -1325,11 +1327,59 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__onion_open_rw() */
 
+/*-----------------------------------------------------------------------------
+ * Function:    H5FD__onion_read_run
+ *
+ * Purpose:     Read a run of bytes that is contiguous in its source, either
+ *              the onion file or the original file.
+ *
+ *              Bytes of the original file past its end are returned as 0s.
+ *
+ * Return:      SUCCEED/FAIL
+ *-----------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__onion_read_run(H5FD_onion_t *file, H5FD_mem_t type, hbool_t in_onion, haddr_t addr, size_t size,
+                     unsigned char *buf)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file != NULL);
+    assert(buf != NULL);
+    assert(size > 0);
+
+    if (in_onion) {
+        if (H5FD_read(file->onion_file, H5FD_MEM_DRAW, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "can't get onion file data");
+    }
+    else {
+        haddr_t overlap_size = (addr > file->origin_eof) ? 0 : file->origin_eof - addr;
+        size_t  read_size    = (size_t)MIN(overlap_size, (haddr_t)size);
+
+        /* Get all original bytes in range */
+        if ((read_size > 0) && H5FD_read(file->original_file, type, addr, read_size, buf) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "can't get original file data");
+
+        /* Fill with 0s any gap after end of original bytes */
+        if (read_size < size)
+            memset(buf + read_size, 0, size - read_size);
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__onion_read_run() */
+
 /*-----------------------------------------------------------------------------
  * Function:    H5FD__onion_read
  *
  * Purpose:     Read bytes from an onionized file
  *
+ *              The archival index entries of all pages in the read are
+ *              looked up at once, and pages that are stored back to back
+ *              in the same file are read with a single request.
+ *
  * Return:      SUCCEED/FAIL
  *-----------------------------------------------------------------------------
  */
@@ -1337,14 +1387,21 @@ static herr_t
 H5FD__onion_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t offset, size_t len,
                  void *_buf_out)
 {
-    H5FD_onion_t  *file           = (H5FD_onion_t *)_file;
-    uint64_t       page_0         = 0;
-    size_t         n_pages        = 0;
-    uint32_t       page_size      = 0;
-    uint32_t       page_size_log2 = 0;
-    size_t         bytes_to_read  = len;
-    unsigned char *buf_out        = (unsigned char *)_buf_out;
-    herr_t         ret_value      = SUCCEED;
+    H5FD_onion_t                   *file           = (H5FD_onion_t *)_file;
+    const H5FD_onion_index_entry_t *aix_entries    = NULL; /* archival entries of pages in the read */
+    uint64_t                        aix_n_entries  = 0;
+    uint64_t                        aix_i          = 0;
+    uint64_t                        page_i         = 0;
+    uint32_t                        page_size      = 0;
+    uint32_t                        page_size_log2 = 0;
+    haddr_t                         page_gap_head  = 0; /* start of page to start of buffer */
+    hbool_t                         run_in_onion   = FALSE;
+    haddr_t                         run_addr       = 0;
+    size_t                          run_size       = 0;
+    unsigned char                  *run_buf        = NULL;
+    size_t                          bytes_to_read  = len;
+    unsigned char                  *buf_out        = (unsigned char *)_buf_out;
+    herr_t                          ret_value      = SUCCEED;
 
     FUNC_ENTER_PACKAGE
 
@@ -1359,70 +1416,65 @@ H5FD__onion_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, h
 
     page_size      = file->header.page_size;
     page_size_log2 = file->curr_rev_record.archival_index.page_size_log2;
-    page_0         = offset >> page_size_log2;
-    n_pages        = (len + page_size - 1) >> page_size_log2;
-
-    /* Read, page-by-page */
-    for (size_t i = 0; i < n_pages; i++) {
-        const H5FD_onion_index_entry_t *entry_out     = NULL;
-        haddr_t                         page_gap_head = 0; /* start of page to start of buffer */
-        haddr_t                         page_gap_tail = 0; /* end of buffer to end of page */
-        size_t                          page_readsize = 0;
-        uint64_t                        page_i        = page_0 + i;
-
-        if (0 == i) {
-            page_gap_head = offset & (((uint32_t)1 << page_size_log2) - 1);
-            /* Check if we need to add an additional page to make up for the page_gap_head */
-            if (page_gap_head > 0 &&
-                (page_gap_head + (bytes_to_read % page_size) > page_size || bytes_to_read % page_size == 0)) {
-                n_pages++;
-            }
-        }
+    page_i         = offset >> page_size_log2;
+    page_gap_head  = offset & (((uint32_t)1 << page_size_log2) - 1);
 
-        if (n_pages - 1 == i)
-            page_gap_tail = page_size - bytes_to_read - page_gap_head;
+    if (file->fa.revision_num != 0)
+        aix_n_entries =
+            H5FD__onion_archival_index_find_range(&file->curr_rev_record.archival_index, page_i,
+                                                  (offset + len - 1) >> page_size_log2, &aix_entries);
 
-        page_readsize = (size_t)page_size - page_gap_head - page_gap_tail;
+    /* Read, page-by-page, merging pages that are contiguous in their source */
+    for (; bytes_to_read > 0; page_i++) {
+        const H5FD_onion_index_entry_t *entry_out     = NULL;
+        size_t                          page_readsize = MIN((size_t)page_size - page_gap_head, bytes_to_read);
+        hbool_t                         in_onion      = FALSE;
+        haddr_t                         addr          = 0;
 
         if (TRUE == file->is_open_rw && file->fa.revision_num != 0 &&
             H5FD__onion_revision_index_find(file->rev_index, page_i, &entry_out)) {
             /* Page exists in 'live' revision index */
-            if (H5FD_read(file->onion_file, H5FD_MEM_DRAW, entry_out->phys_addr + page_gap_head,
-                          page_readsize, buf_out) < 0)
-                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "can't get working file data");
-        }
-        else if (file->fa.revision_num != 0 &&
-                 H5FD__onion_archival_index_find(&file->curr_rev_record.archival_index, page_i, &entry_out)) {
-            /* Page exists in archival index */
-            if (H5FD_read(file->onion_file, H5FD_MEM_DRAW, entry_out->phys_addr + page_gap_head,
-                          page_readsize, buf_out) < 0)
-                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "can't get previously-amended file data");
+            in_onion = TRUE;
         }
         else {
-            /* Page does not exist in either index */
+            /* Skip archival entries of pages that were found in the revision index */
+            while (aix_i < aix_n_entries && aix_entries[aix_i].logical_page < page_i)
+                aix_i++;
 
-            /* Casts prevent truncation */
-            haddr_t addr_start   = (haddr_t)page_i * (haddr_t)page_size + (haddr_t)page_gap_head;
-            haddr_t overlap_size = (addr_start > file->origin_eof) ? 0 : file->origin_eof - addr_start;
-            haddr_t read_size    = MIN(overlap_size, page_readsize);
-
-            /* Get all original bytes in page range */
-            if ((read_size > 0) && H5FD_read(file->original_file, type, addr_start, read_size, buf_out) < 0) {
-                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "can't get original file data");
+            if (aix_i < aix_n_entries && aix_entries[aix_i].logical_page == page_i) {
+                /* Page exists in archival index */
+                entry_out = &aix_entries[aix_i];
+                in_onion  = TRUE;
             }
+        }
 
-            /* Fill with 0s any gaps after end of original bytes
-             * and before end of page.
-             */
-            for (size_t j = read_size; j < page_readsize; j++)
-                buf_out[j] = 0;
+        /* Page not in either index comes from the original file */
+        if (in_onion)
+            addr = entry_out->phys_addr + page_gap_head;
+        else
+            addr = ((haddr_t)page_i << page_size_log2) + page_gap_head;
+
+        /* Read the pending run if this page doesn't continue it */
+        if (run_size > 0 && (in_onion != run_in_onion || addr != run_addr + run_size)) {
+            if (H5FD__onion_read_run(file, type, run_in_onion, run_addr, run_size, run_buf) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "can't read file data");
+            run_size = 0;
+        }
+
+        if (0 == run_size) {
+            run_in_onion = in_onion;
+            run_addr     = addr;
+            run_buf      = buf_out;
         }
+        run_size += page_readsize;
 
         buf_out += page_readsize;
         bytes_to_read -= page_readsize;
+        page_gap_head = 0;
     } /* end for each page in range */
 
-    assert(0 == bytes_to_read);
+    if (H5FD__onion_read_run(file, type, run_in_onion, run_addr, run_size, run_buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "can't read file data");
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -279,6 +279,70 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__onion_archival_index_find() */
 
+/*-----------------------------------------------------------------------------
+ * Function:    H5FD__onion_archival_index_find_range
+ *
+ * Purpose:     Retrieve all archival index entries for the logical pages
+ *              `first_page` .. `last_page` (inclusive) with one search.
+ *
+ *              As the list is sorted by logical page, the entries in the
+ *              range are adjacent in it. The first one is located with a
+ *              binary search and the rest follow it, so a read spanning
+ *              many pages costs one search instead of one per page.
+ *
+ *              The entry out pointer-pointer cannot be null.
+ *
+ * Return:      Number of entries in the range. When non-zero, the entry
+ *              out pointer-pointer is set to point to the first of them;
+ *              otherwise it is unmodified.
+ *-----------------------------------------------------------------------------
+ */
+uint64_t
+H5FD__onion_archival_index_find_range(const H5FD_onion_archival_index_t *aix, uint64_t first_page,
+                                      uint64_t last_page, const H5FD_onion_index_entry_t **entries_out)
+{
+    uint64_t low       = 0;
+    uint64_t high      = 0;
+    uint64_t n         = 0;
+    uint64_t ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(aix);
+    assert(H5FD_ONION_ARCHIVAL_INDEX_VERSION_CURR == aix->version);
+    assert(entries_out);
+    assert(first_page <= last_page);
+    if (aix->n_entries != 0)
+        assert(aix->list);
+
+    /* Trivial cases */
+    if (aix->n_entries == 0 || first_page > aix->list[aix->n_entries - 1].logical_page ||
+        last_page < aix->list[0].logical_page)
+        HGOTO_DONE(0);
+
+    /* Find the first entry at or after the first page */
+    high = aix->n_entries;
+    while (low < high) {
+        n = low + ((high - low) / 2);
+        if (aix->list[n].logical_page < first_page)
+            low = n + 1;
+        else
+            high = n;
+    }
+
+    /* Count the entries up to the last page */
+    for (n = low; n < aix->n_entries && aix->list[n].logical_page <= last_page; n++)
+        ;
+
+    if (n > low) {
+        *entries_out = &aix->list[low];
+        ret_value    = n - low;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__onion_archival_index_find_range() */
+
 /*-----------------------------------------------------------------------------
  * Function:    H5FD__onion_revision_index_destroy
  *
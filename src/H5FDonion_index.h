@@ -128,6 +128,8 @@ H5_DLL herr_t H5FD__onion_ingest_revision_record(H5FD_onion_revision_record_t *r
 H5_DLL hbool_t H5FD__onion_archival_index_is_valid(const H5FD_onion_archival_index_t *);
 H5_DLL int     H5FD__onion_archival_index_find(const H5FD_onion_archival_index_t *, uint64_t,
                                                const H5FD_onion_index_entry_t **);
+H5_DLL uint64_t H5FD__onion_archival_index_find_range(const H5FD_onion_archival_index_t *, uint64_t, uint64_t,
+                                                      const H5FD_onion_index_entry_t **);
 
 H5_DLL H5FD_onion_revision_index_t *H5FD__onion_revision_index_init(uint32_t page_size);
 H5_DLL herr_t                       H5FD__onion_revision_index_destroy(H5FD_onion_revision_index_t *);
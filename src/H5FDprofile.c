@@ -0,0 +1,1405 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The profiling file driver.  This is a pass-through driver
+ *          stacked on another one, like the splitter, which records
+ *          statistics about the I/O requests it passes down.
+ *
+ *          Unlike the log driver, which keeps flags for every byte of the
+ *          file, the memory used here is fixed: for each direction and
+ *          memory type there are counters and power-of-two histograms of
+ *          the request sizes, seek distances and latencies.  Reading the
+ *          clock costs more than the bookkeeping, so only one request in
+ *          'sample_interval' is timed.  The statistics are appended to the
+ *          output file as one line of JSON when the file is closed.
+ *
+ *          There are no vector or selection I/O callbacks.  Having them
+ *          turns on selection I/O by default, which would change the
+ *          requests the library makes compared to running without this
+ *          driver.  Vector and selection requests are therefore split up
+ *          by the library and each piece is counted as a request.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDprofile.h" /* Profiling file driver    */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+#include "H5VMprivate.h" /* Vectors and arrays       */
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_PROFILE_g = 0;
+
+/* Number of histogram buckets: one for zero and one per bit of a 64-bit value */
+#define H5FD_PROFILE_NBUCKETS 65
+
+/* Histogram bucket of a value: 0 for 0, else i for values in [2^(i-1), 2^i) */
+#define H5FD_PROFILE_BUCKET(N) ((N) ? H5VM_log2_gen((uint64_t)(N)) + 1 : 0)
+
+/* Directions of the statistics */
+#define H5FD_PROFILE_READ  0
+#define H5FD_PROFILE_WRITE 1
+
+/* Driver-specific file access properties */
+typedef struct H5FD_profile_fapl_t {
+    hid_t    under_fapl_id;                       /* FAPL of the underlying driver      */
+    char     out_path[H5FD_PROFILE_PATH_MAX + 1]; /* Profile output file, empty: stderr */
+    unsigned sample_interval;                     /* Time one request out of this many  */
+} H5FD_profile_fapl_t;
+
+/* Statistics of one direction and memory type */
+typedef struct H5FD_profile_stats_t {
+    uint64_t nrequests;                        /* Number of requests               */
+    uint64_t nbytes;                           /* Number of bytes                  */
+    uint64_t nsampled;                         /* Number of timed requests         */
+    uint64_t time_ns;                          /* Total time of the timed requests */
+    uint64_t max_ns;                           /* Longest timed request            */
+    uint64_t size[H5FD_PROFILE_NBUCKETS];      /* Histogram of request sizes       */
+    uint64_t latency[H5FD_PROFILE_NBUCKETS];   /* Histogram of timed latencies     */
+    uint64_t seek_fwd[H5FD_PROFILE_NBUCKETS];  /* Histogram of forward seeks       */
+    uint64_t seek_back[H5FD_PROFILE_NBUCKETS]; /* Histogram of backward seeks      */
+} H5FD_profile_stats_t;
+
+/*
+ * The description of a file belonging to this driver.  Seek distances are
+ * measured from 'last_end', the end of the previous read or write in
+ * either direction.
+ */
+typedef struct H5FD_profile_t {
+    H5FD_t               pub;         /* public stuff, must be first       */
+    H5FD_t              *under;       /* underlying file                   */
+    H5FD_profile_fapl_t  fa;          /* file access properties            */
+    char                *name;        /* name the file was opened with     */
+    haddr_t              last_end;    /* end of the previous request       */
+    unsigned             countdown;   /* requests until the next timed one */
+    uint64_t             open_ns;     /* time the file was opened          */
+    uint64_t             nflushes;    /* number of flushes                 */
+    uint64_t             flush_ns;    /* total time of the flushes         */
+    uint64_t             ntruncates;  /* number of truncations             */
+    uint64_t             truncate_ns; /* total time of the truncations     */
+    H5FD_profile_stats_t stats[2][H5FD_MEM_NTYPES]; /* by direction and type */
+} H5FD_profile_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+
+/* Prototypes */
+static herr_t  H5FD__profile_term(void);
+static hsize_t H5FD__profile_sb_size(H5FD_t *_file);
+static herr_t  H5FD__profile_sb_encode(H5FD_t *_file, char *name /*out*/, unsigned char *buf /*out*/);
+static herr_t  H5FD__profile_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf);
+static void   *H5FD__profile_fapl_get(H5FD_t *_file);
+static void   *H5FD__profile_fapl_copy(const void *_old_fa);
+static herr_t  H5FD__profile_fapl_free(void *_fa);
+static H5FD_t *H5FD__profile_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__profile_close(H5FD_t *_file);
+static int     H5FD__profile_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__profile_query(const H5FD_t *_file, unsigned long *flags);
+static herr_t  H5FD__profile_get_type_map(const H5FD_t *_file, H5FD_mem_t *type_map);
+static haddr_t H5FD__profile_alloc(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, hsize_t size);
+static herr_t  H5FD__profile_free(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, hsize_t size);
+static haddr_t H5FD__profile_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__profile_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__profile_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__profile_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__profile_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                                  void *buf);
+static herr_t  H5FD__profile_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                                   const void *buf);
+static herr_t  H5FD__profile_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__profile_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__profile_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__profile_unlock(H5FD_t *_file);
+static herr_t  H5FD__profile_delete(const char *filename, hid_t fapl_id);
+static herr_t  H5FD__profile_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input,
+                                 void **output);
+
+static herr_t H5FD__profile_populate_config(hid_t under_fapl_id, const char *out_path,
+                                            unsigned sample_interval, H5FD_profile_fapl_t *fa_out);
+static void   H5FD__profile_count(H5FD_profile_t *file, int dir, H5FD_mem_t type, haddr_t addr, size_t size);
+static void   H5FD__profile_time(H5FD_profile_t *file, int dir, H5FD_mem_t type, uint64_t elapsed);
+static void   H5FD__profile_put_hist(FILE *stream, const char *key, const uint64_t *hist);
+static void   H5FD__profile_put_stats(FILE *stream, const char *key, const H5FD_profile_stats_t *stats);
+static herr_t H5FD__profile_dump(const H5FD_profile_t *file);
+
+static const H5FD_class_t H5FD_profile_g = {
+    H5FD_CLASS_VERSION,          /* struct version       */
+    H5FD_PROFILE_VALUE,          /* value                */
+    "profile",                   /* name                 */
+    MAXADDR,                     /* maxaddr              */
+    H5F_CLOSE_WEAK,              /* fc_degree            */
+    H5FD__profile_term,          /* terminate            */
+    H5FD__profile_sb_size,       /* sb_size              */
+    H5FD__profile_sb_encode,     /* sb_encode            */
+    H5FD__profile_sb_decode,     /* sb_decode            */
+    sizeof(H5FD_profile_fapl_t), /* fapl_size            */
+    H5FD__profile_fapl_get,      /* fapl_get             */
+    H5FD__profile_fapl_copy,     /* fapl_copy            */
+    H5FD__profile_fapl_free,     /* fapl_free            */
+    0,                           /* dxpl_size            */
+    NULL,                        /* dxpl_copy            */
+    NULL,                        /* dxpl_free            */
+    H5FD__profile_open,          /* open                 */
+    H5FD__profile_close,         /* close                */
+    H5FD__profile_cmp,           /* cmp                  */
+    H5FD__profile_query,         /* query                */
+    H5FD__profile_get_type_map,  /* get_type_map         */
+    H5FD__profile_alloc,         /* alloc                */
+    H5FD__profile_free,          /* free                 */
+    H5FD__profile_get_eoa,       /* get_eoa              */
+    H5FD__profile_set_eoa,       /* set_eoa              */
+    H5FD__profile_get_eof,       /* get_eof              */
+    H5FD__profile_get_handle,    /* get_handle           */
+    H5FD__profile_read,          /* read                 */
+    H5FD__profile_write,         /* write                */
+    NULL,                        /* read_vector          */
+    NULL,                        /* write_vector         */
+    NULL,                        /* read_selection       */
+    NULL,                        /* write_selection      */
+    H5FD__profile_flush,         /* flush                */
+    H5FD__profile_truncate,      /* truncate             */
+    H5FD__profile_lock,          /* lock                 */
+    H5FD__profile_unlock,        /* unlock               */
+    H5FD__profile_delete,        /* del                  */
+    H5FD__profile_ctl,           /* ctl                  */
+    H5FD_FLMAP_DICHOTOMY         /* fl_map               */
+};
+
+/* Names of the memory types in the profile, indexed by H5FD_mem_t */
+static const char *const H5FD_profile_type_names_g[H5FD_MEM_NTYPES] = {"default", "super", "btree", "draw",
+                                                                        "gheap",   "lheap", "ohdr"};
+
+/* Declare free lists to manage the driver structs */
+H5FL_DEFINE_STATIC(H5FD_profile_t);
+H5FL_DEFINE_STATIC(H5FD_profile_fapl_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_profile_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the profiling driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_profile_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_PROFILE_g)) {
+        H5FD_PROFILE_g = H5FD_register(&H5FD_profile_g, sizeof(H5FD_class_t), FALSE);
+        if (H5I_INVALID_HID == H5FD_PROFILE_g)
+            HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, H5I_INVALID_HID, "unable to register profile");
+    }
+
+    /* Set return value */
+    ret_value = H5FD_PROFILE_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_profile_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__profile_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_term(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Reset VFL ID */
+    H5FD_PROFILE_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__profile_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_profile
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_PROFILE driver defined in this source file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_profile(hid_t fapl_id, hid_t under_fapl_id, const char *out_path, unsigned sample_interval)
+{
+    H5P_genplist_t      *plist;     /* Property list pointer */
+    H5FD_profile_fapl_t *fa = NULL; /* Too large for the stack */
+    herr_t               ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ii*sIu", fapl_id, under_fapl_id, out_path, sample_interval);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if (NULL == (fa = H5FL_CALLOC(H5FD_profile_fapl_t)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate profile FAPL");
+    if (H5FD__profile_populate_config(under_fapl_id, out_path, sample_interval, fa) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+
+    ret_value = H5P_set_driver(plist, H5FD_PROFILE, fa, NULL);
+
+done:
+    /* The property list holds its own copy of the underlying FAPL */
+    if (fa) {
+        if (H5I_INVALID_HID != fa->under_fapl_id && H5I_dec_ref(fa->under_fapl_id) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+        fa = H5FL_FREE(H5FD_profile_fapl_t, fa);
+    }
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_profile() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_profile
+ *
+ * Purpose:     Returns information about the profiling file access
+ *              property list though the function arguments.  The
+ *              underlying FAPL is returned as a copy, which the caller
+ *              must close.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_profile(hid_t fapl_id, hid_t *under_fapl_id /*out*/, char *out_path /*out*/,
+                    size_t out_path_size, unsigned *sample_interval /*out*/)
+{
+    H5P_genplist_t            *plist; /* Property list pointer */
+    const H5FD_profile_fapl_t *fa;
+    H5FD_profile_fapl_t       *default_fa = NULL;
+    herr_t                     ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "ixxzx", fapl_id, under_fapl_id, out_path, out_path_size, sample_interval);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list");
+    if (H5FD_PROFILE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (fa = H5P_peek_driver_info(plist))) {
+        if (NULL == (default_fa = H5FL_CALLOC(H5FD_profile_fapl_t)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate profile FAPL");
+        if (H5FD__profile_populate_config(H5P_DEFAULT, NULL, 0, default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+        fa = default_fa;
+    }
+
+    if (under_fapl_id) {
+        H5P_genplist_t *under_plist;
+
+        if (NULL == (under_plist = (H5P_genplist_t *)H5I_object(fa->under_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if ((*under_fapl_id = H5P_copy_plist(under_plist, TRUE)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, FAIL, "can't copy underlying FAPL");
+    }
+    if (out_path && out_path_size > 0) {
+        HDstrncpy(out_path, fa->out_path, out_path_size);
+        out_path[out_path_size - 1] = '\0';
+    }
+    if (sample_interval)
+        *sample_interval = fa->sample_interval;
+
+done:
+    if (default_fa) {
+        if (H5I_INVALID_HID != default_fa->under_fapl_id && H5I_dec_ref(default_fa->under_fapl_id) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+        default_fa = H5FL_FREE(H5FD_profile_fapl_t, default_fa);
+    }
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_profile() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_populate_config
+ *
+ * Purpose:     Populates a H5FD_profile_fapl_t structure with the provided
+ *              values, supplying defaults where values are not provided.
+ *              The underlying FAPL stored in FA_OUT is a new copy, which
+ *              the caller must release.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_populate_config(hid_t under_fapl_id, const char *out_path, unsigned sample_interval,
+                              H5FD_profile_fapl_t *fa_out)
+{
+    H5P_genplist_t *plist;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    assert(fa_out);
+
+    memset(fa_out, 0, sizeof(H5FD_profile_fapl_t));
+    fa_out->under_fapl_id   = H5I_INVALID_HID;
+    fa_out->sample_interval = sample_interval ? sample_interval : 1;
+
+    if (out_path) {
+        if (HDstrlen(out_path) > H5FD_PROFILE_PATH_MAX)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "profile output path too long");
+        HDstrncpy(fa_out->out_path, out_path, H5FD_PROFILE_PATH_MAX);
+    }
+
+    if (H5P_DEFAULT == under_fapl_id) {
+        /* Use a copy of the default FAPL with the sec2 driver set
+         * explicitly, since the default driver might have been replaced
+         * with this one, which would cause recursion.
+         */
+        if (NULL == (plist = (H5P_genplist_t *)H5I_object(H5P_FILE_ACCESS_DEFAULT)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if ((fa_out->under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, FAIL, "can't copy property list");
+        if (NULL == (plist = (H5P_genplist_t *)H5I_object(fa_out->under_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if (H5P_set_driver_by_value(plist, H5_VFD_SEC2, NULL, TRUE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't set default driver on underlying FAPL");
+    }
+    else {
+        if (NULL == (plist = H5P_object_verify(under_fapl_id, H5P_FILE_ACCESS)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if ((fa_out->under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, FAIL, "can't copy property list");
+    }
+
+done:
+    if (ret_value < 0 && H5I_INVALID_HID != fa_out->under_fapl_id) {
+        if (H5I_dec_ref(fa_out->under_fapl_id) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+        fa_out->under_fapl_id = H5I_INVALID_HID;
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_populate_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_fapl_get
+ *
+ * Purpose:     Gets a file access property list which could be used to
+ *              create an identical file.
+ *
+ * Return:      Success:    Ptr to new file access property list value.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__profile_fapl_get(H5FD_t *_file)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    void           *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    ret_value = H5FD__profile_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_fapl_copy
+ *
+ * Purpose:     Copies the profiling-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__profile_fapl_copy(const void *_old_fa)
+{
+    const H5FD_profile_fapl_t *old_fa = (const H5FD_profile_fapl_t *)_old_fa;
+    H5FD_profile_fapl_t       *new_fa = NULL;
+    H5P_genplist_t            *plist;
+    void                      *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(old_fa);
+
+    if (NULL == (new_fa = H5FL_CALLOC(H5FD_profile_fapl_t)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to allocate profile FAPL");
+
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_profile_fapl_t));
+    new_fa->under_fapl_id = H5I_INVALID_HID;
+
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(old_fa->under_fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if ((new_fa->under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, NULL, "can't copy underlying FAPL");
+
+    ret_value = new_fa;
+
+done:
+    if (NULL == ret_value && new_fa)
+        new_fa = H5FL_FREE(H5FD_profile_fapl_t, new_fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_fapl_free
+ *
+ * Purpose:     Frees the profiling-specific file access properties.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_fapl_free(void *_fa)
+{
+    H5FD_profile_fapl_t *fa        = (H5FD_profile_fapl_t *)_fa;
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(fa);
+
+    if (H5I_dec_ref(fa->under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+
+    fa = H5FL_FREE(H5FD_profile_fapl_t, fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_fapl_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_sample
+ *
+ * Purpose:     Decides whether the next request is timed.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static inline hbool_t
+H5FD__profile_sample(H5FD_profile_t *file)
+{
+    if (--file->countdown > 0)
+        return FALSE;
+
+    file->countdown = file->fa.sample_interval;
+    return TRUE;
+} /* end H5FD__profile_sample() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_count
+ *
+ * Purpose:     Records the size and seek distance of one request.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__profile_count(H5FD_profile_t *file, int dir, H5FD_mem_t type, haddr_t addr, size_t size)
+{
+    H5FD_profile_stats_t *stats;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (type < H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        type = H5FD_MEM_DEFAULT;
+    stats = &file->stats[dir][type];
+
+    stats->nrequests++;
+    stats->nbytes += size;
+    stats->size[H5FD_PROFILE_BUCKET(size)]++;
+    if (addr >= file->last_end)
+        stats->seek_fwd[H5FD_PROFILE_BUCKET(addr - file->last_end)]++;
+    else
+        stats->seek_back[H5FD_PROFILE_BUCKET(file->last_end - addr)]++;
+    file->last_end = addr + size;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__profile_count() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_time
+ *
+ * Purpose:     Records the latency of one timed request.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__profile_time(H5FD_profile_t *file, int dir, H5FD_mem_t type, uint64_t elapsed)
+{
+    H5FD_profile_stats_t *stats;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (type < H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        type = H5FD_MEM_DEFAULT;
+    stats = &file->stats[dir][type];
+
+    stats->nsampled++;
+    stats->time_ns += elapsed;
+    stats->max_ns = MAX(stats->max_ns, elapsed);
+    stats->latency[H5FD_PROFILE_BUCKET(elapsed)]++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__profile_time() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_put_hist
+ *
+ * Purpose:     Writes a histogram as a JSON array, leaving out the
+ *              trailing empty buckets.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__profile_put_hist(FILE *stream, const char *key, const uint64_t *hist)
+{
+    int n, i;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    for (n = H5FD_PROFILE_NBUCKETS; n > 0 && 0 == hist[n - 1]; n--)
+        ;
+
+    fprintf(stream, ",\"%s\":[", key);
+    for (i = 0; i < n; i++)
+        fprintf(stream, "%s%" PRIu64, i ? "," : "", hist[i]);
+    fputc(']', stream);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__profile_put_hist() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_put_stats
+ *
+ * Purpose:     Writes the statistics of one direction as a JSON object
+ *              with a member for each memory type that was used.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__profile_put_stats(FILE *stream, const char *key, const H5FD_profile_stats_t *stats)
+{
+    hbool_t first = TRUE;
+    int     type;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    fprintf(stream, ",\"%s\":{", key);
+    for (type = 0; type < H5FD_MEM_NTYPES; type++) {
+        const H5FD_profile_stats_t *s = &stats[type];
+
+        if (0 == s->nrequests)
+            continue;
+
+        fprintf(stream,
+                "%s\"%s\":{\"requests\":%" PRIu64 ",\"bytes\":%" PRIu64 ",\"sampled\":%" PRIu64
+                ",\"time_ns\":%" PRIu64 ",\"max_ns\":%" PRIu64,
+                first ? "" : ",", H5FD_profile_type_names_g[type], s->nrequests, s->nbytes, s->nsampled,
+                s->time_ns, s->max_ns);
+        H5FD__profile_put_hist(stream, "size", s->size);
+        H5FD__profile_put_hist(stream, "seek_forward", s->seek_fwd);
+        H5FD__profile_put_hist(stream, "seek_backward", s->seek_back);
+        H5FD__profile_put_hist(stream, "latency_ns", s->latency);
+        fputc('}', stream);
+        first = FALSE;
+    }
+    fputc('}', stream);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__profile_put_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_dump
+ *
+ * Purpose:     Appends the profile of a file to the output file, or
+ *              writes it to stderr, as a single line of JSON.  Nothing is
+ *              written for a file without any I/O, since the library opens
+ *              files briefly to probe them.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_dump(const H5FD_profile_t *file)
+{
+    FILE       *stream = stderr;
+    const char *p;
+    uint64_t    nrequests = file->nflushes + file->ntruncates;
+    int         dir, type;
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    for (dir = 0; dir < 2; dir++)
+        for (type = 0; type < H5FD_MEM_NTYPES; type++)
+            nrequests += file->stats[dir][type].nrequests;
+    if (0 == nrequests)
+        HGOTO_DONE(SUCCEED);
+
+    if (*file->fa.out_path && NULL == (stream = fopen(file->fa.out_path, "a")))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, FAIL, "unable to open profile output file '%s'",
+                    file->fa.out_path);
+
+    /* The file name is the only string that needs escaping */
+    fputs("{\"file\":\"", stream);
+    for (p = file->name; *p; p++) {
+        if ('"' == *p || '\\' == *p)
+            fprintf(stream, "\\%c", *p);
+        else if ((unsigned char)*p < 0x20)
+            fprintf(stream, "\\u%04x", (unsigned)(unsigned char)*p);
+        else
+            fputc(*p, stream);
+    }
+    fprintf(stream,
+            "\",\"driver\":\"%s\",\"sample_interval\":%u,\"elapsed_ns\":%" PRIu64
+            ",\"flush\":{\"count\":%" PRIu64 ",\"time_ns\":%" PRIu64 "},\"truncate\":{\"count\":%" PRIu64
+            ",\"time_ns\":%" PRIu64 "}",
+            file->under->cls->name, file->fa.sample_interval, H5_now_nsec() - file->open_ns, file->nflushes,
+            file->flush_ns, file->ntruncates, file->truncate_ns);
+    H5FD__profile_put_stats(stream, "read", file->stats[H5FD_PROFILE_READ]);
+    H5FD__profile_put_stats(stream, "write", file->stats[H5FD_PROFILE_WRITE]);
+    fputs("}\n", stream);
+
+    if (stderr == stream)
+        fflush(stream);
+    else if (0 != fclose(stream))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close profile output file '%s'",
+                    file->fa.out_path);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_dump() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__profile_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_profile_t            *file       = NULL; /* profile VFD info */
+    const H5FD_profile_fapl_t *fa         = NULL; /* profile info from property list */
+    H5FD_profile_fapl_t       *default_fa = NULL;
+    H5P_genplist_t            *plist; /* Property list pointer */
+    H5FD_t                    *ret_value = NULL;
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name");
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr");
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_profile_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (NULL == (default_fa = H5FL_CALLOC(H5FD_profile_fapl_t)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to allocate profile FAPL");
+        if (H5FD__profile_populate_config(H5P_DEFAULT, NULL, 0, default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, NULL, "can't initialize driver configuration info");
+        fa = default_fa;
+    }
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_profile_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct");
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_profile_fapl_t));
+    file->fa.under_fapl_id = H5I_INVALID_HID;
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fa->under_fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if ((file->fa.under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, NULL, "can't copy underlying FAPL");
+
+    if (NULL == (file->name = H5MM_strdup(name)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't copy file name");
+    file->countdown = 1;
+
+    if (NULL == (file->under = H5FD_open(name, flags, file->fa.under_fapl_id, HADDR_UNDEF)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, NULL, "unable to open underlying file");
+
+    file->open_ns = H5_now_nsec();
+
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (default_fa) {
+        if (H5I_INVALID_HID != default_fa->under_fapl_id && H5I_dec_ref(default_fa->under_fapl_id) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTDEC, NULL, "can't close underlying FAPL");
+        default_fa = H5FL_FREE(H5FD_profile_fapl_t, default_fa);
+    }
+
+    if (NULL == ret_value && file) {
+        if (H5I_INVALID_HID != file->fa.under_fapl_id)
+            H5I_dec_ref(file->fa.under_fapl_id);
+        H5MM_xfree(file->name);
+        file = H5FL_FREE(H5FD_profile_t, file);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_close
+ *
+ * Purpose:     Closes the underlying file and writes out the profile.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_close(H5FD_t *_file)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Release everything, even if the profile can't be written */
+    if (H5FD__profile_dump(file) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write profile");
+
+    if (H5FD_close(file->under) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close underlying file");
+    if (H5I_dec_ref(file->fa.under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+
+    H5MM_xfree(file->name);
+    file = H5FL_FREE(H5FD_profile_t, file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver by comparing
+ *              their underlying files.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__profile_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_profile_t *f1        = (const H5FD_profile_t *)_f1;
+    const H5FD_profile_t *f2        = (const H5FD_profile_t *)_f2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    ret_value = H5FD_cmp(f1->under, f2->under);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              The features are those of the underlying driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_profile_t *file      = (const H5FD_profile_t *)_file;
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (flags) {
+        *flags = 0;
+        if (file && H5FD_driver_query(file->under->cls, flags) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to query underlying driver");
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_sb_size
+ *
+ * Purpose:     Obtains the number of bytes required to store the driver
+ *              file access data in the HDF5 superblock, which is that of
+ *              the underlying driver.
+ *
+ * Return:      Success:    Number of bytes required.
+ *              Failure:    0 if an error occurs or if the driver has no
+ *                          data to store in the superblock.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5FD__profile_sb_size(H5FD_t *_file)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    hsize_t         ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(file);
+
+    ret_value = H5FD_sb_size(file->under);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_sb_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_sb_encode
+ *
+ * Purpose:     Encodes the superblock data of the underlying driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_sb_encode(H5FD_t *_file, char *name /*out*/, unsigned char *buf /*out*/)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (H5FD_sb_encode(file->under, name, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTENCODE, FAIL, "unable to encode the superblock of underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_sb_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_sb_decode
+ *
+ * Purpose:     Decodes the superblock data of the underlying driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (H5FD_sb_load(file->under, name, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTDECODE, FAIL, "unable to decode the superblock of underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_sb_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_get_type_map
+ *
+ * Purpose:     Retrieves the memory type mapping of the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_get_type_map(const H5FD_t *_file, H5FD_mem_t *type_map)
+{
+    const H5FD_profile_t *file      = (const H5FD_profile_t *)_file;
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (H5FD_get_fs_type_map(file->under, type_map) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get type map of underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_get_type_map() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_alloc
+ *
+ * Purpose:     Allocates file memory in the underlying file.
+ *
+ * Return:      Success:    Address of new memory
+ *              Failure:    HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__profile_alloc(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, hsize_t size)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    haddr_t         ret_value = HADDR_UNDEF; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (HADDR_UNDEF == (ret_value = H5FDalloc(file->under, type, dxpl_id, size)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, HADDR_UNDEF, "unable to allocate in underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_free
+ *
+ * Purpose:     Releases file memory in the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_free(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, hsize_t size)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (H5FDfree(file->under, type, dxpl_id, addr, size) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to free in underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker of the underlying file.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__profile_get_eoa(const H5FD_t *_file, H5FD_mem_t type)
+{
+    const H5FD_profile_t *file      = (const H5FD_profile_t *)_file;
+    haddr_t               ret_value = HADDR_UNDEF; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (HADDR_UNDEF == (ret_value = H5FD_get_eoa(file->under, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, HADDR_UNDEF, "unable to get underlying eoa");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_set_eoa
+ *
+ * Purpose:     Sets the end-of-address marker of the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5FD_set_eoa(file->under, type, addr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "unable to set underlying eoa");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker of the underlying file.
+ *
+ * Return:      Success:    The end-of-file marker.
+ *              Failure:    HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__profile_get_eof(const H5FD_t *_file, H5FD_mem_t type)
+{
+    const H5FD_profile_t *file      = (const H5FD_profile_t *)_file;
+    haddr_t               ret_value = HADDR_UNDEF; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (HADDR_UNDEF == (ret_value = H5FD_get_eof(file->under, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, HADDR_UNDEF, "unable to get underlying eof");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_get_handle
+ *
+ * Purpose:     Returns the file handle of the underlying driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid");
+
+    if (H5FD_get_vfd_handle(file->under, file->fa.under_fapl_id, file_handle) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get handle of underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_read
+ *
+ * Purpose:     Reads SIZE bytes of data from the underlying file beginning
+ *              at address ADDR into buffer BUF, and records the request.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr, size_t size,
+                   void *buf /*out*/)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    hbool_t         timed;
+    uint64_t        start     = 0;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    timed = H5FD__profile_sample(file);
+    H5FD__profile_count(file, H5FD_PROFILE_READ, type, addr, size);
+
+    if (timed)
+        start = H5_now_nsec();
+    if (H5FD_read(file->under, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to read from underlying file");
+    if (timed)
+        H5FD__profile_time(file, H5FD_PROFILE_READ, type, H5_now_nsec() - start);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_write
+ *
+ * Purpose:     Writes SIZE bytes of data from buffer BUF to the underlying
+ *              file beginning at address ADDR, and records the request.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr, size_t size,
+                    const void *buf)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    hbool_t         timed;
+    uint64_t        start     = 0;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    timed = H5FD__profile_sample(file);
+    H5FD__profile_count(file, H5FD_PROFILE_WRITE, type, addr, size);
+
+    if (timed)
+        start = H5_now_nsec();
+    if (H5FD_write(file->under, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to underlying file");
+    if (timed)
+        H5FD__profile_time(file, H5FD_PROFILE_WRITE, type, H5_now_nsec() - start);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_flush
+ *
+ * Purpose:     Flushes the underlying file and records the time taken.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    uint64_t        start;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    start = H5_now_nsec();
+    if (H5FD_flush(file->under, closing) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFLUSH, FAIL, "unable to flush underlying file");
+
+    file->nflushes++;
+    file->flush_ns += H5_now_nsec() - start;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_truncate
+ *
+ * Purpose:     Truncates the underlying file and records the time taken.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    uint64_t        start;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    start = H5_now_nsec();
+    if (H5FD_truncate(file->under, closing) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTUPDATE, FAIL, "unable to truncate underlying file");
+
+    file->ntruncates++;
+    file->truncate_ns += H5_now_nsec() - start;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_lock
+ *
+ * Purpose:     Places a lock on the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5FD_lock(file->under, rw) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_unlock
+ *
+ * Purpose:     Removes the lock on the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_unlock(H5FD_t *_file)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5FD_unlock(file->under) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_ctl
+ *
+ * Purpose:     Passes requests for the terminal driver down to the
+ *              underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input, void **output)
+{
+    H5FD_profile_t *file      = (H5FD_profile_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (flags & H5FD_CTL_ROUTE_TO_TERMINAL_VFD_FLAG) {
+        if (H5FD_ctl(file->under, op_code, flags, input, output) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_FCNTL, FAIL, "VFD ctl request failed");
+    }
+    else if (flags & H5FD_CTL_FAIL_IF_UNKNOWN_FLAG)
+        HGOTO_ERROR(H5E_VFL, H5E_FCNTL, FAIL,
+                    "VFD ctl request failed (unknown op code and fail if unknown flag is set)");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_ctl() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__profile_delete
+ *
+ * Purpose:     Deletes a file through the underlying driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__profile_delete(const char *filename, hid_t fapl_id)
+{
+    const H5FD_profile_fapl_t *fa         = NULL;
+    H5FD_profile_fapl_t       *default_fa = NULL;
+    H5P_genplist_t            *plist;
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(filename);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_profile_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (NULL == (default_fa = H5FL_CALLOC(H5FD_profile_fapl_t)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate profile FAPL");
+        if (H5FD__profile_populate_config(H5P_DEFAULT, NULL, 0, default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+        fa = default_fa;
+    }
+
+    if (H5FD_delete(filename, fa->under_fapl_id) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTDELETEFILE, FAIL, "unable to delete file");
+
+done:
+    if (default_fa) {
+        if (H5I_INVALID_HID != default_fa->under_fapl_id && H5I_dec_ref(default_fa->under_fapl_id) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+        default_fa = H5FL_FREE(H5FD_profile_fapl_t, default_fa);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__profile_delete() */
@@ -0,0 +1,108 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the profiling driver.
+ */
+#ifndef H5FDprofile_H
+#define H5FDprofile_H
+
+#define H5FD_PROFILE       (H5FDperform_init(H5FD_profile_init))
+#define H5FD_PROFILE_VALUE H5_VFD_PROFILE
+
+/* Maximum length of the profile output path, not counting the terminator */
+#define H5FD_PROFILE_PATH_MAX 4096
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t H5FD_profile_init(void);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets up use of the profiling driver
+ *
+ * \fapl_id
+ * \param[in] under_fapl_id File access property list for the driver that
+ *                          performs the I/O
+ * \param[in] out_path Name of the file the profile is appended to
+ * \param[in] sample_interval Time one request out of this many
+ * \returns \herr_t
+ *
+ * \details H5Pset_fapl_profile() sets the file access property list, \p
+ *          fapl_id, to use the profiling driver, #H5FD_PROFILE. The driver
+ *          is stacked on top of the driver set in \p under_fapl_id, which
+ *          may be any driver, and passes every operation through to it.
+ *          Passing #H5P_DEFAULT for \p under_fapl_id selects the sec2
+ *          driver. Vector and selection I/O requests reach the underlying
+ *          driver as individual reads and writes.
+ *
+ *          For reads and writes, the driver keeps statistics for each
+ *          memory type (#H5FD_mem_t) of the request: the number of requests
+ *          and bytes, and power-of-two histograms of the request sizes, of
+ *          the distance from the end of the previous request (forward and
+ *          backward separately), and of the request latencies. The latency
+ *          of only one request in \p sample_interval is measured, which
+ *          keeps the cost of reading the clock out of most requests; 0
+ *          (zero) or 1 measures every request. The number and total time of
+ *          flushes and truncations are recorded as well. The memory used
+ *          doesn't depend on the size of the file.
+ *
+ *          When the file is closed, the profile is appended to \p out_path
+ *          as one line of JSON, unless no I/O was done at all. When \p
+ *          out_path is NULL or empty, the profile is written to \c stderr.
+ *          Each histogram in it is an array whose element \c 0 counts zero
+ *          values and whose element \c i counts values in the range
+ *          <tt>[2^(i-1), 2^i)</tt>, with trailing zero elements omitted.
+ *          Sizes and distances are in bytes and latencies in nanoseconds.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pset_fapl_profile(hid_t fapl_id, hid_t under_fapl_id, const char *out_path,
+                                  unsigned sample_interval);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves profiling driver settings
+ *
+ * \fapl_id
+ * \param[out] under_fapl_id File access property list for the driver that
+ *                           performs the I/O
+ * \param[out] out_path Buffer for the name of the profile output file
+ * \param[in] out_path_size Size of \p out_path, in bytes
+ * \param[out] sample_interval Time one request out of this many
+ * \returns \herr_t
+ *
+ * \details H5Pget_fapl_profile() retrieves the settings of the profiling
+ *          driver, #H5FD_PROFILE, from the file access property list \p
+ *          fapl_id. The property list returned in \p under_fapl_id is a
+ *          copy and must be closed with H5Pclose(). At most \p
+ *          out_path_size bytes, including the terminator, are copied to \p
+ *          out_path; an empty string means \c stderr.
+ *
+ *          See H5Pset_fapl_profile() for a discussion of these values.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pget_fapl_profile(hid_t fapl_id, hid_t *under_fapl_id /*out*/, char *out_path /*out*/,
+                                  size_t out_path_size, unsigned *sample_interval /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
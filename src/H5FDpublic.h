@@ -26,22 +26,27 @@
 /* VFD identifier values
  * These are H5FD_class_value_t values, NOT hid_t values!
  */
-#define H5_VFD_INVALID   ((H5FD_class_value_t)(-1))
-#define H5_VFD_SEC2      ((H5FD_class_value_t)(0))
-#define H5_VFD_CORE      ((H5FD_class_value_t)(1))
-#define H5_VFD_LOG       ((H5FD_class_value_t)(2))
-#define H5_VFD_FAMILY    ((H5FD_class_value_t)(3))
-#define H5_VFD_MULTI     ((H5FD_class_value_t)(4))
-#define H5_VFD_STDIO     ((H5FD_class_value_t)(5))
-#define H5_VFD_SPLITTER  ((H5FD_class_value_t)(6))
-#define H5_VFD_MPIO      ((H5FD_class_value_t)(7))
-#define H5_VFD_DIRECT    ((H5FD_class_value_t)(8))
-#define H5_VFD_MIRROR    ((H5FD_class_value_t)(9))
-#define H5_VFD_HDFS      ((H5FD_class_value_t)(10))
-#define H5_VFD_ROS3      ((H5FD_class_value_t)(11))
-#define H5_VFD_SUBFILING ((H5FD_class_value_t)(12))
-#define H5_VFD_IOC       ((H5FD_class_value_t)(13))
-#define H5_VFD_ONION     ((H5FD_class_value_t)(14))
+#define H5_VFD_INVALID     ((H5FD_class_value_t)(-1))
+#define H5_VFD_SEC2        ((H5FD_class_value_t)(0))
+#define H5_VFD_CORE        ((H5FD_class_value_t)(1))
+#define H5_VFD_LOG         ((H5FD_class_value_t)(2))
+#define H5_VFD_FAMILY      ((H5FD_class_value_t)(3))
+#define H5_VFD_MULTI       ((H5FD_class_value_t)(4))
+#define H5_VFD_STDIO       ((H5FD_class_value_t)(5))
+#define H5_VFD_SPLITTER    ((H5FD_class_value_t)(6))
+#define H5_VFD_MPIO        ((H5FD_class_value_t)(7))
+#define H5_VFD_DIRECT      ((H5FD_class_value_t)(8))
+#define H5_VFD_MIRROR      ((H5FD_class_value_t)(9))
+#define H5_VFD_HDFS        ((H5FD_class_value_t)(10))
+#define H5_VFD_ROS3        ((H5FD_class_value_t)(11))
+#define H5_VFD_SUBFILING   ((H5FD_class_value_t)(12))
+#define H5_VFD_IOC         ((H5FD_class_value_t)(13))
+#define H5_VFD_ONION       ((H5FD_class_value_t)(14))
+#define H5_VFD_IOURING     ((H5FD_class_value_t)(15))
+#define H5_VFD_MMAP        ((H5FD_class_value_t)(16))
+#define H5_VFD_STRIPE      ((H5FD_class_value_t)(17))
+#define H5_VFD_WRITEBEHIND ((H5FD_class_value_t)(18))
+#define H5_VFD_PROFILE     ((H5FD_class_value_t)(19))
 
 /* VFD IDs below this value are reserved for library use. */
 #define H5_VFD_RESERVED 256
@@ -185,6 +190,7 @@
 #define H5FD_CTL_MEM_FREE                    6
 #define H5FD_CTL_MEM_COPY                    7
 #define H5FD_CTL_GET_MPI_FILE_SYNC_OPCODE    8
+#define H5FD_CTL_BORROW_BUFFER_OPCODE        9
 
 /* ctl function flags: */
 
@@ -386,6 +392,20 @@ typedef struct H5FD_ctl_memcpy_args_t {
 } H5FD_ctl_memcpy_args_t;
 //! <!-- [H5FD_ctl_memcpy_args_t_snip] -->
 
+/**
+ * Define structure to hold "ctl borrow buffer" parameters.  A driver that
+ * keeps the requested range of the file in memory, and guarantees that it
+ * stays valid and unchanged until the file is closed, returns a pointer to
+ * it; otherwise it returns NULL.
+ */
+//! <!-- [H5FD_ctl_borrow_buffer_args_t_snip] -->
+typedef struct H5FD_ctl_borrow_buffer_args_t {
+    H5FD_mem_t type; /**< Type of data in the range */
+    haddr_t    addr; /**< Absolute file address of the range */
+    size_t     size; /**< Size of the range */
+} H5FD_ctl_borrow_buffer_args_t;
+//! <!-- [H5FD_ctl_borrow_buffer_args_t_snip] -->
+
 /********************/
 /* Public Variables */
 /********************/
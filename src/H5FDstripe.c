@@ -0,0 +1,1668 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The striping file driver.  The HDF5 address space is cut into
+ *          fixed-size stripes which are placed round-robin on a number of
+ *          local member files, so stripe K lives in member K % NMEMBERS.
+ *          Unlike the family driver, which fills one member before moving
+ *          to the next, any large transfer touches every member.
+ *
+ *          Each read or write, and each vector request, is split into one
+ *          batch of pread()/pwrite() calls per member.  The batches are
+ *          handed to a small pool of threads owned by the open file, and
+ *          the calling thread works through batches as well until all of
+ *          them are done, so a single process can drive several devices
+ *          at once.  Selection I/O reaches the driver through the
+ *          library's translation to one vector call.
+ *
+ *          The pool threads only ever call pread() and pwrite() on the
+ *          caller's buffers; they never enter the library.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDstripe.h"  /* Striping file driver     */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_STRIPE_VFD
+
+#include <pthread.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_STRIPE_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Size of the buffer for a member file name */
+#define H5FD_STRIPE_MEMB_NAME_BUF_SIZE 4096
+
+/* Number of pieces and member batches tracked on the stack before allocating */
+#define H5FD_STRIPE_LOCAL_PIECES 8
+#define H5FD_STRIPE_LOCAL_TASKS  8
+
+/* Size of the driver information stored in the superblock */
+#define H5FD_STRIPE_SB_SIZE 12
+
+/* Driver-specific file access properties */
+typedef struct H5FD_stripe_fapl_t {
+    unsigned nmembers;    /* Number of member files            */
+    hsize_t  stripe_size; /* Size of each stripe               */
+    unsigned nthreads;    /* I/O threads, including the caller */
+} H5FD_stripe_fapl_t;
+
+/* One member file */
+typedef struct H5FD_stripe_memb_t {
+    int   fd;     /* the filesystem file descriptor   */
+    dev_t device; /* file device number               */
+    ino_t inode;  /* file i-node number               */
+} H5FD_stripe_memb_t;
+
+/* One contiguous transfer within a member file */
+typedef struct H5FD_stripe_piece_t {
+    HDoff_t        offset; /* Offset in the member file           */
+    size_t         size;   /* Number of bytes to transfer         */
+    unsigned char *buf;    /* Caller's buffer for the piece       */
+} H5FD_stripe_piece_t;
+
+/* The batch of pieces a request places on one member */
+typedef struct H5FD_stripe_task_t {
+    unsigned             memb;     /* Index of the member                 */
+    int                  fd;       /* Member file descriptor              */
+    hbool_t              do_write; /* Whether the pieces are written      */
+    H5FD_stripe_piece_t *pieces;   /* Pieces, in request order            */
+    size_t               npieces;  /* Number of pieces                    */
+    int                  io_errno; /* errno of a failed transfer, or 0    */
+} H5FD_stripe_task_t;
+
+/*
+ * The thread pool of an open file.  A request publishes its batches in
+ * 'tasks' and wakes the workers; every thread, including the one that made
+ * the request, claims batches by advancing 'next' until none are left, and
+ * the requester then waits for 'ndone' to reach 'ntasks'.  All fields past
+ * 'threads' are protected by 'mutex'.
+ */
+typedef struct H5FD_stripe_pool_t {
+    pthread_t          *threads;  /* Worker threads                      */
+    unsigned            nthreads; /* Number of worker threads started    */
+    hbool_t             init;     /* Whether the pool objects exist      */
+    pthread_mutex_t     mutex;    /* Protects the fields below           */
+    pthread_cond_t      work_cv;  /* Signaled when batches are published */
+    pthread_cond_t      done_cv;  /* Signaled when the last batch is done */
+    H5FD_stripe_task_t *tasks;    /* Batches of the current request      */
+    size_t              ntasks;   /* Number of batches                   */
+    size_t              next;     /* Next batch to claim                 */
+    size_t              ndone;    /* Number of batches completed         */
+    hbool_t             shutdown; /* Whether the workers should exit     */
+} H5FD_stripe_pool_t;
+
+/*
+ * The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the logical file, i.e. the end of the last byte stored in any member.
+ */
+typedef struct H5FD_stripe_t {
+    H5FD_t              pub;  /* public stuff, must be first      */
+    haddr_t             eoa;  /* end of allocated region          */
+    haddr_t             eof;  /* end of file; current file size   */
+    H5FD_stripe_fapl_t  fa;   /* file access properties           */
+    H5FD_stripe_memb_t *memb; /* member files                     */
+    H5FD_stripe_pool_t  pool; /* I/O threads                      */
+    hbool_t             ignore_disabled_file_locks;
+    char                filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+} H5FD_stripe_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__stripe_term(void);
+static herr_t  H5FD__stripe_populate_config(unsigned nmembers, hsize_t stripe_size, unsigned nthreads,
+                                            H5FD_stripe_fapl_t *fa_out);
+static hsize_t H5FD__stripe_sb_size(H5FD_t *_file);
+static herr_t  H5FD__stripe_sb_encode(H5FD_t *_file, char *name /*out*/, unsigned char *buf /*out*/);
+static herr_t  H5FD__stripe_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf);
+static void   *H5FD__stripe_fapl_get(H5FD_t *file);
+static void   *H5FD__stripe_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__stripe_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__stripe_close(H5FD_t *_file);
+static int     H5FD__stripe_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__stripe_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__stripe_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__stripe_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__stripe_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__stripe_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__stripe_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                 void *buf);
+static herr_t  H5FD__stripe_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                  const void *buf);
+static herr_t  H5FD__stripe_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                        haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__stripe_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                         haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__stripe_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__stripe_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__stripe_unlock(H5FD_t *_file);
+static herr_t  H5FD__stripe_delete(const char *filename, hid_t fapl_id);
+
+static herr_t H5FD__stripe_memb_name(const char *name, unsigned memb, char *buf, size_t buf_size);
+static herr_t H5FD__stripe_pool_init(H5FD_stripe_pool_t *pool, unsigned nthreads);
+static void   H5FD__stripe_pool_term(H5FD_stripe_pool_t *pool);
+static void   H5FD__stripe_pool_run(H5FD_stripe_pool_t *pool, H5FD_stripe_task_t *tasks, size_t ntasks);
+static void  *H5FD__stripe_worker(void *_pool);
+static void   H5FD__stripe_run_task(H5FD_stripe_task_t *task);
+static herr_t H5FD__stripe_transfer(H5FD_stripe_t *file, hbool_t do_write, uint32_t count, haddr_t addrs[],
+                                    size_t sizes[], H5_flexible_const_ptr_t bufs[]);
+
+static const H5FD_class_t H5FD_stripe_g = {
+    H5FD_CLASS_VERSION,         /* struct version       */
+    H5FD_STRIPE_VALUE,          /* value                */
+    "stripe",                   /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD__stripe_term,          /* terminate            */
+    H5FD__stripe_sb_size,       /* sb_size              */
+    H5FD__stripe_sb_encode,     /* sb_encode            */
+    H5FD__stripe_sb_decode,     /* sb_decode            */
+    sizeof(H5FD_stripe_fapl_t), /* fapl_size            */
+    H5FD__stripe_fapl_get,      /* fapl_get             */
+    H5FD__stripe_fapl_copy,     /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD__stripe_open,          /* open                 */
+    H5FD__stripe_close,         /* close                */
+    H5FD__stripe_cmp,           /* cmp                  */
+    H5FD__stripe_query,         /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD__stripe_get_eoa,       /* get_eoa              */
+    H5FD__stripe_set_eoa,       /* set_eoa              */
+    H5FD__stripe_get_eof,       /* get_eof              */
+    H5FD__stripe_get_handle,    /* get_handle           */
+    H5FD__stripe_read,          /* read                 */
+    H5FD__stripe_write,         /* write                */
+    H5FD__stripe_read_vector,   /* read_vector          */
+    H5FD__stripe_write_vector,  /* write_vector         */
+    NULL,                       /* read_selection       */
+    NULL,                       /* write_selection      */
+    NULL,                       /* flush                */
+    H5FD__stripe_truncate,      /* truncate             */
+    H5FD__stripe_lock,          /* lock                 */
+    H5FD__stripe_unlock,        /* unlock               */
+    H5FD__stripe_delete,        /* del                  */
+    NULL,                       /* ctl                  */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_stripe_t struct */
+H5FL_DEFINE_STATIC(H5FD_stripe_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_stripe_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the striping driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_stripe_init(void)
+{
+    char *lock_env_var = NULL;            /* Environment variable pointer */
+    hid_t ret_value    = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv(HDF5_USE_FILE_LOCKING);
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5I_VFL != H5I_get_type(H5FD_STRIPE_g)) {
+        H5FD_STRIPE_g = H5FD_register(&H5FD_stripe_g, sizeof(H5FD_class_t), FALSE);
+        if (H5I_INVALID_HID == H5FD_STRIPE_g)
+            HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, H5I_INVALID_HID, "unable to register stripe");
+    }
+
+    /* Set return value */
+    ret_value = H5FD_STRIPE_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__stripe_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_term(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Reset VFL ID */
+    H5FD_STRIPE_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__stripe_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_stripe
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_STRIPE driver defined in this source file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_stripe(hid_t fapl_id, unsigned nmembers, hsize_t stripe_size, unsigned nthreads)
+{
+    H5P_genplist_t    *plist; /* Property list pointer */
+    H5FD_stripe_fapl_t fa;
+    herr_t             ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIuhIu", fapl_id, nmembers, stripe_size, nthreads);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if (H5FD__stripe_populate_config(nmembers, stripe_size, nthreads, &fa) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+
+    ret_value = H5P_set_driver(plist, H5FD_STRIPE, &fa, NULL);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_stripe() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_stripe
+ *
+ * Purpose:     Returns information about the striping file access
+ *              property list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_stripe(hid_t fapl_id, unsigned *nmembers /*out*/, hsize_t *stripe_size /*out*/,
+                   unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t           *plist; /* Property list pointer */
+    const H5FD_stripe_fapl_t *fa;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, nmembers, stripe_size, nthreads);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list");
+    if (H5FD_STRIPE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (fa = H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info");
+    if (nmembers)
+        *nmembers = fa->nmembers;
+    if (stripe_size)
+        *stripe_size = fa->stripe_size;
+    if (nthreads)
+        *nthreads = fa->nthreads;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_stripe() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_populate_config
+ *
+ * Purpose:     Populates a H5FD_stripe_fapl_t structure with the provided
+ *              values, supplying defaults where values are not provided.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_populate_config(unsigned nmembers, hsize_t stripe_size, unsigned nthreads,
+                             H5FD_stripe_fapl_t *fa_out)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    assert(fa_out);
+
+    memset(fa_out, 0, sizeof(H5FD_stripe_fapl_t));
+
+    if (nmembers > H5FD_STRIPE_NMEMBERS_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "member count may not exceed %u",
+                    (unsigned)H5FD_STRIPE_NMEMBERS_MAX);
+    if (nthreads > H5FD_STRIPE_NTHREADS_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "thread count may not exceed %u",
+                    (unsigned)H5FD_STRIPE_NTHREADS_MAX);
+    if (SIZE_OVERFLOW(stripe_size) || stripe_size > (hsize_t)H5_POSIX_MAX_IO_BYTES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe size too large");
+
+    fa_out->nmembers    = nmembers ? nmembers : H5FD_STRIPE_NMEMBERS_DEF;
+    fa_out->stripe_size = stripe_size ? stripe_size : H5FD_STRIPE_STRIPE_SIZE_DEF;
+    fa_out->nthreads    = nthreads;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_populate_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_sb_size
+ *
+ * Purpose:     Returns the size of the private information to be stored in
+ *              the superblock.
+ *
+ * Return:      Success:    The superblock driver data size.
+ *              Failure:    never fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5FD__stripe_sb_size(H5FD_t H5_ATTR_UNUSED *_file)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Member count and stripe size */
+    FUNC_LEAVE_NOAPI(H5FD_STRIPE_SB_SIZE)
+} /* end H5FD__stripe_sb_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_sb_encode
+ *
+ * Purpose:     Encode driver information for the superblock. The NAME
+ *              argument is a nine-byte buffer which will be initialized with
+ *              an eight-character name/version number and null termination.
+ *
+ *              The encoding is the member count and the stripe size.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_sb_encode(H5FD_t *_file, char *name /*out*/, unsigned char *buf /*out*/)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Name and version number */
+    HDstrncpy(name, "NCSAstrp", (size_t)9);
+    name[8] = '\0';
+
+    UINT32ENCODE(buf, file->fa.nmembers);
+    UINT64ENCODE(buf, (uint64_t)file->fa.stripe_size);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__stripe_sb_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_sb_decode
+ *
+ * Purpose:     Decodes the superblock information for this driver and
+ *              checks that the file was opened with the layout it was
+ *              written with.  The superblock itself lies in the first
+ *              stripe, so it can be read before the check is made.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_sb_decode(H5FD_t *_file, const char H5_ATTR_UNUSED *name, const unsigned char *buf)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+    unsigned       nmembers;
+    uint64_t       stripe_size;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    UINT32DECODE(buf, nmembers);
+    UINT64DECODE(buf, stripe_size);
+
+    if (nmembers != file->fa.nmembers || stripe_size != (uint64_t)file->fa.stripe_size)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL,
+                    "file is striped across %u members of %llu bytes, but the file access property list "
+                    "specifies %u members of %llu bytes",
+                    nmembers, (unsigned long long)stripe_size, file->fa.nmembers,
+                    (unsigned long long)file->fa.stripe_size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_sb_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__stripe_fapl_get(H5FD_t *_file)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    void          *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__stripe_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_fapl_copy
+ *
+ * Purpose:     Copies the striping-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__stripe_fapl_copy(const void *_old_fa)
+{
+    const H5FD_stripe_fapl_t *old_fa    = (const H5FD_stripe_fapl_t *)_old_fa;
+    H5FD_stripe_fapl_t       *new_fa    = NULL;
+    void                     *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (NULL == (new_fa = (H5FD_stripe_fapl_t *)H5MM_malloc(sizeof(H5FD_stripe_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed");
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_stripe_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_memb_name
+ *
+ * Purpose:     Builds the name of member MEMB of the file NAME.  A NAME
+ *              that expands to different strings for different members is
+ *              used as a printf-style template, as with the family driver.
+ *              Otherwise the member index is appended as a suffix.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+/* Disable warning for "format not a string literal" here */
+H5_GCC_CLANG_DIAG_OFF("format-nonliteral")
+static herr_t
+H5FD__stripe_memb_name(const char *name, unsigned memb, char *buf, size_t buf_size)
+{
+    char  *temp = NULL;
+    int    len;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(name);
+    assert(buf);
+
+    if (NULL == (temp = (char *)H5MM_malloc(buf_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate temporary member name");
+
+    /* Check whether the name is a template */
+    HDsnprintf(buf, buf_size, name, 0);
+    HDsnprintf(temp, buf_size, name, 1);
+
+    if (HDstrcmp(buf, temp))
+        len = HDsnprintf(buf, buf_size, name, memb);
+    else
+        len = HDsnprintf(buf, buf_size, "%s.%u", name, memb);
+    if (len < 0 || (size_t)len >= buf_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "member file name too long");
+
+done:
+    H5MM_xfree(temp);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_memb_name() */
+H5_GCC_CLANG_DIAG_ON("format-nonliteral")
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_pool_init
+ *
+ * Purpose:     Starts NTHREADS worker threads.  A pool without workers is
+ *              valid: every batch is then performed by the requester.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_pool_init(H5FD_stripe_pool_t *pool, unsigned nthreads)
+{
+    int    err;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(pool);
+
+    memset(pool, 0, sizeof(H5FD_stripe_pool_t));
+
+    if (0 == nthreads)
+        HGOTO_DONE(SUCCEED);
+
+    if (0 != (err = pthread_mutex_init(&pool->mutex, NULL)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize pool mutex, error = %d", err);
+    if (0 != (err = pthread_cond_init(&pool->work_cv, NULL))) {
+        pthread_mutex_destroy(&pool->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize pool condition, error = %d", err);
+    }
+    if (0 != (err = pthread_cond_init(&pool->done_cv, NULL))) {
+        pthread_cond_destroy(&pool->work_cv);
+        pthread_mutex_destroy(&pool->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize pool condition, error = %d", err);
+    }
+    pool->init = TRUE;
+
+    if (NULL == (pool->threads = (pthread_t *)H5MM_malloc(nthreads * sizeof(pthread_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread array");
+
+    for (pool->nthreads = 0; pool->nthreads < nthreads; pool->nthreads++)
+        if (0 != (err = pthread_create(&pool->threads[pool->nthreads], NULL, H5FD__stripe_worker, pool)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, FAIL, "can't start I/O thread, error = %d", err);
+
+done:
+    if (ret_value < 0)
+        H5FD__stripe_pool_term(pool);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_pool_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_pool_term
+ *
+ * Purpose:     Stops and joins the worker threads and releases the pool.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__stripe_pool_term(H5FD_stripe_pool_t *pool)
+{
+    unsigned u;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(pool);
+
+    if (pool->init) {
+        pthread_mutex_lock(&pool->mutex);
+        pool->shutdown = TRUE;
+        pthread_cond_broadcast(&pool->work_cv);
+        pthread_mutex_unlock(&pool->mutex);
+
+        for (u = 0; u < pool->nthreads; u++)
+            pthread_join(pool->threads[u], NULL);
+
+        pthread_cond_destroy(&pool->done_cv);
+        pthread_cond_destroy(&pool->work_cv);
+        pthread_mutex_destroy(&pool->mutex);
+    }
+
+    H5MM_xfree(pool->threads);
+    memset(pool, 0, sizeof(H5FD_stripe_pool_t));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__stripe_pool_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_run_task
+ *
+ * Purpose:     Performs the pieces of one member batch in order.  Reads
+ *              that reach the end of the member are zero-filled, as with
+ *              the sec2 driver.  The first failure stops the batch and is
+ *              recorded in the task's io_errno.
+ *
+ *              This is called from the pool threads, so it must not use
+ *              the library's error stack or any other library state.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__stripe_run_task(H5FD_stripe_task_t *task)
+{
+    size_t i;
+
+    for (i = 0; i < task->npieces; i++) {
+        HDoff_t        offset = task->pieces[i].offset;
+        size_t         left   = task->pieces[i].size;
+        unsigned char *ptr    = task->pieces[i].buf;
+
+        while (left > 0) {
+            h5_posix_io_t     bytes_in;
+            h5_posix_io_ret_t bytes_out;
+
+            bytes_in = (left > H5_POSIX_MAX_IO_BYTES) ? H5_POSIX_MAX_IO_BYTES : (h5_posix_io_t)left;
+
+            do {
+                if (task->do_write)
+                    bytes_out = HDpwrite(task->fd, ptr, bytes_in, offset);
+                else
+                    bytes_out = HDpread(task->fd, ptr, bytes_in, offset);
+            } while (-1 == bytes_out && EINTR == errno);
+
+            if (-1 == bytes_out) {
+                task->io_errno = errno;
+                return;
+            }
+            if (0 == bytes_out) {
+                if (task->do_write) {
+                    task->io_errno = EIO;
+                    return;
+                }
+
+                /* End of the member */
+                memset(ptr, 0, left);
+                break;
+            }
+
+            left -= (size_t)bytes_out;
+            ptr += bytes_out;
+            offset += (HDoff_t)bytes_out;
+        }
+    }
+} /* end H5FD__stripe_run_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_worker
+ *
+ * Purpose:     Body of a pool thread: claims and performs batches until
+ *              the pool is shut down.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__stripe_worker(void *_pool)
+{
+    H5FD_stripe_pool_t *pool = (H5FD_stripe_pool_t *)_pool;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        size_t t;
+
+        while (!pool->shutdown && pool->next >= pool->ntasks)
+            pthread_cond_wait(&pool->work_cv, &pool->mutex);
+        if (pool->shutdown)
+            break;
+
+        t = pool->next++;
+        pthread_mutex_unlock(&pool->mutex);
+
+        H5FD__stripe_run_task(&pool->tasks[t]);
+
+        pthread_mutex_lock(&pool->mutex);
+        if (++pool->ndone == pool->ntasks)
+            pthread_cond_signal(&pool->done_cv);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+} /* end H5FD__stripe_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_pool_run
+ *
+ * Purpose:     Performs NTASKS member batches and returns when all of them
+ *              are done.  The calling thread claims batches along with the
+ *              workers, so a request never waits for an idle thread.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__stripe_pool_run(H5FD_stripe_pool_t *pool, H5FD_stripe_task_t *tasks, size_t ntasks)
+{
+    size_t t;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(pool);
+    assert(tasks || 0 == ntasks);
+
+    /* Nothing to overlap */
+    if (0 == pool->nthreads || ntasks < 2) {
+        for (t = 0; t < ntasks; t++)
+            H5FD__stripe_run_task(&tasks[t]);
+    }
+    else {
+        pthread_mutex_lock(&pool->mutex);
+        pool->tasks  = tasks;
+        pool->ntasks = ntasks;
+        pool->next   = 0;
+        pool->ndone  = 0;
+        pthread_cond_broadcast(&pool->work_cv);
+
+        while (pool->next < pool->ntasks) {
+            t = pool->next++;
+            pthread_mutex_unlock(&pool->mutex);
+
+            H5FD__stripe_run_task(&tasks[t]);
+
+            pthread_mutex_lock(&pool->mutex);
+            pool->ndone++;
+        }
+        while (pool->ndone < pool->ntasks)
+            pthread_cond_wait(&pool->done_cv, &pool->mutex);
+
+        pool->tasks  = NULL;
+        pool->ntasks = 0;
+        pool->next   = 0;
+        pool->ndone  = 0;
+        pthread_mutex_unlock(&pool->mutex);
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__stripe_pool_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__stripe_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_stripe_t            *file      = NULL; /* Striping VFD info        */
+    char                     *memb_name = NULL; /* Name of a member file    */
+    int                       o_flags;          /* Flags for open() call    */
+    const H5FD_stripe_fapl_t *fa;
+    H5FD_stripe_fapl_t        default_fa;
+    H5P_genplist_t           *plist; /* Property list pointer */
+    unsigned                  nthreads;
+    unsigned                  u;
+    H5FD_t                   *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name");
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr");
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_stripe_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (H5FD__stripe_populate_config(0, 0, 0, &default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, NULL, "can't initialize driver configuration info");
+        fa = &default_fa;
+    }
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_stripe_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct");
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_stripe_fapl_t));
+
+    if (NULL == (file->memb = (H5FD_stripe_memb_t *)H5MM_malloc(file->fa.nmembers * sizeof(H5FD_stripe_memb_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate member array");
+    for (u = 0; u < file->fa.nmembers; u++)
+        file->memb[u].fd = -1;
+    if (NULL == (memb_name = (char *)H5MM_malloc(H5FD_STRIPE_MEMB_NAME_BUF_SIZE)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate member name");
+
+    /* Open the members, and derive the logical end of file from their sizes:
+     * the last byte of member U lies in stripe (size - 1) / stripe_size of
+     * that member, which is global stripe that * nmembers + U.
+     */
+    for (u = 0; u < file->fa.nmembers; u++) {
+        h5_stat_t sb;
+
+        if (H5FD__stripe_memb_name(name, u, memb_name, H5FD_STRIPE_MEMB_NAME_BUF_SIZE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, NULL, "can't build member file name");
+
+        if ((file->memb[u].fd = HDopen(memb_name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+            int myerrno = errno;
+            HGOTO_ERROR(
+                H5E_FILE, H5E_CANTOPENFILE, NULL,
+                "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+                memb_name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+        } /* end if */
+
+        if (HDfstat(file->memb[u].fd, &sb) < 0)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+        file->memb[u].device = sb.st_dev;
+        file->memb[u].inode  = sb.st_ino;
+
+        if (sb.st_size > 0) {
+            haddr_t last = (haddr_t)sb.st_size - 1;
+            haddr_t end;
+
+            end = ((last / file->fa.stripe_size) * file->fa.nmembers + u) * file->fa.stripe_size +
+                  last % file->fa.stripe_size + 1;
+            if (end > file->eof)
+                file->eof = end;
+        }
+    }
+
+    /* Start the I/O threads.  The requesting thread performs batches too,
+     * so one fewer worker than the requested thread count is needed.
+     */
+    nthreads = file->fa.nthreads ? file->fa.nthreads : MIN(file->fa.nmembers, H5FD_STRIPE_NTHREADS_MAX);
+    if (nthreads > file->fa.nmembers)
+        nthreads = file->fa.nmembers;
+    if (H5FD__stripe_pool_init(&file->pool, nthreads - 1) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to start I/O threads");
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property");
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    H5MM_xfree(memb_name);
+
+    if (NULL == ret_value && file) {
+        H5FD__stripe_pool_term(&file->pool);
+        if (file->memb) {
+            for (u = 0; u < file->fa.nmembers; u++)
+                if (file->memb[u].fd >= 0)
+                    HDclose(file->memb[u].fd);
+            H5MM_xfree(file->memb);
+        }
+        file = H5FL_FREE(H5FD_stripe_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_close(H5FD_t *_file)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+    unsigned       u;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(file);
+
+    /* Stop the I/O threads */
+    H5FD__stripe_pool_term(&file->pool);
+
+    /* Close the members, reporting the first failure */
+    for (u = 0; u < file->fa.nmembers; u++)
+        if (HDclose(file->memb[u].fd) < 0 && ret_value >= 0)
+            HSYS_DONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close member file")
+
+    /* Release the file info */
+    H5MM_xfree(file->memb);
+    file = H5FL_FREE(H5FD_stripe_t, file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.  Files are identified
+ *              by their first member.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__stripe_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_stripe_memb_t *m1        = ((const H5FD_stripe_t *)_f1)->memb;
+    const H5FD_stripe_memb_t *m2        = ((const H5FD_stripe_t *)_f2)->memb;
+    int                       ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (m1->device < m2->device)
+        HGOTO_DONE(-1);
+    if (m1->device > m2->device)
+        HGOTO_DONE(1);
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (memcmp(&(m1->device), &(m2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1);
+    if (memcmp(&(m1->device), &(m2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1);
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (m1->inode < m2->inode)
+        HGOTO_DONE(-1);
+    if (m1->inode > m2->inode)
+        HGOTO_DONE(1);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__stripe_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__stripe_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_stripe_t *file = (const H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__stripe_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__stripe_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker: the first address past the
+ *              last byte stored in any member.
+ *
+ * Return:      End of file address
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__stripe_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_stripe_t *file = (const H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__stripe_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_get_handle
+ *
+ * Purpose:     Returns the file descriptor of the first member.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid");
+
+    *file_handle = &(file->memb[0].fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_transfer
+ *
+ * Purpose:     Reads or writes COUNT pieces.  Each piece is cut at stripe
+ *              boundaries and the parts are sorted, in request order, into
+ *              one batch per member; the batches are then performed
+ *              concurrently by the file's thread pool.
+ *
+ *              SIZES follows the vector I/O convention: a zero entry means
+ *              the previous size applies to the rest of the vector.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_transfer(H5FD_stripe_t *file, hbool_t do_write, uint32_t count, haddr_t addrs[],
+                      size_t sizes[], H5_flexible_const_ptr_t bufs[])
+{
+    H5FD_stripe_piece_t  local_pieces[H5FD_STRIPE_LOCAL_PIECES]; /* Piece array for short requests    */
+    H5FD_stripe_task_t   local_tasks[H5FD_STRIPE_LOCAL_TASKS];   /* Batch array for few members       */
+    H5FD_stripe_piece_t *pieces       = local_pieces;            /* Parts of all pieces, by member    */
+    H5FD_stripe_task_t  *tasks        = local_tasks;             /* One batch per member              */
+    hsize_t              stripe_size  = file->fa.stripe_size;    /* Size of a stripe                  */
+    unsigned             nmembers     = file->fa.nmembers;       /* Number of members                 */
+    size_t               npieces      = 0;                       /* Number of parts                   */
+    size_t               ntasks       = 0;                       /* Number of non-empty batches       */
+    haddr_t              max_addr     = 0;                       /* End of the highest write          */
+    size_t               size         = 0;                       /* Size of the current piece         */
+    hbool_t              extend_sizes = FALSE;                   /* Whether the last size repeats     */
+    uint32_t             i;                                      /* Local index variable              */
+    unsigned             u;                                      /* Local index variable              */
+    herr_t               ret_value = SUCCEED;                    /* Return value                      */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+    assert(count == 0 || (addrs && sizes && bufs));
+
+    if (nmembers > H5FD_STRIPE_LOCAL_TASKS)
+        if (NULL == (tasks = (H5FD_stripe_task_t *)H5MM_malloc(nmembers * sizeof(H5FD_stripe_task_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate batch array");
+    memset(tasks, 0, nmembers * sizeof(H5FD_stripe_task_t));
+
+    /* Check the pieces and count the parts each member receives */
+    for (i = 0; i < count; i++) {
+        hsize_t stripe, last;
+
+        if (!extend_sizes) {
+            if (sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                size = sizes[i];
+        }
+
+        if (!H5_addr_defined(addrs[i]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                        (unsigned long long)addrs[i]);
+        if (REGION_OVERFLOW(addrs[i], size))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                        (unsigned long long)addrs[i], (unsigned long long)size);
+        if ((addrs[i] + size) > file->eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu",
+                        (unsigned long long)addrs[i], (unsigned long long)size,
+                        (unsigned long long)file->eoa);
+
+        if (0 == size)
+            continue;
+
+        last = (addrs[i] + size - 1) / stripe_size;
+        for (stripe = addrs[i] / stripe_size; stripe <= last; stripe++)
+            tasks[stripe % nmembers].npieces++;
+        npieces += (size_t)(last - addrs[i] / stripe_size + 1);
+
+        if (addrs[i] + size > max_addr)
+            max_addr = addrs[i] + size;
+    }
+
+    if (0 == npieces)
+        HGOTO_DONE(SUCCEED);
+
+    if (npieces > H5FD_STRIPE_LOCAL_PIECES)
+        if (NULL == (pieces = (H5FD_stripe_piece_t *)H5MM_malloc(npieces * sizeof(H5FD_stripe_piece_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate piece array");
+
+    /* Give each member its range of the piece array */
+    npieces = 0;
+    for (u = 0; u < nmembers; u++) {
+        tasks[u].memb     = u;
+        tasks[u].fd       = file->memb[u].fd;
+        tasks[u].do_write = do_write;
+        tasks[u].pieces   = pieces + npieces;
+        npieces += tasks[u].npieces;
+        tasks[u].npieces = 0;
+    }
+
+    /* Cut the pieces at stripe boundaries */
+    extend_sizes = FALSE;
+    for (i = 0; i < count; i++) {
+        haddr_t        addr;
+        size_t         left;
+        unsigned char *ptr;
+
+        if (!extend_sizes) {
+            if (sizes[i] == 0)
+                extend_sizes = TRUE;
+            else
+                size = sizes[i];
+        }
+
+        addr = addrs[i];
+        left = size;
+        ptr  = (unsigned char *)bufs[i].vp;
+        while (left > 0) {
+            hsize_t              stripe = addr / stripe_size;
+            hsize_t              within = addr % stripe_size;
+            H5FD_stripe_task_t  *task   = &tasks[stripe % nmembers];
+            H5FD_stripe_piece_t *piece  = &task->pieces[task->npieces++];
+
+            piece->offset = (HDoff_t)((stripe / nmembers) * stripe_size + within);
+            piece->size   = (size_t)MIN((hsize_t)left, stripe_size - within);
+            piece->buf    = ptr;
+
+            addr += piece->size;
+            left -= piece->size;
+            ptr += piece->size;
+        }
+    }
+
+    /* Drop the members with nothing to do */
+    for (u = 0; u < nmembers; u++)
+        if (tasks[u].npieces > 0)
+            tasks[ntasks++] = tasks[u];
+
+    H5FD__stripe_pool_run(&file->pool, tasks, ntasks);
+
+    for (u = 0; u < ntasks; u++)
+        if (tasks[u].io_errno) {
+            time_t mytime = HDtime(NULL);
+
+            if (do_write)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                            "file write failed: time = %s, filename = '%s', member = %u, errno = %d, "
+                            "error message = '%s', pieces = %llu",
+                            HDctime(&mytime), file->filename, tasks[u].memb, tasks[u].io_errno,
+                            HDstrerror(tasks[u].io_errno), (unsigned long long)count);
+            else
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                            "file read failed: time = %s, filename = '%s', member = %u, errno = %d, "
+                            "error message = '%s', pieces = %llu",
+                            HDctime(&mytime), file->filename, tasks[u].memb, tasks[u].io_errno,
+                            HDstrerror(tasks[u].io_errno), (unsigned long long)count);
+        }
+
+    /* Update the eof */
+    if (do_write && max_addr > file->eof)
+        file->eof = max_addr;
+
+done:
+    if (pieces != local_pieces)
+        H5MM_xfree(pieces);
+    if (tasks != local_tasks)
+        H5MM_xfree(tasks);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_transfer() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                  size_t size, void *buf /*out*/)
+{
+    H5FD_stripe_t          *file = (H5FD_stripe_t *)_file;
+    H5_flexible_const_ptr_t fbuf;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    if (0 == size)
+        HGOTO_DONE(SUCCEED);
+
+    fbuf.vp = buf;
+    if (H5FD__stripe_transfer(file, FALSE, 1, &addr, &size, &fbuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "striped read failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                   size_t size, const void *buf)
+{
+    H5FD_stripe_t          *file = (H5FD_stripe_t *)_file;
+    H5_flexible_const_ptr_t fbuf;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    if (0 == size)
+        HGOTO_DONE(SUCCEED);
+
+    fbuf.cvp = buf;
+    if (H5FD__stripe_transfer(file, TRUE, 1, &addr, &size, &fbuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "striped write failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_read_vector
+ *
+ * Purpose:     Reads the COUNT pieces described by ADDRS and SIZES into
+ *              BUFS, with the members read concurrently.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                         H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                         void *bufs[] /* out */)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || sizes[0] != 0);
+
+    if (H5FD__stripe_transfer(file, FALSE, count, addrs, sizes, (H5_flexible_const_ptr_t *)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "striped vector read failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_write_vector
+ *
+ * Purpose:     Writes the COUNT pieces described by ADDRS and SIZES from
+ *              BUFS, with the members written concurrently.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+                          H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[],
+                          const void *bufs[] /* in */)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(count == 0 || sizes[0] != 0);
+
+    if (H5FD__stripe_transfer(file, TRUE, count, addrs, sizes, (H5_flexible_const_ptr_t *)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "striped vector write failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as the
+ *              end-of-address, by sizing every member to its share of it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+    unsigned       u;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (!H5_addr_eq(file->eoa, file->eof)) {
+        hsize_t round_size = file->fa.stripe_size * file->fa.nmembers;
+        hsize_t rounds     = file->eoa / round_size;
+        hsize_t rem        = file->eoa % round_size;
+
+        /* Every member holds one stripe of each full round, plus its part of
+         * the last, partial round.
+         */
+        for (u = 0; u < file->fa.nmembers; u++) {
+            hsize_t start     = (hsize_t)u * file->fa.stripe_size;
+            hsize_t memb_size = rounds * file->fa.stripe_size;
+
+            if (rem > start)
+                memb_size += MIN(rem - start, file->fa.stripe_size);
+
+            if (-1 == HDftruncate(file->memb[u].fd, (HDoff_t)memb_size))
+                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend member file properly")
+        }
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_lock
+ *
+ * Purpose:     To place an advisory lock on every member.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file; /* VFD file struct          */
+    int            lock_flags;                    /* file locking flags       */
+    unsigned       u;
+    herr_t         ret_value = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the members */
+    for (u = 0; u < file->fa.nmembers; u++)
+        if (HDflock(file->memb[u].fd, lock_flags | LOCK_NB) < 0) {
+            if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+                /* When errno is set to ENOSYS, the file system does not support
+                 * locking, so ignore it.
+                 */
+                errno = 0;
+            }
+            else {
+                /* Release the locks already taken */
+                while (u-- > 0)
+                    HDflock(file->memb[u].fd, LOCK_UN);
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+            }
+        }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_unlock
+ *
+ * Purpose:     To remove the existing lock on every member
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_unlock(H5FD_t *_file)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file; /* VFD file struct          */
+    unsigned       u;
+    herr_t         ret_value = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    for (u = 0; u < file->fa.nmembers; u++)
+        if (HDflock(file->memb[u].fd, LOCK_UN) < 0) {
+            if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+                /* When errno is set to ENOSYS, the file system does not support
+                 * locking, so ignore it.
+                 */
+                errno = 0;
+            }
+            else
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+        }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_delete
+ *
+ * Purpose:     Delete a file, by deleting all of its members
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_delete(const char *filename, hid_t fapl_id)
+{
+    H5P_genplist_t           *plist;
+    const H5FD_stripe_fapl_t *fa        = NULL;
+    unsigned                  nmembers  = H5FD_STRIPE_NMEMBERS_DEF;
+    char                     *memb_name = NULL;
+    unsigned                  u;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(filename);
+
+    /* The member count comes from the fapl, if it was set up for this driver */
+    if (H5P_FILE_ACCESS_DEFAULT != fapl_id) {
+        if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if (NULL != (fa = (const H5FD_stripe_fapl_t *)H5P_peek_driver_info(plist)))
+            nmembers = fa->nmembers;
+    }
+
+    if (NULL == (memb_name = (char *)H5MM_malloc(H5FD_STRIPE_MEMB_NAME_BUF_SIZE)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to allocate member name");
+
+    for (u = 0; u < nmembers; u++) {
+        if (H5FD__stripe_memb_name(filename, u, memb_name, H5FD_STRIPE_MEMB_NAME_BUF_SIZE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "can't build member file name");
+
+        if (HDremove(memb_name) < 0)
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTDELETEFILE, FAIL, "unable to delete member file")
+    }
+
+done:
+    H5MM_xfree(memb_name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_delete() */
+
+#endif /* H5_HAVE_STRIPE_VFD */
@@ -0,0 +1,114 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the striping driver.
+ */
+#ifndef H5FDstripe_H
+#define H5FDstripe_H
+
+#ifdef H5_HAVE_STRIPE_VFD
+#define H5FD_STRIPE       (H5FDperform_init(H5FD_stripe_init))
+#define H5FD_STRIPE_VALUE H5_VFD_STRIPE
+#else
+#define H5FD_STRIPE       (H5I_INVALID_HID)
+#define H5FD_STRIPE_VALUE H5_VFD_INVALID
+#endif /* H5_HAVE_STRIPE_VFD */
+
+#ifdef H5_HAVE_STRIPE_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default values for the member count and the stripe size.  Application
+ * can set these values through H5Pset_fapl_stripe. */
+#define H5FD_STRIPE_NMEMBERS_DEF    4
+#define H5FD_STRIPE_STRIPE_SIZE_DEF (1024 * 1024)
+
+/* Largest member and thread counts accepted by H5Pset_fapl_stripe */
+#define H5FD_STRIPE_NMEMBERS_MAX 256
+#define H5FD_STRIPE_NTHREADS_MAX 64
+
+H5_DLL hid_t H5FD_stripe_init(void);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets up use of the striping driver
+ *
+ * \fapl_id
+ * \param[in] nmembers Number of member files the data is striped across
+ * \param[in] stripe_size Size of each stripe, in bytes
+ * \param[in] nthreads Number of threads performing I/O on the members
+ * \returns \herr_t
+ *
+ * \details H5Pset_fapl_stripe() sets the file access property list, \p
+ *          fapl_id, to use the striping driver, #H5FD_STRIPE. The driver
+ *          divides the HDF5 address space into stripes of \p stripe_size
+ *          bytes and places them round-robin on \p nmembers local files:
+ *          stripe \c k is stored in member <tt>k % nmembers</tt>. Placing
+ *          each member on a different device lets a single process use the
+ *          combined bandwidth of all of them.
+ *
+ *          The name passed to H5Fcreate() or H5Fopen() may be a printf-style
+ *          template with one integer conversion, e.g.
+ *          <tt>"/mnt/nvme%d/data.h5"</tt>, which is expanded with the member
+ *          index to give each member's name. Any other name is used as a
+ *          prefix, and member \c i is named <tt>name.i</tt>.
+ *
+ *          Reads and writes, including vector and selection requests, are
+ *          split into one batch of transfers per member, and the batches are
+ *          performed concurrently by \p nthreads threads. The calling thread
+ *          is one of them, so a value of 1 (one) performs all I/O serially.
+ *          A value of 0 (zero) selects one thread per member. Values above 64
+ *          are rejected.
+ *
+ *          Passing 0 (zero) for \p nmembers or \p stripe_size selects the
+ *          defaults of 4 members and 1 MiB stripes. No more than 256 members
+ *          are allowed. The member count and stripe size are recorded in the
+ *          file, and opening it with a different layout fails.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pset_fapl_stripe(hid_t fapl_id, unsigned nmembers, hsize_t stripe_size, unsigned nthreads);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves striping driver settings
+ *
+ * \fapl_id
+ * \param[out] nmembers Number of member files the data is striped across
+ * \param[out] stripe_size Size of each stripe, in bytes
+ * \param[out] nthreads Number of threads performing I/O on the members
+ * \returns \herr_t
+ *
+ * \details H5Pget_fapl_stripe() retrieves the layout and thread count
+ *          settings for the striping driver, #H5FD_STRIPE, from the file
+ *          access property list \p fapl_id.
+ *
+ *          See H5Pset_fapl_stripe() for a discussion of these values.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pget_fapl_stripe(hid_t fapl_id, unsigned *nmembers /*out*/, hsize_t *stripe_size /*out*/,
+                                 unsigned *nthreads /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_STRIPE_VFD */
+
+#endif
@@ -0,0 +1,1441 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The write-behind file driver.  This is a pass-through driver
+ *          stacked on another one, like the splitter.  Writes are copied
+ *          into a bounded staging buffer and return at once; a background
+ *          thread owned by the open file then hands them to the underlying
+ *          driver.
+ *
+ *          Staged writes form a FIFO queue whose data lives in a single
+ *          ring buffer, and the drain thread stores them strictly in queue
+ *          order, so a later write to an overlapping range always lands
+ *          after the earlier one.  Neighbouring staged writes that follow
+ *          each other both in the file and in the ring are stored with one
+ *          call.  Reads go to the underlying driver and are then patched
+ *          with any overlapping data that is still staged.  Flush, truncate
+ *          and close wait for the queue to empty.
+ *
+ *          Every call into the underlying driver, from either thread, is
+ *          made while holding 'io_mutex', because drivers keep per-file
+ *          state (e.g. the sec2 EOF) without locking.  The drain thread
+ *          calls the driver's write callback directly rather than going
+ *          through H5FD_write(), which needs the API context of the calling
+ *          thread.  Only drivers whose write callback touches nothing but
+ *          the open file may be used underneath.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"       /* Generic Functions        */
+#include "H5Eprivate.h"      /* Error handling           */
+#include "H5Fprivate.h"      /* File access              */
+#include "H5FDprivate.h"     /* File drivers             */
+#include "H5FDwritebehind.h" /* Write-behind file driver */
+#include "H5FLprivate.h"     /* Free Lists               */
+#include "H5Iprivate.h"      /* IDs                      */
+#include "H5MMprivate.h"     /* Memory management        */
+#include "H5Pprivate.h"      /* Property lists           */
+
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+
+#include <pthread.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_WRITEBEHIND_g = 0;
+
+/* Maximum number of staged writes, regardless of their size */
+#define H5FD_WRITEBEHIND_MAX_PENDING 1024
+
+/* Driver-specific file access properties */
+typedef struct H5FD_writebehind_fapl_t {
+    hid_t  under_fapl_id; /* FAPL of the underlying driver     */
+    size_t buffer_size;   /* Size of the staging buffer        */
+} H5FD_writebehind_fapl_t;
+
+/* One staged write */
+typedef struct H5FD_writebehind_rec_t {
+    H5FD_mem_t type;   /* Memory type of the write                   */
+    haddr_t    addr;   /* File address of the write                  */
+    size_t     size;   /* Number of bytes                            */
+    size_t     offset; /* Offset of the data in the staging buffer   */
+    size_t     charge; /* Staging bytes held, including a wrap skip  */
+} H5FD_writebehind_rec_t;
+
+/*
+ * The description of a file belonging to this driver.
+ *
+ * The staged writes are 'recs[first]' .. 'recs[first + nrecs - 1]' (modulo
+ * H5FD_WRITEBEHIND_MAX_PENDING), oldest first.  Their data occupies the
+ * bytes of 'stage' from 'head' up to 'tail', wrapping around to the start
+ * when a write doesn't fit at the end; the skipped bytes at the end are
+ * charged to the write that wrapped.  The first 'nbusy' records are being
+ * stored by the drain thread.  All fields from 'first' through 'shutdown'
+ * are protected by 'mutex'.
+ *
+ * 'pending_lo' and 'pending_hi' bound the addresses of the staged writes,
+ * so most reads skip the scan for staged data.  'pending_eof' is the end of
+ * the highest write staged since the last truncate and is only used by the
+ * application's thread.
+ */
+typedef struct H5FD_writebehind_t {
+    H5FD_t                  pub;   /* public stuff, must be first      */
+    H5FD_t                 *under; /* underlying file                  */
+    H5FD_writebehind_fapl_t fa;    /* file access properties           */
+    haddr_t                 pending_eof;
+
+    unsigned char          *stage; /* staging buffer                   */
+    H5FD_writebehind_rec_t *recs;  /* staged writes, circular          */
+    size_t                  first; /* index of the oldest staged write */
+    size_t                  nrecs; /* number of staged writes          */
+    size_t                  nbusy; /* staged writes being stored       */
+    size_t                  head;  /* staging offset of oldest data    */
+    size_t                  tail;  /* staging offset for new data      */
+    size_t                  used;  /* staging bytes held               */
+    haddr_t                 pending_lo;
+    haddr_t                 pending_hi;
+    hbool_t                 failed;      /* whether a staged write failed    */
+    haddr_t                 failed_addr; /* address of the failed write      */
+    hbool_t                 shutdown;    /* whether the drain thread exits   */
+
+    hbool_t         sync_init;  /* whether the objects below exist  */
+    hbool_t         thread_run; /* whether the drain thread started */
+    pthread_t       thread;     /* drain thread                     */
+    pthread_mutex_t mutex;      /* protects the staging state       */
+    pthread_mutex_t io_mutex;   /* serializes the underlying driver */
+    pthread_cond_t  work_cv;    /* signaled when a write is staged  */
+    pthread_cond_t  space_cv;   /* signaled when writes are stored  */
+} H5FD_writebehind_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__writebehind_term(void);
+static void   *H5FD__writebehind_fapl_get(H5FD_t *_file);
+static void   *H5FD__writebehind_fapl_copy(const void *_old_fa);
+static herr_t  H5FD__writebehind_fapl_free(void *_fa);
+static H5FD_t *H5FD__writebehind_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__writebehind_close(H5FD_t *_file);
+static int     H5FD__writebehind_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__writebehind_query(const H5FD_t *_file, unsigned long *flags);
+static haddr_t H5FD__writebehind_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__writebehind_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__writebehind_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__writebehind_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__writebehind_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+                                      size_t size, void *buf);
+static herr_t  H5FD__writebehind_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+                                       size_t size, const void *buf);
+static herr_t  H5FD__writebehind_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__writebehind_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__writebehind_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__writebehind_unlock(H5FD_t *_file);
+static herr_t  H5FD__writebehind_delete(const char *filename, hid_t fapl_id);
+static herr_t  H5FD__writebehind_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input,
+                                     void **output);
+
+static herr_t H5FD__writebehind_populate_config(hid_t under_fapl_id, size_t buffer_size,
+                                                H5FD_writebehind_fapl_t *fa_out);
+static herr_t H5FD__writebehind_sync_init(H5FD_writebehind_t *file);
+static void   H5FD__writebehind_sync_term(H5FD_writebehind_t *file);
+static void  *H5FD__writebehind_worker(void *_file);
+static herr_t H5FD__writebehind_drain(H5FD_writebehind_t *file);
+
+static const H5FD_class_t H5FD_writebehind_g = {
+    H5FD_CLASS_VERSION,              /* struct version       */
+    H5FD_WRITEBEHIND_VALUE,          /* value                */
+    "writebehind",                   /* name                 */
+    MAXADDR,                         /* maxaddr              */
+    H5F_CLOSE_WEAK,                  /* fc_degree            */
+    H5FD__writebehind_term,          /* terminate            */
+    NULL,                            /* sb_size              */
+    NULL,                            /* sb_encode            */
+    NULL,                            /* sb_decode            */
+    sizeof(H5FD_writebehind_fapl_t), /* fapl_size            */
+    H5FD__writebehind_fapl_get,      /* fapl_get             */
+    H5FD__writebehind_fapl_copy,     /* fapl_copy            */
+    H5FD__writebehind_fapl_free,     /* fapl_free            */
+    0,                               /* dxpl_size            */
+    NULL,                            /* dxpl_copy            */
+    NULL,                            /* dxpl_free            */
+    H5FD__writebehind_open,          /* open                 */
+    H5FD__writebehind_close,         /* close                */
+    H5FD__writebehind_cmp,           /* cmp                  */
+    H5FD__writebehind_query,         /* query                */
+    NULL,                            /* get_type_map         */
+    NULL,                            /* alloc                */
+    NULL,                            /* free                 */
+    H5FD__writebehind_get_eoa,       /* get_eoa              */
+    H5FD__writebehind_set_eoa,       /* set_eoa              */
+    H5FD__writebehind_get_eof,       /* get_eof              */
+    H5FD__writebehind_get_handle,    /* get_handle           */
+    H5FD__writebehind_read,          /* read                 */
+    H5FD__writebehind_write,         /* write                */
+    NULL,                            /* read_vector          */
+    NULL,                            /* write_vector         */
+    NULL,                            /* read_selection       */
+    NULL,                            /* write_selection      */
+    H5FD__writebehind_flush,         /* flush                */
+    H5FD__writebehind_truncate,      /* truncate             */
+    H5FD__writebehind_lock,          /* lock                 */
+    H5FD__writebehind_unlock,        /* unlock               */
+    H5FD__writebehind_delete,        /* del                  */
+    H5FD__writebehind_ctl,           /* ctl                  */
+    H5FD_FLMAP_DICHOTOMY             /* fl_map               */
+};
+
+/* Declare free lists to manage the driver structs */
+H5FL_DEFINE_STATIC(H5FD_writebehind_t);
+H5FL_DEFINE_STATIC(H5FD_writebehind_fapl_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_writebehind_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the write-behind driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_writebehind_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_WRITEBEHIND_g)) {
+        H5FD_WRITEBEHIND_g = H5FD_register(&H5FD_writebehind_g, sizeof(H5FD_class_t), FALSE);
+        if (H5I_INVALID_HID == H5FD_WRITEBEHIND_g)
+            HGOTO_ERROR(H5E_ID, H5E_CANTREGISTER, H5I_INVALID_HID, "unable to register writebehind");
+    }
+
+    /* Set return value */
+    ret_value = H5FD_WRITEBEHIND_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_writebehind_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_term(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Reset VFL ID */
+    H5FD_WRITEBEHIND_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__writebehind_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_writebehind
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_WRITEBEHIND driver defined in this source file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_writebehind(hid_t fapl_id, hid_t under_fapl_id, size_t buffer_size)
+{
+    H5P_genplist_t         *plist; /* Property list pointer */
+    H5FD_writebehind_fapl_t fa;
+    herr_t                  ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iiz", fapl_id, under_fapl_id, buffer_size);
+
+    fa.under_fapl_id = H5I_INVALID_HID;
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    if (H5FD__writebehind_populate_config(under_fapl_id, buffer_size, &fa) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+
+    ret_value = H5P_set_driver(plist, H5FD_WRITEBEHIND, &fa, NULL);
+
+done:
+    /* The property list holds its own copy of the underlying FAPL */
+    if (H5I_INVALID_HID != fa.under_fapl_id && H5I_dec_ref(fa.under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_writebehind() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_writebehind
+ *
+ * Purpose:     Returns information about the write-behind file access
+ *              property list though the function arguments.  The
+ *              underlying FAPL is returned as a copy, which the caller
+ *              must close.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_writebehind(hid_t fapl_id, hid_t *under_fapl_id /*out*/, size_t *buffer_size /*out*/)
+{
+    H5P_genplist_t                *plist; /* Property list pointer */
+    const H5FD_writebehind_fapl_t *fa;
+    H5FD_writebehind_fapl_t        default_fa;
+    herr_t                         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", fapl_id, under_fapl_id, buffer_size);
+
+    default_fa.under_fapl_id = H5I_INVALID_HID;
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list");
+    if (H5FD_WRITEBEHIND != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver");
+    if (NULL == (fa = H5P_peek_driver_info(plist))) {
+        if (H5FD__writebehind_populate_config(H5P_DEFAULT, 0, &default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+        fa = &default_fa;
+    }
+
+    if (under_fapl_id) {
+        H5P_genplist_t *under_plist;
+
+        if (NULL == (under_plist = (H5P_genplist_t *)H5I_object(fa->under_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if ((*under_fapl_id = H5P_copy_plist(under_plist, TRUE)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, FAIL, "can't copy underlying FAPL");
+    }
+    if (buffer_size)
+        *buffer_size = fa->buffer_size;
+
+done:
+    if (H5I_INVALID_HID != default_fa.under_fapl_id && H5I_dec_ref(default_fa.under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_writebehind() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_populate_config
+ *
+ * Purpose:     Populates a H5FD_writebehind_fapl_t structure with the
+ *              provided values, supplying defaults where values are not
+ *              provided.  The underlying FAPL stored in FA_OUT is a new
+ *              copy, which the caller must release.
+ *
+ *              The drain thread calls the underlying driver's write
+ *              callback, so only drivers whose writes touch nothing
+ *              outside the open file are accepted.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_populate_config(hid_t under_fapl_id, size_t buffer_size, H5FD_writebehind_fapl_t *fa_out)
+{
+    H5P_genplist_t     *plist;
+    H5FD_driver_prop_t  driver_prop;
+    const H5FD_class_t *driver;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    assert(fa_out);
+
+    fa_out->under_fapl_id = H5I_INVALID_HID;
+    fa_out->buffer_size   = buffer_size ? buffer_size : H5FD_WRITEBEHIND_BUFFER_SIZE_DEF;
+
+    if (SIZE_OVERFLOW(fa_out->buffer_size))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "staging buffer size too large");
+
+    if (H5P_DEFAULT == under_fapl_id) {
+        /* Use a copy of the default FAPL with the sec2 driver set
+         * explicitly, since the default driver might have been replaced
+         * with this one, which would cause recursion.
+         */
+        if (NULL == (plist = (H5P_genplist_t *)H5I_object(H5P_FILE_ACCESS_DEFAULT)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if ((fa_out->under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, FAIL, "can't copy property list");
+        if (NULL == (plist = (H5P_genplist_t *)H5I_object(fa_out->under_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if (H5P_set_driver_by_value(plist, H5_VFD_SEC2, NULL, TRUE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't set default driver on underlying FAPL");
+    }
+    else {
+        if (NULL == (plist = H5P_object_verify(under_fapl_id, H5P_FILE_ACCESS)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+        if (H5P_peek(plist, H5F_ACS_FILE_DRV_NAME, &driver_prop) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get driver ID & info");
+        if (NULL == (driver = (const H5FD_class_t *)H5I_object(driver_prop.driver_id)))
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "invalid driver ID in file access property list");
+        if (H5_VFD_SEC2 != driver->value
+#ifdef H5_HAVE_IOURING_VFD
+            && H5_VFD_IOURING != driver->value
+#endif
+        )
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "driver '%s' can't be used under write-behind",
+                        driver->name);
+
+        if ((fa_out->under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, FAIL, "can't copy property list");
+    }
+
+done:
+    if (ret_value < 0 && H5I_INVALID_HID != fa_out->under_fapl_id) {
+        if (H5I_dec_ref(fa_out->under_fapl_id) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+        fa_out->under_fapl_id = H5I_INVALID_HID;
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_populate_config() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_fapl_get
+ *
+ * Purpose:     Gets a file access property list which could be used to
+ *              create an identical file.
+ *
+ * Return:      Success:    Ptr to new file access property list value.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__writebehind_fapl_get(H5FD_t *_file)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    void               *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    ret_value = H5FD__writebehind_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_fapl_copy
+ *
+ * Purpose:     Copies the write-behind-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__writebehind_fapl_copy(const void *_old_fa)
+{
+    const H5FD_writebehind_fapl_t *old_fa = (const H5FD_writebehind_fapl_t *)_old_fa;
+    H5FD_writebehind_fapl_t       *new_fa = NULL;
+    H5P_genplist_t                *plist;
+    void                          *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(old_fa);
+
+    if (NULL == (new_fa = H5FL_CALLOC(H5FD_writebehind_fapl_t)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to allocate write-behind FAPL");
+
+    new_fa->buffer_size   = old_fa->buffer_size;
+    new_fa->under_fapl_id = H5I_INVALID_HID;
+
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(old_fa->under_fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if ((new_fa->under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, NULL, "can't copy underlying FAPL");
+
+    ret_value = new_fa;
+
+done:
+    if (NULL == ret_value && new_fa)
+        new_fa = H5FL_FREE(H5FD_writebehind_fapl_t, new_fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_fapl_free
+ *
+ * Purpose:     Frees the write-behind-specific file access properties.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_fapl_free(void *_fa)
+{
+    H5FD_writebehind_fapl_t *fa        = (H5FD_writebehind_fapl_t *)_fa;
+    herr_t                   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(fa);
+
+    if (H5I_dec_ref(fa->under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+
+    fa = H5FL_FREE(H5FD_writebehind_fapl_t, fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_fapl_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_sync_init
+ *
+ * Purpose:     Creates the locks and conditions of an open file and starts
+ *              its drain thread.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_sync_init(H5FD_writebehind_t *file)
+{
+    int    err;
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+    assert(!file->sync_init);
+
+    if (0 != (err = pthread_mutex_init(&file->mutex, NULL)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize staging mutex, error = %d", err);
+    if (0 != (err = pthread_mutex_init(&file->io_mutex, NULL))) {
+        pthread_mutex_destroy(&file->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize I/O mutex, error = %d", err);
+    }
+    if (0 != (err = pthread_cond_init(&file->work_cv, NULL))) {
+        pthread_mutex_destroy(&file->io_mutex);
+        pthread_mutex_destroy(&file->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize staging condition, error = %d", err);
+    }
+    if (0 != (err = pthread_cond_init(&file->space_cv, NULL))) {
+        pthread_cond_destroy(&file->work_cv);
+        pthread_mutex_destroy(&file->io_mutex);
+        pthread_mutex_destroy(&file->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't initialize staging condition, error = %d", err);
+    }
+    file->sync_init = TRUE;
+
+    if (0 != (err = pthread_create(&file->thread, NULL, H5FD__writebehind_worker, file)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, FAIL, "can't start drain thread, error = %d", err);
+    file->thread_run = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_sync_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_sync_term
+ *
+ * Purpose:     Stops and joins the drain thread, which first stores any
+ *              writes still staged, and destroys the locks and conditions.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__writebehind_sync_term(H5FD_writebehind_t *file)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(file);
+
+    if (file->sync_init) {
+        if (file->thread_run) {
+            pthread_mutex_lock(&file->mutex);
+            file->shutdown = TRUE;
+            pthread_cond_signal(&file->work_cv);
+            pthread_mutex_unlock(&file->mutex);
+
+            pthread_join(file->thread, NULL);
+            file->thread_run = FALSE;
+        }
+
+        pthread_cond_destroy(&file->space_cv);
+        pthread_cond_destroy(&file->work_cv);
+        pthread_mutex_destroy(&file->io_mutex);
+        pthread_mutex_destroy(&file->mutex);
+        file->sync_init = FALSE;
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__writebehind_sync_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_worker
+ *
+ * Purpose:     Body of the drain thread: stores staged writes in queue
+ *              order until the file is closed.  Runs of staged writes that
+ *              are adjacent both in the file and in the staging buffer are
+ *              stored with a single call.  After a write fails the rest of
+ *              the queue is discarded, and the failure is reported to the
+ *              application by the next write or barrier.
+ *
+ *              The library isn't entered from here except through the
+ *              underlying driver's write callback.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__writebehind_worker(void *_file)
+{
+    H5FD_writebehind_t *file = (H5FD_writebehind_t *)_file;
+    H5FD_t             *under = file->under;
+
+    pthread_mutex_lock(&file->mutex);
+    for (;;) {
+        const H5FD_writebehind_rec_t *rec;
+        H5FD_mem_t                    type;
+        haddr_t                       addr;
+        size_t                        size, offset;
+        size_t                        n;
+        hbool_t                       skip;
+        herr_t                        status = SUCCEED;
+
+        while (!file->shutdown && 0 == file->nrecs)
+            pthread_cond_wait(&file->work_cv, &file->mutex);
+        if (0 == file->nrecs)
+            break;
+
+        /* Collect the run of writes to store */
+        rec    = &file->recs[file->first];
+        type   = rec->type;
+        addr   = rec->addr;
+        size   = rec->size;
+        offset = rec->offset;
+        for (n = 1; n < file->nrecs; n++) {
+            rec = &file->recs[(file->first + n) % H5FD_WRITEBEHIND_MAX_PENDING];
+            if (rec->type != type || rec->addr != addr + size || rec->offset != offset + size ||
+                rec->size > (size_t)H5_POSIX_MAX_IO_BYTES - size)
+                break;
+            size += rec->size;
+        }
+        file->nbusy = n;
+        skip        = file->failed;
+        pthread_mutex_unlock(&file->mutex);
+
+        if (!skip) {
+            pthread_mutex_lock(&file->io_mutex);
+            status = (under->cls->write)(under, type, H5P_DATASET_XFER_DEFAULT, addr + under->base_addr, size,
+                                         file->stage + offset);
+            pthread_mutex_unlock(&file->io_mutex);
+        }
+
+        /* Retire the run.  The I/O lock was released first, so a reader
+         * holding it may briefly see the run both stored and staged, which
+         * is harmless as the staged data is what was stored.
+         */
+        pthread_mutex_lock(&file->mutex);
+        if (status < 0 && !file->failed) {
+            file->failed      = TRUE;
+            file->failed_addr = addr;
+        }
+        while (n-- > 0) {
+            rec        = &file->recs[file->first];
+            file->head = rec->offset + rec->size;
+            file->used -= rec->charge;
+            file->first = (file->first + 1) % H5FD_WRITEBEHIND_MAX_PENDING;
+            file->nrecs--;
+        }
+        file->nbusy = 0;
+        if (0 == file->nrecs)
+            file->head = file->tail = file->used = 0;
+        pthread_cond_broadcast(&file->space_cv);
+    }
+    pthread_mutex_unlock(&file->mutex);
+
+    return NULL;
+} /* end H5FD__writebehind_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_drain
+ *
+ * Purpose:     Waits until every staged write has been stored.  This is
+ *              the barrier used before flushing, truncating and closing.
+ *
+ * Return:      SUCCEED/FAIL; fails if any staged write failed
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_drain(H5FD_writebehind_t *file)
+{
+    hbool_t failed;
+    haddr_t failed_addr;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    pthread_mutex_lock(&file->mutex);
+    while (file->nrecs > 0)
+        pthread_cond_wait(&file->space_cv, &file->mutex);
+    failed      = file->failed;
+    failed_addr = file->failed_addr;
+    pthread_mutex_unlock(&file->mutex);
+
+    if (failed)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "deferred write failed, addr = %llu",
+                    (unsigned long long)failed_addr);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_drain() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_open
+ *
+ * Purpose:     Opens the file with the underlying driver, allocates the
+ *              staging buffer and starts the drain thread.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__writebehind_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_writebehind_t            *file = NULL; /* write-behind VFD info */
+    const H5FD_writebehind_fapl_t *fa   = NULL; /* write-behind info from property list */
+    H5FD_writebehind_fapl_t        default_fa;
+    H5P_genplist_t                *plist; /* Property list pointer */
+    H5FD_t                        *ret_value = NULL;
+
+    FUNC_ENTER_PACKAGE
+
+    default_fa.under_fapl_id = H5I_INVALID_HID;
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name");
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr");
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr");
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_writebehind_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (H5FD__writebehind_populate_config(H5P_DEFAULT, 0, &default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, NULL, "can't initialize driver configuration info");
+        fa = &default_fa;
+    }
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_writebehind_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct");
+    file->fa.buffer_size   = fa->buffer_size;
+    file->fa.under_fapl_id = H5I_INVALID_HID;
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fa->under_fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list");
+    if ((file->fa.under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCOPY, NULL, "can't copy underlying FAPL");
+
+    if (NULL == (file->stage = (unsigned char *)H5MM_malloc(file->fa.buffer_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate staging buffer");
+    if (NULL == (file->recs = (H5FD_writebehind_rec_t *)H5MM_malloc(H5FD_WRITEBEHIND_MAX_PENDING *
+                                                                     sizeof(H5FD_writebehind_rec_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate staged write queue");
+
+    if (NULL == (file->under = H5FD_open(name, flags, file->fa.under_fapl_id, HADDR_UNDEF)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTOPENFILE, NULL, "unable to open underlying file");
+
+    if (H5FD__writebehind_sync_init(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "can't start drain thread");
+
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (H5I_INVALID_HID != default_fa.under_fapl_id && H5I_dec_ref(default_fa.under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, NULL, "can't close underlying FAPL");
+
+    if (NULL == ret_value && file) {
+        H5FD__writebehind_sync_term(file);
+        if (file->under)
+            H5FD_close(file->under);
+        if (H5I_INVALID_HID != file->fa.under_fapl_id)
+            H5I_dec_ref(file->fa.under_fapl_id);
+        H5MM_xfree(file->recs);
+        H5MM_xfree(file->stage);
+        file = H5FL_FREE(H5FD_writebehind_t, file);
+    }
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_close
+ *
+ * Purpose:     Stores all staged writes, stops the drain thread and
+ *              closes the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_close(H5FD_t *_file)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    /* Wait for the staged writes, but release everything regardless */
+    if (H5FD__writebehind_drain(file) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to store staged writes");
+
+    H5FD__writebehind_sync_term(file);
+
+    if (H5FD_close(file->under) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close underlying file");
+    if (H5I_dec_ref(file->fa.under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+
+    H5MM_xfree(file->recs);
+    H5MM_xfree(file->stage);
+    file = H5FL_FREE(H5FD_writebehind_t, file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver by comparing
+ *              their underlying files.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__writebehind_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_writebehind_t *f1        = (const H5FD_writebehind_t *)_f1;
+    const H5FD_writebehind_t *f2        = (const H5FD_writebehind_t *)_f2;
+    int                       ret_value = 0;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    ret_value = H5FD_cmp(f1->under, f2->under);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              The features are those of the underlying driver, except
+ *              for SWMR, whose readers must see each write once it has
+ *              returned.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_writebehind_t *file      = (const H5FD_writebehind_t *)_file;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (flags) {
+        *flags = 0;
+        if (file) {
+            if (H5FD_driver_query(file->under->cls, flags) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to query underlying driver");
+            *flags &= ~(unsigned long)H5FD_FEAT_SUPPORTS_SWMR_IO;
+        }
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file, which is kept
+ *              by the underlying driver.  The drain thread never changes
+ *              it, so no lock is needed.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__writebehind_get_eoa(const H5FD_t *_file, H5FD_mem_t type)
+{
+    const H5FD_writebehind_t *file      = (const H5FD_writebehind_t *)_file;
+    haddr_t                   ret_value = HADDR_UNDEF; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (HADDR_UNDEF == (ret_value = H5FD_get_eoa(file->under, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, HADDR_UNDEF, "unable to get underlying eoa");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file.  Staged writes
+ *              past a lowered marker are stored first, so the underlying
+ *              driver never sees a write beyond its end of address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (addr < file->pending_eof && H5FD__writebehind_drain(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to store staged writes");
+
+    pthread_mutex_lock(&file->io_mutex);
+    ret_value = H5FD_set_eoa(file->under, type, addr);
+    pthread_mutex_unlock(&file->io_mutex);
+    if (ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "unable to set underlying eoa");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, counting the staged writes
+ *              as if they had been stored.
+ *
+ * Return:      Success:    The end-of-file marker.
+ *              Failure:    HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__writebehind_get_eof(const H5FD_t *_file, H5FD_mem_t type)
+{
+    H5FD_writebehind_t *file;
+    haddr_t             ret_value = HADDR_UNDEF; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* The I/O lock must be taken even though the file isn't modified */
+    H5_GCC_CLANG_DIAG_OFF("cast-qual")
+    file = (H5FD_writebehind_t *)_file;
+    H5_GCC_CLANG_DIAG_ON("cast-qual")
+
+    pthread_mutex_lock(&file->io_mutex);
+    ret_value = H5FD_get_eof(file->under, type);
+    pthread_mutex_unlock(&file->io_mutex);
+    if (HADDR_UNDEF == ret_value)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, HADDR_UNDEF, "unable to get underlying eof");
+
+    ret_value = MAX(ret_value, file->pending_eof);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_get_handle
+ *
+ * Purpose:     Returns the file handle of the underlying driver, once the
+ *              staged writes have been stored.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid");
+
+    /* The caller may access the file directly */
+    if (H5FD__writebehind_drain(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to store staged writes");
+
+    if (H5FD_get_vfd_handle(file->under, file->fa.under_fapl_id, file_handle) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get handle of underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF.  The data is read from the underlying file
+ *              and then overlaid, oldest first, with the parts of any
+ *              staged writes that overlap it.  The I/O lock is held
+ *              throughout, so no staged write can be stored in between.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                       size_t size, void *buf /*out*/)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr);
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr);
+
+    pthread_mutex_lock(&file->io_mutex);
+
+    if ((ret_value = H5FD_read(file->under, type, addr, size, buf)) >= 0) {
+        pthread_mutex_lock(&file->mutex);
+        if (file->nrecs > 0 && addr < file->pending_hi && addr + size > file->pending_lo) {
+            size_t n;
+
+            for (n = 0; n < file->nrecs; n++) {
+                const H5FD_writebehind_rec_t *rec =
+                    &file->recs[(file->first + n) % H5FD_WRITEBEHIND_MAX_PENDING];
+                haddr_t lo, hi;
+
+                lo = MAX(addr, rec->addr);
+                hi = MIN(addr + size, rec->addr + rec->size);
+                if (lo < hi)
+                    H5MM_memcpy((unsigned char *)buf + (lo - addr),
+                                file->stage + rec->offset + (lo - rec->addr), (size_t)(hi - lo));
+            }
+        }
+        pthread_mutex_unlock(&file->mutex);
+    }
+
+    pthread_mutex_unlock(&file->io_mutex);
+
+    if (ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "underlying read failed");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_write
+ *
+ * Purpose:     Stages SIZE bytes of data from BUF for writing at address
+ *              ADDR and returns.  The call waits only while the staging
+ *              buffer is full.  A write larger than the whole staging
+ *              buffer is performed directly, after the staged writes.
+ *
+ *              The space is reserved under the staging lock and the data
+ *              copied without it, so the drain thread can keep retiring
+ *              writes meanwhile; the write is queued once the copy is
+ *              complete.  The library never makes two driver calls at
+ *              once, so nothing else is staged in between.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                        size_t size, const void *buf)
+{
+    H5FD_writebehind_t     *file = (H5FD_writebehind_t *)_file;
+    H5FD_writebehind_rec_t *rec;
+    size_t                  cap = file->fa.buffer_size;
+    size_t                  offset, charge;
+    hbool_t                 failed;
+    haddr_t                 failed_addr;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file && file->pub.cls);
+    assert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr);
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size);
+
+    if (0 == size)
+        HGOTO_DONE(SUCCEED);
+
+    /* Too large to stage: store it directly behind the staged writes */
+    if (size > cap) {
+        if (H5FD__writebehind_drain(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to store staged writes");
+
+        pthread_mutex_lock(&file->io_mutex);
+        ret_value = H5FD_write(file->under, type, addr, size, buf);
+        pthread_mutex_unlock(&file->io_mutex);
+        if (ret_value < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "underlying write failed");
+
+        file->pending_eof = MAX(file->pending_eof, addr + size);
+        HGOTO_DONE(SUCCEED);
+    }
+
+    /* Reserve staging space, waiting for the drain thread as needed */
+    pthread_mutex_lock(&file->mutex);
+    for (;;) {
+        if (file->failed)
+            break;
+        if (file->nrecs < H5FD_WRITEBEHIND_MAX_PENDING) {
+            if (file->tail > file->head || 0 == file->used) {
+                /* Free space at the end, and before the head */
+                if (cap - file->tail >= size) {
+                    offset = file->tail;
+                    charge = size;
+                    break;
+                }
+                if (file->head >= size) {
+                    offset = 0;
+                    charge = (cap - file->tail) + size;
+                    break;
+                }
+            }
+            else if (file->head - file->tail >= size) {
+                /* Free space between the tail and the head */
+                offset = file->tail;
+                charge = size;
+                break;
+            }
+        }
+        pthread_cond_wait(&file->space_cv, &file->mutex);
+    }
+    failed      = file->failed;
+    failed_addr = file->failed_addr;
+    if (!failed) {
+        file->tail = offset + size;
+        file->used += charge;
+    }
+    pthread_mutex_unlock(&file->mutex);
+
+    if (failed)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "deferred write failed, addr = %llu",
+                    (unsigned long long)failed_addr);
+
+    H5MM_memcpy(file->stage + offset, buf, size);
+
+    /* Queue the write */
+    pthread_mutex_lock(&file->mutex);
+    rec         = &file->recs[(file->first + file->nrecs) % H5FD_WRITEBEHIND_MAX_PENDING];
+    rec->type   = type;
+    rec->addr   = addr;
+    rec->size   = size;
+    rec->offset = offset;
+    rec->charge = charge;
+    if (0 == file->nrecs) {
+        file->pending_lo = addr;
+        file->pending_hi = addr + size;
+    }
+    else {
+        file->pending_lo = MIN(file->pending_lo, addr);
+        file->pending_hi = MAX(file->pending_hi, addr + size);
+    }
+    file->nrecs++;
+    pthread_cond_signal(&file->work_cv);
+    pthread_mutex_unlock(&file->mutex);
+
+    file->pending_eof = MAX(file->pending_eof, addr + size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_flush
+ *
+ * Purpose:     Stores all staged writes and flushes the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5FD__writebehind_drain(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to store staged writes");
+
+    pthread_mutex_lock(&file->io_mutex);
+    ret_value = H5FD_flush(file->under, closing);
+    pthread_mutex_unlock(&file->io_mutex);
+    if (ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFLUSH, FAIL, "unable to flush underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_truncate
+ *
+ * Purpose:     Stores all staged writes and truncates the underlying file
+ *              to its end of address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (H5FD__writebehind_drain(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to store staged writes");
+
+    pthread_mutex_lock(&file->io_mutex);
+    ret_value = H5FD_truncate(file->under, closing);
+    pthread_mutex_unlock(&file->io_mutex);
+    if (ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTUPDATE, FAIL, "unable to truncate underlying file");
+
+    /* Everything staged is now in the file */
+    file->pending_eof = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_lock
+ *
+ * Purpose:     Places a lock on the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    pthread_mutex_lock(&file->io_mutex);
+    ret_value = H5FD_lock(file->under, rw);
+    pthread_mutex_unlock(&file->io_mutex);
+    if (ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_unlock
+ *
+ * Purpose:     Removes the lock on the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_unlock(H5FD_t *_file)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    pthread_mutex_lock(&file->io_mutex);
+    ret_value = H5FD_unlock(file->under);
+    pthread_mutex_unlock(&file->io_mutex);
+    if (ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock underlying file");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_unlock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_ctl
+ *
+ * Purpose:     Passes requests for the terminal driver down to the
+ *              underlying file, after the staged writes have been stored.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_ctl(H5FD_t *_file, uint64_t op_code, uint64_t flags, const void *input, void **output)
+{
+    H5FD_writebehind_t *file      = (H5FD_writebehind_t *)_file;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(file);
+
+    if (flags & H5FD_CTL_ROUTE_TO_TERMINAL_VFD_FLAG) {
+        if (H5FD__writebehind_drain(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to store staged writes");
+
+        pthread_mutex_lock(&file->io_mutex);
+        ret_value = H5FD_ctl(file->under, op_code, flags, input, output);
+        pthread_mutex_unlock(&file->io_mutex);
+        if (ret_value < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_FCNTL, FAIL, "VFD ctl request failed");
+    }
+    else if (flags & H5FD_CTL_FAIL_IF_UNKNOWN_FLAG)
+        HGOTO_ERROR(H5E_VFL, H5E_FCNTL, FAIL,
+                    "VFD ctl request failed (unknown op code and fail if unknown flag is set)");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_ctl() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__writebehind_delete
+ *
+ * Purpose:     Deletes a file through the underlying driver.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__writebehind_delete(const char *filename, hid_t fapl_id)
+{
+    const H5FD_writebehind_fapl_t *fa = NULL;
+    H5FD_writebehind_fapl_t        default_fa;
+    H5P_genplist_t                *plist;
+    herr_t                         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(filename);
+
+    default_fa.under_fapl_id = H5I_INVALID_HID;
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if (NULL == (fa = (const H5FD_writebehind_fapl_t *)H5P_peek_driver_info(plist))) {
+        if (H5FD__writebehind_populate_config(H5P_DEFAULT, 0, &default_fa) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "can't initialize driver configuration info");
+        fa = &default_fa;
+    }
+
+    if (H5FD_delete(filename, fa->under_fapl_id) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTDELETEFILE, FAIL, "unable to delete file");
+
+done:
+    if (H5I_INVALID_HID != default_fa.under_fapl_id && H5I_dec_ref(default_fa.under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close underlying FAPL");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__writebehind_delete() */
+
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
@@ -0,0 +1,109 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the write-behind driver.
+ */
+#ifndef H5FDwritebehind_H
+#define H5FDwritebehind_H
+
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+#define H5FD_WRITEBEHIND       (H5FDperform_init(H5FD_writebehind_init))
+#define H5FD_WRITEBEHIND_VALUE H5_VFD_WRITEBEHIND
+#else
+#define H5FD_WRITEBEHIND       (H5I_INVALID_HID)
+#define H5FD_WRITEBEHIND_VALUE H5_VFD_INVALID
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
+
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default size of the staging buffer.  Application can set this value
+ * through H5Pset_fapl_writebehind. */
+#define H5FD_WRITEBEHIND_BUFFER_SIZE_DEF (64 * 1024 * 1024)
+
+H5_DLL hid_t H5FD_writebehind_init(void);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets up use of the write-behind driver
+ *
+ * \fapl_id
+ * \param[in] under_fapl_id File access property list for the driver that
+ *                          performs the I/O
+ * \param[in] buffer_size Size of the staging buffer, in bytes
+ * \returns \herr_t
+ *
+ * \details H5Pset_fapl_writebehind() sets the file access property list, \p
+ *          fapl_id, to use the write-behind driver, #H5FD_WRITEBEHIND. The
+ *          driver is stacked on top of the driver set in \p under_fapl_id,
+ *          which stores the file. Passing #H5P_DEFAULT for \p under_fapl_id
+ *          selects the sec2 driver.
+ *
+ *          Each write is copied into a staging buffer of \p buffer_size bytes
+ *          and the call returns at once. A background thread owned by the
+ *          open file passes the staged writes to the underlying driver in
+ *          the order they were made, so overlapping writes reach the file in
+ *          program order. A write waits only when the staging buffer is
+ *          full, and a write larger than the whole buffer is performed
+ *          directly once the staged writes have drained. Reads see the data
+ *          of staged writes that have not been stored yet.
+ *
+ *          Flushing, truncating and closing the file wait for all staged
+ *          writes to be stored first. A staged write that fails is reported
+ *          by the next write, flush, truncate or close of the file.
+ *
+ *          Passing 0 (zero) for \p buffer_size selects the default of 64 MiB.
+ *
+ *          The underlying driver's write callback runs on the background
+ *          thread, so only drivers that keep no state outside the open file
+ *          may be used: sec2 and, when it is built, io_uring.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pset_fapl_writebehind(hid_t fapl_id, hid_t under_fapl_id, size_t buffer_size);
+
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves write-behind driver settings
+ *
+ * \fapl_id
+ * \param[out] under_fapl_id File access property list for the driver that
+ *                           performs the I/O
+ * \param[out] buffer_size Size of the staging buffer, in bytes
+ * \returns \herr_t
+ *
+ * \details H5Pget_fapl_writebehind() retrieves the settings of the
+ *          write-behind driver, #H5FD_WRITEBEHIND, from the file access
+ *          property list \p fapl_id. The property list returned in \p
+ *          under_fapl_id is a copy and must be closed with H5Pclose().
+ *
+ *          See H5Pset_fapl_writebehind() for a discussion of these values.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pget_fapl_writebehind(hid_t fapl_id, hid_t *under_fapl_id /*out*/,
+                                      size_t *buffer_size /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
+
+#endif
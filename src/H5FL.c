@@ -113,6 +113,94 @@ struct H5FL_fac_node_t {
 /* The head of the list of factory things to garbage collect */
 static H5FL_fac_gc_list_t H5FL_fac_gc_head = {0, NULL};
 
+#ifdef H5_HAVE_MULTITHREAD
+/* Lock for the free lists, their garbage collection lists and the limits.
+ * It is recursive, as allocating from one free list may allocate from
+ * another one, or garbage collect all of them.
+ */
+static pthread_mutex_t H5FL_mutex_s;
+static H5TS_once_t     H5FL_mt_once_s = PTHREAD_ONCE_INIT;
+
+#define H5FL_LOCK(have_lock)                                                                                 \
+    do {                                                                                                     \
+        if (!(have_lock)) {                                                                                  \
+            H5FL__lock();                                                                                    \
+            (have_lock) = TRUE;                                                                              \
+        }                                                                                                    \
+    } while (0)
+#define H5FL_UNLOCK(have_lock)                                                                               \
+    do {                                                                                                     \
+        if (have_lock) {                                                                                     \
+            H5FL__unlock();                                                                                  \
+            (have_lock) = FALSE;                                                                             \
+        }                                                                                                    \
+    } while (0)
+#else /* H5_HAVE_MULTITHREAD */
+#define H5FL_LOCK(have_lock)   /* void */
+#define H5FL_UNLOCK(have_lock) /* void */
+#endif /* H5_HAVE_MULTITHREAD */
+
+/* In multi-thread builds, each thread keeps a small cache of freed blocks in
+ * front of the regular, block and array free lists, so most allocations and
+ * frees don't take the lock.  A thread returns the blocks of a free list to
+ * it in one batch when its cache for the list is full, when it needs the
+ * cache slot for another list, when it garbage collects and when it exits.
+ * (Not with allocation tracking, which needs the lock for every block.)
+ */
+#if defined(H5_HAVE_MULTITHREAD) && !defined(H5FL_TRACK)
+#define H5FL_TL_CACHE
+#endif
+
+#ifdef H5FL_TL_CACHE
+/* Number of slots in each thread's cache (a power of two) */
+#define H5FL_TL_NSLOTS 64
+
+/* Most blocks, and most bytes, a thread keeps for one free list */
+#define H5FL_TL_BATCH   32
+#define H5FL_TL_MEM_LIM (16 * 1024)
+
+/* Slot of a thread's cache for the blocks of free list 'h' with key 'k' */
+#define H5FL_TL_SLOT(cache, h, k)                                                                            \
+    (&(cache)->slot[(((uintptr_t)(h) >> 4) ^ (k) ^ ((k) >> 6) ^ ((k) >> 12)) & (H5FL_TL_NSLOTS - 1)])
+
+/* Kinds of free lists with blocks in the thread caches */
+typedef enum H5FL_tl_kind_t {
+    H5FL_TL_REG, /* Regular free list, the blocks are the objects */
+    H5FL_TL_BLK, /* Block free list, the blocks start with an H5FL_blk_list_t */
+    H5FL_TL_ARR  /* Array free list, the blocks start with an H5FL_arr_list_t */
+} H5FL_tl_kind_t;
+
+/* The blocks of one free list in a thread's cache */
+typedef struct H5FL_tl_slot_t {
+    void            *head;  /* Head of the free list, NULL when the slot is empty */
+    size_t           key;   /* Size of the blocks for block lists, # of elements for array lists */
+    H5FL_tl_kind_t   kind;  /* Kind of the free list */
+    unsigned         count; /* Number of blocks in the slot */
+    H5FL_reg_node_t *first; /* First block, linked to the next one through its first word */
+} H5FL_tl_slot_t;
+
+/* A thread's cache */
+typedef struct H5FL_tl_cache_t {
+    H5FL_tl_slot_t          slot[H5FL_TL_NSLOTS]; /* Blocks of the free lists */
+    hbool_t                 closing;              /* Whether the thread is exiting */
+    struct H5FL_tl_cache_t *next;                 /* Next cache in the list of all of them */
+    struct H5FL_tl_cache_t *prev;                 /* Previous cache in the list of all of them */
+} H5FL_tl_cache_t;
+
+/* Keys for each thread's cache and for how many times the thread has locked
+ * the free lists, and whether they could be created
+ */
+static H5TS_key_t H5FL_tl_key_s;
+static H5TS_key_t H5FL_tl_depth_key_s;
+static hbool_t    H5FL_tl_key_created_s = FALSE;
+
+/* Whether the calling thread has locked the free lists */
+#define H5FL_TL_LOCKED() (NULL != H5TS_get_thread_local_value(H5FL_tl_depth_key_s))
+
+/* The caches of all threads (protected by the lock) */
+static H5FL_tl_cache_t *H5FL_tl_caches_s = NULL;
+#endif /* H5FL_TL_CACHE */
+
 #ifdef H5FL_TRACK
 
 /* Extra headers needed */
@@ -141,6 +229,24 @@ static int              H5FL__arr_term(void);
 static herr_t           H5FL__fac_gc_list(H5FL_fac_head_t *head);
 static herr_t           H5FL__fac_gc(void);
 static int              H5FL__fac_term_all(void);
+static herr_t           H5FL__reg_put_batch(H5FL_reg_head_t *head, H5FL_reg_node_t *first, unsigned count);
+static herr_t H5FL__blk_put_batch(H5FL_blk_head_t *head, size_t size, H5FL_blk_list_t *first, unsigned count);
+static herr_t H5FL__arr_put_batch(H5FL_arr_head_t *head, size_t nelem, H5FL_arr_list_t *first,
+                                  unsigned count);
+#ifdef H5_HAVE_MULTITHREAD
+static void H5FL__mt_init(void);
+static void H5FL__lock(void);
+static void H5FL__unlock(void);
+#endif /* H5_HAVE_MULTITHREAD */
+#ifdef H5FL_TL_CACHE
+static H5FL_tl_cache_t *H5FL__tl_cache(hbool_t create);
+static void            *H5FL__tl_get(void *head, size_t key);
+static htri_t H5FL__tl_put(void *head, H5FL_tl_kind_t kind, size_t key, size_t size, size_t mem_lim,
+                           void *block);
+static herr_t H5FL__tl_return(H5FL_tl_slot_t *slot);
+static herr_t H5FL__tl_flush(H5FL_tl_cache_t *cache);
+static void   H5FL__tl_cache_free(void *cache);
+#endif /* H5FL_TL_CACHE */
 
 /* Declare a free list to manage the H5FL_blk_node_t struct */
 H5FL_DEFINE(H5FL_blk_node_t);
@@ -173,13 +279,37 @@ H5FL_DEFINE(H5FL_fac_head_t);
 int
 H5FL_term_package(void)
 {
-    int n = 0;
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    int                    n         = 0;
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
-        /* Garbage collect any nodes on the free lists */
-        (void)
-    H5FL_garbage_coll();
+    H5FL_LOCK(have_lock);
+
+#ifdef H5FL_TL_CACHE
+    {
+        H5FL_tl_cache_t *cache; /* Thread's cache */
+
+        /* Return the blocks in every thread's cache to the free lists */
+        for (cache = H5FL_tl_caches_s; cache; cache = cache->next)
+            (void)H5FL__tl_flush(cache);
+
+        /* Release this thread's cache.  Other threads release theirs when they exit. */
+        if (NULL != (cache = H5FL__tl_cache(FALSE))) {
+            if (cache->prev)
+                cache->prev->next = cache->next;
+            else
+                H5FL_tl_caches_s = cache->next;
+            if (cache->next)
+                cache->next->prev = cache->prev;
+            (void)H5TS_set_thread_local_value(H5FL_tl_key_s, NULL);
+            free(cache);
+        } /* end if */
+    }
+#endif /* H5FL_TL_CACHE */
+
+    /* Garbage collect any nodes on the free lists */
+    (void)H5FL_garbage_coll();
 
     /* Shut down the various kinds of free lists */
     n += H5FL__reg_term();
@@ -206,6 +336,8 @@ H5FL_term_package(void)
     }     /* end if */
 #endif    /* H5FL_TRACK */
 
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(n)
 } /* end H5FL_term_package() */
 
@@ -300,7 +432,11 @@ done:
 void *
 H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
 {
-    void *ret_value = NULL; /* Return value */
+#ifdef H5FL_TL_CACHE
+    htri_t cached; /* Whether the object is kept in the thread's cache */
+#endif
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    void                  *ret_value = NULL;  /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_reg_malloc/calloc
      * -NAF */
@@ -343,32 +479,81 @@ H5FL_reg_free(H5FL_reg_head_t *head, void *obj)
     /* Make certain that the free list is initialized */
     assert(head->init);
 
+#ifdef H5FL_TL_CACHE
+    /* Keep the object in this thread's cache, if there's room */
+    if ((cached = H5FL__tl_put(head, H5FL_TL_REG, (size_t)0, head->size, H5FL_reg_lst_mem_lim, obj)) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, NULL, "can't cache object");
+    if (cached)
+        HGOTO_DONE(NULL);
+#endif /* H5FL_TL_CACHE */
+
     /* Link into the free list */
-    ((H5FL_reg_node_t *)obj)->next = head->list;
+    H5FL_LOCK(have_lock);
+    if (H5FL__reg_put_batch(head, (H5FL_reg_node_t *)obj, 1) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, NULL, "can't put object on free list");
 
-    /* Point free list at the node freed */
-    head->list = (H5FL_reg_node_t *)obj;
+done:
+    H5FL_UNLOCK(have_lock);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL_reg_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__reg_put_batch
+ *
+ * Purpose:	Put a chain of objects, each linked to the next through its
+ *      first word, on a free list.  Then garbage collect if the free list
+ *      memory limits are exceeded.
+ *
+ *      The free lists must be locked.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__reg_put_batch(H5FL_reg_head_t *head, H5FL_reg_node_t *first, unsigned count)
+{
+    H5FL_reg_node_t *last      = first;   /* Last object of the chain */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Double check parameters */
+    assert(head);
+    assert(head->init);
+    assert(first);
+    assert(count > 0);
+
+    /* Find the last object of the chain */
+    for (unsigned u = 1; u < count; u++)
+        last = last->next;
+
+    /* Link the chain into the free list */
+    last->next = head->list;
+    head->list = first;
 
     /* Increment the number of blocks on free list */
-    head->onlist++;
+    head->onlist += count;
 
     /* Increment the amount of "regular" freed memory globally */
-    H5FL_reg_gc_head.mem_freed += head->size;
+    H5FL_reg_gc_head.mem_freed += count * head->size;
 
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if (head->onlist * head->size > H5FL_reg_lst_mem_lim)
         if (H5FL__reg_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
     /* Then check the global amount memory on regular free lists */
     if (H5FL_reg_gc_head.mem_freed > H5FL_reg_glb_mem_lim)
         if (H5FL__reg_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5FL_reg_free() */
+} /* end H5FL__reg_put_batch() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5FL_reg_malloc
@@ -383,40 +568,50 @@ done:
 void *
 H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS)
 {
-    void *ret_value = NULL; /* Pointer to object to return */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    void                  *ret_value = NULL;  /* Pointer to object to return */
 
     FUNC_ENTER_NOAPI(NULL)
 
     /* Double check parameters */
     assert(head);
 
-    /* Make certain the list is initialized first */
-    if (!head->init)
-        if (H5FL__reg_init(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'regular' blocks");
+#ifdef H5FL_TL_CACHE
+    /* Use an object from this thread's cache, if it has one */
+    ret_value = H5FL__tl_get(head, (size_t)0);
+#endif /* H5FL_TL_CACHE */
 
-    /* Check for nodes available on the free list first */
-    if (head->list != NULL) {
-        /* Get a pointer to the block on the free list */
-        ret_value = (void *)(head->list);
+    if (NULL == ret_value) {
+        H5FL_LOCK(have_lock);
 
-        /* Remove node from free list */
-        head->list = head->list->next;
+        /* Make certain the list is initialized first */
+        if (!head->init)
+            if (H5FL__reg_init(head) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'regular' blocks");
 
-        /* Decrement the number of blocks & memory on free list */
-        head->onlist--;
+        /* Check for nodes available on the free list first */
+        if (head->list != NULL) {
+            /* Get a pointer to the block on the free list */
+            ret_value = (void *)(head->list);
 
-        /* Decrement the amount of global "regular" free list memory in use */
-        H5FL_reg_gc_head.mem_freed -= (head->size);
-    } /* end if */
-    /* Otherwise allocate a node */
-    else {
-        if (NULL == (ret_value = H5FL__malloc(head->size)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
+            /* Remove node from free list */
+            head->list = head->list->next;
 
-        /* Increment the number of blocks allocated in list */
-        head->allocated++;
-    } /* end else */
+            /* Decrement the number of blocks & memory on free list */
+            head->onlist--;
+
+            /* Decrement the amount of global "regular" free list memory in use */
+            H5FL_reg_gc_head.mem_freed -= (head->size);
+        } /* end if */
+        /* Otherwise allocate a node */
+        else {
+            if (NULL == (ret_value = H5FL__malloc(head->size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
+
+            /* Increment the number of blocks allocated in list */
+            head->allocated++;
+        } /* end else */
+    } /* end if */
 
 #ifdef H5FL_TRACK
     /* Copy allocation location information */
@@ -441,6 +636,8 @@ H5FL_reg_malloc(H5FL_reg_head_t *head H5FL_TRACK_PARAMS)
 #endif /* H5FL_TRACK */
 
 done:
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_reg_malloc() */
 
@@ -771,14 +968,31 @@ done:
 htri_t
 H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
 {
-    H5FL_blk_node_t *free_list;        /* The free list of nodes of correct size */
-    htri_t           ret_value = FAIL; /* Return value */
+    H5FL_blk_node_t       *free_list;         /* The free list of nodes of correct size */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    htri_t                 ret_value = FAIL;  /* Return value */
 
     FUNC_ENTER_NOAPI_NOERR
 
     /* Double check parameters */
     assert(head);
 
+#ifdef H5FL_TL_CACHE
+    {
+        H5FL_tl_cache_t *cache = H5FL__tl_cache(FALSE); /* This thread's cache */
+        H5FL_tl_slot_t  *slot;                          /* Slot for blocks of this size */
+
+        /* Check this thread's cache first */
+        if (cache) {
+            slot = H5FL_TL_SLOT(cache, head, size);
+            if (slot->count > 0 && slot->head == head && slot->key == size)
+                HGOTO_DONE(TRUE);
+        } /* end if */
+    }
+#endif /* H5FL_TL_CACHE */
+
+    H5FL_LOCK(have_lock);
+
     /* check if there is a free list for blocks of this size */
     /* and if there are any blocks available on the list */
     if ((free_list = H5FL__blk_find_list(&(head->head), size)) != NULL && free_list->list != NULL)
@@ -786,6 +1000,11 @@ H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
     else
         ret_value = FALSE;
 
+#ifdef H5FL_TL_CACHE
+done:
+#endif /* H5FL_TL_CACHE */
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_blk_free_block_avail() */
 
@@ -805,9 +1024,10 @@ H5FL_blk_free_block_avail(H5FL_blk_head_t *head, size_t size)
 void *
 H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
 {
-    H5FL_blk_node_t *free_list;        /* The free list of nodes of correct size */
-    H5FL_blk_list_t *temp;             /* Temp. ptr to the new native list allocated */
-    void            *ret_value = NULL; /* Pointer to the block to return to the user */
+    H5FL_blk_node_t       *free_list;         /* The free list of nodes of correct size */
+    H5FL_blk_list_t       *temp      = NULL;  /* Temp. ptr to the new native list allocated */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    void                  *ret_value = NULL;  /* Pointer to the block to return to the user */
 
     FUNC_ENTER_NOAPI(NULL)
 
@@ -815,45 +1035,55 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
     assert(head);
     assert(size);
 
-    /* Make certain the list is initialized first */
-    if (!head->init)
-        if (H5FL__blk_init(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list");
-
-    /* check if there is a free list for blocks of this size */
-    /* and if there are any blocks available on the list */
-    if (NULL != (free_list = H5FL__blk_find_list(&(head->head), size)) && NULL != free_list->list) {
-        /* Remove the first node from the free list */
-        temp            = free_list->list;
-        free_list->list = free_list->list->next;
-
-        /* Decrement the number of blocks & memory used on free list */
-        free_list->onlist--;
-        head->onlist--;
-        head->list_mem -= size;
-
-        /* Decrement the amount of global "block" free list memory in use */
-        H5FL_blk_gc_head.mem_freed -= size;
-    } /* end if */
-    /* No free list available, or there are no nodes on the list, allocate a new node to give to the user */
-    else {
-        /* Check if there was no free list for native blocks of this size */
-        if (NULL == free_list)
-            /* Create a new list node and insert it to the queue */
-            free_list = H5FL__blk_create_list(&(head->head), size);
-        assert(free_list);
-
-        /* Allocate new node, with room for the page info header and the actual page data */
-        if (NULL ==
-            (temp = (H5FL_blk_list_t *)H5FL__malloc(sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE + size)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for chunk");
-
-        /* Increment the number of blocks of this size */
-        free_list->allocated++;
-
-        /* Increment the total number of blocks allocated */
-        head->allocated++;
-    } /* end else */
+#ifdef H5FL_TL_CACHE
+    /* Use a block from this thread's cache, if it has one */
+    temp = (H5FL_blk_list_t *)H5FL__tl_get(head, size);
+#endif /* H5FL_TL_CACHE */
+
+    if (NULL == temp) {
+        H5FL_LOCK(have_lock);
+
+        /* Make certain the list is initialized first */
+        if (!head->init)
+            if (H5FL__blk_init(head) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'block' list");
+
+        /* check if there is a free list for blocks of this size */
+        /* and if there are any blocks available on the list */
+        if (NULL != (free_list = H5FL__blk_find_list(&(head->head), size)) && NULL != free_list->list) {
+            /* Remove the first node from the free list */
+            temp            = free_list->list;
+            free_list->list = free_list->list->next;
+
+            /* Decrement the number of blocks & memory used on free list */
+            free_list->onlist--;
+            head->onlist--;
+            head->list_mem -= size;
+
+            /* Decrement the amount of global "block" free list memory in use */
+            H5FL_blk_gc_head.mem_freed -= size;
+        } /* end if */
+        /* No free list available, or there are no nodes on the list, allocate a new node to give to the user
+         */
+        else {
+            /* Check if there was no free list for native blocks of this size */
+            if (NULL == free_list)
+                /* Create a new list node and insert it to the queue */
+                free_list = H5FL__blk_create_list(&(head->head), size);
+            assert(free_list);
+
+            /* Allocate new node, with room for the page info header and the actual page data */
+            if (NULL ==
+                (temp = (H5FL_blk_list_t *)H5FL__malloc(sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE + size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for chunk");
+
+            /* Increment the number of blocks of this size */
+            free_list->allocated++;
+
+            /* Increment the total number of blocks allocated */
+            head->allocated++;
+        } /* end else */
+    }     /* end if */
 
     /* Initialize the block allocated */
     temp->size = size;
@@ -884,6 +1114,8 @@ H5FL_blk_malloc(H5FL_blk_head_t *head, size_t size H5FL_TRACK_PARAMS)
 #endif /* H5FL_TRACK */
 
 done:
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_blk_malloc() */
 
@@ -939,10 +1171,13 @@ done:
 void *
 H5FL_blk_free(H5FL_blk_head_t *head, void *block)
 {
-    H5FL_blk_node_t *free_list;        /* The free list of nodes of correct size */
-    H5FL_blk_list_t *temp;             /* Temp. ptr to the new free list node allocated */
-    size_t           free_size;        /* Size of the block freed */
-    void            *ret_value = NULL; /* Return value */
+    H5FL_blk_list_t *temp;      /* Temp. ptr to the new free list node allocated */
+    size_t           free_size; /* Size of the block freed */
+#ifdef H5FL_TL_CACHE
+    htri_t cached; /* Whether the block is kept in the thread's cache */
+#endif
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    void                  *ret_value = NULL;  /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_blk_malloc/calloc
      * -NAF */
@@ -957,6 +1192,9 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
         unsigned char *block_ptr = ((unsigned char *)block) - sizeof(H5FL_track_t);
         H5FL_track_t   trk;
 
+        /* The "outstanding allocations" list is shared */
+        H5FL_LOCK(have_lock);
+
         memcpy(&trk, block_ptr, sizeof(H5FL_track_t));
 
         /* Free tracking information about the allocation location */
@@ -996,39 +1234,91 @@ H5FL_blk_free(H5FL_blk_head_t *head, void *block)
     memset(temp, 255, free_size + sizeof(H5FL_blk_list_t) + H5FL_TRACK_SIZE);
 #endif /* H5FL_DEBUG */
 
+#ifdef H5FL_TL_CACHE
+    /* Keep the block in this thread's cache, if there's room */
+    if ((cached = H5FL__tl_put(head, H5FL_TL_BLK, free_size, free_size, H5FL_blk_lst_mem_lim, temp)) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, NULL, "can't cache block");
+    if (cached)
+        HGOTO_DONE(NULL);
+#endif /* H5FL_TL_CACHE */
+
+    /* Prepend the free'd native block to the front of the free list */
+    H5FL_LOCK(have_lock);
+    if (H5FL__blk_put_batch(head, free_size, temp, 1) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, NULL, "can't put block on free list");
+
+done:
+    H5FL_UNLOCK(have_lock);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL_blk_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__blk_put_batch
+ *
+ * Purpose:	Put a chain of blocks of one size, each linked to the next
+ *      through its header, on the free list for blocks of that size.
+ *      Then garbage collect if the free list memory limits are exceeded.
+ *
+ *      The free lists must be locked.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__blk_put_batch(H5FL_blk_head_t *head, size_t size, H5FL_blk_list_t *first, unsigned count)
+{
+    H5FL_blk_node_t *free_list;           /* The free list of nodes of correct size */
+    H5FL_blk_list_t *last      = first;   /* Last block of the chain */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Double check parameters */
+    assert(head);
+    assert(head->init);
+    assert(first);
+    assert(count > 0);
+
     /* Check if there is a free list for native blocks of this size */
-    if (NULL == (free_list = H5FL__blk_find_list(&(head->head), free_size)))
+    if (NULL == (free_list = H5FL__blk_find_list(&(head->head), size)))
         /* No free list available, create a new list node and insert it to the queue */
-        free_list = H5FL__blk_create_list(&(head->head), free_size);
+        free_list = H5FL__blk_create_list(&(head->head), size);
     if (NULL == free_list)
-        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "couldn't create new list node");
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't create new list node");
 
-    /* Prepend the free'd native block to the front of the free list */
-    temp->next      = free_list->list; /* Note: Overwrites the size field in union */
-    free_list->list = temp;
+    /* Find the last block of the chain */
+    for (unsigned u = 1; u < count; u++)
+        last = last->next;
+
+    /* Prepend the chain to the front of the free list */
+    last->next      = free_list->list; /* Note: Overwrites the size field in union */
+    free_list->list = first;
 
     /* Increment the number of blocks on free list */
-    free_list->onlist++;
-    head->onlist++;
-    head->list_mem += free_size;
+    free_list->onlist += count;
+    head->onlist += count;
+    head->list_mem += count * size;
 
     /* Increment the amount of "block" freed memory globally */
-    H5FL_blk_gc_head.mem_freed += free_size;
+    H5FL_blk_gc_head.mem_freed += count * size;
 
     /* Check for exceeding free list memory use limits */
     /* First check this particular list */
     if (head->list_mem > H5FL_blk_lst_mem_lim)
         if (H5FL__blk_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
     /* Then check the global amount memory on block free lists */
     if (H5FL_blk_gc_head.mem_freed > H5FL_blk_glb_mem_lim)
         if (H5FL__blk_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5FL_blk_free() */
+} /* end H5FL__blk_put_batch() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5FL_blk_realloc
@@ -1356,10 +1646,13 @@ done:
 void *
 H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
 {
-    H5FL_arr_list_t *temp;             /* Temp. ptr to the new free list node allocated */
-    size_t           mem_size;         /* Size of memory being freed */
-    size_t           free_nelem;       /* Number of elements in node being free'd */
-    void            *ret_value = NULL; /* Return value */
+    H5FL_arr_list_t *temp;       /* Temp. ptr to the new free list node allocated */
+    size_t           free_nelem; /* Number of elements in node being free'd */
+#ifdef H5FL_TL_CACHE
+    htri_t cached; /* Whether the array is kept in the thread's cache */
+#endif
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    void                  *ret_value = NULL;  /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_arr_malloc/calloc
      * -NAF */
@@ -1380,6 +1673,9 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
         unsigned char *block_ptr = ((unsigned char *)obj) - sizeof(H5FL_track_t);
         H5FL_track_t   trk;
 
+        /* The "outstanding allocations" list is shared */
+        H5FL_LOCK(have_lock);
+
         memcpy(&trk, block_ptr, sizeof(H5FL_track_t));
 
         /* Free tracking information about the allocation location */
@@ -1418,17 +1714,72 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
     /* Double-check that there is enough room for arrays of this size */
     assert((int)free_nelem <= head->maxelem);
 
+#ifdef H5FL_TL_CACHE
+    /* Keep the array in this thread's cache, if there's room */
+    if ((cached = H5FL__tl_put(head, H5FL_TL_ARR, free_nelem, head->list_arr[free_nelem].size,
+                               H5FL_arr_lst_mem_lim, temp)) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, NULL, "can't cache array");
+    if (cached)
+        HGOTO_DONE(NULL);
+#endif /* H5FL_TL_CACHE */
+
     /* Link into the free list */
-    temp->next = head->list_arr[free_nelem].list;
+    H5FL_LOCK(have_lock);
+    if (H5FL__arr_put_batch(head, free_nelem, temp, 1) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, NULL, "can't put array on free list");
 
-    /* Point free list at the node freed */
-    head->list_arr[free_nelem].list = temp;
+done:
+    H5FL_UNLOCK(have_lock);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL_arr_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__arr_put_batch
+ *
+ * Purpose:	Put a chain of arrays with the same number of elements, each
+ *      linked to the next through its header, on the free list for arrays
+ *      of that size.  Then garbage collect if the free list memory limits
+ *      are exceeded.
+ *
+ *      The free lists must be locked.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__arr_put_batch(H5FL_arr_head_t *head, size_t nelem, H5FL_arr_list_t *first, unsigned count)
+{
+    H5FL_arr_list_t *last = first;       /* Last array of the chain */
+    size_t           mem_size;           /* Size of memory being freed */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Double check parameters */
+    assert(head);
+    assert(head->init);
+    assert((int)nelem <= head->maxelem);
+    assert(first);
+    assert(count > 0);
+
+    /* Find the last array of the chain */
+    for (unsigned u = 1; u < count; u++)
+        last = last->next;
+
+    /* Link into the free list */
+    last->next = head->list_arr[nelem].list;
+
+    /* Point free list at the nodes freed */
+    head->list_arr[nelem].list = first;
 
-    /* Get the size of arrays with this many elements */
-    mem_size = head->list_arr[free_nelem].size;
+    /* Get the size of the arrays freed */
+    mem_size = count * head->list_arr[nelem].size;
 
     /* Increment the number of blocks & memory used on free list */
-    head->list_arr[free_nelem].onlist++;
+    head->list_arr[nelem].onlist += count;
     head->list_mem += mem_size;
 
     /* Increment the amount of "array" freed memory globally */
@@ -1438,16 +1789,16 @@ H5FL_arr_free(H5FL_arr_head_t *head, void *obj)
     /* First check this particular list */
     if (head->list_mem > H5FL_arr_lst_mem_lim)
         if (H5FL__arr_gc_list(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
     /* Then check the global amount memory on array free lists */
     if (H5FL_arr_gc_head.mem_freed > H5FL_arr_glb_mem_lim)
         if (H5FL__arr_gc() < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection failed during free");
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5FL_arr_free() */
+} /* end H5FL__arr_put_batch() */
 
 /*-------------------------------------------------------------------------
  * Function:	H5FL_arr_malloc
@@ -1462,9 +1813,10 @@ done:
 void *
 H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem H5FL_TRACK_PARAMS)
 {
-    H5FL_arr_list_t *new_obj;          /* Pointer to the new free list node allocated */
-    size_t           mem_size;         /* Size of memory block being recycled */
-    void            *ret_value = NULL; /* Pointer to the block to return */
+    H5FL_arr_list_t       *new_obj   = NULL;  /* Pointer to the new free list node allocated */
+    size_t                 mem_size;          /* Size of memory block being recycled */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    void                  *ret_value = NULL;  /* Pointer to the block to return */
 
     FUNC_ENTER_NOAPI(NULL)
 
@@ -1472,45 +1824,54 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem H5FL_TRACK_PARAMS)
     assert(head);
     assert(elem);
 
-    /* Make certain the list is initialized first */
-    if (!head->init)
-        if (H5FL__arr_init(head) < 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'array' blocks");
+#ifdef H5FL_TL_CACHE
+    /* Use an array from this thread's cache, if it has one */
+    new_obj = (H5FL_arr_list_t *)H5FL__tl_get(head, elem);
+#endif /* H5FL_TL_CACHE */
 
-    /* Sanity check that the number of elements is supported */
-    assert(elem <= (unsigned)head->maxelem);
+    if (NULL == new_obj) {
+        H5FL_LOCK(have_lock);
 
-    /* Get the set of the memory block */
-    mem_size = head->list_arr[elem].size;
+        /* Make certain the list is initialized first */
+        if (!head->init)
+            if (H5FL__arr_init(head) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, NULL, "can't initialize 'array' blocks");
 
-    /* Check for nodes available on the free list first */
-    if (head->list_arr[elem].list != NULL) {
-        /* Get a pointer to the block on the free list */
-        new_obj = head->list_arr[elem].list;
+        /* Sanity check that the number of elements is supported */
+        assert(elem <= (unsigned)head->maxelem);
 
-        /* Remove node from free list */
-        head->list_arr[elem].list = head->list_arr[elem].list->next;
+        /* Get the set of the memory block */
+        mem_size = head->list_arr[elem].size;
 
-        /* Decrement the number of blocks & memory used on free list */
-        head->list_arr[elem].onlist--;
-        head->list_mem -= mem_size;
+        /* Check for nodes available on the free list first */
+        if (head->list_arr[elem].list != NULL) {
+            /* Get a pointer to the block on the free list */
+            new_obj = head->list_arr[elem].list;
 
-        /* Decrement the amount of global "array" free list memory in use */
-        H5FL_arr_gc_head.mem_freed -= mem_size;
+            /* Remove node from free list */
+            head->list_arr[elem].list = head->list_arr[elem].list->next;
 
-    } /* end if */
-    /* Otherwise allocate a node */
-    else {
-        if (NULL ==
-            (new_obj = (H5FL_arr_list_t *)H5FL__malloc(sizeof(H5FL_arr_list_t) + H5FL_TRACK_SIZE + mem_size)))
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
+            /* Decrement the number of blocks & memory used on free list */
+            head->list_arr[elem].onlist--;
+            head->list_mem -= mem_size;
 
-        /* Increment the number of blocks of this size */
-        head->list_arr[elem].allocated++;
+            /* Decrement the amount of global "array" free list memory in use */
+            H5FL_arr_gc_head.mem_freed -= mem_size;
 
-        /* Increment the number of blocks allocated in list, of all sizes */
-        head->allocated++;
-    } /* end else */
+        } /* end if */
+        /* Otherwise allocate a node */
+        else {
+            if (NULL == (new_obj = (H5FL_arr_list_t *)H5FL__malloc(sizeof(H5FL_arr_list_t) +
+                                                                   H5FL_TRACK_SIZE + mem_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed");
+
+            /* Increment the number of blocks of this size */
+            head->list_arr[elem].allocated++;
+
+            /* Increment the number of blocks allocated in list, of all sizes */
+            head->allocated++;
+        } /* end else */
+    }     /* end if */
 
     /* Initialize the new object */
     new_obj->nelem = elem;
@@ -1541,6 +1902,8 @@ H5FL_arr_malloc(H5FL_arr_head_t *head, size_t elem H5FL_TRACK_PARAMS)
 #endif
 
 done:
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_arr_malloc() */
 
@@ -1943,15 +2306,18 @@ H5FL_seq_realloc(H5FL_seq_head_t *head, void *obj, size_t new_elem H5FL_TRACK_PA
 H5FL_fac_head_t *
 H5FL_fac_init(size_t size)
 {
-    H5FL_fac_gc_node_t *new_node  = NULL; /* Pointer to the node for the new list to garbage collect */
-    H5FL_fac_head_t    *factory   = NULL; /* Pointer to new block factory */
-    H5FL_fac_head_t    *ret_value = NULL; /* Return value */
+    H5FL_fac_gc_node_t    *new_node  = NULL;  /* Pointer to the node for the new list to garbage collect */
+    H5FL_fac_head_t       *factory   = NULL;  /* Pointer to new block factory */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    H5FL_fac_head_t       *ret_value = NULL;  /* Return value */
 
     FUNC_ENTER_NOAPI(NULL)
 
     /* Sanity check */
     assert(size > 0);
 
+    H5FL_LOCK(have_lock);
+
     /* Allocate room for the new factory */
     if (NULL == (factory = (H5FL_fac_head_t *)H5FL_CALLOC(H5FL_fac_head_t)))
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for factory object");
@@ -1995,6 +2361,7 @@ done:
         if (new_node)
             new_node = H5FL_FREE(H5FL_fac_gc_node_t, new_node);
     } /* end if */
+    H5FL_UNLOCK(have_lock);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_fac_init() */
@@ -2011,7 +2378,8 @@ done:
 void *
 H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
 {
-    void *ret_value = NULL; /* Return value */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    void                  *ret_value = NULL;  /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_fac_init -NAF */
     FUNC_ENTER_NOAPI_NOINIT
@@ -2020,6 +2388,8 @@ H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
     assert(head);
     assert(obj);
 
+    H5FL_LOCK(have_lock);
+
 #ifdef H5FL_TRACK
     {
         H5FL_track_t *trk = obj = ((unsigned char *)obj) - sizeof(H5FL_track_t);
@@ -2077,6 +2447,8 @@ H5FL_fac_free(H5FL_fac_head_t *head, void *obj)
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, NULL, "garbage collection failed during free");
 
 done:
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_fac_free() */
 
@@ -2093,7 +2465,8 @@ done:
 void *
 H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
 {
-    void *ret_value = NULL; /* Pointer to the block to return */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    void                  *ret_value = NULL;  /* Pointer to the block to return */
 
     /* NOINIT OK here because this must be called after H5FL_fac_init -NAF */
     FUNC_ENTER_NOAPI_NOINIT
@@ -2102,6 +2475,8 @@ H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
     assert(head);
     assert(head->init);
 
+    H5FL_LOCK(have_lock);
+
     /* Check for nodes available on the free list first */
     if (head->list != NULL) {
         /* Get a pointer to the block on the free list */
@@ -2148,6 +2523,8 @@ H5FL_fac_malloc(H5FL_fac_head_t *head H5FL_TRACK_PARAMS)
 #endif /* H5FL_TRACK */
 
 done:
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_fac_malloc() */
 
@@ -2279,7 +2656,8 @@ herr_t
 H5FL_fac_term(H5FL_fac_head_t *factory)
 {
     H5FL_fac_gc_node_t *tmp;                 /* Temporary pointer to a garbage collection node */
-    herr_t              ret_value = SUCCEED; /* Return value */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE;   /* Whether the free lists are locked */
+    herr_t                 ret_value = SUCCEED; /* Return value */
 
     /* NOINIT OK here because this must be called after H5FL_fac_init -NAF */
     FUNC_ENTER_NOAPI_NOINIT
@@ -2287,6 +2665,8 @@ H5FL_fac_term(H5FL_fac_head_t *factory)
     /* Sanity check */
     assert(factory);
 
+    H5FL_LOCK(have_lock);
+
     /* Garbage collect all the blocks in the factory's free list */
     if (H5FL__fac_gc_list(factory) < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "garbage collection of factory failed");
@@ -2320,6 +2700,8 @@ H5FL_fac_term(H5FL_fac_head_t *factory)
     factory = H5FL_FREE(H5FL_fac_head_t, factory);
 
 done:
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_fac_term() */
 
@@ -2377,10 +2759,23 @@ H5FL__fac_term_all(void)
 herr_t
 H5FL_garbage_coll(void)
 {
-    herr_t ret_value = SUCCEED;
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+    herr_t                 ret_value = SUCCEED;
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5FL_LOCK(have_lock);
+
+#ifdef H5FL_TL_CACHE
+    {
+        H5FL_tl_cache_t *cache = H5FL__tl_cache(FALSE); /* This thread's cache */
+
+        /* Return the blocks in this thread's cache to the free lists first */
+        if (cache && H5FL__tl_flush(cache) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't flush thread's free list cache");
+    }
+#endif /* H5FL_TL_CACHE */
+
     /* Garbage collect the free lists for array objects */
     if (H5FL__arr_gc() < 0)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect array objects");
@@ -2398,6 +2793,8 @@ H5FL_garbage_coll(void)
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGC, FAIL, "can't garbage collect factory objects");
 
 done:
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_garbage_coll() */
 
@@ -2429,10 +2826,13 @@ herr_t
 H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_lim, int arr_list_lim,
                           int blk_global_lim, int blk_list_lim, int fac_global_lim, int fac_list_lim)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE;   /* Whether the free lists are locked */
+    herr_t                 ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI_NOERR
 
+    H5FL_LOCK(have_lock);
+
     /* Set the limit variables */
     /* limit on all regular free lists */
     H5FL_reg_glb_mem_lim = (reg_global_lim == -1 ? UINT_MAX : (size_t)reg_global_lim);
@@ -2451,6 +2851,8 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
     /* limit on each factory free list */
     H5FL_fac_lst_mem_lim = (fac_list_lim == -1 ? UINT_MAX : (size_t)fac_list_lim);
 
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FL_set_free_list_limits() */
 
@@ -2476,8 +2878,12 @@ H5FL_set_free_list_limits(int reg_global_lim, int reg_list_lim, int arr_global_l
 herr_t
 H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size, size_t *fac_size)
 {
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE; /* Whether the free lists are locked */
+
     FUNC_ENTER_NOAPI_NOERR
 
+    H5FL_LOCK(have_lock);
+
     /* Retrieve the amount of "regular" memory used */
     if (reg_size) {
         H5FL_reg_gc_node_t *gc_node; /* Pointer into the list of lists */
@@ -2570,5 +2976,370 @@ H5FL_get_free_list_sizes(size_t *reg_size, size_t *arr_size, size_t *blk_size, s
         } /* end while */
     }     /* end if */
 
+    H5FL_UNLOCK(have_lock);
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5FL_get_free_list_sizes() */
+
+#ifdef H5_HAVE_MULTITHREAD
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__mt_init
+ *
+ * Purpose:	Create the lock for the free lists and the key for the
+ *      thread caches.  Called once, by the first thread to use either.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__mt_init(void)
+{
+    pthread_mutexattr_t attr; /* Attributes for the lock */
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    /* The lock is recursive */
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&H5FL_mutex_s, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+#ifdef H5FL_TL_CACHE
+    /* Without the keys, threads use the free lists directly */
+    if (0 == pthread_key_create(&H5FL_tl_key_s, H5FL__tl_cache_free)) {
+        if (0 == pthread_key_create(&H5FL_tl_depth_key_s, NULL))
+            H5FL_tl_key_created_s = TRUE;
+        else
+            pthread_key_delete(H5FL_tl_key_s);
+    } /* end if */
+#endif /* H5FL_TL_CACHE */
+
+    FUNC_LEAVE_NOAPI_VOID_NAMECHECK_ONLY
+} /* end H5FL__mt_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__lock
+ *
+ * Purpose:	Lock the free lists
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__lock(void)
+{
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    pthread_once(&H5FL_mt_once_s, H5FL__mt_init);
+    pthread_mutex_lock(&H5FL_mutex_s);
+
+#ifdef H5FL_TL_CACHE
+    /* Count the locks held by this thread */
+    if (H5FL_tl_key_created_s) {
+        void     *val   = H5TS_get_thread_local_value(H5FL_tl_depth_key_s);
+        uintptr_t depth = (uintptr_t)val;
+
+        (void)H5TS_set_thread_local_value(H5FL_tl_depth_key_s, (void *)(depth + 1));
+    } /* end if */
+#endif /* H5FL_TL_CACHE */
+
+    FUNC_LEAVE_NOAPI_VOID_NAMECHECK_ONLY
+} /* end H5FL__lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__unlock
+ *
+ * Purpose:	Unlock the free lists
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__unlock(void)
+{
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+#ifdef H5FL_TL_CACHE
+    if (H5FL_tl_key_created_s) {
+        void     *val   = H5TS_get_thread_local_value(H5FL_tl_depth_key_s);
+        uintptr_t depth = (uintptr_t)val;
+
+        assert(depth > 0);
+        (void)H5TS_set_thread_local_value(H5FL_tl_depth_key_s, (void *)(depth - 1));
+    } /* end if */
+#endif /* H5FL_TL_CACHE */
+
+    pthread_mutex_unlock(&H5FL_mutex_s);
+
+    FUNC_LEAVE_NOAPI_VOID_NAMECHECK_ONLY
+} /* end H5FL__unlock() */
+#endif /* H5_HAVE_MULTITHREAD */
+
+#ifdef H5FL_TL_CACHE
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tl_cache
+ *
+ * Purpose:	Get the calling thread's free list cache, creating it first
+ *      if it doesn't exist and CREATE is set.
+ *
+ * Return:	Success:	Pointer to the thread's cache
+ * 		Failure:	NULL, when the thread has no cache
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FL_tl_cache_t *
+H5FL__tl_cache(hbool_t create)
+{
+    H5FL_tl_cache_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    pthread_once(&H5FL_mt_once_s, H5FL__mt_init);
+    if (!H5FL_tl_key_created_s)
+        HGOTO_DONE(NULL);
+
+    ret_value = (H5FL_tl_cache_t *)H5TS_get_thread_local_value(H5FL_tl_key_s);
+    if (NULL == ret_value && create) {
+        /* Use calloc() and free() for the caches, as they are released when
+         * the threads exit, which may be after the library is shut down.
+         */
+        if (NULL == (ret_value = (H5FL_tl_cache_t *)calloc(1, sizeof(H5FL_tl_cache_t))))
+            HGOTO_DONE(NULL);
+        if (0 != H5TS_set_thread_local_value(H5FL_tl_key_s, ret_value)) {
+            free(ret_value);
+            HGOTO_DONE(NULL);
+        } /* end if */
+
+        /* Add the cache to the list of all of them */
+        H5FL__lock();
+        ret_value->next = H5FL_tl_caches_s;
+        if (H5FL_tl_caches_s)
+            H5FL_tl_caches_s->prev = ret_value;
+        H5FL_tl_caches_s = ret_value;
+        H5FL__unlock();
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__tl_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tl_get
+ *
+ * Purpose:	Take a block of the free list HEAD with KEY from the calling
+ *      thread's cache.
+ *
+ * Return:	Success:	Pointer to the block
+ * 		Failure:	NULL, when the cache has no such block
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FL__tl_get(void *head, size_t key)
+{
+    H5FL_tl_cache_t *cache;            /* This thread's cache */
+    H5FL_tl_slot_t  *slot;             /* Slot for the blocks of the free list */
+    void            *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (NULL == (cache = H5FL__tl_cache(FALSE)) || cache->closing)
+        HGOTO_DONE(NULL);
+
+    slot = H5FL_TL_SLOT(cache, head, key);
+    if (slot->count > 0 && slot->head == head && slot->key == key) {
+        ret_value   = slot->first;
+        slot->first = slot->first->next;
+        if (0 == --slot->count)
+            slot->head = NULL;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__tl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tl_put
+ *
+ * Purpose:	Keep BLOCK, of SIZE bytes, of the free list HEAD of kind KIND
+ *      with KEY in the calling thread's cache.  When the slot for the free
+ *      list holds the blocks of another free list, or is full, its blocks
+ *      are returned to their free list first.  MEM_LIM is the limit on the
+ *      memory of each free list of the kind; a slot never holds more.
+ *
+ *      Blocks freed while the thread has locked the free lists, for
+ *      instance during garbage collection, are not cached, as returning
+ *      a slot then could change the free list being worked on.
+ *
+ * Return:	Success:	TRUE when the block is in the cache, FALSE when
+ *                              it must go on the free list
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5FL__tl_put(void *head, H5FL_tl_kind_t kind, size_t key, size_t size, size_t mem_lim, void *block)
+{
+    H5FL_tl_cache_t *cache;             /* This thread's cache */
+    H5FL_tl_slot_t  *slot;              /* Slot for the blocks of the free list */
+    size_t           lim;               /* Most bytes in the slot */
+    htri_t           ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (NULL == (cache = H5FL__tl_cache(TRUE)) || cache->closing || H5FL_TL_LOCKED())
+        HGOTO_DONE(FALSE);
+
+    lim = MIN(H5FL_TL_MEM_LIM, mem_lim);
+    if (size > lim)
+        HGOTO_DONE(FALSE);
+
+    slot = H5FL_TL_SLOT(cache, head, key);
+    if (slot->count > 0 && (slot->head != head || slot->key != key || slot->count >= H5FL_TL_BATCH ||
+                            (slot->count + 1) * size > lim)) {
+        if (H5FL__tl_return(slot) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't return blocks to free list");
+    } /* end if */
+
+    /* Link the block into the slot */
+    ((H5FL_reg_node_t *)block)->next = slot->first;
+    slot->first                      = (H5FL_reg_node_t *)block;
+    slot->head                       = head;
+    slot->key                        = key;
+    slot->kind                       = kind;
+    slot->count++;
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__tl_put() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tl_return
+ *
+ * Purpose:	Return the blocks in a slot of a thread's cache to their free
+ *      list, in one batch.
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__tl_return(H5FL_tl_slot_t *slot)
+{
+    H5FL_tl_slot_t         blocks;              /* Blocks to return */
+    hbool_t H5_ATTR_UNUSED have_lock = FALSE;   /* Whether the free lists are locked */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (0 == slot->count)
+        HGOTO_DONE(SUCCEED);
+
+    /* Empty the slot before returning its blocks, in case that frees others */
+    blocks      = *slot;
+    slot->head  = NULL;
+    slot->first = NULL;
+    slot->count = 0;
+
+    H5FL_LOCK(have_lock);
+    switch (blocks.kind) {
+        case H5FL_TL_REG:
+            if (H5FL__reg_put_batch((H5FL_reg_head_t *)blocks.head, blocks.first, blocks.count) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't put objects on free list");
+            break;
+
+        case H5FL_TL_BLK:
+            if (H5FL__blk_put_batch((H5FL_blk_head_t *)blocks.head, blocks.key,
+                                    (H5FL_blk_list_t *)blocks.first, blocks.count) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't put blocks on free list");
+            break;
+
+        case H5FL_TL_ARR:
+            if (H5FL__arr_put_batch((H5FL_arr_head_t *)blocks.head, blocks.key,
+                                    (H5FL_arr_list_t *)blocks.first, blocks.count) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't put arrays on free list");
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_RESOURCE, H5E_BADVALUE, FAIL, "invalid kind of free list");
+    } /* end switch */
+
+done:
+    H5FL_UNLOCK(have_lock);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__tl_return() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tl_flush
+ *
+ * Purpose:	Return all the blocks in a thread's cache to their free lists
+ *
+ * Return:	Success:	Non-negative
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FL__tl_flush(H5FL_tl_cache_t *cache)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    for (u = 0; u < H5FL_TL_NSLOTS; u++)
+        if (H5FL__tl_return(&cache->slot[u]) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't return blocks to free list");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FL__tl_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FL__tl_cache_free
+ *
+ * Purpose:	Return the blocks in an exiting thread's cache to their free
+ *      lists and release the cache.  Called by each thread as it exits.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FL__tl_cache_free(void *_cache)
+{
+    H5FL_tl_cache_t *cache = (H5FL_tl_cache_t *)_cache;
+
+    FUNC_ENTER_PACKAGE_NAMECHECK_ONLY
+
+    /* Re-publish the cache while returning its blocks, but keep other
+     * blocks out of it
+     */
+    (void)H5TS_set_thread_local_value(H5FL_tl_key_s, cache);
+    cache->closing = TRUE;
+
+    H5FL__lock();
+    (void)H5FL__tl_flush(cache);
+
+    /* Remove the cache from the list of all of them */
+    if (cache->prev)
+        cache->prev->next = cache->next;
+    else
+        H5FL_tl_caches_s = cache->next;
+    if (cache->next)
+        cache->next->prev = cache->prev;
+    H5FL__unlock();
+
+    (void)H5TS_set_thread_local_value(H5FL_tl_key_s, NULL);
+    free(cache);
+
+    FUNC_LEAVE_NOAPI_VOID_NAMECHECK_ONLY
+} /* end H5FL__tl_cache_free() */
+#endif /* H5FL_TL_CACHE */
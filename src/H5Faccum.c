@@ -46,6 +46,20 @@
 #define H5F_ACCUM_THRESHOLD 2048
 #define H5F_ACCUM_MAX_SIZE  (1024 * 1024) /* Max. accum. buf size (max. I/Os will be 1/2 this size) */
 
+/* Max. size of a dirty extent that is set aside instead of being written out */
+#define H5F_ACCUM_REGION_MAX_SIZE (H5F_ACCUM_MAX_SIZE / 16)
+
+/* Check if a block adjoins or overlaps a block of metadata */
+#define H5F_ACCUM_TOUCHES(addr, size, loc, len)                                                              \
+    (H5_addr_overlap((addr), (size), (loc), (len)) || ((addr) + (size)) == (loc) || ((loc) + (len)) == (addr))
+
+/* Track writes of dirty metadata */
+#define H5F_ACCUM_STATS_WRITE(accum, n)                                                                      \
+    do {                                                                                                     \
+        (accum)->flushes++;                                                                                  \
+        (accum)->flushed_regions += (n);                                                                     \
+    } while (0)
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -63,6 +77,11 @@ typedef enum {
 /********************/
 /* Local Prototypes */
 /********************/
+static void   H5F__accum_region_remove(H5F_meta_accum_t *accum, unsigned idx, hbool_t free_buf);
+static herr_t H5F__accum_region_write(H5FD_t *file, H5F_meta_accum_t *accum, unsigned idx);
+static herr_t H5F__accum_flush_regions(H5FD_t *file, H5F_meta_accum_t *accum, haddr_t addr, size_t size);
+static herr_t H5F__accum_park(H5F_shared_t *f_sh, H5F_meta_accum_t *accum);
+static herr_t H5F__accum_swap(H5F_shared_t *f_sh, H5F_meta_accum_t *accum, unsigned idx);
 
 /*********************/
 /* Package Variables */
@@ -119,6 +138,26 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
             /* Sanity check */
             assert(!accum->buf || (accum->alloc_size >= accum->size));
 
+            /* Check the dirty regions set aside by the accumulator */
+            if (accum->nregions > 0) {
+                unsigned u; /* Local index variable */
+
+                /* Check for the read falling entirely within a dirty region */
+                for (u = 0; u < accum->nregions; u++)
+                    if (H5_addr_le(accum->regions[u].loc, addr) &&
+                        H5_addr_le(addr + size, accum->regions[u].loc + accum->regions[u].size)) {
+                        /* Copy the data out of the region */
+                        H5MM_memcpy(buf, accum->regions[u].buf + (addr - accum->regions[u].loc), size);
+                        HGOTO_DONE(SUCCEED);
+                    } /* end if */
+
+                /* Write out any dirty regions the read overlaps, so the read
+                 * (and the accumulator, if the read extends it) sees them
+                 */
+                if (H5F__accum_flush_regions(file, accum, addr, size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata regions");
+            } /* end if */
+
             /* Current read adjoins or overlaps with metadata accumulator */
             if (H5_addr_defined(accum->loc) &&
                 (H5_addr_overlap(addr, size, accum->loc, accum->size) || ((addr + size) == accum->loc) ||
@@ -198,6 +237,11 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
             } /* end else */
         }     /* end if */
         else {
+            /* Write out any dirty regions the read overlaps */
+            if (accum->nregions > 0)
+                if (H5F__accum_flush_regions(file, accum, addr, size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata regions");
+
             /* Read the data */
             if (H5FD_read(file, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed");
@@ -331,6 +375,7 @@ H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file, H5F_accum_adjust_t adju
                         if (H5FD_write(file, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off),
                                        accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
                             HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "file write failed");
+                        H5F_ACCUM_STATS_WRITE(accum, 1);
 
                         /* Reset accumulator dirty flag */
                         accum->dirty = FALSE;
@@ -344,6 +389,7 @@ H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file, H5F_accum_adjust_t adju
                         if (H5FD_write(file, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off),
                                        accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
                             HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "file write failed");
+                        H5F_ACCUM_STATS_WRITE(accum, 1);
 
                         /* Reset accumulator dirty flag */
                         accum->dirty = FALSE;
@@ -425,6 +471,29 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
             /* Sanity check */
             assert(!accum->buf || (accum->alloc_size >= accum->size));
 
+            /* Check the dirty regions set aside by the accumulator */
+            if (accum->nregions > 0) {
+                /* Check if the new metadata misses the accumulator but adjoins
+                 * or overlaps a dirty region, and switch to that region if so
+                 */
+                if (!(accum->size > 0 && H5_addr_defined(accum->loc) &&
+                      H5F_ACCUM_TOUCHES(addr, size, accum->loc, accum->size))) {
+                    unsigned u; /* Local index variable */
+
+                    for (u = 0; u < accum->nregions; u++)
+                        if (H5F_ACCUM_TOUCHES(addr, size, accum->regions[u].loc, accum->regions[u].size)) {
+                            if (H5F__accum_swap(f_sh, accum, u) < 0)
+                                HGOTO_ERROR(H5E_IO, H5E_CANTUPDATE, FAIL,
+                                            "can't switch to dirty metadata region");
+                            break;
+                        } /* end if */
+                }         /* end if */
+
+                /* Write out any other dirty regions the new metadata overlaps */
+                if (H5F__accum_flush_regions(file, accum, addr, size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata regions");
+            } /* end if */
+
             /* Check if there is already metadata in the accumulator */
             if (accum->size > 0) {
                 /* Check if the new metadata adjoins the beginning of the current accumulator */
@@ -625,15 +694,10 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 }     /* end if */
                 /* New piece of metadata doesn't adjoin or overlap the existing accumulator */
                 else {
-                    /* Write out the existing metadata accumulator, with dispatch to driver */
-                    if (accum->dirty) {
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off,
-                                       accum->dirty_len, accum->buf + accum->dirty_off) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
-
-                        /* Reset accumulator dirty flag */
-                        accum->dirty = FALSE;
-                    } /* end if */
+                    /* Set aside (or write out) the existing dirty metadata */
+                    if (accum->dirty)
+                        if (H5F__accum_park(f_sh, accum) < 0)
+                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't set aside dirty metadata");
 
                     /* Cache the new piece of metadata */
                     /* Check if we need to resize the buffer */
@@ -727,6 +791,11 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 if (H5F__accum_reset(f_sh, TRUE) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator");
 
+            /* Write out any dirty regions the new metadata overlaps */
+            if (accum->nregions > 0)
+                if (H5F__accum_flush_regions(file, accum, addr, size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata regions");
+
             /* Write the data */
             if (H5FD_write(file, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
@@ -928,6 +997,7 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
                         if (H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start, accum->dirty_len,
                                        accum->buf + accum->dirty_off) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+                        H5F_ACCUM_STATS_WRITE(accum, 1);
                     } /* end if */
                     /* Block to free overlaps with some/all of dirty region */
                     /* Check for unfreed dirty region to write */
@@ -944,6 +1014,7 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
                         if (H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size,
                                        accum->buf + accum->dirty_off + dirty_delta) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+                        H5F_ACCUM_STATS_WRITE(accum, 1);
                     } /* end if */
 
                     /* Reset dirty flag */
@@ -965,6 +1036,7 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
                         if (H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size,
                                        accum->buf + accum->dirty_off + dirty_delta) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+                        H5F_ACCUM_STATS_WRITE(accum, 1);
                     } /* end if */
 
                     /* Check for block to free beginning at same location as dirty region */
@@ -985,6 +1057,52 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
         } /* end else */
     }     /* end if */
 
+    /* Remove the freed block from any dirty regions it overlaps */
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && accum->nregions > 0) {
+        haddr_t  tail_addr = addr + size; /* Address just past the block to free */
+        unsigned u;                       /* Local index variable */
+
+        /* Iterate backwards, as regions may be removed */
+        for (u = accum->nregions; u > 0; u--) {
+            H5F_meta_accum_region_t *region = &accum->regions[u - 1]; /* Current region */
+            haddr_t                  region_end = region->loc + region->size;
+
+            if (!H5_addr_overlap(addr, size, region->loc, region->size))
+                continue;
+
+            /* Check for block to free beginning at or before the region */
+            if (H5_addr_le(addr, region->loc)) {
+                /* Check for completely overlapping the region */
+                if (H5_addr_ge(tail_addr, region_end))
+                    H5F__accum_region_remove(accum, u - 1, TRUE);
+                /* Block to free must end within the region */
+                else {
+                    size_t trim_size = (size_t)(tail_addr - region->loc); /* Amount to trim */
+
+                    memmove(region->buf, region->buf + trim_size, region->size - trim_size);
+                    region->loc += trim_size;
+                    region->size -= trim_size;
+                } /* end else */
+            }     /* end if */
+            /* Block to free starts within the region */
+            else {
+                /* Check if block to free ends before end of region */
+                if (H5_addr_lt(tail_addr, region_end)) {
+                    size_t write_size = (size_t)(region_end - tail_addr); /* Size of tail to write */
+
+                    /* Write out the unfreed tail of the region */
+                    if (H5FD_write(file, H5FD_MEM_DEFAULT, tail_addr, write_size,
+                                   region->buf + (tail_addr - region->loc)) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+                    H5F_ACCUM_STATS_WRITE(accum, 1);
+                } /* end if */
+
+                /* Eliminate the end of the region */
+                region->size = (size_t)(addr - region->loc);
+            } /* end else */
+        }     /* end for */
+    }         /* end if */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_free() */
@@ -1009,19 +1127,57 @@ H5F__accum_flush(H5F_shared_t *f_sh)
     assert(f_sh);
 
     /* Check if we need to flush out the metadata accumulator */
-    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f_sh->accum.dirty) {
-        H5FD_t *file; /* File driver pointer */
-
-        /* Translate to file driver pointer */
-        file = f_sh->lf;
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) &&
+        (f_sh->accum.dirty || f_sh->accum.nregions > 0)) {
+        H5F_meta_accum_t *accum;                            /* Alias for file's metadata accumulator */
+        H5FD_t           *file;                             /* File driver pointer */
+        H5FD_mem_t        types[H5F_ACCUM_MAX_REGIONS + 1]; /* Memory types of dirty extents */
+        haddr_t           addrs[H5F_ACCUM_MAX_REGIONS + 1]; /* Addresses of dirty extents */
+        size_t            sizes[H5F_ACCUM_MAX_REGIONS + 1]; /* Sizes of dirty extents */
+        const void       *bufs[H5F_ACCUM_MAX_REGIONS + 1];  /* Buffers of dirty extents */
+        uint32_t          count = 0;                        /* # of dirty extents */
+        uint32_t          u, v;                             /* Local index variables */
+
+        /* Set up aliases */
+        accum = &f_sh->accum;
+        file  = f_sh->lf;
+
+        /* Gather the dirty extents, in increasing address order */
+        if (accum->dirty) {
+            addrs[count] = accum->loc + accum->dirty_off;
+            sizes[count] = accum->dirty_len;
+            bufs[count]  = accum->buf + accum->dirty_off;
+            count++;
+        } /* end if */
+        for (u = 0; u < accum->nregions; u++) {
+            for (v = count; v > 0 && H5_addr_gt(addrs[v - 1], accum->regions[u].loc); v--) {
+                addrs[v] = addrs[v - 1];
+                sizes[v] = sizes[v - 1];
+                bufs[v]  = bufs[v - 1];
+            } /* end for */
+            addrs[v] = accum->regions[u].loc;
+            sizes[v] = accum->regions[u].size;
+            bufs[v]  = accum->regions[u].buf;
+            count++;
+        } /* end for */
+        for (u = 0; u < count; u++)
+            types[u] = H5FD_MEM_DEFAULT;
+
+        /* Flush the metadata contents, coalescing the extents into one vector write */
+        if (count == 1) {
+            if (H5FD_write(file, H5FD_MEM_DEFAULT, addrs[0], sizes[0], bufs[0]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+        } /* end if */
+        else if (H5FD_write_vector(file, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed");
+        H5F_ACCUM_STATS_WRITE(accum, count);
 
-        /* Flush the metadata contents */
-        if (H5FD_write(file, H5FD_MEM_DEFAULT, f_sh->accum.loc + f_sh->accum.dirty_off, f_sh->accum.dirty_len,
-                       f_sh->accum.buf + f_sh->accum.dirty_off) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+        /* Release the dirty regions */
+        while (accum->nregions > 0)
+            H5F__accum_region_remove(accum, accum->nregions - 1, TRUE);
 
         /* Reset the dirty flag */
-        f_sh->accum.dirty = FALSE;
+        accum->dirty = FALSE;
     } /* end if */
 
 done:
@@ -1058,6 +1214,10 @@ H5F__accum_reset(H5F_shared_t *f_sh, hbool_t flush)
         if (f_sh->accum.buf)
             f_sh->accum.buf = H5FL_BLK_FREE(meta_accum, f_sh->accum.buf);
 
+        /* Discard any dirty regions */
+        while (f_sh->accum.nregions > 0)
+            H5F__accum_region_remove(&f_sh->accum, f_sh->accum.nregions - 1, TRUE);
+
         /* Reset the buffer sizes & location */
         f_sh->accum.alloc_size = f_sh->accum.size = 0;
         f_sh->accum.loc                           = HADDR_UNDEF;
@@ -1068,3 +1228,270 @@ H5F__accum_reset(H5F_shared_t *f_sh, hbool_t flush)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_region_remove
+ *
+ * Purpose:	Remove a dirty region from the accumulator's set of regions,
+ *              optionally releasing its buffer
+ *
+ * Return:	none
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F__accum_region_remove(H5F_meta_accum_t *accum, unsigned idx, hbool_t free_buf)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    assert(accum);
+    assert(idx < accum->nregions);
+
+    /* Release the buffer, if requested */
+    if (free_buf)
+        accum->regions[idx].buf = H5FL_BLK_FREE(meta_accum, accum->regions[idx].buf);
+
+    /* Close the gap, keeping the remaining regions in LRU order */
+    accum->nregions--;
+    if (idx < accum->nregions)
+        memmove(&accum->regions[idx], &accum->regions[idx + 1],
+                (accum->nregions - idx) * sizeof(H5F_meta_accum_region_t));
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__accum_region_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_region_write
+ *
+ * Purpose:	Write a dirty region to the file and remove it from the
+ *              accumulator
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_region_write(H5FD_t *file, H5F_meta_accum_t *accum, unsigned idx)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(file);
+    assert(accum);
+    assert(idx < accum->nregions);
+
+    /* Write out the dirty region, with dispatch to driver */
+    if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->regions[idx].loc, accum->regions[idx].size,
+                   accum->regions[idx].buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+    H5F_ACCUM_STATS_WRITE(accum, 1);
+
+    /* Drop the region */
+    H5F__accum_region_remove(accum, idx, TRUE);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_region_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_flush_regions
+ *
+ * Purpose:	Write out any dirty regions that overlap a block about to be
+ *              read or written outside of them, so the file holds the most
+ *              recent metadata for the block.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_flush_regions(H5FD_t *file, H5F_meta_accum_t *accum, haddr_t addr, size_t size)
+{
+    unsigned u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(file);
+    assert(accum);
+
+    /* Iterate backwards, as writing a region removes it */
+    for (u = accum->nregions; u > 0; u--)
+        if (H5_addr_overlap(addr, size, accum->regions[u - 1].loc, accum->regions[u - 1].size))
+            if (H5F__accum_region_write(file, accum, u - 1) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata region");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_flush_regions() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_park
+ *
+ * Purpose:	Set aside the dirty part of the accumulator as a new region,
+ *              so the accumulator can be reused for a write elsewhere in
+ *              the file.  The least recently used region is written out
+ *              if all regions are in use.  Large dirty extents, and those
+ *              of files open for SWMR writing, are written out instead.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_park(H5F_shared_t *f_sh, H5F_meta_accum_t *accum)
+{
+    H5FD_t *file;                /* File driver pointer */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f_sh);
+    assert(accum);
+    assert(accum->dirty);
+
+    /* Translate to file driver pointer */
+    file = f_sh->lf;
+
+    /* Check for writing the dirty metadata out now */
+    if (accum->dirty_len > H5F_ACCUM_REGION_MAX_SIZE || (H5F_SHARED_INTENT(f_sh) & H5F_ACC_SWMR_WRITE)) {
+        /* Write out the existing metadata accumulator, with dispatch to driver */
+        if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off, accum->dirty_len,
+                       accum->buf + accum->dirty_off) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed");
+        H5F_ACCUM_STATS_WRITE(accum, 1);
+    } /* end if */
+    else {
+        H5F_meta_accum_region_t *region; /* New dirty region */
+        unsigned char           *buf;    /* Buffer for region */
+
+        /* Make room for the new region */
+        if (accum->nregions == H5F_ACCUM_MAX_REGIONS) {
+            if (H5F__accum_region_write(file, accum, accum->nregions - 1) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write dirty metadata region");
+            accum->evictions++;
+        } /* end if */
+
+        /* Copy out the dirty metadata */
+        if (NULL == (buf = H5FL_BLK_MALLOC(meta_accum, accum->dirty_len)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata region buffer");
+        H5MM_memcpy(buf, accum->buf + accum->dirty_off, accum->dirty_len);
+
+        /* Insert the region as the most recently used */
+        if (accum->nregions > 0)
+            memmove(&accum->regions[1], &accum->regions[0],
+                    accum->nregions * sizeof(H5F_meta_accum_region_t));
+        region       = &accum->regions[0];
+        region->buf  = buf;
+        region->loc  = accum->loc + accum->dirty_off;
+        region->size = accum->dirty_len;
+        accum->nregions++;
+    } /* end else */
+
+    /* Reset accumulator dirty flag */
+    accum->dirty = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_park() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_swap
+ *
+ * Purpose:	Make a dirty region the contents of the accumulator, setting
+ *              aside the accumulator's own dirty metadata first.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_swap(H5F_shared_t *f_sh, H5F_meta_accum_t *accum, unsigned idx)
+{
+    H5F_meta_accum_region_t region;              /* Region to swap in */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f_sh);
+    assert(accum);
+    assert(idx < accum->nregions);
+
+    /* Take the region out of the set, keeping its buffer */
+    region = accum->regions[idx];
+    H5F__accum_region_remove(accum, idx, FALSE);
+
+    /* Set aside the accumulator's dirty metadata */
+    if (accum->dirty)
+        if (H5F__accum_park(f_sh, accum) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't set aside dirty metadata");
+
+    /* Check if we need more buffer space */
+    if (region.size > accum->alloc_size) {
+        size_t new_alloc_size; /* New size of accumulator */
+
+        /* Adjust the buffer size to be a power of 2 that is large enough to hold data */
+        new_alloc_size = (size_t)1 << (1 + H5VM_log2_gen((uint64_t)(region.size - 1)));
+
+        /* Reallocate the metadata accumulator buffer */
+        if (NULL == (accum->buf = H5FL_BLK_REALLOC(meta_accum, accum->buf, new_alloc_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer");
+
+        /* Note the new buffer size */
+        accum->alloc_size = new_alloc_size;
+
+        /* Clear the memory */
+        memset(accum->buf + region.size, 0, (accum->alloc_size - region.size));
+    } /* end if */
+
+    /* Store the region's metadata in the accumulator */
+    H5MM_memcpy(accum->buf, region.buf, region.size);
+    accum->loc  = region.loc;
+    accum->size = region.size;
+
+    /* Mark the whole accumulator dirty */
+    accum->dirty_off = 0;
+    accum->dirty_len = region.size;
+    accum->dirty     = TRUE;
+
+done:
+    /* Release the region's buffer */
+    region.buf = H5FL_BLK_FREE(meta_accum, region.buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_swap() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_get_metadata_accum_stats
+ *
+ * Purpose:	Retrieve the statistics for a file's metadata accumulator
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_get_metadata_accum_stats(const H5F_t *f, unsigned *flushes, unsigned *flushed_regions,
+                             unsigned *evictions)
+{
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Sanity checks */
+    assert(f);
+    assert(f->shared);
+
+    if (flushes)
+        *flushes = f->shared->accum.flushes;
+    if (flushed_regions)
+        *flushed_regions = f->shared->accum.flushed_regions;
+    if (evictions)
+        *evictions = f->shared->accum.evictions;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F_get_metadata_accum_stats() */
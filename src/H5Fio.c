@@ -102,6 +102,53 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_shared_block_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_block_borrow
+ *
+ * Purpose:	Looks for an in-memory copy of some contiguous data that
+ *		the file driver can lend out, so that the caller can copy
+ *		from it directly instead of reading the data.  The address
+ *		is relative to the base address for the file.  *BUF is set
+ *		to NULL when no such copy is available.
+ *
+ *		Buffers are only borrowed from files opened read-only: the
+ *		page buffer, the metadata accumulator and the data sieve
+ *		buffers can't hold newer data than the driver in that case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_block_borrow(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                        const void **buf /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    assert(f_sh);
+    assert(buf);
+    assert(H5_addr_defined(addr));
+
+    *buf = NULL;
+
+    /* Only lend out buffers when nothing can be written */
+    if (H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR)
+        HGOTO_DONE(SUCCEED);
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if (H5_addr_le(f_sh->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space");
+
+    if (H5FD_borrow_buffer(f_sh->lf, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to borrow buffer from file driver");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_block_borrow() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5F_block_read
  *
@@ -65,6 +65,9 @@
      (F)->shared->fs_strategy == H5F_FSPACE_STRATEGY_PAGE)
 
 /* Macros for encoding/decoding superblock */
+/* Max. # of dirty extents the metadata accumulator holds aside while accumulating elsewhere */
+#define H5F_ACCUM_MAX_REGIONS 8
+
 #define H5F_MAX_DRVINFOBLOCK_SIZE 1024 /* Maximum size of superblock driver info buffer */
 #define H5F_DRVINFOBLOCK_HDR_SIZE 16   /* Size of superblock driver info header */
 
@@ -183,6 +186,13 @@ struct H5F_blk_aggr_t {
     haddr_t       addr;         /* Location of block left */
 };
 
+/* Structure for a dirty extent set aside by the metadata accumulator */
+typedef struct H5F_meta_accum_region_t {
+    unsigned char *buf;  /* Buffer holding the dirty metadata */
+    haddr_t        loc;  /* File location (offset) of the dirty metadata */
+    size_t         size; /* Size of the dirty metadata (in bytes) */
+} H5F_meta_accum_region_t;
+
 /* Structure for metadata accumulator fields */
 typedef struct H5F_meta_accum_t {
     unsigned char *buf;        /* Buffer to hold the accumulated metadata */
@@ -192,6 +202,18 @@ typedef struct H5F_meta_accum_t {
     size_t         dirty_off;  /* Offset of the dirty region in the accumulator buffer */
     size_t         dirty_len;  /* Length of the dirty region in the accumulator buffer */
     hbool_t        dirty;      /* Flag to indicate that the accumulated metadata is dirty */
+
+    /* Dirty extents set aside when a write doesn't adjoin the accumulator.
+     * Kept in LRU order (most recently used first).  They never overlap
+     * each other or the accumulator above.
+     */
+    unsigned                nregions;                       /* # of regions in use */
+    H5F_meta_accum_region_t regions[H5F_ACCUM_MAX_REGIONS]; /* Dirty regions */
+
+    /* Statistics */
+    unsigned flushes;         /* # of times dirty metadata was flushed */
+    unsigned flushed_regions; /* # of dirty extents written by those flushes */
+    unsigned evictions;       /* # of regions written early to make room for another */
 } H5F_meta_accum_t;
 
 /* A record of the mount table */
@@ -271,6 +271,8 @@ typedef struct H5F_t H5F_t;
     "page_buffer_min_meta_perc" /* the min metadata percentage for the page buffer cache */
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME                                                                \
     "page_buffer_min_raw_perc" /* the min raw data percentage for the page buffer cache */
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_NAME                                                                   \
+    "page_buffer_readahead" /* the number of raw data pages the page buffer reads ahead */
 #define H5F_ACS_USE_FILE_LOCKING_NAME                                                                        \
     "use_file_locking" /* whether or not we use file locks for SWMR control and to prevent multiple writers  \
                         */
@@ -587,6 +589,12 @@ H5_DLL herr_t H5F_block_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t siz
 H5_DLL herr_t H5F_shared_block_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
                                      const void *buf);
 H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5F_shared_block_borrow(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                                      const void **buf /*out*/);
+
+/* Metadata accumulator routines */
+H5_DLL herr_t H5F_get_metadata_accum_stats(const H5F_t *f, unsigned *flushes, unsigned *flushed_regions,
+                                           unsigned *evictions);
 
 /* Functions that operate on selections of elements in the file */
 H5_DLL herr_t H5F_shared_select_read(H5F_shared_t *f_sh, H5FD_mem_t type, uint32_t count,
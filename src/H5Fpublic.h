@@ -1069,6 +1069,37 @@ H5_DLL herr_t H5Fset_mdc_config(hid_t file_id, const H5AC_cache_config_t *config
  *
  */
 H5_DLL herr_t H5Fget_mdc_hit_rate(hid_t file_id, double *hit_rate_ptr);
+/**
+ * \ingroup MDC
+ *
+ * \brief Obtains the estimated miss ratio curve of the target file's metadata cache
+ *
+ * \file_id
+ * \param[in,out] npoints Pointer to the number of elements in \p cache_sizes and \p miss_ratios on
+ *                        entry, and the number of points in the estimated curve on return
+ * \param[out] cache_sizes Array of cache sizes, in bytes, at which the curve is estimated
+ * \param[out] miss_ratios Array of estimated miss ratios, one for each element of \p cache_sizes
+ * \return \herr_t
+ *
+ * \details H5Fget_mdc_mrc() retrieves the miss ratio curve estimated by the metadata cache when its
+ *          adaptive resize code is configured with \p incr_mode set to #H5C_incr__mrc. The curve gives,
+ *          for cache sizes up to the configured \p max_size, the fraction of metadata cache accesses that
+ *          would have missed in a cache of that size.
+ *
+ *          At most \p npoints points are copied into \p cache_sizes and \p miss_ratios, in increasing
+ *          order of cache size, and \p npoints is set to the number of points available. Either array
+ *          may be NULL, for instance to query the number of points first.
+ *
+ *          If the cache is not in the miss ratio curve resize mode, or has not sampled any accesses yet,
+ *          \p npoints is set to 0.
+ *
+ *          The estimate is aged at the end of each resize epoch, but is not affected by
+ *          H5Freset_mdc_hit_rate_stats().
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Fget_mdc_mrc(hid_t file_id, size_t *npoints, size_t cache_sizes[], double miss_ratios[]);
 /**
  * \ingroup MDC
  *
@@ -1612,6 +1643,40 @@ H5_DLL herr_t H5Freset_page_buffering_stats(hid_t file_id);
  */
 H5_DLL herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2], unsigned hits[2],
                                           unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+/**
+ * \ingroup H5F
+ *
+ * \brief Retrieves statistics about the metadata accumulator
+ *
+ * \file_id
+ * \param[out] flushes Number of times dirty accumulated metadata was written
+ *                     to the file
+ * \param[out] flushed_regions Number of contiguous dirty extents written by
+ *                             those writes
+ * \param[out] evictions Number of dirty extents written early, to make room
+ *                       for metadata written elsewhere in the file
+ *
+ * \return \herr_t
+ *
+ * \details H5Fget_metadata_accum_stats() retrieves statistics for the
+ *          metadata accumulator, which caches small metadata writes and
+ *          groups them into larger I/O operations.
+ *
+ *          Besides the contiguous block it is accumulating into, the
+ *          accumulator can hold a small number of dirty extents from other
+ *          parts of the file, so interleaved writes to several areas of the
+ *          file can still be grouped.  When the accumulator is flushed, all
+ *          of its dirty extents are written with a single vector write, which
+ *          counts as one flush in \p flushes.
+ *
+ *          Any of the output parameters may be NULL.  The statistics are
+ *          kept for the lifetime of the open file.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Fget_metadata_accum_stats(hid_t file_id, unsigned *flushes, unsigned *flushed_regions,
+                                          unsigned *evictions);
 /**
  * \ingroup MDC
  *
@@ -559,6 +559,10 @@ typedef struct H5O_storage_virtual_ent_t {
                                  unlim_extent_virtual */
     H5O_virtual_space_status_t source_space_status;  /* Extent patching status of source_select */
     H5O_virtual_space_status_t virtual_space_status; /* Extent patching status of virtual_select */
+    struct H5O_storage_virtual_ent_t *open_prev; /* Previous (more recently used) mapping in the list of open
+                                                    source datasets of limited mappings */
+    struct H5O_storage_virtual_ent_t *open_next; /* Next (less recently used) mapping in the list of open
+                                                    source datasets of limited mappings */
 } H5O_storage_virtual_ent_t;
 
 typedef struct H5O_storage_virtual_t {
@@ -580,6 +584,25 @@ typedef struct H5O_storage_virtual_t {
     hid_t   source_fapl; /* FAPL to use to open source files */
     hid_t   source_dapl; /* DAPL to use to open source datasets */
     hbool_t init;        /* Whether all information has been completely initialized */
+
+    /* Index of the mappings, for finding the ones which intersect a selection */
+    size_t   index_nlimited; /* Number of mappings with limited virtual selections, first in index */
+    int      index_dim;      /* Dimension the mappings with limited selections are sorted on */
+    hbool_t  index_disjoint; /* Whether all mappings have limited selections, with disjoint bounds */
+    size_t  *index;          /* Indices in list of all mappings, those with limited selections first, sorted
+                                by the start of their virtual selection bounds in index_dim */
+    hsize_t *index_bounds;   /* Virtual selection bounds of the mappings with limited selections, in the order
+                                of index: the starts in each dimension, then the ends */
+    hsize_t *index_max_end;  /* Largest end in index_dim of the bounds of the mappings up to each one */
+    size_t  *io_list;        /* Indices in list of the mappings involved in the current I/O op, in increasing
+                                order.  Field has no meaning at other times */
+    size_t   io_nused;       /* Number of mappings in io_list */
+
+    /* Open source datasets of the mappings with limited selections, most recently used first */
+    size_t                            max_open;  /* Max # of them kept open between I/O ops, 0 for no limit */
+    size_t                            nopen;     /* Number of mappings in the list */
+    struct H5O_storage_virtual_ent_t *open_head; /* Most recently used mapping with an open source dataset */
+    struct H5O_storage_virtual_ent_t *open_tail; /* Least recently used mapping with an open source dataset */
 } H5O_storage_virtual_t;
 
 typedef struct H5O_storage_t {
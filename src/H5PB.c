@@ -36,24 +36,34 @@
 #include "H5Iprivate.h"  /* IDs                              */
 #include "H5MMprivate.h" /* Memory management                */
 #include "H5PBpkg.h"     /* File access                      */
-#include "H5SLprivate.h" /* Skip List                        */
 
 /****************/
 /* Local Macros */
 /****************/
-#define H5PB__PREPEND(page_ptr, head_ptr, tail_ptr, len)                                                     \
+
+/* Index into the statistics arrays for an access of TYPE: 0 for metadata, 1 for raw data */
+#define H5PB__STATS_IDX(type) ((H5FD_MEM_DRAW == (type) || H5FD_MEM_GHEAP == (type)) ? 1 : 0)
+
+/* Bump a statistic both in the page buffer totals and for the calling thread */
+#define H5PB__UPDATE_STATS(page_buf, thread_stats, stat, type)                                               \
+    {                                                                                                        \
+        (page_buf)->stat[H5PB__STATS_IDX(type)]++;                                                           \
+        (thread_stats)->stat[H5PB__STATS_IDX(type)]++;                                                       \
+    } /* H5PB__UPDATE_STATS() */
+
+#define H5PB__APPEND(page_ptr, head_ptr, tail_ptr, len)                                                      \
     {                                                                                                        \
         if ((head_ptr) == NULL) {                                                                            \
             (head_ptr) = (page_ptr);                                                                         \
             (tail_ptr) = (page_ptr);                                                                         \
         } /* end if */                                                                                       \
         else {                                                                                               \
-            (head_ptr)->prev = (page_ptr);                                                                   \
-            (page_ptr)->next = (head_ptr);                                                                   \
-            (head_ptr)       = (page_ptr);                                                                   \
+            (tail_ptr)->next = (page_ptr);                                                                   \
+            (page_ptr)->prev = (tail_ptr);                                                                   \
+            (tail_ptr)       = (page_ptr);                                                                   \
         } /* end else */                                                                                     \
         (len)++;                                                                                             \
-    } /* H5PB__PREPEND() */
+    } /* H5PB__APPEND() */
 
 #define H5PB__REMOVE(page_ptr, head_ptr, tail_ptr, len)                                                      \
     {                                                                                                        \
@@ -76,44 +86,48 @@
         (len)--;                                                                                             \
     }
 
-#define H5PB__INSERT_LRU(page_buf, page_ptr)                                                                 \
-    {                                                                                                        \
-        assert(page_buf);                                                                                    \
-        assert(page_ptr);                                                                                    \
-        /* insert the entry at the head of the list. */                                                      \
-        H5PB__PREPEND((page_ptr), (page_buf)->LRU_head_ptr, (page_buf)->LRU_tail_ptr,                        \
-                      (page_buf)->LRU_list_len)                                                              \
-    }
+/* The CLOCK ring is kept as a NULL-terminated list; the hand wraps from the tail back to the head */
+#define H5PB__CLOCK_NEXT(page_buf, page_ptr)                                                                 \
+    ((page_ptr)->next ? (page_ptr)->next : (page_buf)->clock_head_ptr)
 
-#define H5PB__REMOVE_LRU(page_buf, page_ptr)                                                                 \
+#define H5PB__INSERT_CLOCK(page_buf, page_ptr)                                                               \
     {                                                                                                        \
         assert(page_buf);                                                                                    \
         assert(page_ptr);                                                                                    \
-        /* remove the entry from the list. */                                                                \
-        H5PB__REMOVE((page_ptr), (page_buf)->LRU_head_ptr, (page_buf)->LRU_tail_ptr,                         \
-                     (page_buf)->LRU_list_len)                                                               \
+        /* insert the entry just behind the hand, so it is the last one the hand reaches. */                 \
+        if ((page_buf)->clock_hand_ptr == NULL ||                                                            \
+            (page_buf)->clock_hand_ptr == (page_buf)->clock_head_ptr) {                                      \
+            H5PB__APPEND((page_ptr), (page_buf)->clock_head_ptr, (page_buf)->clock_tail_ptr,                 \
+                         (page_buf)->clock_list_len)                                                         \
+            if ((page_buf)->clock_hand_ptr == NULL)                                                          \
+                (page_buf)->clock_hand_ptr = (page_ptr);                                                     \
+        } /* end if */                                                                                       \
+        else {                                                                                               \
+            (page_ptr)->next                       = (page_buf)->clock_hand_ptr;                             \
+            (page_ptr)->prev                       = (page_buf)->clock_hand_ptr->prev;                       \
+            (page_buf)->clock_hand_ptr->prev->next = (page_ptr);                                             \
+            (page_buf)->clock_hand_ptr->prev       = (page_ptr);                                             \
+            (page_buf)->clock_list_len++;                                                                    \
+        } /* end else */                                                                                     \
     }
 
-#define H5PB__MOVE_TO_TOP_LRU(page_buf, page_ptr)                                                            \
+#define H5PB__REMOVE_CLOCK(page_buf, page_ptr)                                                               \
     {                                                                                                        \
         assert(page_buf);                                                                                    \
         assert(page_ptr);                                                                                    \
-        /* Remove entry and insert at the head of the list. */                                               \
-        H5PB__REMOVE((page_ptr), (page_buf)->LRU_head_ptr, (page_buf)->LRU_tail_ptr,                         \
-                     (page_buf)->LRU_list_len)                                                               \
-        H5PB__PREPEND((page_ptr), (page_buf)->LRU_head_ptr, (page_buf)->LRU_tail_ptr,                        \
-                      (page_buf)->LRU_list_len)                                                              \
+        /* advance the hand past the entry if it points at it. */                                            \
+        if ((page_buf)->clock_hand_ptr == (page_ptr))                                                        \
+            (page_buf)->clock_hand_ptr =                                                                     \
+                (1 == (page_buf)->clock_list_len ? NULL : H5PB__CLOCK_NEXT((page_buf), (page_ptr)));         \
+        /* remove the entry from the ring. */                                                                \
+        H5PB__REMOVE((page_ptr), (page_buf)->clock_head_ptr, (page_buf)->clock_tail_ptr,                     \
+                     (page_buf)->clock_list_len)                                                             \
     }
 
 /******************/
 /* Local Typedefs */
 /******************/
 
-/* Iteration context for destroying page buffer */
-typedef struct {
-    H5PB_t *page_buf;
-    hbool_t actual_slist;
-} H5PB_ud1_t;
 
 /********************/
 /* Package Typedefs */
@@ -125,6 +139,10 @@ typedef struct {
 static herr_t H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
 static htri_t H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type);
 static herr_t H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry);
+static H5PB_thread_stats_t *H5PB__get_thread_stats(H5PB_t *page_buf);
+static void                 H5PB__free_thread_stats(H5PB_t *page_buf);
+static int                  H5PB__entry_addr_cmp(const void *_entry1, const void *_entry2);
+static herr_t               H5PB__readahead(H5F_shared_t *f_sh, H5PB_t *page_buf, haddr_t page_addr);
 
 /*********************/
 /* Package Variables */
@@ -143,6 +161,9 @@ H5FL_DEFINE_STATIC(H5PB_t);
 /* Declare a free list to manage the H5PB_entry_t struct */
 H5FL_DEFINE_STATIC(H5PB_entry_t);
 
+/* Declare a free list to manage the H5PB_thread_stats_t struct */
+H5FL_DEFINE_STATIC(H5PB_thread_stats_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5PB_reset_stats
  *
@@ -174,6 +195,12 @@ H5PB_reset_stats(H5PB_t *page_buf)
     page_buf->bypasses[0]  = 0;
     page_buf->bypasses[1]  = 0;
 
+    page_buf->readahead_pages = 0;
+    page_buf->readahead_hits  = 0;
+
+    /* Drop the per-thread statistics */
+    H5PB__free_thread_stats(page_buf);
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_reset_stats() */
 
@@ -217,6 +244,53 @@ H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2], u
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_get_stats */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5PB_get_thread_stats
+ *
+ * Purpose:     Retrieve the metadata and raw data statistics gathered for
+ *              the thread identified by THREAD_ID (as returned by
+ *              H5TS_thread_id()).
+ *              --accesses: the number of metadata and raw data accesses made by the thread
+ *              --hits: the number of metadata and raw data hits seen by the thread
+ *              --misses: the number of metadata and raw data misses seen by the thread
+ *
+ *              A thread that has not accessed the page buffer since it
+ *              was created or its statistics were last reset reports
+ *              zero for everything.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_get_thread_stats(const H5PB_t *page_buf, uint64_t thread_id, unsigned accesses[2], unsigned hits[2],
+                      unsigned misses[2])
+{
+    H5PB_thread_stats_t *thread_stats = NULL; /* Statistics for the thread */
+
+    FUNC_ENTER_NOAPI_NOERR
+
+    /* Sanity checks */
+    assert(page_buf);
+
+    HASH_FIND(hh, page_buf->thread_stats, &thread_id, sizeof(uint64_t), thread_stats);
+    if (thread_stats) {
+        accesses[0] = thread_stats->accesses[0];
+        accesses[1] = thread_stats->accesses[1];
+        hits[0]     = thread_stats->hits[0];
+        hits[1]     = thread_stats->hits[1];
+        misses[0]   = thread_stats->misses[0];
+        misses[1]   = thread_stats->misses[1];
+    } /* end if */
+    else {
+        accesses[0] = accesses[1] = 0;
+        hits[0] = hits[1] = 0;
+        misses[0] = misses[1] = 0;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5PB_get_thread_stats */
+
 /*-------------------------------------------------------------------------
  * Function:    H5PB_print_stats()
  *
@@ -255,9 +329,30 @@ H5PB_print_stats(const H5PB_t *page_buf)
     printf("\t Evictions: %u\n", page_buf->evictions[1]);
     printf("\t Bypasses: %u\n", page_buf->bypasses[1]);
     printf("\t Hit Rate = %f%%\n",
-           ((double)page_buf->hits[1] / (page_buf->accesses[1] - page_buf->bypasses[0])) * 100);
+           ((double)page_buf->hits[1] / (page_buf->accesses[1] - page_buf->bypasses[1])) * 100);
+    if (page_buf->readahead > 0) {
+        printf("\t Readahead Pages: %u\n", page_buf->readahead_pages);
+        printf("\t Readahead Hits: %u\n", page_buf->readahead_hits);
+        printf("\t Readahead Hit Rate = %f%%\n",
+               ((double)page_buf->readahead_hits / page_buf->readahead_pages) * 100);
+    } /* end if */
     printf("*****************\n\n");
 
+    /* Per-thread breakdown */
+    if (page_buf->thread_stats) {
+        const H5PB_thread_stats_t *thread_stats;
+
+        for (thread_stats = page_buf->thread_stats; thread_stats != NULL;
+             thread_stats = (const H5PB_thread_stats_t *)thread_stats->hh.next) {
+            printf("******* THREAD %" PRIu64 "\n", thread_stats->thread_id);
+            printf("\t Metadata Accesses/Hits/Misses: %u/%u/%u\n", thread_stats->accesses[0],
+                   thread_stats->hits[0], thread_stats->misses[0]);
+            printf("\t Raw Data Accesses/Hits/Misses: %u/%u/%u\n", thread_stats->accesses[1],
+                   thread_stats->hits[1], thread_stats->misses[1]);
+        } /* end for */
+        printf("*****************\n\n");
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_print_stats */
 
@@ -271,7 +366,8 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *-------------------------------------------------------------------------
  */
 herr_t
-H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc)
+H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+            unsigned page_buf_readahead)
 {
     H5PB_t *page_buf  = NULL;
     herr_t  ret_value = SUCCEED; /* Return value */
@@ -310,10 +406,10 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
     page_buf->min_meta_count = (unsigned)((size * page_buf_min_meta_perc) / (f_sh->fs_page_size * 100));
     page_buf->min_raw_count  = (unsigned)((size * page_buf_min_raw_perc) / (f_sh->fs_page_size * 100));
 
-    if (NULL == (page_buf->slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list");
-    if (NULL == (page_buf->mf_slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list");
+    /* Readahead never uses more than half of the page buffer */
+    page_buf->readahead     = MIN(page_buf_readahead, (unsigned)((size / f_sh->fs_page_size) / 2));
+    page_buf->seq_last_addr = HADDR_UNDEF;
+    page_buf->ra_next_addr  = HADDR_UNDEF;
 
     if (NULL == (page_buf->page_fac = H5FL_fac_init(page_buf->page_size)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINIT, FAIL, "can't create page factory");
@@ -323,10 +419,6 @@ H5PB_create(H5F_shared_t *f_sh, size_t size, unsigned page_buf_min_meta_perc, un
 done:
     if (ret_value < 0) {
         if (page_buf != NULL) {
-            if (page_buf->slist_ptr != NULL)
-                H5SL_close(page_buf->slist_ptr);
-            if (page_buf->mf_slist_ptr != NULL)
-                H5SL_close(page_buf->mf_slist_ptr);
             if (page_buf->page_fac != NULL)
                 H5FL_fac_term(page_buf->page_fac);
             page_buf = H5FL_FREE(H5PB_t, page_buf);
@@ -336,42 +428,13 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5PB_create */
 
-/*-------------------------------------------------------------------------
- * Function:    H5PB__flush_cb
- *
- * Purpose:     Callback to flush PB skiplist entries.
- *
- * Return:      Non-negative on success/Negative on failure
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5PB__flush_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
-{
-    H5PB_entry_t *page_entry = (H5PB_entry_t *)item; /* Pointer to page entry node */
-    H5F_shared_t *f_sh       = (H5F_shared_t *)_op_data;
-    herr_t        ret_value  = SUCCEED; /* Return value */
-
-    FUNC_ENTER_PACKAGE
-
-    /* Sanity checks */
-    assert(page_entry);
-    assert(f_sh);
-
-    /* Flush the page if it's dirty */
-    if (page_entry->is_dirty)
-        if (H5PB__write_entry(f_sh, page_entry) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed");
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* H5PB__flush_cb() */
-
 /*-------------------------------------------------------------------------
  * Function:    H5PB_flush
  *
  * Purpose:     Flush/Free all the PB entries to the file.
  *
+ *              Dirty pages are written in increasing address order.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
@@ -386,53 +449,27 @@ H5PB_flush(H5F_shared_t *f_sh)
     /* Sanity check */
     assert(f_sh);
 
-    /* Flush all the entries in the PB skiplist, if we have write access on the file */
+    /* Flush all the entries in the PB, if we have write access on the file */
     if (f_sh->page_buf && (H5F_ACC_RDWR & H5F_SHARED_INTENT(f_sh))) {
-        H5PB_t *page_buf = f_sh->page_buf;
-
-        /* Iterate over all entries in page buffer skip list */
-        if (H5SL_iterate(page_buf->slist_ptr, H5PB__flush_cb, f_sh))
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_BADITER, FAIL, "can't flush page buffer skip list");
-    } /* end if */
+        H5PB_t       *page_buf = f_sh->page_buf;
+        H5PB_entry_t *page_entry, *tmp; /* Pointers to page entry nodes */
+
+        /* Put the page index in address order, so the writes reach the file sequentially */
+        HASH_SRT(hh, page_buf->index, H5PB__entry_addr_cmp);
+
+        HASH_ITER(hh, page_buf->index, page_entry, tmp)
+        {
+            /* Flush the page if it's dirty */
+            if (page_entry->is_dirty)
+                if (H5PB__write_entry(f_sh, page_entry) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed");
+        } /* end HASH_ITER */
+    }     /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5PB_flush */
 
-/*-------------------------------------------------------------------------
- * Function:    H5PB__dest_cb
- *
- * Purpose:     Callback to free PB skiplist entries.
- *
- * Return:      Non-negative on success/Negative on failure
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5PB__dest_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
-{
-    H5PB_entry_t *page_entry = (H5PB_entry_t *)item; /* Pointer to page entry node */
-    H5PB_ud1_t   *op_data    = (H5PB_ud1_t *)_op_data;
-
-    FUNC_ENTER_PACKAGE_NOERR
-
-    /* Sanity checking */
-    assert(page_entry);
-    assert(op_data);
-    assert(op_data->page_buf);
-
-    /* Remove entry from LRU list */
-    if (op_data->actual_slist) {
-        H5PB__REMOVE_LRU(op_data->page_buf, page_entry)
-        page_entry->page_buf_ptr = H5FL_FAC_FREE(op_data->page_buf->page_fac, page_entry->page_buf_ptr);
-    } /* end if */
-
-    /* Free page entry */
-    page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
-
-    FUNC_LEAVE_NOAPI(SUCCEED)
-} /* H5PB__dest_cb() */
-
 /*-------------------------------------------------------------------------
  * Function:    H5PB_dest
  *
@@ -454,24 +491,31 @@ H5PB_dest(H5F_shared_t *f_sh)
 
     /* flush and destroy the page buffer, if it exists */
     if (f_sh->page_buf) {
-        H5PB_t    *page_buf = f_sh->page_buf;
-        H5PB_ud1_t op_data; /* Iteration context */
+        H5PB_t       *page_buf = f_sh->page_buf;
+        H5PB_entry_t *page_entry, *tmp; /* Pointers to page entry nodes */
 
         if (H5PB_flush(f_sh) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTFLUSH, FAIL, "can't flush page buffer");
 
-        /* Set up context info */
-        op_data.page_buf = page_buf;
-
-        /* Destroy the skip list containing all the entries in the PB */
-        op_data.actual_slist = TRUE;
-        if (H5SL_destroy(page_buf->slist_ptr, H5PB__dest_cb, &op_data))
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy page buffer skip list");
+        /* Free all the entries in the PB */
+        HASH_ITER(hh, page_buf->index, page_entry, tmp)
+        {
+            HASH_DELETE(hh, page_buf->index, page_entry);
+            H5PB__REMOVE_CLOCK(page_buf, page_entry)
+            page_entry->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, page_entry->page_buf_ptr);
+            page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
+        } /* end HASH_ITER */
+        assert(0 == page_buf->clock_list_len);
+
+        /* Free the new entries, which have no page allocated yet */
+        HASH_ITER(hh, page_buf->mf_index, page_entry, tmp)
+        {
+            HASH_DELETE(hh, page_buf->mf_index, page_entry);
+            page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
+        } /* end HASH_ITER */
 
-        /* Destroy the skip list containing the new entries */
-        op_data.actual_slist = FALSE;
-        if (H5SL_destroy(page_buf->mf_slist_ptr, H5PB__dest_cb, &op_data))
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't destroy page buffer skip list");
+        /* Free the per-thread statistics */
+        H5PB__free_thread_stats(page_buf);
 
         /* Destroy the page factory */
         if (H5FL_fac_term(page_buf->page_fac) < 0)
@@ -518,7 +562,8 @@ H5PB_add_new_page(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t page_addr)
      * the page when it is freed from this list if it still exists and
      * remove this check
      */
-    if (NULL == H5SL_search(page_buf->mf_slist_ptr, &(page_addr))) {
+    H5PB__SEARCH_INDEX(page_buf->mf_index, page_addr, page_entry);
+    if (NULL == page_entry) {
         /* Create the new PB entry */
         if (NULL == (page_entry = H5FL_CALLOC(H5PB_entry_t)))
             HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed");
@@ -528,15 +573,11 @@ H5PB_add_new_page(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t page_addr)
         page_entry->type     = (H5F_mem_page_t)type;
         page_entry->is_dirty = FALSE;
 
-        /* Insert entry in skip list */
-        if (H5SL_insert(page_buf->mf_slist_ptr, page_entry, &(page_entry->addr)) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Can't insert entry in skip list");
+        /* Insert entry in the new page index */
+        HASH_ADD(hh, page_buf->mf_index, addr, sizeof(haddr_t), page_entry);
     } /* end if */
 
 done:
-    if (ret_value < 0)
-        if (page_entry)
-            page_entry = H5FL_FREE(H5PB_entry_t, page_entry);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5PB_add_new_page */
@@ -570,7 +611,7 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
     page_addr = (addr / page_buf->page_size) * page_buf->page_size;
 
     /* search for the page and update if found */
-    page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&page_addr));
+    H5PB__SEARCH_INDEX(page_buf->index, page_addr, page_entry);
     if (page_entry) {
         haddr_t offset;
 
@@ -578,8 +619,8 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
         offset = addr - page_addr;
         H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, buf, size);
 
-        /* move to top of LRU list */
-        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+        /* Mark the page referenced for CLOCK */
+        page_entry->referenced = TRUE;
     } /* end if */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
@@ -601,29 +642,27 @@ H5PB_update_entry(H5PB_t *page_buf, haddr_t addr, size_t size, const void *buf)
 herr_t
 H5PB_remove_entry(const H5F_shared_t *f_sh, haddr_t addr)
 {
-    H5PB_t       *page_buf;             /* Page buffer to operate on */
-    H5PB_entry_t *page_entry = NULL;    /* Pointer to the page entry being searched */
-    herr_t        ret_value  = SUCCEED; /* Return value */
+    H5PB_t       *page_buf;          /* Page buffer to operate on */
+    H5PB_entry_t *page_entry = NULL; /* Pointer to the page entry being searched */
 
-    FUNC_ENTER_NOAPI(FAIL)
+    FUNC_ENTER_NOAPI_NOERR
 
     /* Sanity checks */
     assert(f_sh);
     page_buf = f_sh->page_buf;
     assert(page_buf);
 
-    /* Search for address in the skip list */
-    page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&addr));
+    /* Search for address in the page index */
+    H5PB__SEARCH_INDEX(page_buf->index, addr, page_entry);
 
     /* If found, remove the entry from the PB cache */
     if (page_entry) {
         assert(page_entry->type != H5F_MEM_PAGE_DRAW);
-        if (NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
-            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Page Entry is not in skip list");
+        HASH_DELETE(hh, page_buf->index, page_entry);
 
-        /* Remove from LRU list */
-        H5PB__REMOVE_LRU(page_buf, page_entry)
-        assert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+        /* Remove from CLOCK ring */
+        H5PB__REMOVE_CLOCK(page_buf, page_entry)
+        assert(HASH_COUNT(page_buf->index) == page_buf->clock_list_len);
 
         page_buf->meta_count--;
 
@@ -631,8 +670,7 @@ H5PB_remove_entry(const H5F_shared_t *f_sh, haddr_t addr)
         page_entry               = H5FL_FREE(H5PB_entry_t, page_entry);
     } /* end if */
 
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_remove_entry */
 
 /*-------------------------------------------------------------------------
@@ -648,17 +686,19 @@ done:
 herr_t
 H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf /*out*/)
 {
-    H5PB_t       *page_buf;                        /* Page buffering info for this file */
-    H5PB_entry_t *page_entry;                      /* Pointer to the corresponding page entry */
-    H5FD_t       *file;                            /* File driver pointer */
-    haddr_t       first_page_addr, last_page_addr; /* Addresses of the first and last pages covered by I/O */
-    haddr_t       offset;
-    haddr_t       search_addr;       /* Address of current page */
-    hsize_t       num_touched_pages; /* Number of pages accessed */
-    size_t        access_size = 0;
-    hbool_t       bypass_pb   = FALSE; /* Whether to bypass page buffering */
-    hsize_t       i;                   /* Local index variable */
-    herr_t        ret_value = SUCCEED; /* Return value */
+    H5PB_t              *page_buf;     /* Page buffering info for this file */
+    H5PB_thread_stats_t *thread_stats; /* Statistics for the calling thread */
+    H5PB_entry_t        *page_entry;   /* Pointer to the corresponding page entry */
+    H5FD_t              *file;         /* File driver pointer */
+    haddr_t              first_page_addr, last_page_addr; /* First and last pages covered by I/O */
+    haddr_t              offset;
+    haddr_t              search_addr;       /* Address of current page */
+    hsize_t              num_touched_pages; /* Number of pages accessed */
+    size_t               access_size = 0;
+    hbool_t              bypass_pb    = FALSE; /* Whether to bypass page buffering */
+    hbool_t              do_readahead = FALSE; /* Whether to read the following pages ahead */
+    hsize_t              i;                    /* Local index variable */
+    herr_t               ret_value = SUCCEED;  /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
@@ -710,12 +750,9 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
     } /* end if */
 
     /* Update statistics */
-    if (page_buf) {
-        if (type == H5FD_MEM_DRAW)
-            page_buf->accesses[1]++;
-        else
-            page_buf->accesses[0]++;
-    } /* end if */
+    if (NULL == (thread_stats = H5PB__get_thread_stats(page_buf)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't get page buffer statistics for thread");
+    H5PB__UPDATE_STATS(page_buf, thread_stats, accesses, type)
 
     /* Calculate the aligned address of the first page */
     first_page_addr = (addr / page_buf->page_size) * page_buf->page_size;
@@ -746,70 +783,51 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
     /* Copy raw data from dirty pages into the read buffer if the read
        request spans pages in the page buffer*/
     if (H5FD_MEM_DRAW == type && size >= page_buf->page_size) {
-        H5SL_node_t *node;
-
-        /* For each touched page in the page buffer, check if it
-         * exists in the page Buffer and is dirty. If it does, we
-         * update the buffer with what's in the page so we get the up
-         * to date data into the buffer after the big read from the file.
+        /* For each touched page, check if it exists in the page Buffer
+         * and is dirty. If it does, we update the buffer with what's in
+         * the page so we get the up to date data into the buffer after
+         * the big read from the file.
          */
-        node = H5SL_find(page_buf->slist_ptr, (void *)(&first_page_addr));
         for (i = 0; i < num_touched_pages; i++) {
             search_addr = i * page_buf->page_size + first_page_addr;
 
-            /* if we still haven't located a starting page, search again */
-            if (!node && i != 0)
-                node = H5SL_find(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf->index, search_addr, page_entry);
 
-            /* if the current page is in the Page Buffer, do the updates */
-            if (node) {
-                page_entry = (H5PB_entry_t *)H5SL_item(node);
-
-                assert(page_entry);
+            /* if the current page is in the Page Buffer and dirty, do the updates */
+            if (page_entry && page_entry->is_dirty) {
+                /* special handling for the first page if it is not a full page access */
+                if (i == 0 && first_page_addr != addr) {
+                    offset = addr - first_page_addr;
+                    assert(page_buf->page_size > offset);
 
-                /* If the current page address falls out of the access
-                   block, then there are no more pages to go over */
-                if (page_entry->addr >= addr + size)
-                    break;
+                    H5MM_memcpy(buf, (uint8_t *)page_entry->page_buf_ptr + offset,
+                                page_buf->page_size - (size_t)offset);
 
-                assert(page_entry->addr == search_addr);
+                    /* Mark the page referenced for CLOCK */
+                    page_entry->referenced = TRUE;
+                } /* end if */
+                /* special handling for the last page if it is not a full page access */
+                else if (num_touched_pages > 1 && i == num_touched_pages - 1 && search_addr < addr + size) {
+                    offset = (num_touched_pages - 2) * page_buf->page_size +
+                             (page_buf->page_size - (addr - first_page_addr));
 
-                if (page_entry->is_dirty) {
-                    /* special handling for the first page if it is not a full page access */
-                    if (i == 0 && first_page_addr != addr) {
-                        offset = addr - first_page_addr;
-                        assert(page_buf->page_size > offset);
+                    H5MM_memcpy((uint8_t *)buf + offset, page_entry->page_buf_ptr,
+                                (size_t)((addr + size) - last_page_addr));
 
-                        H5MM_memcpy(buf, (uint8_t *)page_entry->page_buf_ptr + offset,
-                                    page_buf->page_size - (size_t)offset);
+                    /* Mark the page referenced for CLOCK */
+                    page_entry->referenced = TRUE;
+                } /* end else-if */
+                /* copy the entire fully accessed pages */
+                else {
+                    offset = i * page_buf->page_size;
 
-                        /* move to top of LRU list */
-                        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
-                    } /* end if */
-                    /* special handling for the last page if it is not a full page access */
-                    else if (num_touched_pages > 1 && i == num_touched_pages - 1 &&
-                             search_addr < addr + size) {
-                        offset = (num_touched_pages - 2) * page_buf->page_size +
-                                 (page_buf->page_size - (addr - first_page_addr));
-
-                        H5MM_memcpy((uint8_t *)buf + offset, page_entry->page_buf_ptr,
-                                    (size_t)((addr + size) - last_page_addr));
-
-                        /* move to top of LRU list */
-                        H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
-                    } /* end else-if */
-                    /* copy the entire fully accessed pages */
-                    else {
-                        offset = i * page_buf->page_size;
-
-                        H5MM_memcpy((uint8_t *)buf + (i * page_buf->page_size), page_entry->page_buf_ptr,
-                                    page_buf->page_size);
-                    } /* end else */
-                }     /* end if */
-                node = H5SL_next(node);
-            } /* end if */
-        }     /* end for */
-    }         /* end if */
+                    H5MM_memcpy((uint8_t *)buf + (i * page_buf->page_size), page_entry->page_buf_ptr,
+                                page_buf->page_size);
+                } /* end else */
+            }     /* end if */
+        }         /* end for */
+    }             /* end if */
     else {
         /* A raw data access could span 1 or 2 PB entries at this point so
            we need to handle that */
@@ -817,7 +835,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
         for (i = 0; i < num_touched_pages; i++) {
             haddr_t buf_offset;
 
-            /* Calculate the aligned address of the page to search for it in the skip list */
+            /* Calculate the aligned address of the page to search for it in the page index */
             search_addr = (0 == i ? first_page_addr : last_page_addr);
 
             /* Calculate the access size if the access spans more than 1 page */
@@ -827,8 +845,8 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 access_size = (0 == i ? (size_t)((first_page_addr + page_buf->page_size) - addr)
                                       : (size - access_size));
 
-            /* Lookup the page in the skip list */
-            page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf->index, search_addr, page_entry);
 
             /* if found */
             if (page_entry) {
@@ -839,14 +857,18 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 H5MM_memcpy((uint8_t *)buf + buf_offset, (uint8_t *)page_entry->page_buf_ptr + offset,
                             access_size);
 
-                /* Update LRU */
-                H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                /* Mark the page referenced for CLOCK */
+                page_entry->referenced = TRUE;
+
+                /* First read of a page that was read ahead keeps the readahead going */
+                if (page_entry->prefetched) {
+                    page_entry->prefetched = FALSE;
+                    page_buf->readahead_hits++;
+                    do_readahead = TRUE;
+                } /* end if */
 
                 /* Update statistics */
-                if (type == H5FD_MEM_DRAW)
-                    page_buf->hits[1]++;
-                else
-                    page_buf->hits[0]++;
+                H5PB__UPDATE_STATS(page_buf, thread_stats, hits, type)
             } /* end if */
             /* if not found */
             else {
@@ -855,7 +877,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 haddr_t eoa;
 
                 /* make space for new entry */
-                if ((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
+                if ((page_buf->clock_list_len * page_buf->page_size) >= page_buf->max_size) {
                     htri_t can_make_space;
 
                     /* check if we can make space in page buffer */
@@ -920,14 +942,25 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                 if (H5PB__insert_entry(page_buf, page_entry) < 0)
                     HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer");
 
+                /* A miss on the page following the last one read starts a readahead */
+                if (H5_addr_defined(page_buf->seq_last_addr) &&
+                    search_addr == page_buf->seq_last_addr + page_buf->page_size)
+                    do_readahead = TRUE;
+
                 /* Update statistics */
-                if (type == H5FD_MEM_DRAW)
-                    page_buf->misses[1]++;
-                else
-                    page_buf->misses[0]++;
+                H5PB__UPDATE_STATS(page_buf, thread_stats, misses, type)
             } /* end else */
-        }     /* end for */
-    }         /* end else */
+
+            /* Remember the last raw data page read, for sequential access detection */
+            if (H5FD_MEM_DRAW == type)
+                page_buf->seq_last_addr = search_addr;
+        } /* end for */
+
+        /* Read the pages following a sequential raw data access ahead */
+        if (do_readahead && H5FD_MEM_DRAW == type && page_buf->readahead > 0)
+            if (H5PB__readahead(f_sh, page_buf, page_buf->seq_last_addr) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "page buffer readahead failed");
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -947,17 +980,18 @@ done:
 herr_t
 H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf)
 {
-    H5PB_t       *page_buf;                        /* Page buffering info for this file */
-    H5PB_entry_t *page_entry;                      /* Pointer to the corresponding page entry */
-    H5FD_t       *file;                            /* File driver pointer */
-    haddr_t       first_page_addr, last_page_addr; /* Addresses of the first and last pages covered by I/O */
-    haddr_t       offset;
-    haddr_t       search_addr;       /* Address of current page */
-    hsize_t       num_touched_pages; /* Number of pages accessed */
-    size_t        access_size = 0;
-    hbool_t       bypass_pb   = FALSE; /* Whether to bypass page buffering */
-    hsize_t       i;                   /* Local index variable */
-    herr_t        ret_value = SUCCEED; /* Return value */
+    H5PB_t              *page_buf;     /* Page buffering info for this file */
+    H5PB_thread_stats_t *thread_stats; /* Statistics for the calling thread */
+    H5PB_entry_t        *page_entry;   /* Pointer to the corresponding page entry */
+    H5FD_t              *file;         /* File driver pointer */
+    haddr_t              first_page_addr, last_page_addr; /* First and last pages covered by I/O */
+    haddr_t              offset;
+    haddr_t              search_addr;       /* Address of current page */
+    hsize_t              num_touched_pages; /* Number of pages accessed */
+    size_t               access_size = 0;
+    hbool_t              bypass_pb   = FALSE; /* Whether to bypass page buffering */
+    hsize_t              i;                   /* Local index variable */
+    herr_t               ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
@@ -1016,12 +1050,9 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
     } /* end if */
 
     /* Update statistics */
-    if (page_buf) {
-        if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-            page_buf->accesses[1]++;
-        else
-            page_buf->accesses[0]++;
-    } /* end if */
+    if (NULL == (thread_stats = H5PB__get_thread_stats(page_buf)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "can't get page buffer statistics for thread");
+    H5PB__UPDATE_STATS(page_buf, thread_stats, accesses, type)
 
     /* Calculate the aligned address of the first page */
     first_page_addr = (addr / page_buf->page_size) * page_buf->page_size;
@@ -1059,8 +1090,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
 
             /* Special handling for the first page if it is not a full page update */
             if (i == 0 && first_page_addr != addr) {
-                /* Lookup the page in the skip list */
-                page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+                /* Lookup the page in the page index */
+                H5PB__SEARCH_INDEX(page_buf->index, search_addr, page_entry);
                 if (page_entry) {
                     offset = addr - first_page_addr;
                     assert(page_buf->page_size > offset);
@@ -1069,9 +1100,9 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                     H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, buf,
                                 page_buf->page_size - (size_t)offset);
 
-                    /* Mark page dirty and push to top of LRU */
-                    page_entry->is_dirty = TRUE;
-                    H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                    /* Mark page dirty and referenced for CLOCK */
+                    page_entry->is_dirty   = TRUE;
+                    page_entry->referenced = TRUE;
                 } /* end if */
             }     /* end if */
             /* Special handling for the last page if it is not a full page update */
@@ -1079,8 +1110,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                      (search_addr + page_buf->page_size) != (addr + size)) {
                 assert(search_addr + page_buf->page_size > addr + size);
 
-                /* Lookup the page in the skip list */
-                page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+                /* Lookup the page in the page index */
+                H5PB__SEARCH_INDEX(page_buf->index, search_addr, page_entry);
                 if (page_entry) {
                     offset = (num_touched_pages - 2) * page_buf->page_size +
                              (page_buf->page_size - (addr - first_page_addr));
@@ -1089,17 +1120,18 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                     H5MM_memcpy(page_entry->page_buf_ptr, (const uint8_t *)buf + offset,
                                 (size_t)((addr + size) - last_page_addr));
 
-                    /* Mark page dirty and push to top of LRU */
-                    page_entry->is_dirty = TRUE;
-                    H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                    /* Mark page dirty and referenced for CLOCK */
+                    page_entry->is_dirty   = TRUE;
+                    page_entry->referenced = TRUE;
                 } /* end if */
             }     /* end else-if */
             /* Discard all fully written pages from the page buffer */
             else {
-                page_entry = (H5PB_entry_t *)H5SL_remove(page_buf->slist_ptr, (void *)(&search_addr));
+                H5PB__SEARCH_INDEX(page_buf->index, search_addr, page_entry);
                 if (page_entry) {
-                    /* Remove from LRU list */
-                    H5PB__REMOVE_LRU(page_buf, page_entry)
+                    /* Remove from the page index and CLOCK ring */
+                    HASH_DELETE(hh, page_buf->index, page_entry);
+                    H5PB__REMOVE_CLOCK(page_buf, page_entry)
 
                     /* Decrement page count of appropriate type */
                     if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
@@ -1120,7 +1152,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
         for (i = 0; i < num_touched_pages; i++) {
             haddr_t buf_offset;
 
-            /* Calculate the aligned address of the page to search for it in the skip list */
+            /* Calculate the aligned address of the page to search for it in the page index */
             search_addr = (0 == i ? first_page_addr : last_page_addr);
 
             /* Calculate the access size if the access spans more than 1 page */
@@ -1130,8 +1162,8 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 access_size =
                     (0 == i ? (size_t)(first_page_addr + page_buf->page_size - addr) : (size - access_size));
 
-            /* Lookup the page in the skip list */
-            page_entry = (H5PB_entry_t *)H5SL_search(page_buf->slist_ptr, (void *)(&search_addr));
+            /* Lookup the page in the page index */
+            H5PB__SEARCH_INDEX(page_buf->index, search_addr, page_entry);
 
             /* If found */
             if (page_entry) {
@@ -1142,15 +1174,12 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 H5MM_memcpy((uint8_t *)page_entry->page_buf_ptr + offset, (const uint8_t *)buf + buf_offset,
                             access_size);
 
-                /* Mark page dirty and push to top of LRU */
-                page_entry->is_dirty = TRUE;
-                H5PB__MOVE_TO_TOP_LRU(page_buf, page_entry)
+                /* Mark page dirty and referenced for CLOCK */
+                page_entry->is_dirty   = TRUE;
+                page_entry->referenced = TRUE;
 
                 /* Update statistics */
-                if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-                    page_buf->hits[1]++;
-                else
-                    page_buf->hits[0]++;
+                H5PB__UPDATE_STATS(page_buf, thread_stats, hits, type)
             } /* end if */
             /* If not found */
             else {
@@ -1158,7 +1187,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 size_t page_size = page_buf->page_size;
 
                 /* Make space for new entry */
-                if ((H5SL_count(page_buf->slist_ptr) * page_buf->page_size) >= page_buf->max_size) {
+                if ((page_buf->clock_list_len * page_buf->page_size) >= page_buf->max_size) {
                     htri_t can_make_space;
 
                     /* Check if we can make space in page buffer */
@@ -1181,11 +1210,14 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                 }     /* end if */
 
                 /* Don't bother searching if there is no write access */
-                if (H5F_ACC_RDWR & H5F_SHARED_INTENT(f_sh))
-                    /* Lookup & remove the page from the new skip list page if
+                if (H5F_ACC_RDWR & H5F_SHARED_INTENT(f_sh)) {
+                    /* Lookup & remove the page from the new page index if
                      * it exists to see if this is a new page from the MF layer
                      */
-                    page_entry = (H5PB_entry_t *)H5SL_remove(page_buf->mf_slist_ptr, (void *)(&search_addr));
+                    H5PB__SEARCH_INDEX(page_buf->mf_index, search_addr, page_entry);
+                    if (page_entry)
+                        HASH_DELETE(hh, page_buf->mf_index, page_entry);
+                } /* end if */
 
                 /* Calculate offset into the buffer of the page and the user buffer */
                 offset     = (0 == i ? addr - search_addr : 0);
@@ -1204,10 +1236,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                     page_entry->page_buf_ptr = new_page_buf;
 
                     /* Update statistics */
-                    if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-                        page_buf->hits[1]++;
-                    else
-                        page_buf->hits[0]++;
+                    H5PB__UPDATE_STATS(page_buf, thread_stats, hits, type)
                 } /* end if */
                 /* Otherwise read page through the VFD layer, but make sure we don't read past the EOA. */
                 else {
@@ -1252,10 +1281,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                             HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed");
 
                         /* Update statistics */
-                        if (type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-                            page_buf->misses[1]++;
-                        else
-                            page_buf->misses[0]++;
+                        H5PB__UPDATE_STATS(page_buf, thread_stats, misses, type)
                     } /* end if */
                 }     /* end else */
 
@@ -1350,7 +1376,7 @@ H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, hbool_t *enabled)
  *              What follows is my best understanding of Mohamad's intent.
  *
  *              Insert the supplied page into the page buffer, both the
- *              skip list and the LRU.
+ *              page index and the CLOCK ring.
  *
  *              As best I can tell, this function imposes no limit on the
  *              number of entries in the page buffer beyond an assertion
@@ -1366,14 +1392,17 @@ H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, hbool_t *enabled)
 static herr_t
 H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    H5PB_entry_t *old_entry;           /* Entry already in the index at the page's address */
+    herr_t        ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
-    /* Insert entry in skip list */
-    if (H5SL_insert(page_buf->slist_ptr, page_entry, &(page_entry->addr)) < 0)
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "can't insert entry in skip list");
-    assert(H5SL_count(page_buf->slist_ptr) * page_buf->page_size <= page_buf->max_size);
+    /* Insert entry in page index */
+    H5PB__SEARCH_INDEX(page_buf->index, page_entry->addr, old_entry);
+    if (old_entry)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "page already in page index");
+    HASH_ADD(hh, page_buf->index, addr, sizeof(haddr_t), page_entry);
+    assert(HASH_COUNT(page_buf->index) * page_buf->page_size <= page_buf->max_size);
 
     /* Increment appropriate page count */
     if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
@@ -1381,8 +1410,8 @@ H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
     else
         page_buf->meta_count++;
 
-    /* Insert entry in LRU */
-    H5PB__INSERT_LRU(page_buf, page_entry)
+    /* Insert entry in CLOCK ring */
+    H5PB__INSERT_CLOCK(page_buf, page_entry)
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1408,8 +1437,10 @@ done:
 static htri_t
 H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
 {
-    H5PB_entry_t *page_entry;       /* Pointer to page eviction candidate */
-    htri_t        ret_value = TRUE; /* Return value */
+    H5PB_entry_t *page_entry;             /* Pointer to page eviction candidate */
+    H5PB_entry_t *first_protected = NULL; /* First page skipped for its type's minimum count */
+    size_t        scanned;                /* Number of pages the CLOCK hand has passed */
+    htri_t        ret_value = TRUE;       /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -1417,9 +1448,6 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
     assert(f_sh);
     assert(page_buf);
 
-    /* Get oldest entry */
-    page_entry = page_buf->LRU_tail_ptr;
-
     if (H5FD_MEM_DRAW == inserted_type) {
         /* If threshould is 100% metadata and page buffer is full of
            metadata, then we can't make space for raw data */
@@ -1427,15 +1455,6 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
             assert(page_buf->meta_count * page_buf->page_size == page_buf->max_size);
             HGOTO_DONE(FALSE);
         } /* end if */
-
-        /* check the metadata threshold before evicting metadata items */
-        while (1) {
-            if (page_entry->prev && H5F_MEM_PAGE_META == page_entry->type &&
-                page_buf->min_meta_count >= page_buf->meta_count)
-                page_entry = page_entry->prev;
-            else
-                break;
-        } /* end while */
     }     /* end if */
     else {
         /* If threshould is 100% raw data and page buffer is full of
@@ -1444,25 +1463,56 @@ H5PB__make_space(H5F_shared_t *f_sh, H5PB_t *page_buf, H5FD_mem_t inserted_type)
             assert(page_buf->raw_count * page_buf->page_size == page_buf->max_size);
             HGOTO_DONE(FALSE);
         } /* end if */
+    }     /* end else */
 
-        /* check the raw data threshold before evicting raw data items */
-        while (1) {
-            if (page_entry->prev &&
-                (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type) &&
-                page_buf->min_raw_count >= page_buf->raw_count)
-                page_entry = page_entry->prev;
-            else
+    /* Sweep the CLOCK hand until it reaches an unreferenced page that may
+     * be evicted, clearing reference bits as it passes.  Pages whose type
+     * is at or below its minimum count are skipped, but the hand is left
+     * on the first of them so they are the first candidates once their
+     * type is back above its minimum.  Two full turns are enough to clear
+     * every reference bit, so if the hand comes back without a candidate,
+     * everything left is protected and the page under the hand is evicted
+     * regardless.
+     */
+    page_entry = page_buf->clock_hand_ptr;
+    assert(page_entry);
+    for (scanned = 0; scanned < 2 * page_buf->clock_list_len; scanned++) {
+        hbool_t protected_page;
+
+        if (H5FD_MEM_DRAW == inserted_type)
+            /* check the metadata threshold before evicting metadata items */
+            protected_page = (H5F_MEM_PAGE_META == page_entry->type &&
+                              page_buf->min_meta_count >= page_buf->meta_count);
+        else
+            /* check the raw data threshold before evicting raw data items */
+            protected_page =
+                ((H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type) &&
+                 page_buf->min_raw_count >= page_buf->raw_count);
+
+        if (protected_page) {
+            if (NULL == first_protected)
+                first_protected = page_entry;
+        } /* end if */
+        else {
+            if (!page_entry->referenced)
                 break;
-        } /* end while */
-    }     /* end else */
+            page_entry->referenced = FALSE;
+        } /* end else */
+
+        page_entry = H5PB__CLOCK_NEXT(page_buf, page_entry);
+    } /* end for */
+    if (scanned == 2 * page_buf->clock_list_len) {
+        page_entry      = page_buf->clock_hand_ptr;
+        first_protected = NULL;
+    } /* end if */
+    page_buf->clock_hand_ptr = first_protected ? first_protected : page_entry;
 
     /* Remove from page index */
-    if (NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
-        HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Tail Page Entry is not in skip list");
+    HASH_DELETE(hh, page_buf->index, page_entry);
 
-    /* Remove entry from LRU list */
-    H5PB__REMOVE_LRU(page_buf, page_entry)
-    assert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+    /* Remove entry from CLOCK ring */
+    H5PB__REMOVE_CLOCK(page_buf, page_entry)
+    assert(HASH_COUNT(page_buf->index) == page_buf->clock_list_len);
 
     /* Decrement appropriate page type counter */
     if (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
@@ -1541,3 +1591,236 @@ H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB__write_entry() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__get_thread_stats
+ *
+ * Purpose:     Look up the statistics record for the calling thread,
+ *              creating it on the thread's first access to the page
+ *              buffer.
+ *
+ *              Thread IDs may be reused once a thread is joined, in
+ *              which case the new thread picks up the old one's counts.
+ *
+ * Return:      Pointer to the record on success/NULL on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5PB_thread_stats_t *
+H5PB__get_thread_stats(H5PB_t *page_buf)
+{
+    H5PB_thread_stats_t *thread_stats = NULL;              /* Statistics for the thread */
+    uint64_t             thread_id    = H5TS_thread_id(); /* ID of the calling thread */
+    H5PB_thread_stats_t *ret_value    = NULL;              /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    assert(page_buf);
+
+    /* Most accesses come from the same thread as the previous one */
+    if (page_buf->last_thread_stats && page_buf->last_thread_stats->thread_id == thread_id)
+        HGOTO_DONE(page_buf->last_thread_stats);
+
+    HASH_FIND(hh, page_buf->thread_stats, &thread_id, sizeof(uint64_t), thread_stats);
+    if (NULL == thread_stats) {
+        if (NULL == (thread_stats = H5FL_CALLOC(H5PB_thread_stats_t)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, NULL, "memory allocation failed");
+        thread_stats->thread_id = thread_id;
+        HASH_ADD(hh, page_buf->thread_stats, thread_id, sizeof(uint64_t), thread_stats);
+    } /* end if */
+
+    page_buf->last_thread_stats = thread_stats;
+    ret_value                   = thread_stats;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__get_thread_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__free_thread_stats
+ *
+ * Purpose:     Release all the per-thread statistics records.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PB__free_thread_stats(H5PB_t *page_buf)
+{
+    H5PB_thread_stats_t *thread_stats, *tmp; /* Statistics records */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    assert(page_buf);
+
+    HASH_ITER(hh, page_buf->thread_stats, thread_stats, tmp)
+    {
+        HASH_DELETE(hh, page_buf->thread_stats, thread_stats);
+        thread_stats = H5FL_FREE(H5PB_thread_stats_t, thread_stats);
+    } /* end HASH_ITER */
+    page_buf->last_thread_stats = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5PB__free_thread_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__entry_addr_cmp
+ *
+ * Purpose:     Compare two page entries by address, for sorting the page
+ *              index before a flush.
+ *
+ * Return:      <0, 0 or >0 as the first entry's address is below, equal
+ *              to or above the second's
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5PB__entry_addr_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5PB_entry_t *entry1 = (const H5PB_entry_t *)_entry1;
+    const H5PB_entry_t *entry2 = (const H5PB_entry_t *)_entry2;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI(H5_addr_cmp(entry1->addr, entry2->addr))
+} /* end H5PB__entry_addr_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5PB__readahead
+ *
+ * Purpose:     Read the raw data pages following the page at PAGE_ADDR
+ *              into the page buffer with a single vector read, so that a
+ *              sequential scan finds them there.
+ *
+ *              The window covers the page buffer's readahead count of
+ *              pages after PAGE_ADDR.  It is only refilled once less
+ *              than half of it is left from the previous readahead, so
+ *              each vector read brings in at least half a window.  Pages
+ *              already in the page buffer or just allocated by the MF
+ *              layer are skipped, and nothing past the EOA is read.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__readahead(H5F_shared_t *f_sh, H5PB_t *page_buf, haddr_t page_addr)
+{
+    H5PB_entry_t **entries = NULL;       /* Pages being read ahead */
+    H5FD_mem_t    *types   = NULL;       /* Memory types for the vector read */
+    haddr_t       *addrs   = NULL;       /* Addresses for the vector read */
+    size_t        *sizes   = NULL;       /* Sizes for the vector read */
+    void         **bufs    = NULL;       /* Buffers for the vector read */
+    uint32_t       count   = 0;          /* Number of pages read ahead */
+    haddr_t        start_addr, end_addr; /* Window of pages to read ahead */
+    haddr_t        search_addr;          /* Address of current page */
+    haddr_t        eoa;                  /* Current EOA for the file */
+    uint32_t       u;                    /* Local index variable */
+    herr_t         ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(f_sh);
+    assert(page_buf);
+    assert(page_buf->readahead > 0);
+
+    /* Compute the window, skipping what an earlier readahead already covered */
+    start_addr = page_addr + page_buf->page_size;
+    end_addr   = start_addr + (haddr_t)page_buf->readahead * page_buf->page_size;
+    if (H5_addr_defined(page_buf->ra_next_addr) && page_buf->ra_next_addr > start_addr &&
+        page_buf->ra_next_addr <= end_addr) {
+        /* Wait until less than half the window is left */
+        if ((page_buf->ra_next_addr - start_addr) / page_buf->page_size >= (page_buf->readahead + 1) / 2)
+            HGOTO_DONE(SUCCEED);
+        start_addr = page_buf->ra_next_addr;
+    } /* end if */
+
+    /* Don't read ahead past the EOA */
+    if (HADDR_UNDEF == (eoa = H5F_shared_get_eoa(f_sh, H5FD_MEM_DRAW)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed");
+    if (end_addr > eoa)
+        end_addr = eoa;
+    if (start_addr >= end_addr)
+        HGOTO_DONE(SUCCEED);
+
+    /* Allocate the vector read arrays */
+    if (NULL == (entries = (H5PB_entry_t **)H5MM_malloc(page_buf->readahead * sizeof(H5PB_entry_t *))) ||
+        NULL == (types = (H5FD_mem_t *)H5MM_malloc(page_buf->readahead * sizeof(H5FD_mem_t))) ||
+        NULL == (addrs = (haddr_t *)H5MM_malloc(page_buf->readahead * sizeof(haddr_t))) ||
+        NULL == (sizes = (size_t *)H5MM_malloc(page_buf->readahead * sizeof(size_t))) ||
+        NULL == (bufs = (void **)H5MM_malloc(page_buf->readahead * sizeof(void *))))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for readahead vectors");
+
+    /* Set up a page entry for each page in the window that isn't cached yet */
+    for (search_addr = start_addr; search_addr < end_addr; search_addr += page_buf->page_size) {
+        H5PB_entry_t *page_entry;
+
+        /* Skip pages already in the page buffer, and new pages that have nothing to read */
+        H5PB__SEARCH_INDEX(page_buf->index, search_addr, page_entry);
+        if (NULL == page_entry)
+            H5PB__SEARCH_INDEX(page_buf->mf_index, search_addr, page_entry);
+        if (page_entry)
+            continue;
+
+        /* Make space for the page, stopping if the raw data pages can't grow */
+        if (((page_buf->clock_list_len + count) * page_buf->page_size) >= page_buf->max_size) {
+            htri_t can_make_space;
+
+            if ((can_make_space = H5PB__make_space(f_sh, page_buf, H5FD_MEM_DRAW)) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "make space in Page buffer Failed");
+            if (0 == can_make_space)
+                break;
+        } /* end if */
+
+        /* Create the new PB entry */
+        if (NULL == (page_entry = H5FL_CALLOC(H5PB_entry_t)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed");
+        entries[count++] = page_entry;
+        if (NULL == (page_entry->page_buf_ptr = H5FL_FAC_MALLOC(page_buf->page_fac)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer entry");
+        page_entry->addr       = search_addr;
+        page_entry->type       = H5F_MEM_PAGE_DRAW;
+        page_entry->prefetched = TRUE;
+
+        types[count - 1] = H5FD_MEM_DRAW;
+        addrs[count - 1] = search_addr;
+        sizes[count - 1] = (size_t)MIN(page_buf->page_size, eoa - search_addr);
+        bufs[count - 1]  = page_entry->page_buf_ptr;
+    } /* end for */
+    page_buf->ra_next_addr = search_addr;
+
+    if (count > 0) {
+        /* Read all the pages with one vector read */
+        if (H5FD_read_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver vector read request failed");
+
+        /* Insert the pages into the PB */
+        for (u = 0; u < count; u++) {
+            if (H5PB__insert_entry(page_buf, entries[u]) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer");
+            entries[u] = NULL;
+        } /* end for */
+        page_buf->readahead_pages += count;
+    } /* end if */
+
+done:
+    /* Release any pages that didn't make it into the PB */
+    if (entries)
+        for (u = 0; u < count; u++)
+            if (entries[u]) {
+                if (entries[u]->page_buf_ptr)
+                    entries[u]->page_buf_ptr = H5FL_FAC_FREE(page_buf->page_fac, entries[u]->page_buf_ptr);
+                entries[u] = H5FL_FREE(H5PB_entry_t, entries[u]);
+            } /* end if */
+    H5MM_xfree(entries);
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__readahead() */
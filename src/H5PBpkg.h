@@ -26,6 +26,10 @@
 /* Package Private Macros */
 /**************************/
 
+/* Look up the page at PAGE_ADDR in a page index, setting ENTRY_PTR to NULL if not found */
+#define H5PB__SEARCH_INDEX(index_ptr, page_addr, entry_ptr)                                                  \
+    HASH_FIND(hh, (index_ptr), &(page_addr), sizeof(haddr_t), (entry_ptr))
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -35,12 +39,26 @@ typedef struct H5PB_entry_t {
     haddr_t        addr;         /* Address of the page in the file */
     H5F_mem_page_t type;         /* Type of the page entry (H5F_MEM_PAGE_RAW/META) */
     hbool_t        is_dirty;     /* Flag indicating whether the page has dirty data or not */
+    hbool_t        prefetched;   /* Flag indicating the page was read ahead and hasn't been read since */
 
     /* Fields supporting replacement policies */
-    struct H5PB_entry_t *next; /* next pointer in the LRU list */
-    struct H5PB_entry_t *prev; /* previous pointer in the LRU list */
+    hbool_t              referenced; /* CLOCK reference bit, set on every access to the page */
+    struct H5PB_entry_t *next;       /* next pointer in the CLOCK ring */
+    struct H5PB_entry_t *prev;       /* previous pointer in the CLOCK ring */
+
+    UT_hash_handle hh; /* Hash table handle for the page index (must be last) */
 } H5PB_entry_t;
 
+/* Metadata / raw data statistics gathered for a single thread */
+typedef struct H5PB_thread_stats_t {
+    uint64_t thread_id;   /* Thread the statistics belong to, from H5TS_thread_id() */
+    unsigned accesses[2]; /* Metadata / raw data accesses made by the thread */
+    unsigned hits[2];     /* Metadata / raw data hits seen by the thread */
+    unsigned misses[2];   /* Metadata / raw data misses seen by the thread */
+
+    UT_hash_handle hh; /* Hash table handle (must be last) */
+} H5PB_thread_stats_t;
+
 /*****************************/
 /* Package Private Variables */
 /*****************************/
@@ -24,7 +24,6 @@
 #include "H5private.h"   /* Generic Functions			*/
 #include "H5Fprivate.h"  /* File access				*/
 #include "H5FLprivate.h" /* Free Lists                           */
-#include "H5SLprivate.h" /* Skip List				*/
 
 /**************************/
 /* Library Private Macros */
@@ -34,8 +33,9 @@
 /* Library Private Typedefs */
 /****************************/
 
-/* Forward declaration for a page buffer entry */
+/* Forward declarations for a page buffer entry and per-thread statistics */
 struct H5PB_entry_t;
+struct H5PB_thread_stats_t;
 
 /* Typedef for the main structure for the page buffer */
 typedef struct H5PB_t {
@@ -47,22 +47,34 @@ typedef struct H5PB_t {
     unsigned raw_count;      /* Number of entries for raw data */
     unsigned min_meta_count; /* Minimum # of entries for metadata */
     unsigned min_raw_count;  /* Minimum # of entries for raw data */
+    unsigned readahead;      /* # of raw data pages to read ahead of a sequential access */
 
-    H5SL_t *slist_ptr;    /* Skip list with all the active page entries */
-    H5SL_t *mf_slist_ptr; /* Skip list containing newly allocated page entries inserted from the MF layer */
+    struct H5PB_entry_t *index;    /* Hash table with all the active page entries, keyed on address */
+    struct H5PB_entry_t *mf_index; /* Hash table of newly allocated page entries inserted from the MF layer */
 
-    size_t               LRU_list_len; /* Number of entries in the LRU (identical to slist_ptr count) */
-    struct H5PB_entry_t *LRU_head_ptr; /* Head pointer of the LRU */
-    struct H5PB_entry_t *LRU_tail_ptr; /* Tail pointer of the LRU */
+    size_t               clock_list_len; /* Number of entries on the CLOCK ring (identical to index count) */
+    struct H5PB_entry_t *clock_head_ptr; /* Head pointer of the CLOCK ring */
+    struct H5PB_entry_t *clock_tail_ptr; /* Tail pointer of the CLOCK ring */
+    struct H5PB_entry_t *clock_hand_ptr; /* Next eviction candidate on the CLOCK ring */
 
     H5FL_fac_head_t *page_fac; /* Factory for allocating pages */
 
+    /* Sequential raw data access detection */
+    haddr_t seq_last_addr; /* Address of the last raw data page read */
+    haddr_t ra_next_addr;  /* Address just past the last page read ahead */
+
     /* Statistics */
     unsigned accesses[2];
     unsigned hits[2];
     unsigned misses[2];
     unsigned evictions[2];
     unsigned bypasses[2];
+    unsigned readahead_pages; /* Raw data pages read ahead */
+    unsigned readahead_hits;  /* Pages read ahead that were read afterwards */
+
+    /* Per-thread statistics, keyed on H5TS_thread_id() */
+    struct H5PB_thread_stats_t *thread_stats;      /* Hash table of per-thread statistics */
+    struct H5PB_thread_stats_t *last_thread_stats; /* Most recently used per-thread record */
 } H5PB_t;
 
 /*****************************/
@@ -75,7 +87,7 @@ typedef struct H5PB_t {
 
 /* General routines */
 H5_DLL herr_t H5PB_create(H5F_shared_t *f_sh, size_t page_buffer_size, unsigned page_buf_min_meta_perc,
-                          unsigned page_buf_min_raw_perc);
+                          unsigned page_buf_min_raw_perc, unsigned page_buf_readahead);
 H5_DLL herr_t H5PB_flush(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_dest(H5F_shared_t *f_sh);
 H5_DLL herr_t H5PB_add_new_page(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t page_addr);
@@ -89,6 +101,8 @@ H5_DLL herr_t H5PB_enabled(H5F_shared_t *f_sh, H5FD_mem_t type, hbool_t *enabled
 H5_DLL herr_t H5PB_reset_stats(H5PB_t *page_buf);
 H5_DLL herr_t H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
                              unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+H5_DLL herr_t H5PB_get_thread_stats(const H5PB_t *page_buf, uint64_t thread_id, unsigned accesses[2],
+                                    unsigned hits[2], unsigned misses[2]);
 H5_DLL herr_t H5PB_print_stats(const H5PB_t *page_buf);
 
 #endif /* H5PBprivate_H */
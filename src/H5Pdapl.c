@@ -67,6 +67,11 @@
 #define H5D_ACS_VDS_PRINTF_GAP_DEF  (hsize_t)0
 #define H5D_ACS_VDS_PRINTF_GAP_ENC  H5P__encode_hsize_t
 #define H5D_ACS_VDS_PRINTF_GAP_DEC  H5P__decode_hsize_t
+/* Definitions for max # of open VDS source datasets */
+#define H5D_ACS_VDS_MAX_OPEN_SOURCES_SIZE sizeof(size_t)
+#define H5D_ACS_VDS_MAX_OPEN_SOURCES_DEF  0 /* No limit */
+#define H5D_ACS_VDS_MAX_OPEN_SOURCES_ENC  H5P__encode_size_t
+#define H5D_ACS_VDS_MAX_OPEN_SOURCES_DEC  H5P__decode_size_t
 /* Definitions for VDS file prefix */
 #define H5D_ACS_VDS_PREFIX_SIZE  sizeof(char *)
 #define H5D_ACS_VDS_PREFIX_DEF   NULL /*default is no prefix */
@@ -191,9 +196,10 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     size_t rdcc_nslots = H5D_ACS_DATA_CACHE_NUM_SLOTS_DEF;    /* Default raw data chunk cache # of slots */
     size_t rdcc_nbytes = H5D_ACS_DATA_CACHE_BYTE_SIZE_DEF;    /* Default raw data chunk cache # of bytes */
     double rdcc_w0     = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;     /* Default raw data chunk cache dirty ratio */
-    H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;       /* Default VDS view option */
-    hsize_t        printf_gap   = H5D_ACS_VDS_PRINTF_GAP_DEF; /* Default VDS printf gap */
-    herr_t         ret_value    = SUCCEED;                    /* Return value */
+    H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;             /* Default VDS view option */
+    hsize_t        printf_gap   = H5D_ACS_VDS_PRINTF_GAP_DEF;       /* Default VDS printf gap */
+    size_t         max_open     = H5D_ACS_VDS_MAX_OPEN_SOURCES_DEF; /* Default max # of open VDS sources */
+    herr_t         ret_value    = SUCCEED;                          /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -226,6 +232,12 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the max # of open VDS source datasets */
+    if (H5P__register_real(pclass, H5D_ACS_VDS_MAX_OPEN_SOURCES_NAME, H5D_ACS_VDS_MAX_OPEN_SOURCES_SIZE,
+                           &max_open, NULL, NULL, NULL, H5D_ACS_VDS_MAX_OPEN_SOURCES_ENC,
+                           H5D_ACS_VDS_MAX_OPEN_SOURCES_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
     /* Register property for vds prefix */
     if (H5P__register_real(pclass, H5D_ACS_VDS_PREFIX_NAME, H5D_ACS_VDS_PREFIX_SIZE, &H5D_def_vds_prefix_g,
                            NULL, H5D_ACS_VDS_PREFIX_SET, H5D_ACS_VDS_PREFIX_GET, H5D_ACS_VDS_PREFIX_ENC,
@@ -1266,6 +1278,76 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_virtual_printf_gap() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_virtual_max_open_sources
+ *
+ * Purpose:     Sets the access property list for the virtual dataset,
+ *              dapl_id, to keep at most max_open source datasets of the
+ *              mappings without unlimited selections open between I/O
+ *              operations.  The source datasets used least recently are
+ *              closed after an I/O operation, and opened again when an
+ *              I/O operation needs them.  A value of 0, the default,
+ *              keeps all of them open until the virtual dataset is
+ *              closed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_virtual_max_open_sources(hid_t plist_id, size_t max_open)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, max_open);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_ACS_VDS_MAX_OPEN_SOURCES_NAME, &max_open) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_virtual_max_open_sources() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_virtual_max_open_sources
+ *
+ * Purpose:     Gets the maximum number of source datasets of the
+ *              mappings without unlimited selections kept open between
+ *              I/O operations, max_open, using the access property list
+ *              for the virtual dataset, dapl_id.  The default library
+ *              value for max_open is 0, for no limit.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_virtual_max_open_sources(hid_t plist_id, size_t *max_open /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, max_open);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value from property list */
+    if (max_open)
+        if (H5P_get(plist, H5D_ACS_VDS_MAX_OPEN_SOURCES_NAME, max_open) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_virtual_max_open_sources() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Pset_append_flush
  *
@@ -90,7 +90,8 @@
     {                                                                                                        \
         {HADDR_UNDEF, 0}, 0, NULL, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,                       \
                                        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},                      \
-            H5D_VDS_ERROR, HSIZE_UNDEF, -1, -1, FALSE                                                        \
+            H5D_VDS_ERROR, HSIZE_UNDEF, -1, -1, FALSE, 0, 0, FALSE, NULL, NULL, NULL, NULL, 0, 0, 0, NULL,   \
+            NULL                                                                                             \
     }
 #define H5D_DEF_STORAGE_COMPACT                                                                              \
     {                                                                                                        \
@@ -146,6 +146,11 @@
     {                                                                                                        \
         NULL, NULL                                                                                           \
     }
+/* Definitions for type conversion threads property */
+#define H5D_XFER_CONV_NTHREADS_SIZE sizeof(unsigned)
+#define H5D_XFER_CONV_NTHREADS_DEF  0
+#define H5D_XFER_CONV_NTHREADS_ENC  H5P__encode_unsigned
+#define H5D_XFER_CONV_NTHREADS_DEC  H5P__decode_unsigned
 /* Definitions for data transform property */
 #define H5D_XFER_XFORM_SIZE  sizeof(void *)
 #define H5D_XFER_XFORM_DEF   NULL
@@ -175,6 +180,9 @@
 /* Definitions for cause of no selection I/O property */
 #define H5D_XFER_NO_SELECTION_IO_CAUSE_SIZE sizeof(uint32_t)
 #define H5D_XFER_NO_SELECTION_IO_CAUSE_DEF  0
+/* Definitions for actual type conversion property */
+#define H5D_XFER_ACTUAL_TYPE_CONV_SIZE sizeof(uint32_t)
+#define H5D_XFER_ACTUAL_TYPE_CONV_DEF  0
 /* Definitions for modify write buffer property */
 #define H5D_XFER_MODIFY_WRITE_BUF_SIZE sizeof(hbool_t)
 #define H5D_XFER_MODIFY_WRITE_BUF_DEF  FALSE
@@ -290,11 +298,14 @@ static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;       /* Default
 static const H5Z_cb_t  H5D_def_filter_cb_g  = H5D_XFER_FILTER_CB_DEF; /* Default value for filter callback */
 static const H5T_conv_cb_t H5D_def_conv_cb_g =
     H5D_XFER_CONV_CB_DEF; /* Default value for datatype conversion callback */
+static const unsigned H5D_def_conv_nthreads_g =
+    H5D_XFER_CONV_NTHREADS_DEF; /* Default value for datatype conversion threads */
 static const void  *H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF; /* Default value for data transform */
 static const H5S_t *H5D_def_dset_io_sel_g =
     H5D_XFER_DSET_IO_SEL_DEF; /* Default value for dataset I/O selection */
 static const H5D_selection_io_mode_t H5D_def_selection_io_mode_g     = H5D_XFER_SELECTION_IO_MODE_DEF;
 static const uint32_t                H5D_def_no_selection_io_cause_g = H5D_XFER_NO_SELECTION_IO_CAUSE_DEF;
+static const uint32_t                H5D_def_actual_type_conv_g      = H5D_XFER_ACTUAL_TYPE_CONV_DEF;
 static const hbool_t                 H5D_def_modify_write_buf_g      = H5D_XFER_MODIFY_WRITE_BUF_DEF;
 
 /*-------------------------------------------------------------------------
@@ -444,6 +455,12 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the type conversion threads property */
+    if (H5P__register_real(pclass, H5D_XFER_CONV_NTHREADS_NAME, H5D_XFER_CONV_NTHREADS_SIZE,
+                           &H5D_def_conv_nthreads_g, NULL, NULL, NULL, H5D_XFER_CONV_NTHREADS_ENC,
+                           H5D_XFER_CONV_NTHREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
     /* Register the data transform property */
     if (H5P__register_real(pclass, H5D_XFER_XFORM_NAME, H5D_XFER_XFORM_SIZE, &H5D_def_xfer_xform_g, NULL,
                            H5D_XFER_XFORM_SET, H5D_XFER_XFORM_GET, H5D_XFER_XFORM_ENC, H5D_XFER_XFORM_DEC,
@@ -470,6 +487,13 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
                            NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the actual type conversion property */
+    /* (Note: this property should not have an encode/decode callback) */
+    if (H5P__register_real(pclass, H5D_XFER_ACTUAL_TYPE_CONV_NAME, H5D_XFER_ACTUAL_TYPE_CONV_SIZE,
+                           &H5D_def_actual_type_conv_g, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                           NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
     /* Register the modify write buffer property */
     if (H5P__register_real(pclass, H5D_XFER_MODIFY_WRITE_BUF_NAME, H5D_XFER_MODIFY_WRITE_BUF_SIZE,
                            &H5D_def_modify_write_buf_g, NULL, NULL, NULL, H5D_XFER_MODIFY_WRITE_BUF_ENC,
@@ -1394,6 +1418,70 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_type_conv_threads
+ *
+ * Purpose:     Sets the number of threads, including the calling thread,
+ *              that large hardware datatype conversions are split across.
+ *              Values of 0 and 1 convert with the calling thread only.
+ *              The setting only has an effect in multi-thread builds.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_type_conv_threads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Update property list */
+    if (H5P_set(plist, H5D_XFER_CONV_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_type_conv_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_type_conv_threads
+ *
+ * Purpose:     Reads the value set with H5Pset_type_conv_threads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_type_conv_threads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get property */
+    if (nthreads)
+        if (H5P_get(plist, H5D_XFER_CONV_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_type_conv_threads() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pget_btree_ratios
  *
@@ -2456,6 +2544,38 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_no_selection_io_cause() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_actual_type_conv
+ *
+ * Purpose:	    Retrieves where the datatype conversion of the last I/O
+ *              call was performed
+ *
+ * Return:	    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_actual_type_conv(hid_t plist_id, uint32_t *actual_type_conv /*out*/)
+{
+    H5P_genplist_t *plist;
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, actual_type_conv);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Return values */
+    if (actual_type_conv)
+        if (H5P_get(plist, H5D_XFER_ACTUAL_TYPE_CONV_NAME, actual_type_conv) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get actual_type_conv value");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_actual_type_conv() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5P__dxfr_modify_write_buf_enc
  *
@@ -47,24 +47,37 @@
 #include "H5FDmulti.h"
 #include "H5FDstdio.h" /* Standard C buffered I/O                  */
 #include "H5FDsplitter.h"
+#include "H5FDprofile.h"
 #ifdef H5_HAVE_PARALLEL
 #include "H5FDmpio.h"
 #endif
 #ifdef H5_HAVE_DIRECT
 #include "H5FDdirect.h"
 #endif
+#ifdef H5_HAVE_IOURING_VFD
+#include "H5FDiouring.h"
+#endif
 #ifdef H5_HAVE_MIRROR_VFD
 #include "H5FDmirror.h"
 #endif
+#ifdef H5_HAVE_MMAP_VFD
+#include "H5FDmmap.h"
+#endif
 #ifdef H5_HAVE_LIBHDFS
 #include "H5FDhdfs.h"
 #endif
 #ifdef H5_HAVE_ROS3_VFD
 #include "H5FDros3.h"
 #endif
+#ifdef H5_HAVE_STRIPE_VFD
+#include "H5FDstripe.h"
+#endif
 #ifdef H5_HAVE_SUBFILING_VFD
 #include "H5FDsubfiling.h"
 #endif
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+#include "H5FDwritebehind.h"
+#endif
 #ifdef H5_HAVE_WINDOWS
 #include "H5FDwindows.h" /* Win32 I/O                                */
 #endif
@@ -297,6 +310,11 @@
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF  0
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC  H5P__encode_unsigned
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC  H5P__decode_unsigned
+/* Definition for # of raw data pages the page buffer reads ahead */
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_SIZE sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_DEF  0
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_ENC  H5P__encode_unsigned
+#define H5F_ACS_PAGE_BUFFER_READAHEAD_DEC  H5P__decode_unsigned
 /* Definition for file VOL connector properties (ID, etc.) */
 #define H5F_ACS_VOL_CONN_SIZE sizeof(H5VL_connector_prop_t)
 #define H5F_ACS_VOL_CONN_DEF                                                                                 \
@@ -526,6 +544,8 @@ static const unsigned H5F_def_page_buf_min_meta_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF; /* Default page buffer minimum metadata size */
 static const unsigned H5F_def_page_buf_min_raw_perc_g =
     H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF; /* Default page buffer minimum raw data size */
+static const unsigned H5F_def_page_buf_readahead_g =
+    H5F_ACS_PAGE_BUFFER_READAHEAD_DEF; /* Default page buffer readahead window */
 static const hbool_t H5F_def_use_file_locking_g =
     H5F_ACS_USE_FILE_LOCKING_DEF; /* Default use file locking flag */
 static const hbool_t H5F_def_ignore_disabled_file_locks_g =
@@ -806,6 +826,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
 
+    /* Register the page buffer readahead window */
+    if (H5P__register_real(pclass, H5F_ACS_PAGE_BUFFER_READAHEAD_NAME, H5F_ACS_PAGE_BUFFER_READAHEAD_SIZE,
+                           &H5F_def_page_buf_readahead_g, NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_READAHEAD_ENC,
+                           H5F_ACS_PAGE_BUFFER_READAHEAD_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class");
+
     /* Register the file VOL connector ID & info */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if (H5P__register_real(pclass, H5F_ACS_VOL_CONN_NAME, H5F_ACS_VOL_CONN_SIZE, &def_vol_prop,
@@ -977,6 +1003,10 @@ H5P__facc_set_def_driver_check_predefined(const char *driver_name, hid_t *driver
         if ((*driver_id = H5FD_SPLITTER) < 0)
             HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize splitter VFD");
     }
+    else if (!HDstrcmp(driver_name, "profile")) {
+        if ((*driver_id = H5FD_PROFILE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize profiling VFD");
+    }
     else if (!HDstrcmp(driver_name, "mpio")) {
 #ifdef H5_HAVE_PARALLEL
         if ((*driver_id = H5FD_MPIO) < 0)
@@ -991,6 +1021,38 @@ H5P__facc_set_def_driver_check_predefined(const char *driver_name, hid_t *driver
             HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize Direct I/O VFD");
 #else
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "Direct I/O VFD is not enabled");
+#endif
+    }
+    else if (!HDstrcmp(driver_name, "iouring")) {
+#ifdef H5_HAVE_IOURING_VFD
+        if ((*driver_id = H5FD_IOURING) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize io_uring VFD");
+#else
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "io_uring VFD is not enabled");
+#endif
+    }
+    else if (!HDstrcmp(driver_name, "mmap")) {
+#ifdef H5_HAVE_MMAP_VFD
+        if ((*driver_id = H5FD_MMAP) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize mmap VFD");
+#else
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "mmap VFD is not enabled");
+#endif
+    }
+    else if (!HDstrcmp(driver_name, "stripe")) {
+#ifdef H5_HAVE_STRIPE_VFD
+        if ((*driver_id = H5FD_STRIPE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize striping VFD");
+#else
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "striping VFD is not enabled");
+#endif
+    }
+    else if (!HDstrcmp(driver_name, "writebehind")) {
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+        if ((*driver_id = H5FD_WRITEBEHIND) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_UNINITIALIZED, FAIL, "couldn't initialize write-behind VFD");
+#else
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "write-behind VFD is not enabled");
 #endif
     }
     else if (!HDstrcmp(driver_name, "mirror")) {
@@ -3903,6 +3965,21 @@ H5P__facc_cache_config_cmp(const void *_config1, const void *_config2, size_t H5
     if (config1->metadata_write_strategy > config2->metadata_write_strategy)
         HGOTO_DONE(1);
 
+    /* The miss ratio curve fields are ignored (and not encoded) unless
+     * that mode is in use.
+     */
+    if (config1->incr_mode == H5C_incr__mrc) {
+        if (config1->mrc_sample_rate < config2->mrc_sample_rate)
+            HGOTO_DONE(-1);
+        if (config1->mrc_sample_rate > config2->mrc_sample_rate)
+            HGOTO_DONE(1);
+
+        if (config1->mrc_knee_threshold < config2->mrc_knee_threshold)
+            HGOTO_DONE(-1);
+        if (config1->mrc_knee_threshold > config2->mrc_knee_threshold)
+            HGOTO_DONE(1);
+    } /* end if */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_config_cmp() */
@@ -4028,6 +4105,15 @@ H5P__facc_cache_config_enc(const void *value, void **_pp, size_t *size)
 
         /* int */
         INT32ENCODE(*pp, (int32_t)config->metadata_write_strategy);
+
+        /* The miss ratio curve fields are only encoded when they are in use,
+         * so that encodings from earlier versions can still be decoded.
+         */
+        if (config->incr_mode == H5C_incr__mrc) {
+            H5_ENCODE_DOUBLE(*pp, config->mrc_sample_rate);
+
+            H5_ENCODE_DOUBLE(*pp, config->mrc_knee_threshold);
+        } /* end if */
     } /* end if */
 
     /* Compute encoded size of variably-encoded values */
@@ -4045,6 +4131,8 @@ H5P__facc_cache_config_enc(const void *value, void **_pp, size_t *size)
     /* Compute encoded size of fixed-size values */
     *size += (5 + (sizeof(unsigned) * 8) + (sizeof(double) * 8) + (sizeof(int32_t) * 4) + sizeof(int64_t) +
               H5AC__MAX_TRACE_FILE_NAME_LEN + 1);
+    if (config->incr_mode == H5C_incr__mrc)
+        *size += sizeof(double) * 2;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P__facc_cache_config_enc() */
@@ -4176,6 +4264,12 @@ H5P__facc_cache_config_dec(const void **_pp, void *_value)
     /* int */
     INT32DECODE(*pp, config->metadata_write_strategy);
 
+    if (config->incr_mode == H5C_incr__mrc) {
+        H5_DECODE_DOUBLE(*pp, config->mrc_sample_rate);
+
+        H5_DECODE_DOUBLE(*pp, config->mrc_knee_threshold);
+    } /* end if */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_config_dec() */
@@ -5770,6 +5864,69 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_page_buffer_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_readahead
+ *
+ * Purpose:     Set the number of raw data pages the page buffer reads
+ *              ahead once it detects sequential access.  Zero disables
+ *              readahead.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_readahead(hid_t plist_id, unsigned npages)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, npages);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_PAGE_BUFFER_READAHEAD_NAME, &npages) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer readahead window");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_readahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_readahead
+ *
+ * Purpose:    Retrieves the page buffer readahead window.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_readahead(hid_t plist_id, unsigned *npages /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, npages);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get value */
+    if (npages)
+        if (H5P_get(plist, H5F_ACS_PAGE_BUFFER_READAHEAD_NAME, npages) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer readahead window");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_readahead() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5P_set_vol
  *
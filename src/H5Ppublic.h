@@ -402,6 +402,16 @@ typedef enum H5D_mpio_no_collective_cause_t {
     (H5D_SEL_IO_DISABLE_BY_API | H5D_SEL_IO_TCONV_BUF_TOO_SMALL | H5D_SEL_IO_BKG_BUF_TOO_SMALL |             \
      H5D_SEL_IO_DATASET_FILTER | H5D_SEL_IO_CHUNK_CACHE)
 
+/**
+ * Type conversion paths for H5Pget_actual_type_conv() property
+ */
+#define H5D_TYPE_CONV_IN_PLACE                                                                               \
+    (0x0001u) /**< Some or all of the data was converted in the                                              \
+                 application buffer, without the type conversion buffer */
+#define H5D_TYPE_CONV_BUFFER                                                                                 \
+    (0x0002u) /**< Some or all of the data was converted in the                                              \
+                 type conversion buffer */
+
 //! <!--[H5D_selection_io_mode_t_snip] -->
 /**
  * Selection I/O mode property
@@ -4045,6 +4055,24 @@ H5_DLL herr_t H5Pget_multi_type(hid_t fapl_id, H5FD_mem_t *type);
  * \since 1.10.0
  */
 H5_DLL herr_t H5Pget_object_flush_cb(hid_t plist_id, H5F_flush_cb_t *func, void **udata);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the page buffer readahead window
+ *
+ * \fapl_id{plist_id}
+ * \param[out] npages Number of raw data pages read ahead of a sequential
+ *             access
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_page_buffer_readahead() retrieves \p npages, the number of
+ *          raw data pages the page buffer reads ahead once it detects
+ *          sequential access, as set by H5Pset_page_buffer_readahead().
+ *
+ * \since 1.14.3
+ */
+H5_DLL herr_t H5Pget_page_buffer_readahead(hid_t plist_id, unsigned *npages);
 /**
  * \ingroup FAPL
  *
@@ -5617,6 +5645,37 @@ H5_DLL herr_t H5Pset_mpi_params(hid_t fapl_id, MPI_Comm comm, MPI_Info info);
  * \since 1.10.1
  */
 H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the page buffer readahead window
+ *
+ * \fapl_id{plist_id}
+ * \param[in] npages Number of raw data pages to read ahead of a sequential
+ *            access (Default is 0)
+ * \return \herr_t
+ *
+ * \details H5Pset_page_buffer_readahead() sets \p npages, the readahead
+ *          window of the page buffer enabled with H5Pset_page_buffer_size().
+ *          When raw data is read through the page buffer page after page in
+ *          increasing address order, the page buffer reads the next \p npages
+ *          pages into the buffer with a single vector read, instead of
+ *          fetching each page from the file as it is missed.  The window is
+ *          refilled as the prefetched pages are consumed.
+ *
+ *          Pages already in the page buffer are not read again, readahead
+ *          never goes past the end of the allocated file space, and at most
+ *          half of the page buffer is used for a single window.  The default
+ *          value of zero disables readahead.
+ *
+ *          The number of pages read ahead and how many of them were
+ *          subsequently used are reported with the other page buffer
+ *          statistics.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pset_page_buffer_readahead(hid_t plist_id, unsigned npages);
 /**
  * \ingroup FAPL
  *
@@ -7173,6 +7232,34 @@ H5_DLL ssize_t H5Pget_virtual_prefix(hid_t dapl_id, char *prefix /*out*/, size_t
  *
  */
 H5_DLL herr_t H5Pget_virtual_printf_gap(hid_t dapl_id, hsize_t *gap_size);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Returns the maximum number of source datasets of a virtual
+ *        dataset kept open between I/O operations
+ *
+ * \dapl_id
+ * \param[out] max_open Maximum number of source datasets of the mappings
+ *                      without unlimited selections kept open between
+ *                      I/O operations, or 0 for no limit.
+ *                      (\em Default: 0)
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_virtual_max_open_sources() returns the maximum number
+ *          of source datasets kept open between I/O operations on a
+ *          virtual dataset, \p max_open, using the access property list
+ *          for the virtual dataset, \p dapl_id.
+ *
+ *          The default library value for \p max_open is 0 (zero), which
+ *          keeps all of the source datasets open.
+ *
+ * \see H5Pset_virtual_max_open_sources()
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pget_virtual_max_open_sources(hid_t dapl_id, size_t *max_open);
 /**
  * \ingroup DAPL
  *
@@ -7526,6 +7613,47 @@ H5_DLL herr_t H5Pset_virtual_prefix(hid_t dapl_id, const char *prefix);
  *
  */
 H5_DLL herr_t H5Pset_virtual_printf_gap(hid_t dapl_id, hsize_t gap_size);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Sets the maximum number of source datasets of a virtual dataset
+ *        kept open between I/O operations
+ *
+ * \dapl_id
+ * \param[in] max_open Maximum number of source datasets of the mappings
+ *                     without unlimited selections kept open between I/O
+ *                     operations, or 0 for no limit
+ *                     (<em>Default value</em>: 0)
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_virtual_max_open_sources() sets the access property
+ *          list for the virtual dataset, \p dapl_id, to keep at most
+ *          \p max_open of the source datasets of the mappings without
+ *          unlimited selections open between I/O operations.
+ *
+ *          A source dataset is opened the first time an I/O operation
+ *          selects elements it is mapped to.  After each I/O operation,
+ *          the source datasets used least recently are closed until no
+ *          more than \p max_open are open, which also closes their
+ *          source files when nothing else holds them open.  They are
+ *          opened again when an I/O operation needs them.  This bounds
+ *          the number of files held open by a virtual dataset with many
+ *          source files, at the cost of reopening them.
+ *
+ *          The source datasets of mappings with unlimited selections
+ *          are always kept open, as they determine the extent of the
+ *          virtual dataset.
+ *
+ *          The default value of \p max_open, 0 (zero), keeps all of the
+ *          source datasets open until the virtual dataset is closed.
+ *
+ * \see_virtual
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pset_virtual_max_open_sources(hid_t dapl_id, size_t max_open);
 /**
  * \ingroup DAPL
  *
@@ -7738,6 +7866,24 @@ H5_DLL int H5Pget_preserve(hid_t plist_id);
  *
  */
 H5_DLL herr_t H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void **operate_data);
+/**
+ * \ingroup DXPL
+ *
+ * \brief Retrieves the number of threads for datatype conversions
+ *
+ * \dxpl_id
+ * \param[out] nthreads Number of threads, including the calling thread
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_type_conv_threads() retrieves \p nthreads, the number of
+ *          threads large datatype conversions are split across, as set by
+ *          H5Pset_type_conv_threads().
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pget_type_conv_threads(hid_t dxpl_id, unsigned *nthreads);
 /**
  *
  * \ingroup DXPL
@@ -8039,6 +8185,40 @@ H5_DLL herr_t H5Pset_preserve(hid_t plist_id, hbool_t status);
  */
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void *operate_data);
 
+/**
+ * \ingroup DXPL
+ *
+ * \brief Sets the number of threads for datatype conversions
+ *
+ * \dxpl_id
+ * \param[in] nthreads Number of threads, including the calling thread
+ *            (Default is 0)
+ * \return \herr_t
+ *
+ * \details H5Pset_type_conv_threads() sets \p nthreads, the number of
+ *          threads that large conversions between the common native integer
+ *          and floating-point types, and byte order conversions of 2, 4 and
+ *          8 byte types, are split across.  The calling thread converts a
+ *          part of the elements itself; the others are converted by a pool
+ *          of threads the library starts on first use.
+ *
+ *          Conversions are only split when no conversion exception callback
+ *          is set with H5Pset_type_conv_cb(), the elements are packed in the
+ *          conversion buffer, and each thread gets a large enough share.
+ *          The size of the type conversion buffer set with H5Pset_buffer()
+ *          bounds the number of elements converted at once during dataset
+ *          I/O.  While another conversion is using the pool, a conversion
+ *          uses the calling thread only.  The default value of zero, like
+ *          one, converts with the calling thread only.
+ *
+ * \note The setting only has an effect when the library is built with
+ *       multi-thread support.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pset_type_conv_threads(hid_t dxpl_id, unsigned nthreads);
+
 /**
  * \ingroup DXPL
  *
@@ -8394,6 +8574,46 @@ H5_DLL herr_t H5Pget_selection_io(hid_t plist_id, H5D_selection_io_mode_t *selec
  */
 H5_DLL herr_t H5Pget_no_selection_io_cause(hid_t plist_id, uint32_t *no_selection_io_cause);
 
+/**
+ * \ingroup DXPL
+ *
+ * \brief Retrieves where the datatype conversion of the last I/O call was
+ *        performed
+ *
+ * \dxpl_id{plist_id}
+ * \param[out] actual_type_conv A bitwise set value indicating where the data
+ *                              was converted
+ * \return \herr_t
+ *
+ * \details H5Pget_actual_type_conv() can be used to determine whether the
+ *          last I/O call with \p plist_id converted the data in the
+ *          application buffer, without copying it through the type
+ *          conversion buffer.  When the memory datatype is not smaller than
+ *          the file datatype and the memory selection of a contiguous
+ *          dataset or of a chunk is a single contiguous block, a read moves
+ *          the file data straight into the application buffer and converts
+ *          it there, e.g. swapping the bytes of big-endian data in place.
+ *          Writes do the same when H5Pset_modify_write_buf() allows the
+ *          library to modify the write buffer.
+ *
+ *          Valid values returned in \p actual_type_conv are listed as
+ *          follows.  If the I/O used both paths for different datasets or
+ *          chunks, it is a bitwise OR of the two.  If no datatype
+ *          conversion was needed, the value is 0.
+ *
+ *          - #H5D_TYPE_CONV_IN_PLACE
+ *          Some or all of the data was converted in the application buffer
+ *          - #H5D_TYPE_CONV_BUFFER
+ *          Some or all of the data was converted in the type conversion buffer
+ *
+ *          The property retrieved by this function is set before I/O takes
+ *          place and is retained even when I/O fails.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Pget_actual_type_conv(hid_t plist_id, uint32_t *actual_type_conv);
+
 /**
  *
  * \ingroup DXPL
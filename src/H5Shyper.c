@@ -70,6 +70,9 @@
         (UDATA)->skip += (ADD);                                                                              \
     } while (0) /* end H5S_HYPER_PROJ_INT_ADD_SKIP() */
 
+/* Opposite corner of block IDX in dimension DIM, for H5S__hyper_blocks_to_spans() */
+#define H5S_HYPER_BLK_END(BLD, IDX, DIM) ((BLD)->blocks[((IDX)*2 + 1) * (BLD)->rank + (DIM)])
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -104,6 +107,24 @@ typedef struct {
 #error H5S_MAX_RANK too large for ps_clean_bitmap field in H5S_hyper_project_intersect_ud_t struct
 #endif
 
+/* Extent of a block in one dimension, for sorting the blocks of
+ * H5S__hyper_blocks_to_spans() */
+typedef struct {
+    hsize_t start; /* Low bound of block in the dimension */
+    hsize_t end;   /* High bound of block in the dimension */
+    size_t  idx;   /* Index of block in the block list */
+} H5S_hyper_blk_key_t;
+
+/* Scratch space for building a span tree from a list of blocks, with H5S__hyper_blocks_to_spans() */
+typedef struct {
+    unsigned             rank;                          /* Rank of blocks */
+    const hsize_t       *blocks;                        /* List of blocks */
+    H5S_hyper_blk_key_t *keys[H5S_MAX_RANK];            /* Sorted extents of the blocks in each dimension */
+    size_t               keys_nalloc[H5S_MAX_RANK];     /* # of extents allocated in each dimension */
+    size_t              *active[H5S_MAX_RANK];          /* Blocks spanning the current interval */
+    size_t               active_nalloc[H5S_MAX_RANK];   /* # of active blocks allocated in each dimension */
+} H5S_hyper_blk_build_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -150,6 +171,10 @@ static herr_t  H5S__set_regular_hyperslab(H5S_t *space, const hsize_t start[], c
                                           const hsize_t *opt_stride, const hsize_t opt_count[],
                                           const hsize_t *opt_block);
 static herr_t  H5S__fill_in_select(H5S_t *space1, H5S_seloper_t op, H5S_t *space2, H5S_t **result);
+static H5S_hyper_span_info_t *H5S__hyper_blocks_to_spans(unsigned rank, size_t numblocks,
+                                                         const hsize_t *blocks);
+static herr_t H5S__select_hyper_blocklist(H5S_t *space, H5S_seloper_t op, size_t numblocks,
+                                          const hsize_t *blocks);
 static H5S_t  *H5S__combine_select(H5S_t *space1, H5S_seloper_t op, H5S_t *space2);
 static herr_t  H5S__hyper_iter_get_seq_list_gen(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem,
                                                 size_t *nseq, size_t *nelem, hsize_t *off, size_t *len);
@@ -2717,6 +2742,154 @@ H5S__hyper_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__hyper_iter_get_seq_list() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__hyper_iter_get_strided_seq
+ PURPOSE
+    Get the next run of sequences at a constant stride for a selection
+ USAGE
+    htri_t H5S__hyper_iter_get_strided_seq(iter,maxelem,nseq,nelem,off,len,stride)
+        H5S_sel_iter_t *iter;   IN/OUT: Selection iterator describing last
+                                    position of interest in selection.
+        size_t maxelem;         IN: Maximum number of elements to include in the
+                                    run of sequences
+        size_t *nseq;           OUT: Number of sequences in the run
+        size_t *nelem;          OUT: Number of elements in the run
+        hsize_t *off;           OUT: Offset of the first sequence (in bytes)
+        size_t *len;            OUT: Length of each sequence (in bytes)
+        hsize_t *stride;        OUT: Stride between the sequences (in bytes)
+ RETURNS
+    TRUE if a run was generated, FALSE if not
+ DESCRIPTION
+    For a regular hyperslab selection, whose iterator is at the start of a
+    block in the fastest changing dimension, describe the blocks left in the
+    row of the fastest changing dimension, or the rows left in the next
+    dimension when the fastest changing dimension has one block, as a run of
+    equal sequences at a constant stride, and advance the iterator past them.
+    This saves generating their sequence list.
+
+    Irregular hyperslab selections, iterators in the middle of a block and
+    runs of fewer than H5S_STRIDED_SEQ_MIN_NSEQ sequences are left to
+    H5S_SELECT_ITER_GET_SEQ_LIST().
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+htri_t
+H5S__hyper_iter_get_strided_seq(H5S_sel_iter_t *iter, size_t maxelem, size_t *nseq, size_t *nelem,
+                                hsize_t *off, size_t *len, hsize_t *stride)
+{
+    htri_t ret_value = FALSE; /* return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Check args */
+    assert(iter);
+    assert(iter->elmt_left > 0);
+    assert(maxelem > 0);
+    assert(nseq);
+    assert(nelem);
+    assert(off);
+    assert(len);
+    assert(stride);
+
+    if (iter->u.hyp.diminfo_valid) {
+        const H5S_hyper_dim_t *tdiminfo;    /* Temporary pointer to diminfo information */
+        const hssize_t        *sel_off;     /* Selection offset in dataspace */
+        const hsize_t         *slab;        /* Hyperslab size */
+        const hsize_t         *iter_off;    /* Iterator position */
+        unsigned               ndims;       /* Number of dimensions of dataset */
+        unsigned               fast_dim;    /* Rank of the fastest changing dimension for the dataspace */
+        hbool_t                block_start; /* Whether the iterator is at the start of a block */
+        unsigned               u;           /* Local index variable */
+
+        /* Set a local copy of the diminfo pointer */
+        tdiminfo = iter->u.hyp.diminfo;
+        iter_off = iter->u.hyp.off;
+        slab     = iter->u.hyp.slab;
+
+        /* Check if this is a "flattened" regular hyperslab selection */
+        if (iter->u.hyp.iter_rank != 0 && iter->u.hyp.iter_rank < iter->rank) {
+            ndims   = iter->u.hyp.iter_rank;
+            sel_off = iter->u.hyp.sel_off;
+        } /* end if */
+        else {
+            ndims   = iter->rank;
+            sel_off = iter->sel_off;
+        } /* end else */
+        fast_dim = ndims - 1;
+
+        /* Check if we stopped in the middle of a sequence of elements */
+        if (tdiminfo[fast_dim].count == 1)
+            block_start = (iter_off[fast_dim] == tdiminfo[fast_dim].start);
+        else
+            block_start = (0 == (iter_off[fast_dim] - tdiminfo[fast_dim].start) % tdiminfo[fast_dim].stride);
+
+        if (block_start) {
+            hsize_t block = tdiminfo[fast_dim].block; /* Elements in each sequence */
+            hsize_t run;                              /* Sequences in the run */
+            hsize_t seq_stride;                       /* Stride between the sequences */
+
+            if (tdiminfo[fast_dim].count > 1) {
+                /* The blocks left in the row */
+                run = tdiminfo[fast_dim].count -
+                      (iter_off[fast_dim] - tdiminfo[fast_dim].start) / tdiminfo[fast_dim].stride;
+                seq_stride = tdiminfo[fast_dim].stride * slab[fast_dim];
+            } /* end if */
+            else if (ndims > 1) {
+                unsigned row_dim = fast_dim - 1;                                /* Dimension of the rows */
+                hsize_t  row_off = iter_off[row_dim] - tdiminfo[row_dim].start; /* Row in the selection */
+
+                if (tdiminfo[row_dim].count == 1) {
+                    /* The rows left in the only block */
+                    run        = tdiminfo[row_dim].block - row_off;
+                    seq_stride = slab[row_dim];
+                } /* end if */
+                else if (tdiminfo[row_dim].block == 1) {
+                    /* The blocks of one row left */
+                    run        = tdiminfo[row_dim].count - row_off / tdiminfo[row_dim].stride;
+                    seq_stride = tdiminfo[row_dim].stride * slab[row_dim];
+                } /* end if */
+                else {
+                    /* The rows left in the current block */
+                    run        = tdiminfo[row_dim].block - row_off % tdiminfo[row_dim].stride;
+                    seq_stride = slab[row_dim];
+                } /* end else */
+            }     /* end if */
+            else
+                run = 1;
+
+            /* Don't go over the maximum number of elements */
+            run = MIN(run, maxelem / block);
+
+            if (run >= H5S_STRIDED_SEQ_MIN_NSEQ) {
+                hsize_t loc; /* Coordinate offset */
+
+                /* Compute the buffer offset of the first sequence */
+                for (u = 0, loc = 0; u < ndims; u++)
+                    loc += ((hsize_t)((hssize_t)iter_off[u] + sel_off[u])) * slab[u];
+
+                *off    = loc;
+                *stride = seq_stride;
+                H5_CHECKED_ASSIGN(*len, size_t, block * iter->elmt_size, hsize_t);
+                H5_CHECKED_ASSIGN(*nseq, size_t, run, hsize_t);
+                H5_CHECKED_ASSIGN(*nelem, size_t, run * block, hsize_t);
+
+                /* Advance the hyperslab iterator */
+                H5S__hyper_iter_next(iter, *nelem);
+
+                /* Decrement the number of elements left in selection */
+                iter->elmt_left -= *nelem;
+
+                ret_value = TRUE;
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_iter_get_strided_seq() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__hyper_iter_release
@@ -10329,6 +10502,426 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Sselect_hyperslab() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_blk_key_cmp
+ *
+ * Purpose:     Comparison callback for qsort(3) on block extents, ordering
+ *              them by their low bound.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *              first extent starts before, at, or after the second one.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5S__hyper_blk_key_cmp(const void *_key1, const void *_key2)
+{
+    const H5S_hyper_blk_key_t *key1 = (const H5S_hyper_blk_key_t *)_key1;
+    const H5S_hyper_blk_key_t *key2 = (const H5S_hyper_blk_key_t *)_key2;
+
+    if (key1->start < key2->start)
+        return -1;
+    if (key1->start > key2->start)
+        return 1;
+    return 0;
+} /* end H5S__hyper_blk_key_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_blocks_to_spans_helper
+ *
+ * Purpose:     Build the span tree for dimension DIM and below, of the union
+ *              of the NUM blocks in the IDX list (or the first NUM blocks,
+ *              if IDX is NULL).
+ *
+ *              The extents of the blocks in this dimension are sorted, then
+ *              swept from low to high.  The sweep stops wherever a block
+ *              starts or ends, so the same blocks span each interval between
+ *              stops, and the span tree of the lower dimensions for the
+ *              interval is built from those blocks only.  Adjacent intervals
+ *              with the same lower dimensions are merged into one span.  In
+ *              the fastest changing dimension, overlapping and adjacent
+ *              extents are merged directly.
+ *
+ * Return:      Pointer to new span tree on success, NULL on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5S_hyper_span_info_t *
+H5S__hyper_blocks_to_spans_helper(H5S_hyper_blk_build_t *bld, unsigned dim, const size_t *idx, size_t num)
+{
+    H5S_hyper_blk_key_t   *keys;             /* Extents of the blocks in this dimension */
+    H5S_hyper_span_info_t *spans     = NULL; /* Span tree being built */
+    H5S_hyper_span_info_t *down      = NULL; /* Span tree for lower dimensions */
+    size_t                 u;                /* Local index variable */
+    H5S_hyper_span_info_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(bld);
+    assert(dim < bld->rank);
+    assert(num > 0);
+
+    /* Make room for the extents in this dimension */
+    if (num > bld->keys_nalloc[dim]) {
+        H5S_hyper_blk_key_t *new_keys;
+
+        if (NULL == (new_keys = (H5S_hyper_blk_key_t *)H5MM_realloc(bld->keys[dim],
+                                                                    num * sizeof(H5S_hyper_blk_key_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate block extents");
+        bld->keys[dim]        = new_keys;
+        bld->keys_nalloc[dim] = num;
+    } /* end if */
+    keys = bld->keys[dim];
+
+    /* Sort the extents of the blocks in this dimension */
+    for (u = 0; u < num; u++) {
+        const hsize_t *blk = bld->blocks + ((idx ? idx[u] : u) * 2 * bld->rank);
+
+        keys[u].start = blk[dim];
+        keys[u].end   = blk[bld->rank + dim];
+        keys[u].idx   = idx ? idx[u] : u;
+    } /* end for */
+    if (num > 1)
+        qsort(keys, num, sizeof(H5S_hyper_blk_key_t), H5S__hyper_blk_key_cmp);
+
+    if (dim == bld->rank - 1) {
+        hsize_t low  = keys[0].start; /* Low bound of current span */
+        hsize_t high = keys[0].end;   /* High bound of current span */
+
+        /* Merge overlapping extents, then append the spans */
+        /* (Adjacent spans are merged by H5S__hyper_append_span) */
+        for (u = 1; u < num; u++) {
+            if (keys[u].start <= high)
+                high = MAX(high, keys[u].end);
+            else {
+                if (H5S__hyper_append_span(&spans, 1, low, high, NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span");
+                low  = keys[u].start;
+                high = keys[u].end;
+            } /* end else */
+        }     /* end for */
+        if (H5S__hyper_append_span(&spans, 1, low, high, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span");
+    } /* end if */
+    else {
+        size_t *active;      /* Indices of the blocks spanning the current interval */
+        size_t  nactive = 0; /* # of blocks spanning the current interval */
+        hsize_t pos     = 0; /* Low bound of current interval */
+        size_t  next_key;    /* Next block to start */
+
+        /* Make room for the blocks spanning an interval */
+        if (num > bld->active_nalloc[dim]) {
+            size_t *new_active;
+
+            if (NULL == (new_active = (size_t *)H5MM_realloc(bld->active[dim], num * sizeof(size_t))))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate active block list");
+            bld->active[dim]        = new_active;
+            bld->active_nalloc[dim] = num;
+        } /* end if */
+        active = bld->active[dim];
+
+        /* Sweep over the intervals between the bounds of the blocks */
+        next_key = 0;
+        while (next_key < num || nactive > 0) {
+            hsize_t next_pos; /* Low bound of next interval */
+            size_t  v;        /* Local index variable */
+
+            /* Skip gaps between blocks */
+            if (0 == nactive)
+                pos = keys[next_key].start;
+
+            /* Add the blocks starting here */
+            while (next_key < num && keys[next_key].start == pos)
+                active[nactive++] = keys[next_key++].idx;
+
+            /* Find the end of the interval: the next place a block starts or ends */
+            next_pos = (next_key < num) ? keys[next_key].start : HSIZE_UNDEF;
+            for (v = 0; v < nactive; v++)
+                if (H5S_HYPER_BLK_END(bld, active[v], dim) + 1 < next_pos)
+                    next_pos = H5S_HYPER_BLK_END(bld, active[v], dim) + 1;
+
+            /* Build the lower dimensions for the blocks spanning the interval */
+            if (NULL == (down = H5S__hyper_blocks_to_spans_helper(bld, dim + 1, active, nactive)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, NULL, "can't build span tree for lower dimensions");
+
+            /* Append the interval, merging with the previous span if possible */
+            if (H5S__hyper_append_span(&spans, bld->rank - dim, pos, next_pos - 1, down) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTAPPEND, NULL, "can't allocate hyperslab span");
+            if (H5S__hyper_free_span_info(down) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTFREE, NULL, "unable to free span info");
+            down = NULL;
+
+            /* Remove the blocks ending before the next interval */
+            pos = next_pos;
+            for (v = 0, u = 0; v < nactive; v++)
+                if (H5S_HYPER_BLK_END(bld, active[v], dim) >= pos)
+                    active[u++] = active[v];
+            nactive = u;
+        } /* end while */
+    }     /* end else */
+
+    /* Set return value */
+    ret_value = spans;
+    spans     = NULL;
+
+done:
+    if (down)
+        if (H5S__hyper_free_span_info(down) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTFREE, NULL, "unable to free span info");
+    if (spans)
+        if (H5S__hyper_free_span_info(spans) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTFREE, NULL, "unable to free span info");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_blocks_to_spans_helper() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__hyper_blocks_to_spans
+ *
+ * Purpose:     Build the span tree for the union of a list of blocks, in one
+ *              pass over the blocks of each dimension.  The BLOCKS list has
+ *              the layout that H5Sget_select_hyper_blocklist() returns: the
+ *              start and the opposite corner of each block.
+ *
+ * Return:      Pointer to new span tree on success, NULL on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5S_hyper_span_info_t *
+H5S__hyper_blocks_to_spans(unsigned rank, size_t numblocks, const hsize_t *blocks)
+{
+    H5S_hyper_blk_build_t  bld;              /* Scratch space for building the span tree */
+    unsigned               u;                /* Local index variable */
+    H5S_hyper_span_info_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(rank > 0 && rank <= H5S_MAX_RANK);
+    assert(numblocks > 0);
+    assert(blocks);
+
+    memset(&bld, 0, sizeof(bld));
+    bld.rank   = rank;
+    bld.blocks = blocks;
+
+    if (NULL == (ret_value = H5S__hyper_blocks_to_spans_helper(&bld, 0, NULL, numblocks)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, NULL, "can't build span tree for blocks");
+
+done:
+    for (u = 0; u < rank; u++) {
+        H5MM_xfree(bld.keys[u]);
+        H5MM_xfree(bld.active[u]);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__hyper_blocks_to_spans() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5S__select_hyper_blocklist
+ *
+ * Purpose:     Internal version of H5Sselect_hyper_blocklist().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5S__select_hyper_blocklist(H5S_t *space, H5S_seloper_t op, size_t numblocks, const hsize_t *blocks)
+{
+    H5S_hyper_span_info_t *new_spans = NULL;    /* Span tree for the blocks */
+    size_t                 u;                   /* Local index variable */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    assert(space);
+    assert(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID);
+    assert(blocks || numblocks == 0);
+
+    /* Check the blocks */
+    for (u = 0; u < numblocks; u++) {
+        const hsize_t *blk = blocks + (u * 2 * space->extent.rank);
+        unsigned       v;
+
+        for (v = 0; v < space->extent.rank; v++)
+            if (blk[v] > blk[space->extent.rank + v] || blk[space->extent.rank + v] == H5S_UNLIMITED)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid block");
+    } /* end for */
+
+    /* Handle an empty list of blocks */
+    if (0 == numblocks) {
+        if (op == H5S_SELECT_SET || op == H5S_SELECT_AND || op == H5S_SELECT_NOTA)
+            if (H5S_select_none(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection");
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Check for operating on unlimited selection */
+    if ((H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS) &&
+        (space->select.sel_info.hslab->unlim_dim >= 0) && (op != H5S_SELECT_SET))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "unsupported operation on unlimited selection");
+
+    /* Fixup operation for non-hyperslab selections */
+    switch (H5S_GET_SELECT_TYPE(space)) {
+        case H5S_SEL_NONE: /* No elements selected in dataspace */
+            if (op == H5S_SELECT_AND || op == H5S_SELECT_NOTB)
+                HGOTO_DONE(SUCCEED); /* Selection stays "none" */
+            op = H5S_SELECT_SET;
+            break;
+
+        case H5S_SEL_ALL: /* All elements selected in dataspace */
+            if (op == H5S_SELECT_OR)
+                HGOTO_DONE(SUCCEED); /* Selection stays "all" */
+            else if (op == H5S_SELECT_NOTA) {
+                if (H5S_select_none(space) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't convert selection");
+                HGOTO_DONE(SUCCEED);
+            } /* end if */
+            else if (op == H5S_SELECT_AND)
+                op = H5S_SELECT_SET;
+            else if (op != H5S_SELECT_SET) {
+                /* Convert current "all" selection to "real" hyperslab selection */
+                if (H5S_select_hyperslab(space, H5S_SELECT_SET, H5S_hyper_zeros_g, H5S_hyper_ones_g,
+                                         H5S_hyper_ones_g, space->extent.size) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't convert selection");
+            } /* end if */
+            break;
+
+        case H5S_SEL_HYPERSLABS:
+            /* Hyperslab operation on hyperslab selection, OK */
+            break;
+
+        case H5S_SEL_POINTS:          /* Can't combine hyperslab operations and point selections currently */
+            if (op == H5S_SELECT_SET) /* Allow only "set" operation to proceed */
+                break;
+            /* FALLTHROUGH (to error) */
+            H5_ATTR_FALLTHROUGH
+
+        case H5S_SEL_ERROR:
+        case H5S_SEL_N:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation");
+    } /* end switch */
+
+    /* Build the span tree for the blocks */
+    if (NULL == (new_spans = H5S__hyper_blocks_to_spans(space->extent.rank, numblocks, blocks)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't create hyperslab information");
+
+    if (op == H5S_SELECT_SET) {
+        /* Remove current selection */
+        if (H5S_SELECT_RELEASE(space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection");
+
+        /* Allocate space for the hyperslab selection information */
+        if (NULL == (space->select.sel_info.hslab = H5FL_MALLOC(H5S_hyper_sel_t)))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate hyperslab info");
+
+        /* Set the selection to the new span tree */
+        space->select.type                      = H5S_sel_hyper;
+        space->select.num_elem                  = H5S__hyper_spans_nelem(new_spans);
+        space->select.sel_info.hslab->unlim_dim = -1;
+        space->select.sel_info.hslab->span_lst  = new_spans;
+        new_spans                               = NULL;
+
+        /* Check if the blocks form a regular hyperslab.  If they do, keep
+         * only the dimension info, as H5Sselect_hyperslab() would.
+         */
+        H5S__hyper_rebuild(space);
+        if (space->select.sel_info.hslab->diminfo_valid == H5S_DIMINFO_VALID_YES) {
+            if (H5S__hyper_free_span_info(space->select.sel_info.hslab->span_lst) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "unable to free span info");
+            space->select.sel_info.hslab->span_lst = NULL;
+        } /* end if */
+    }     /* end if */
+    else {
+        hbool_t new_spans_owned = FALSE;
+        hbool_t updated_spans   = FALSE;
+
+        /* Sanity check */
+        assert(H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS);
+
+        /* Check if there's no hyperslab span information currently */
+        if (NULL == space->select.sel_info.hslab->span_lst)
+            if (H5S__hyper_generate_spans(space) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_UNINITIALIZED, FAIL, "dataspace does not have span tree");
+
+        /* Combine the span tree for the blocks with the current selection */
+        if (H5S__fill_in_new_space(space, op, new_spans, TRUE, &new_spans_owned, &updated_spans, &space) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't combine blocks with selection");
+
+        /* The selection may have become irregular */
+        if (updated_spans)
+            space->select.sel_info.hslab->diminfo_valid = H5S_DIMINFO_VALID_NO;
+
+        /* Indicate that the new_spans are owned, there's no need to free */
+        if (new_spans_owned)
+            new_spans = NULL;
+    } /* end else */
+
+done:
+    if (new_spans)
+        if (H5S__hyper_free_span_info(new_spans) < 0)
+            HDONE_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "unable to free span info");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__select_hyper_blocklist() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Sselect_hyper_blocklist
+ PURPOSE
+    Specify a list of blocks to combine with the current selection
+ USAGE
+    herr_t H5Sselect_hyper_blocklist(dsid, op, numblocks, blocks)
+        hid_t dsid;             IN: Dataspace ID of selection to modify
+        H5S_seloper_t op;       IN: Operation to perform on current selection
+        size_t numblocks;       IN: Number of blocks in BLOCKS list
+        const hsize_t *blocks;  IN: Start and opposite corner of each block
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Combines the union of a list of blocks with the current selection for a
+    dataspace.  The blocks may overlap and be in any order.  The BLOCKS list
+    has the layout that H5Sget_select_hyper_blocklist() returns.  This is
+    equivalent to selecting each block with H5Sselect_hyperslab() and
+    H5S_SELECT_OR, then combining the result with the current selection,
+    but the blocks are merged into the selection's span tree in one pass.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5Sselect_hyper_blocklist(hid_t spaceid, H5S_seloper_t op, size_t numblocks, const hsize_t *blocks)
+{
+    H5S_t *space;               /* Dataspace to modify selection of */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iSsz*h", spaceid, op, numblocks, blocks);
+
+    /* Check args */
+    if (NULL == (space = (H5S_t *)H5I_object_verify(spaceid, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace");
+    if (H5S_SCALAR == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_SCALAR space");
+    if (H5S_NULL == H5S_GET_EXTENT_TYPE(space))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "hyperslab doesn't support H5S_NULL space");
+    if (blocks == NULL && numblocks > 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "blocks not specified");
+    if (!(op > H5S_SELECT_NOOP && op < H5S_SELECT_INVALID))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, FAIL, "invalid selection operation");
+
+    if (H5S__select_hyper_blocklist(space, op, numblocks, blocks) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to select blocks");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Sselect_hyper_blocklist() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S_combine_hyperslab
@@ -359,12 +359,12 @@ static herr_t
 H5S__mpio_point_type(const H5S_t *space, size_t elmt_size, MPI_Datatype *new_type, int *count,
                      hbool_t *is_derived_type, hbool_t do_permute, hsize_t **permute, hbool_t *is_permuted)
 {
-    MPI_Aint       *disp = NULL;         /* Datatype displacement for each point*/
-    H5S_pnt_node_t *curr = NULL;         /* Current point being operated on in from the selection */
-    hssize_t        snum_points;         /* Signed number of elements in selection */
-    hsize_t         num_points;          /* Sumber of points in the selection */
-    hsize_t         u;                   /* Local index variable */
-    herr_t          ret_value = SUCCEED; /* Return value */
+    MPI_Aint      *disp = NULL;         /* Datatype displacement for each point*/
+    const hsize_t *curr = NULL;         /* Current point being operated on in from the selection */
+    hssize_t       snum_points;         /* Signed number of elements in selection */
+    hsize_t        num_points;          /* Sumber of points in the selection */
+    hsize_t        u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -386,10 +386,10 @@ H5S__mpio_point_type(const H5S_t *space, size_t elmt_size, MPI_Datatype *new_typ
             HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate permutation array");
 
     /* Iterate through list of elements */
-    curr = space->select.sel_info.pnt_lst->head;
+    curr = space->select.sel_info.pnt_lst->coords;
     for (u = 0; u < num_points; u++) {
         /* Calculate the displacement of the current point */
-        hsize_t disp_tmp = H5VM_array_offset(space->extent.rank, space->extent.size, curr->pnt);
+        hsize_t disp_tmp = H5VM_array_offset(space->extent.rank, space->extent.size, curr);
         if (disp_tmp > LONG_MAX) /* Maximum value of type long */
             HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "disp overflow");
         disp[u] = (MPI_Aint)disp_tmp;
@@ -444,7 +444,7 @@ H5S__mpio_point_type(const H5S_t *space, size_t elmt_size, MPI_Datatype *new_typ
         }     /* end else */
 
         /* get the next point */
-        curr = curr->next;
+        curr += space->extent.rank;
     } /* end for */
 
     /* Create the MPI datatype for the set of element displacements */
@@ -69,6 +69,9 @@
 /* Length of stack-allocated sequences for "project intersect" routines */
 #define H5S_PROJECT_INTERSECT_NSEQS 256
 
+/* Fewest sequences in a run from H5S_select_iter_get_strided_seq() */
+#define H5S_STRIDED_SEQ_MIN_NSEQ 4
+
 /* Internal flags for initializing selection iterators */
 #define H5S_SEL_ITER_API_CALL 0x1000 /* Selection iterator created from API call */
 
@@ -118,26 +121,15 @@ struct H5S_extent_t {
  * Dataspace selection information
  */
 
-/* Node in point selection list (typedef'd in H5Sprivate.h) */
-struct H5S_pnt_node_t {
-    struct H5S_pnt_node_t *next;  /* Pointer to next point in list */
-    hsize_t                pnt[]; /* Selected point */
-                                  /* (NOTE: This uses the C99 "flexible array member" feature) */
-};
-
 /* Information about point selection list (typedef'd in H5Sprivate.h) */
 struct H5S_pnt_list_t {
     /* The following two fields defines the bounding box of the whole set of points, relative to the offset */
     hsize_t low_bounds[H5S_MAX_RANK];  /* The smallest element selected in each dimension */
     hsize_t high_bounds[H5S_MAX_RANK]; /* The largest element selected in each dimension */
 
-    H5S_pnt_node_t *head; /* Pointer to head of point list */
-    H5S_pnt_node_t *tail; /* Pointer to tail of point list */
-
-    hsize_t last_idx; /* Index of the point after the last returned from H5S__get_select_elem_pointlist() */
-    H5S_pnt_node_t *last_idx_pnt; /* Point after the last returned from H5S__get_select_elem_pointlist().
-                                   * If we ever add a way to remove points or add points in the middle of
-                                   * the pointlist we will need to invalidate these fields. */
+    hsize_t *coords;  /* Coordinates of the selected points, <rank> values per point, in iteration order */
+    size_t   npoints; /* Number of points in the list */
+    size_t   nalloc;  /* Number of points the coordinate array has room for */
 };
 
 /* Information about hyperslab spans */
@@ -405,6 +397,8 @@ H5_DLL herr_t H5S__hyper_project_intersection(H5S_t *src_space, H5S_t *dst_space
                                               H5S_t *proj_space, hbool_t share_space);
 
 /* Operations on selection iterators */
+H5_DLL htri_t H5S__hyper_iter_get_strided_seq(H5S_sel_iter_t *iter, size_t maxelem, size_t *nseq,
+                                              size_t *nelem, hsize_t *off, size_t *len, hsize_t *stride);
 H5_DLL herr_t H5S__sel_iter_close_cb(H5S_sel_iter_t *_sel_iter, void **request);
 
 /* Testing functions */
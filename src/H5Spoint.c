@@ -36,20 +36,25 @@
 /* Local Macros */
 /****************/
 
+/* Number of points a point list has room for, when it is first allocated */
+#define H5S_PNT_LIST_INIT_NALLOC 8
+
+/* Coordinates of point IDX in a point list for a dataspace of rank RANK */
+#define H5S_PNT_COORDS(LST, RANK, IDX) ((LST)->coords + ((size_t)(IDX) * (RANK)))
+
 /******************/
 /* Local Typedefs */
 /******************/
 
-/* Define alias for hsize_t, for allocating H5S_pnt_node_t + point objects */
-/* (Makes it easier to understand the alloc / free calls) */
-typedef hsize_t hcoords_t;
-
 /********************/
 /* Local Prototypes */
 /********************/
 static herr_t          H5S__point_add(H5S_t *space, H5S_seloper_t op, size_t num_elem, const hsize_t *coord);
+static herr_t          H5S__pnt_list_reserve(H5S_pnt_list_t *pnt_lst, unsigned rank, size_t npoints);
 static H5S_pnt_list_t *H5S__copy_pnt_list(const H5S_pnt_list_t *src, unsigned rank);
 static void            H5S__free_pnt_list(H5S_pnt_list_t *pnt_lst);
+static int             H5S__point_cmp_offset(const void *_off1, const void *_off2);
+static herr_t          H5S__point_sort(H5S_t *space, hbool_t remove_dups);
 
 /* Selection callbacks */
 static herr_t   H5S__point_copy(H5S_t *dst, const H5S_t *src, hbool_t share_selection);
@@ -147,9 +152,6 @@ static const H5S_sel_iter_class_t H5S_sel_iter_point[1] = {{
     H5S__point_iter_release,
 }};
 
-/* Declare a free list to manage the H5S_pnt_node_t + hcoords_t array struct */
-H5FL_BARR_DEFINE_STATIC(H5S_pnt_node_t, hcoords_t, H5S_MAX_RANK);
-
 /* Declare a free list to manage the H5S_pnt_list_t struct */
 H5FL_DEFINE_STATIC(H5S_pnt_list_t);
 
@@ -192,8 +194,8 @@ H5S__point_iter_init(H5S_t *space, H5S_sel_iter_t *iter)
         /* OK to share point list for internal iterations */
         iter->u.pnt.pnt_lst = space->select.sel_info.pnt_lst;
 
-    /* Start at the head of the list of points */
-    iter->u.pnt.curr = iter->u.pnt.pnt_lst->head;
+    /* Start at the first point in the list */
+    iter->u.pnt.curr = 0;
 
     /* Initialize type of selection iterator */
     iter->type = H5S_sel_iter_point;
@@ -222,7 +224,8 @@ H5S__point_iter_coords(const H5S_sel_iter_t *iter, hsize_t *coords)
     assert(coords);
 
     /* Copy the offset of the current point */
-    H5MM_memcpy(coords, iter->u.pnt.curr->pnt, sizeof(hsize_t) * iter->rank);
+    H5MM_memcpy(coords, H5S_PNT_COORDS(iter->u.pnt.pnt_lst, iter->rank, iter->u.pnt.curr),
+                sizeof(hsize_t) * iter->rank);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__point_iter_coords() */
@@ -248,8 +251,10 @@ H5S__point_iter_block(const H5S_sel_iter_t *iter, hsize_t *start, hsize_t *end)
     assert(end);
 
     /* Copy the current point as a block */
-    H5MM_memcpy(start, iter->u.pnt.curr->pnt, sizeof(hsize_t) * iter->rank);
-    H5MM_memcpy(end, iter->u.pnt.curr->pnt, sizeof(hsize_t) * iter->rank);
+    H5MM_memcpy(start, H5S_PNT_COORDS(iter->u.pnt.pnt_lst, iter->rank, iter->u.pnt.curr),
+                sizeof(hsize_t) * iter->rank);
+    H5MM_memcpy(end, H5S_PNT_COORDS(iter->u.pnt.pnt_lst, iter->rank, iter->u.pnt.curr),
+                sizeof(hsize_t) * iter->rank);
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__point_iter_block() */
@@ -302,7 +307,7 @@ H5S__point_iter_has_next_block(const H5S_sel_iter_t *iter)
     assert(iter);
 
     /* Check if there is another point in the list */
-    if (iter->u.pnt.curr->next == NULL)
+    if ((iter->u.pnt.curr + 1) >= iter->u.pnt.pnt_lst->npoints)
         HGOTO_DONE(FALSE);
 
 done:
@@ -337,10 +342,7 @@ H5S__point_iter_next(H5S_sel_iter_t *iter, size_t nelem)
     assert(nelem > 0);
 
     /* Increment the iterator */
-    while (nelem > 0) {
-        iter->u.pnt.curr = iter->u.pnt.curr->next;
-        nelem--;
-    } /* end while */
+    iter->u.pnt.curr += nelem;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__point_iter_next() */
@@ -371,7 +373,7 @@ H5S__point_iter_next_block(H5S_sel_iter_t *iter)
     assert(iter);
 
     /* Increment the iterator */
-    iter->u.pnt.curr = iter->u.pnt.curr->next;
+    iter->u.pnt.curr++;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__point_iter_next_block() */
@@ -409,15 +411,18 @@ static herr_t
 H5S__point_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem, size_t *nseq, size_t *nelem,
                              hsize_t *off, size_t *len)
 {
-    size_t          io_left;             /* The number of bytes left in the selection */
-    size_t          start_io_left;       /* The initial number of bytes left in the selection */
-    H5S_pnt_node_t *node;                /* Point node */
-    unsigned        ndims;               /* Dimensionality of dataspace*/
-    hsize_t         acc;                 /* Coordinate accumulator */
-    hsize_t         loc;                 /* Coordinate offset */
-    size_t          curr_seq;            /* Current sequence being operated on */
-    int             i;                   /* Local index variable */
-    herr_t          ret_value = SUCCEED; /* return value */
+    size_t         io_left;             /* The number of elements left in the selection */
+    size_t         start_io_left;       /* The initial number of elements left in the selection */
+    const hsize_t *pnt;                 /* Coordinates of the current point */
+    hsize_t        slab[H5S_MAX_RANK];  /* Size of each dimension, in bytes */
+    unsigned       ndims;               /* Dimensionality of dataspace*/
+    hsize_t        acc;                 /* Coordinate accumulator */
+    hsize_t        base;                /* Offset of the selection's origin, in bytes */
+    hsize_t        loc;                 /* Coordinate offset */
+    size_t         curr_seq;            /* Current sequence being operated on */
+    unsigned       u;                   /* Local index variable */
+    int            i;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* return value */
 
     FUNC_ENTER_PACKAGE_NOERR
 
@@ -437,39 +442,39 @@ H5S__point_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem
     /* Get the dataspace's rank */
     ndims = iter->rank;
 
+    /* Compute the size of each dimension in bytes and the offset of the
+     *  selection's origin, so the offset of each point is a dot product of
+     *  its coordinates with the dimension sizes.  (The selection offset may
+     *  be negative, which the unsigned arithmetic accounts for.)
+     */
+    for (i = (int)(ndims - 1), acc = iter->elmt_size, base = 0; i >= 0; i--) {
+        slab[i] = acc;
+        base += (hsize_t)iter->sel_off[i] * acc;
+        acc *= iter->dims[i];
+    } /* end for */
+
     /* Walk through the points in the selection, starting at the current */
     /*  location in the iterator */
-    node     = iter->u.pnt.curr;
+    pnt      = H5S_PNT_COORDS(iter->u.pnt.pnt_lst, ndims, iter->u.pnt.curr);
     curr_seq = 0;
-    while (NULL != node) {
-        /* Compute the offset of each selected point in the buffer */
-        for (i = (int)(ndims - 1), acc = iter->elmt_size, loc = 0; i >= 0; i--) {
-            loc += (hsize_t)((hssize_t)node->pnt[i] + iter->sel_off[i]) * acc;
-            acc *= iter->dims[i];
-        } /* end for */
+    while (io_left > 0) {
+        /* Compute the offset of the point in the buffer */
+        for (u = 0, loc = base; u < ndims; u++)
+            loc += pnt[u] * slab[u];
+
+        /* Check if this point extends the previous sequence */
+        if (curr_seq > 0 && loc == (off[curr_seq - 1] + len[curr_seq - 1]))
+            /* Extend the previous sequence */
+            len[curr_seq - 1] += iter->elmt_size;
+        else {
+            /* Check if we're finished with all sequences */
+            if (curr_seq == maxseq)
+                break;
 
-        /* Check if this is a later point in the selection */
-        if (curr_seq > 0) {
             /* If a sorted sequence is requested, make certain we don't go backwards in the offset */
-            if ((iter->flags & H5S_SEL_ITER_GET_SEQ_LIST_SORTED) && loc < off[curr_seq - 1])
+            if (curr_seq > 0 && (iter->flags & H5S_SEL_ITER_GET_SEQ_LIST_SORTED) && loc < off[curr_seq - 1])
                 break;
 
-            /* Check if this point extends the previous sequence */
-            /* (Unlikely, but possible) */
-            if (loc == (off[curr_seq - 1] + len[curr_seq - 1])) {
-                /* Extend the previous sequence */
-                len[curr_seq - 1] += iter->elmt_size;
-            } /* end if */
-            else {
-                /* Add a new sequence */
-                off[curr_seq] = loc;
-                len[curr_seq] = iter->elmt_size;
-
-                /* Increment sequence count */
-                curr_seq++;
-            } /* end else */
-        }     /* end if */
-        else {
             /* Add a new sequence */
             off[curr_seq] = loc;
             len[curr_seq] = iter->elmt_size;
@@ -481,22 +486,14 @@ H5S__point_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxelem
         /* Decrement number of elements left to process */
         io_left--;
 
-        /* Move the iterator */
-        iter->u.pnt.curr = node->next;
-        iter->elmt_left--;
-
-        /* Check if we're finished with all sequences */
-        if (curr_seq == maxseq)
-            break;
-
-        /* Check if we're finished with all the elements available */
-        if (io_left == 0)
-            break;
-
         /* Advance to the next point */
-        node = node->next;
+        pnt += ndims;
     } /* end while */
 
+    /* Move the iterator past the points used */
+    iter->u.pnt.curr += start_io_left - io_left;
+    iter->elmt_left -= start_io_left - io_left;
+
     /* Set the number of sequences generated */
     *nseq = curr_seq;
 
@@ -560,9 +557,11 @@ H5S__point_iter_release(H5S_sel_iter_t *iter)
 static herr_t
 H5S__point_add(H5S_t *space, H5S_seloper_t op, size_t num_elem, const hsize_t *coord)
 {
-    H5S_pnt_node_t *top = NULL, *curr = NULL, *new_node = NULL; /* Point selection nodes */
-    unsigned        u;                                          /* Counter */
-    herr_t          ret_value = SUCCEED;                        /* Return value */
+    H5S_pnt_list_t *pnt_lst;             /* Point list of the selection */
+    hsize_t        *dst;                 /* Where to put the new points */
+    unsigned        rank;                /* Dataspace rank */
+    size_t          u;                   /* Counter */
+    herr_t          ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -572,66 +571,42 @@ H5S__point_add(H5S_t *space, H5S_seloper_t op, size_t num_elem, const hsize_t *c
     assert(coord);
     assert(op == H5S_SELECT_SET || op == H5S_SELECT_APPEND || op == H5S_SELECT_PREPEND);
 
-    for (u = 0; u < num_elem; u++) {
-        unsigned dim; /* Counter for dimensions */
+    pnt_lst = space->select.sel_info.pnt_lst;
+    rank    = space->extent.rank;
 
-        /* Allocate space for the new node */
-        if (NULL == (new_node = (H5S_pnt_node_t *)H5FL_ARR_MALLOC(hcoords_t, space->extent.rank)))
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point node");
+    /* (Note: when op is H5S_SELECT_SET, the point list and the bound box
+     *      have been reset inside H5S_select_elements, the only caller of
+     *      this function.  So SET works the same as APPEND here)
+     */
+    assert(op != H5S_SELECT_SET || 0 == pnt_lst->npoints);
+
+    /* Make room for the new points */
+    if (H5S__pnt_list_reserve(pnt_lst, rank, pnt_lst->npoints + num_elem) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point coordinates");
+
+    /* Insert the points selected in the proper place */
+    if (op == H5S_SELECT_PREPEND) {
+        /* Move the current points after the new ones */
+        memmove(H5S_PNT_COORDS(pnt_lst, rank, num_elem), pnt_lst->coords,
+                pnt_lst->npoints * rank * sizeof(hsize_t));
+        dst = pnt_lst->coords;
+    } /* end if */
+    else
+        dst = H5S_PNT_COORDS(pnt_lst, rank, pnt_lst->npoints);
 
-        /* Initialize fields in node */
-        new_node->next = NULL;
+    /* Copy over the coordinates */
+    H5MM_memcpy(dst, coord, num_elem * rank * sizeof(hsize_t));
+    pnt_lst->npoints += num_elem;
 
-        /* Copy over the coordinates */
-        H5MM_memcpy(new_node->pnt, coord + (u * space->extent.rank), (space->extent.rank * sizeof(hsize_t)));
+    /* Update bound box */
+    for (u = 0; u < num_elem; u++, coord += rank) {
+        unsigned dim; /* Counter for dimensions */
 
-        /* Link into list */
-        if (top == NULL)
-            top = new_node;
-        else
-            curr->next = new_node;
-        curr = new_node;
-
-        /* Update bound box */
-        /* (Note: when op is H5S_SELECT_SET, the bound box has been reset
-         *      inside H5S_select_elements, the only caller of this function.
-         *      So the following bound box update procedure works correctly
-         *      for the SET operation)
-         */
-        for (dim = 0; dim < space->extent.rank; dim++) {
-            space->select.sel_info.pnt_lst->low_bounds[dim] =
-                MIN(space->select.sel_info.pnt_lst->low_bounds[dim], curr->pnt[dim]);
-            space->select.sel_info.pnt_lst->high_bounds[dim] =
-                MAX(space->select.sel_info.pnt_lst->high_bounds[dim], curr->pnt[dim]);
+        for (dim = 0; dim < rank; dim++) {
+            pnt_lst->low_bounds[dim]  = MIN(pnt_lst->low_bounds[dim], coord[dim]);
+            pnt_lst->high_bounds[dim] = MAX(pnt_lst->high_bounds[dim], coord[dim]);
         } /* end for */
     }     /* end for */
-    new_node = NULL;
-
-    /* Insert the list of points selected in the proper place */
-    if (op == H5S_SELECT_SET || op == H5S_SELECT_PREPEND) {
-        /* Append current list, if there is one */
-        if (NULL != space->select.sel_info.pnt_lst->head)
-            curr->next = space->select.sel_info.pnt_lst->head;
-
-        /* Put new list in point selection */
-        space->select.sel_info.pnt_lst->head = top;
-
-        /* Change the tail pointer if tail has not been set */
-        if (NULL == space->select.sel_info.pnt_lst->tail)
-            space->select.sel_info.pnt_lst->tail = curr;
-    }                             /* end if */
-    else {                        /* op==H5S_SELECT_APPEND */
-        H5S_pnt_node_t *tmp_node; /* Temporary point selection node */
-
-        tmp_node = space->select.sel_info.pnt_lst->head;
-        if (tmp_node != NULL) {
-            assert(space->select.sel_info.pnt_lst->tail);
-            space->select.sel_info.pnt_lst->tail->next = top;
-        } /* end if */
-        else
-            space->select.sel_info.pnt_lst->head = top;
-        space->select.sel_info.pnt_lst->tail = curr;
-    } /* end else */
 
     /* Set the number of elements in the new selection */
     if (op == H5S_SELECT_SET)
@@ -640,19 +615,6 @@ H5S__point_add(H5S_t *space, H5S_seloper_t op, size_t num_elem, const hsize_t *c
         space->select.num_elem += num_elem;
 
 done:
-    if (ret_value < 0) {
-        /* Release possibly partially initialized new node */
-        if (new_node)
-            new_node = (H5S_pnt_node_t *)H5FL_ARR_FREE(hcoords_t, new_node);
-
-        /* Release possible linked list of nodes */
-        while (top) {
-            curr = top->next;
-            top  = (H5S_pnt_node_t *)H5FL_ARR_FREE(hcoords_t, top);
-            top  = curr;
-        } /* end while */
-    }     /* end if */
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S__point_add() */
 
@@ -762,6 +724,61 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S_select_elements() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__pnt_list_reserve
+ PURPOSE
+    Make room for a number of points in a point selection list
+ USAGE
+    herr_t H5S__pnt_list_reserve(pnt_lst, rank, npoints)
+        H5S_pnt_list_t *pnt_lst;        IN/OUT: Pointer to the point list
+        unsigned rank;                  IN: # of dimensions for points
+        size_t npoints;                 IN: # of points to make room for
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Grows the coordinate array of the point list so it has room for at least
+    NPOINTS points.  The array is at least doubled when it grows, so adding
+    points one at a time takes amortized constant time.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__pnt_list_reserve(H5S_pnt_list_t *pnt_lst, unsigned rank, size_t npoints)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    assert(pnt_lst);
+    assert(rank > 0);
+
+    if (npoints > pnt_lst->nalloc) {
+        hsize_t *new_coords; /* Reallocated coordinate array */
+        size_t   new_nalloc; /* New # of points to make room for */
+
+        /* Check for overflow */
+        if (npoints < pnt_lst->npoints || npoints > (SIZE_MAX / (rank * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_OVERFLOW, FAIL, "too many points in selection");
+
+        new_nalloc = MAX(H5S_PNT_LIST_INIT_NALLOC, pnt_lst->nalloc);
+        while (new_nalloc < npoints)
+            new_nalloc = MIN(2 * new_nalloc, SIZE_MAX / (rank * sizeof(hsize_t)));
+
+        if (NULL == (new_coords = (hsize_t *)H5MM_realloc(pnt_lst->coords,
+                                                          new_nalloc * rank * sizeof(hsize_t))))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point coordinates");
+        pnt_lst->coords = new_coords;
+        pnt_lst->nalloc = new_nalloc;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__pnt_list_reserve() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S__copy_pnt_list
@@ -784,8 +801,7 @@ done:
 static H5S_pnt_list_t *
 H5S__copy_pnt_list(const H5S_pnt_list_t *src, unsigned rank)
 {
-    H5S_pnt_list_t *dst = NULL;       /* New point list */
-    H5S_pnt_node_t *curr, *new_tail;  /* Point information nodes */
+    H5S_pnt_list_t *dst       = NULL; /* New point list */
     H5S_pnt_list_t *ret_value = NULL; /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -795,42 +811,21 @@ H5S__copy_pnt_list(const H5S_pnt_list_t *src, unsigned rank)
     assert(rank > 0);
 
     /* Allocate room for the head of the point list */
-    if (NULL == (dst = H5FL_MALLOC(H5S_pnt_list_t)))
+    if (NULL == (dst = H5FL_CALLOC(H5S_pnt_list_t)))
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate point list node");
 
-    curr     = src->head;
-    new_tail = NULL;
-    while (curr) {
-        H5S_pnt_node_t *new_node; /* New point information node */
-
-        /* Create new point */
-        if (NULL == (new_node = (H5S_pnt_node_t *)H5FL_ARR_MALLOC(hcoords_t, rank)))
-            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate point node");
-        new_node->next = NULL;
-
-        /* Copy over the point's coordinates */
-        H5MM_memcpy(new_node->pnt, curr->pnt, (rank * sizeof(hsize_t)));
-
-        /* Keep the order the same when copying */
-        if (NULL == new_tail)
-            new_tail = dst->head = new_node;
-        else {
-            new_tail->next = new_node;
-            new_tail       = new_node;
-        } /* end else */
-
-        curr = curr->next;
-    } /* end while */
-    dst->tail = new_tail;
+    /* Copy the points' coordinates, keeping the order the same */
+    if (src->npoints > 0) {
+        if (H5S__pnt_list_reserve(dst, rank, src->npoints) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, NULL, "can't allocate point coordinates");
+        H5MM_memcpy(dst->coords, src->coords, src->npoints * rank * sizeof(hsize_t));
+        dst->npoints = src->npoints;
+    } /* end if */
 
     /* Copy the selection bounds */
     H5MM_memcpy(dst->high_bounds, src->high_bounds, (rank * sizeof(hsize_t)));
     H5MM_memcpy(dst->low_bounds, src->low_bounds, (rank * sizeof(hsize_t)));
 
-    /* Clear cached iteration point */
-    dst->last_idx     = 0;
-    dst->last_idx_pnt = NULL;
-
     /* Set return value */
     ret_value = dst;
 
@@ -861,22 +856,12 @@ done:
 static void
 H5S__free_pnt_list(H5S_pnt_list_t *pnt_lst)
 {
-    H5S_pnt_node_t *curr; /* Point information nodes */
-
     FUNC_ENTER_PACKAGE_NOERR
 
     /* Sanity checks */
     assert(pnt_lst);
 
-    /* Traverse the list, freeing all memory */
-    curr = pnt_lst->head;
-    while (curr) {
-        H5S_pnt_node_t *tmp_node = curr;
-
-        curr     = curr->next;
-        tmp_node = (H5S_pnt_node_t *)H5FL_ARR_FREE(hcoords_t, tmp_node);
-    } /* end while */
-
+    H5MM_xfree(pnt_lst->coords);
     H5FL_FREE(H5S_pnt_list_t, pnt_lst);
 
     FUNC_LEAVE_NOAPI_VOID
@@ -1205,14 +1190,15 @@ done:
 static herr_t
 H5S__point_serialize(H5S_t *space, uint8_t **p)
 {
-    H5S_pnt_node_t *curr;                /* Point information nodes */
-    uint8_t        *pp;                  /* Local pointer for encoding */
-    uint8_t        *lenp = NULL;         /* pointer to length location for later storage */
-    uint32_t        len  = 0;            /* number of bytes used */
-    unsigned        u;                   /* local counting variable */
-    uint32_t        version;             /* Version number */
-    uint8_t         enc_size;            /* Encoded size of point selection info */
-    herr_t          ret_value = SUCCEED; /* Return value */
+    const hsize_t *coords;              /* Coordinates of the points */
+    size_t         ncoords;             /* Number of coordinates to encode */
+    uint8_t       *pp;                  /* Local pointer for encoding */
+    uint8_t       *lenp = NULL;         /* pointer to length location for later storage */
+    uint32_t       len  = 0;            /* number of bytes used */
+    size_t         u;                   /* local counting variable */
+    uint32_t       version;             /* Version number */
+    uint8_t        enc_size;            /* Encoded size of point selection info */
+    herr_t         ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -1244,6 +1230,10 @@ H5S__point_serialize(H5S_t *space, uint8_t **p)
     /* Encode number of dimensions */
     UINT32ENCODE(pp, (uint32_t)space->extent.rank);
 
+    /* The coordinates of all the points, in order */
+    coords  = space->select.sel_info.pnt_lst->coords;
+    ncoords = space->select.sel_info.pnt_lst->npoints * space->extent.rank;
+
     switch (enc_size) {
         case H5S_SELECT_INFO_ENC_SIZE_2:
             assert(version == H5S_POINT_VERSION_2);
@@ -1252,13 +1242,8 @@ H5S__point_serialize(H5S_t *space, uint8_t **p)
             UINT16ENCODE(pp, (uint16_t)space->select.num_elem);
 
             /* Encode each point in selection */
-            curr = space->select.sel_info.pnt_lst->head;
-            while (curr != NULL) {
-                /* Encode each point */
-                for (u = 0; u < space->extent.rank; u++)
-                    UINT16ENCODE(pp, (uint16_t)curr->pnt[u]);
-                curr = curr->next;
-            } /* end while */
+            for (u = 0; u < ncoords; u++)
+                UINT16ENCODE(pp, (uint16_t)coords[u]);
             break;
 
         case H5S_SELECT_INFO_ENC_SIZE_4:
@@ -1268,13 +1253,8 @@ H5S__point_serialize(H5S_t *space, uint8_t **p)
             UINT32ENCODE(pp, (uint32_t)space->select.num_elem);
 
             /* Encode each point in selection */
-            curr = space->select.sel_info.pnt_lst->head;
-            while (curr != NULL) {
-                /* Encode each point */
-                for (u = 0; u < space->extent.rank; u++)
-                    UINT32ENCODE(pp, (uint32_t)curr->pnt[u]);
-                curr = curr->next;
-            } /* end while */
+            for (u = 0; u < ncoords; u++)
+                UINT32ENCODE(pp, (uint32_t)coords[u]);
 
             /* Add 4 bytes times the rank for each element selected */
             if (version == H5S_POINT_VERSION_1)
@@ -1288,13 +1268,8 @@ H5S__point_serialize(H5S_t *space, uint8_t **p)
             UINT64ENCODE(pp, space->select.num_elem);
 
             /* Encode each point in selection */
-            curr = space->select.sel_info.pnt_lst->head;
-            while (curr != NULL) {
-                /* Encode each point */
-                for (u = 0; u < space->extent.rank; u++)
-                    UINT64ENCODE(pp, curr->pnt[u]);
-                curr = curr->next;
-            } /* end while */
+            for (u = 0; u < ncoords; u++)
+                UINT64ENCODE(pp, coords[u]);
             break;
 
         default:
@@ -1545,9 +1520,8 @@ done:
 static herr_t
 H5S__get_select_elem_pointlist(const H5S_t *space, hsize_t startpoint, hsize_t numpoints, hsize_t *buf)
 {
-    const hsize_t   endpoint = startpoint + numpoints; /* Index of last point in iteration */
-    H5S_pnt_node_t *node;                              /* Point node */
-    unsigned        rank;                              /* Dataspace rank */
+    const H5S_pnt_list_t *pnt_lst; /* Point list of the selection */
+    unsigned              rank;    /* Dataspace rank */
 
     FUNC_ENTER_PACKAGE_NOERR
 
@@ -1555,34 +1529,15 @@ H5S__get_select_elem_pointlist(const H5S_t *space, hsize_t startpoint, hsize_t n
     assert(buf);
 
     /* Get the dataspace extent rank */
-    rank = space->extent.rank;
-
-    /* Check for cached point at the correct index */
-    if (space->select.sel_info.pnt_lst->last_idx_pnt &&
-        startpoint == space->select.sel_info.pnt_lst->last_idx)
-        node = space->select.sel_info.pnt_lst->last_idx_pnt;
-    else {
-        /* Get the head of the point list */
-        node = space->select.sel_info.pnt_lst->head;
-
-        /* Iterate to the first point to return */
-        while (node != NULL && startpoint > 0) {
-            startpoint--;
-            node = node->next;
-        } /* end while */
-    }     /* end else */
-
-    /* Iterate through the node, copying each point's information */
-    while (node != NULL && numpoints > 0) {
-        H5MM_memcpy(buf, node->pnt, sizeof(hsize_t) * rank);
-        buf += rank;
-        numpoints--;
-        node = node->next;
-    } /* end while */
-
-    /* Cached next point in iteration */
-    space->select.sel_info.pnt_lst->last_idx     = endpoint;
-    space->select.sel_info.pnt_lst->last_idx_pnt = node;
+    rank    = space->extent.rank;
+    pnt_lst = space->select.sel_info.pnt_lst;
+
+    /* Copy the points' coordinates, up to the end of the list */
+    if (startpoint < pnt_lst->npoints) {
+        numpoints = MIN(numpoints, pnt_lst->npoints - startpoint);
+        H5MM_memcpy(buf, H5S_PNT_COORDS(pnt_lst, rank, startpoint),
+                    (size_t)numpoints * rank * sizeof(hsize_t));
+    } /* end if */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5S__get_select_elem_pointlist() */
@@ -1739,7 +1694,7 @@ H5S__point_offset(const H5S_t *space, hsize_t *offset)
     *offset = 0;
 
     /* Set up pointers to arrays of values */
-    pnt        = space->select.sel_info.pnt_lst->head->pnt;
+    pnt        = space->select.sel_info.pnt_lst->coords;
     sel_offset = space->select.offset;
     dim_size   = space->extent.size;
 
@@ -1929,13 +1884,15 @@ H5S__point_is_regular(H5S_t *space)
 static htri_t
 H5S__point_shape_same(H5S_t *space1, H5S_t *space2)
 {
-    H5S_pnt_node_t *pnt1, *pnt2;          /* Point information nodes */
-    hssize_t        offset[H5S_MAX_RANK]; /* Offset between the selections */
-    unsigned        space1_rank;          /* Number of dimensions of first dataspace */
-    unsigned        space2_rank;          /* Number of dimensions of second dataspace */
-    int             space1_dim;           /* Current dimension in first dataspace */
-    int             space2_dim;           /* Current dimension in second dataspace */
-    htri_t          ret_value = TRUE;     /* Return value */
+    const hsize_t *pnt1, *pnt2;          /* Coordinates of points */
+    hssize_t       offset[H5S_MAX_RANK]; /* Offset between the selections */
+    unsigned       space1_rank;          /* Number of dimensions of first dataspace */
+    unsigned       space2_rank;          /* Number of dimensions of second dataspace */
+    int            space1_dim;           /* Current dimension in first dataspace */
+    int            space2_dim;           /* Current dimension in second dataspace */
+    size_t         npoints;              /* Number of points to compare */
+    size_t         n;                    /* Local index variable */
+    htri_t         ret_value = TRUE;     /* Return value */
 
     FUNC_ENTER_PACKAGE_NOERR
 
@@ -1958,11 +1915,12 @@ H5S__point_shape_same(H5S_t *space1, H5S_t *space2)
     /* Look at first point in each selection to compute the offset for common
      *  dimensions.
      */
-    pnt1 = space1->select.sel_info.pnt_lst->head;
-    pnt2 = space2->select.sel_info.pnt_lst->head;
+    pnt1    = space1->select.sel_info.pnt_lst->coords;
+    pnt2    = space2->select.sel_info.pnt_lst->coords;
+    npoints = MIN(space1->select.sel_info.pnt_lst->npoints, space2->select.sel_info.pnt_lst->npoints);
     while (space2_dim >= 0) {
         /* Set the relative locations of the selections */
-        offset[space1_dim] = (hssize_t)pnt2->pnt[space2_dim] - (hssize_t)pnt1->pnt[space1_dim];
+        offset[space1_dim] = (hssize_t)pnt2[space2_dim] - (hssize_t)pnt1[space1_dim];
 
         space1_dim--;
         space2_dim--;
@@ -1971,24 +1929,24 @@ H5S__point_shape_same(H5S_t *space1, H5S_t *space2)
     /* For dimensions that appear only in space1: */
     while (space1_dim >= 0) {
         /* Set the absolute offset of the remaining dimensions */
-        offset[space1_dim] = (hssize_t)pnt1->pnt[space1_dim];
+        offset[space1_dim] = (hssize_t)pnt1[space1_dim];
 
         space1_dim--;
     } /* end while */
 
     /* Advance to next point */
-    pnt1 = pnt1->next;
-    pnt2 = pnt2->next;
+    pnt1 += space1_rank;
+    pnt2 += space2_rank;
 
     /* Loop over remaining points */
-    while (pnt1 && pnt2) {
+    for (n = 1; n < npoints; n++) {
         /* Initialize dimensions */
         space1_dim = (int)space1_rank - 1;
         space2_dim = (int)space2_rank - 1;
 
         /* Compare locations in common dimensions, including relative offset */
         while (space2_dim >= 0) {
-            if ((hsize_t)((hssize_t)pnt1->pnt[space1_dim] + offset[space1_dim]) != pnt2->pnt[space2_dim])
+            if ((hsize_t)((hssize_t)pnt1[space1_dim] + offset[space1_dim]) != pnt2[space2_dim])
                 HGOTO_DONE(FALSE);
 
             space1_dim--;
@@ -1998,16 +1956,16 @@ H5S__point_shape_same(H5S_t *space1, H5S_t *space2)
         /* For dimensions that appear only in space1: */
         while (space1_dim >= 0) {
             /* Compare the absolute offset in the remaining dimensions */
-            if ((hssize_t)pnt1->pnt[space1_dim] != offset[space1_dim])
+            if ((hssize_t)pnt1[space1_dim] != offset[space1_dim])
                 HGOTO_DONE(FALSE);
 
             space1_dim--;
         } /* end while */
 
         /* Advance to next point */
-        pnt1 = pnt1->next;
-        pnt2 = pnt2->next;
-    } /* end while */
+        pnt1 += space1_rank;
+        pnt2 += space2_rank;
+    } /* end for */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2035,8 +1993,9 @@ done:
 htri_t
 H5S__point_intersect_block(H5S_t *space, const hsize_t *start, const hsize_t *end)
 {
-    H5S_pnt_node_t *pnt;               /* Point information node */
-    htri_t          ret_value = FALSE; /* Return value */
+    const hsize_t *pnt;               /* Coordinates of point */
+    size_t         n;                 /* Local index variable */
+    htri_t         ret_value = FALSE; /* Return value */
 
     FUNC_ENTER_PACKAGE_NOERR
 
@@ -2047,13 +2006,13 @@ H5S__point_intersect_block(H5S_t *space, const hsize_t *start, const hsize_t *en
     assert(end);
 
     /* Loop over points */
-    pnt = space->select.sel_info.pnt_lst->head;
-    while (pnt) {
+    pnt = space->select.sel_info.pnt_lst->coords;
+    for (n = 0; n < space->select.sel_info.pnt_lst->npoints; n++) {
         unsigned u; /* Local index variable */
 
         /* Verify that the point is within the block */
         for (u = 0; u < space->extent.rank; u++)
-            if (pnt->pnt[u] < start[u] || pnt->pnt[u] > end[u])
+            if (pnt[u] < start[u] || pnt[u] > end[u])
                 break;
 
         /* Check if point was within block for all dimensions */
@@ -2061,8 +2020,8 @@ H5S__point_intersect_block(H5S_t *space, const hsize_t *start, const hsize_t *en
             HGOTO_DONE(TRUE);
 
         /* Advance to next point */
-        pnt = pnt->next;
-    } /* end while */
+        pnt += space->extent.rank;
+    } /* end for */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2089,10 +2048,11 @@ done:
 static herr_t
 H5S__point_adjust_u(H5S_t *space, const hsize_t *offset)
 {
-    hbool_t         non_zero_offset = FALSE; /* Whether any offset is non-zero */
-    H5S_pnt_node_t *node;                    /* Point node */
-    unsigned        rank;                    /* Dataspace rank */
-    unsigned        u;                       /* Local index variable */
+    hbool_t  non_zero_offset = FALSE; /* Whether any offset is non-zero */
+    hsize_t *pnt;                     /* Coordinates of point */
+    size_t   n;                       /* Local index variable */
+    unsigned rank;                    /* Dataspace rank */
+    unsigned u;                       /* Local index variable */
 
     FUNC_ENTER_PACKAGE_NOERR
 
@@ -2108,23 +2068,19 @@ H5S__point_adjust_u(H5S_t *space, const hsize_t *offset)
 
     /* Only perform operation if the offset is non-zero */
     if (non_zero_offset) {
-        /* Iterate through the nodes, checking the bounds on each element */
-        node = space->select.sel_info.pnt_lst->head;
+        /* Iterate through the points, checking the bounds on each element */
+        pnt  = space->select.sel_info.pnt_lst->coords;
         rank = space->extent.rank;
-        while (node) {
-            /* Adjust each coordinate for point node */
+        for (n = 0; n < space->select.sel_info.pnt_lst->npoints; n++, pnt += rank)
+            /* Adjust each coordinate for point */
             for (u = 0; u < rank; u++) {
                 /* Check for offset moving selection negative */
-                assert(node->pnt[u] >= offset[u]);
+                assert(pnt[u] >= offset[u]);
 
-                /* Adjust node's coordinate location */
-                node->pnt[u] -= offset[u];
+                /* Adjust point's coordinate location */
+                pnt[u] -= offset[u];
             } /* end for */
 
-            /* Advance to next point node in selection */
-            node = node->next;
-        } /* end while */
-
         /* update the bound box of the selection */
         for (u = 0; u < rank; u++) {
             space->select.sel_info.pnt_lst->low_bounds[u] -= offset[u];
@@ -2156,10 +2112,11 @@ H5S__point_adjust_u(H5S_t *space, const hsize_t *offset)
 static herr_t
 H5S__point_adjust_s(H5S_t *space, const hssize_t *offset)
 {
-    hbool_t         non_zero_offset = FALSE; /* Whether any offset is non-zero */
-    H5S_pnt_node_t *node;                    /* Point node */
-    unsigned        rank;                    /* Dataspace rank */
-    unsigned        u;                       /* Local index variable */
+    hbool_t  non_zero_offset = FALSE; /* Whether any offset is non-zero */
+    hsize_t *pnt;                     /* Coordinates of point */
+    size_t   n;                       /* Local index variable */
+    unsigned rank;                    /* Dataspace rank */
+    unsigned u;                       /* Local index variable */
 
     FUNC_ENTER_PACKAGE_NOERR
 
@@ -2175,23 +2132,19 @@ H5S__point_adjust_s(H5S_t *space, const hssize_t *offset)
 
     /* Only perform operation if the offset is non-zero */
     if (non_zero_offset) {
-        /* Iterate through the nodes, checking the bounds on each element */
-        node = space->select.sel_info.pnt_lst->head;
+        /* Iterate through the points, checking the bounds on each element */
+        pnt  = space->select.sel_info.pnt_lst->coords;
         rank = space->extent.rank;
-        while (node) {
-            /* Adjust each coordinate for point node */
+        for (n = 0; n < space->select.sel_info.pnt_lst->npoints; n++, pnt += rank)
+            /* Adjust each coordinate for point */
             for (u = 0; u < rank; u++) {
                 /* Check for offset moving selection negative */
-                assert((hssize_t)node->pnt[u] >= offset[u]);
+                assert((hssize_t)pnt[u] >= offset[u]);
 
-                /* Adjust node's coordinate location */
-                node->pnt[u] = (hsize_t)((hssize_t)node->pnt[u] - offset[u]);
+                /* Adjust point's coordinate location */
+                pnt[u] = (hsize_t)((hssize_t)pnt[u] - offset[u]);
             } /* end for */
 
-            /* Advance to next point node in selection */
-            node = node->next;
-        } /* end while */
-
         /* update the bound box of the selection */
         for (u = 0; u < rank; u++) {
             assert((hssize_t)space->select.sel_info.pnt_lst->low_bounds[u] >= offset[u]);
@@ -2218,8 +2171,7 @@ H5S__point_adjust_s(H5S_t *space, const hssize_t *offset)
 static herr_t
 H5S__point_project_scalar(const H5S_t *space, hsize_t *offset)
 {
-    const H5S_pnt_node_t *node;                /* Point node */
-    herr_t                ret_value = SUCCEED; /* Return value */
+    herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -2227,16 +2179,14 @@ H5S__point_project_scalar(const H5S_t *space, hsize_t *offset)
     assert(space && H5S_SEL_POINTS == H5S_GET_SELECT_TYPE(space));
     assert(offset);
 
-    /* Get the head of the point list */
-    node = space->select.sel_info.pnt_lst->head;
-
     /* Check for more than one point selected */
-    if (node->next)
+    if (space->select.sel_info.pnt_lst->npoints > 1)
         HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL,
                     "point selection of one element has more than one node!");
 
     /* Calculate offset of selection in projected buffer */
-    *offset = H5VM_array_offset(space->extent.rank, space->extent.size, node->pnt);
+    *offset =
+        H5VM_array_offset(space->extent.rank, space->extent.size, space->select.sel_info.pnt_lst->coords);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2255,10 +2205,14 @@ done:
 static herr_t
 H5S__point_project_simple(const H5S_t *base_space, H5S_t *new_space, hsize_t *offset)
 {
-    const H5S_pnt_node_t *base_node;           /* Point node in base space */
-    H5S_pnt_node_t       *new_node;            /* Point node in new space */
-    H5S_pnt_node_t       *prev_node;           /* Previous point node in new space */
+    const H5S_pnt_list_t *base_lst;            /* Point list of base space */
+    H5S_pnt_list_t       *new_lst;             /* Point list of new space */
+    const hsize_t        *base_pnt;            /* Coordinates of point in base space */
+    hsize_t              *new_pnt;             /* Coordinates of point in new space */
+    unsigned              base_rank;           /* Rank of base space */
+    unsigned              new_rank;            /* Rank of new space */
     unsigned              rank_diff;           /* Difference in ranks between spaces */
+    size_t                n;                   /* Local index variable */
     unsigned              u;                   /* Local index variable */
     herr_t                ret_value = SUCCEED; /* Return value */
 
@@ -2269,111 +2223,75 @@ H5S__point_project_simple(const H5S_t *base_space, H5S_t *new_space, hsize_t *of
     assert(new_space);
     assert(offset);
 
+    base_lst  = base_space->select.sel_info.pnt_lst;
+    base_rank = base_space->extent.rank;
+    new_rank  = new_space->extent.rank;
+
     /* We are setting a new selection, remove any current selection in new dataspace */
     if (H5S_SELECT_RELEASE(new_space) < 0)
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't release selection");
 
     /* Allocate room for the head of the point list */
-    if (NULL == (new_space->select.sel_info.pnt_lst = H5FL_MALLOC(H5S_pnt_list_t)))
+    if (NULL == (new_lst = new_space->select.sel_info.pnt_lst = H5FL_CALLOC(H5S_pnt_list_t)))
         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point list node");
 
+    /* Allocate room for the points */
+    if (H5S__pnt_list_reserve(new_lst, new_rank, base_lst->npoints) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point coordinates");
+    new_lst->npoints = base_lst->npoints;
+
     /* Check if the new space's rank is < or > base space's rank */
-    if (new_space->extent.rank < base_space->extent.rank) {
+    if (new_rank < base_rank) {
         hsize_t block[H5S_MAX_RANK]; /* Block selected in base dataspace */
 
         /* Compute the difference in ranks */
-        rank_diff = base_space->extent.rank - new_space->extent.rank;
+        rank_diff = base_rank - new_rank;
 
         /* Calculate offset of selection in projected buffer */
         memset(block, 0, sizeof(block));
-        H5MM_memcpy(block, base_space->select.sel_info.pnt_lst->head->pnt, sizeof(hsize_t) * rank_diff);
-        *offset = H5VM_array_offset(base_space->extent.rank, base_space->extent.size, block);
-
-        /* Iterate through base space's point nodes, copying the point information */
-        base_node = base_space->select.sel_info.pnt_lst->head;
-        prev_node = NULL;
-        while (base_node) {
-            /* Create new point */
-            if (NULL == (new_node = (H5S_pnt_node_t *)H5FL_ARR_MALLOC(hcoords_t, new_space->extent.rank)))
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point node");
-            new_node->next = NULL;
-
-            /* Copy over the point's coordinates */
-            H5MM_memcpy(new_node->pnt, &base_node->pnt[rank_diff],
-                        (new_space->extent.rank * sizeof(hsize_t)));
-
-            /* Keep the order the same when copying */
-            if (NULL == prev_node)
-                prev_node = new_space->select.sel_info.pnt_lst->head = new_node;
-            else {
-                prev_node->next = new_node;
-                prev_node       = new_node;
-            } /* end else */
-
-            /* Advance to next node */
-            base_node = base_node->next;
-        } /* end while */
+        H5MM_memcpy(block, base_lst->coords, sizeof(hsize_t) * rank_diff);
+        *offset = H5VM_array_offset(base_rank, base_space->extent.size, block);
+
+        /* Copy the point information, keeping the order the same */
+        base_pnt = base_lst->coords;
+        new_pnt  = new_lst->coords;
+        for (n = 0; n < base_lst->npoints; n++, base_pnt += base_rank, new_pnt += new_rank)
+            H5MM_memcpy(new_pnt, &base_pnt[rank_diff], (new_rank * sizeof(hsize_t)));
 
         /* Update the bounding box */
-        for (u = 0; u < new_space->extent.rank; u++) {
-            new_space->select.sel_info.pnt_lst->low_bounds[u] =
-                base_space->select.sel_info.pnt_lst->low_bounds[u + rank_diff];
-            new_space->select.sel_info.pnt_lst->high_bounds[u] =
-                base_space->select.sel_info.pnt_lst->high_bounds[u + rank_diff];
+        for (u = 0; u < new_rank; u++) {
+            new_lst->low_bounds[u]  = base_lst->low_bounds[u + rank_diff];
+            new_lst->high_bounds[u] = base_lst->high_bounds[u + rank_diff];
         } /* end for */
     }     /* end if */
     else {
-        assert(new_space->extent.rank > base_space->extent.rank);
+        assert(new_rank > base_rank);
 
         /* Compute the difference in ranks */
-        rank_diff = new_space->extent.rank - base_space->extent.rank;
+        rank_diff = new_rank - base_rank;
 
         /* The offset is zero when projected into higher dimensions */
         *offset = 0;
 
-        /* Iterate through base space's point nodes, copying the point information */
-        base_node = base_space->select.sel_info.pnt_lst->head;
-        prev_node = NULL;
-        while (base_node) {
-            /* Create new point */
-            if (NULL == (new_node = (H5S_pnt_node_t *)H5FL_ARR_MALLOC(hcoords_t, new_space->extent.rank)))
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate point node");
-            new_node->next = NULL;
-
-            /* Copy over the point's coordinates */
-            memset(new_node->pnt, 0, sizeof(hsize_t) * rank_diff);
-            H5MM_memcpy(&new_node->pnt[rank_diff], base_node->pnt,
-                        (base_space->extent.rank * sizeof(hsize_t)));
-
-            /* Keep the order the same when copying */
-            if (NULL == prev_node)
-                prev_node = new_space->select.sel_info.pnt_lst->head = new_node;
-            else {
-                prev_node->next = new_node;
-                prev_node       = new_node;
-            } /* end else */
-
-            /* Advance to next node */
-            base_node = base_node->next;
-        } /* end while */
+        /* Copy the point information, keeping the order the same */
+        base_pnt = base_lst->coords;
+        new_pnt  = new_lst->coords;
+        for (n = 0; n < base_lst->npoints; n++, base_pnt += base_rank, new_pnt += new_rank) {
+            memset(new_pnt, 0, sizeof(hsize_t) * rank_diff);
+            H5MM_memcpy(&new_pnt[rank_diff], base_pnt, (base_rank * sizeof(hsize_t)));
+        } /* end for */
 
         /* Update the bounding box */
         for (u = 0; u < rank_diff; u++) {
-            new_space->select.sel_info.pnt_lst->low_bounds[u]  = 0;
-            new_space->select.sel_info.pnt_lst->high_bounds[u] = 0;
+            new_lst->low_bounds[u]  = 0;
+            new_lst->high_bounds[u] = 0;
         } /* end for */
-        for (; u < new_space->extent.rank; u++) {
-            new_space->select.sel_info.pnt_lst->low_bounds[u] =
-                base_space->select.sel_info.pnt_lst->low_bounds[u - rank_diff];
-            new_space->select.sel_info.pnt_lst->high_bounds[u] =
-                base_space->select.sel_info.pnt_lst->high_bounds[u - rank_diff];
+        for (; u < new_rank; u++) {
+            new_lst->low_bounds[u]  = base_lst->low_bounds[u - rank_diff];
+            new_lst->high_bounds[u] = base_lst->high_bounds[u - rank_diff];
         } /* end for */
     }     /* end else */
 
-    /* Clear cached iteration point */
-    new_space->select.sel_info.pnt_lst->last_idx     = 0;
-    new_space->select.sel_info.pnt_lst->last_idx_pnt = NULL;
-
     /* Number of elements selected will be the same */
     new_space->select.num_elem = base_space->select.num_elem;
 
@@ -2442,3 +2360,180 @@ H5Sselect_elements(hid_t spaceid, H5S_seloper_t op, size_t num_elem, const hsize
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Sselect_elements() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__point_cmp_offset
+ PURPOSE
+    Compare the linear offsets of two points
+ USAGE
+    int H5S__point_cmp_offset(_off1, _off2)
+        const void *_off1;      IN: Pointer to the first offset
+        const void *_off2;      IN: Pointer to the second offset
+ RETURNS
+    Negative, zero or positive if the first offset is less than, equal to
+    or greater than the second
+ DESCRIPTION
+    Callback for qsort() to sort the linear offsets of points.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static int
+H5S__point_cmp_offset(const void *_off1, const void *_off2)
+{
+    hsize_t off1 = *(const hsize_t *)_off1; /* First offset */
+    hsize_t off2 = *(const hsize_t *)_off2; /* Second offset */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    FUNC_LEAVE_NOAPI((off1 > off2) - (off1 < off2))
+} /* end H5S__point_cmp_offset() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S__point_sort
+ PURPOSE
+    Sort the points of a point selection
+ USAGE
+    herr_t H5S__point_sort(space, remove_dups)
+        H5S_t *space;           IN/OUT: Dataspace with point selection to sort
+        hbool_t remove_dups;    IN: Whether to remove duplicate points
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Sorts the points of a point selection into 'C' array order, i.e. the
+    order of their offsets in the dataspace, and optionally removes points
+    selected more than once.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The points are sorted by their linear offsets in their bounding box,
+    which are in the same order as their offsets in the dataspace and work
+    for points outside the extent too.  The bounding box must have fewer
+    than 2^64 elements.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+static herr_t
+H5S__point_sort(H5S_t *space, hbool_t remove_dups)
+{
+    H5S_pnt_list_t *pnt_lst;             /* Point list of the selection */
+    hsize_t         box[H5S_MAX_RANK];   /* Size of the bounding box of the points */
+    hsize_t         box_nelmts;          /* # of elements in the bounding box */
+    hsize_t        *offsets = NULL;      /* Linear offsets of the points */
+    hsize_t        *pnt;                 /* Coordinates of point */
+    size_t          npoints;             /* # of points after sorting */
+    size_t          n;                   /* Local index variable */
+    unsigned        rank;                /* Dataspace rank */
+    unsigned        u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    assert(space && H5S_SEL_POINTS == H5S_GET_SELECT_TYPE(space));
+
+    pnt_lst = space->select.sel_info.pnt_lst;
+    rank    = space->extent.rank;
+
+    /* Nothing to do for a single point */
+    if (pnt_lst->npoints < 2)
+        HGOTO_DONE(SUCCEED);
+
+    /* Get the size of the bounding box */
+    for (u = 0, box_nelmts = 1; u < rank; u++) {
+        box[u] = (pnt_lst->high_bounds[u] - pnt_lst->low_bounds[u]) + 1;
+        if (0 == box[u] || box_nelmts > (HSIZET_MAX / box[u]))
+            HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "bounding box of points is too large to sort");
+        box_nelmts *= box[u];
+    } /* end for */
+
+    /* Compute the linear offset of each point in the bounding box */
+    if (NULL == (offsets = (hsize_t *)H5MM_malloc(pnt_lst->npoints * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTALLOC, FAIL, "can't allocate array of point offsets");
+    for (n = 0, pnt = pnt_lst->coords; n < pnt_lst->npoints; n++, pnt += rank) {
+        hsize_t off = 0; /* Offset of point */
+
+        for (u = 0; u < rank; u++)
+            off = (off * box[u]) + (pnt[u] - pnt_lst->low_bounds[u]);
+        offsets[n] = off;
+    } /* end for */
+
+    /* Sort the offsets */
+    qsort(offsets, pnt_lst->npoints, sizeof(hsize_t), H5S__point_cmp_offset);
+
+    /* Remove duplicate offsets */
+    npoints = pnt_lst->npoints;
+    if (remove_dups) {
+        for (n = 1, npoints = 1; n < pnt_lst->npoints; n++)
+            if (offsets[n] != offsets[npoints - 1])
+                offsets[npoints++] = offsets[n];
+    } /* end if */
+
+    /* Convert the offsets back to coordinates */
+    /* (The bounding box doesn't change, since every distinct point is kept) */
+    for (n = 0, pnt = pnt_lst->coords; n < npoints; n++, pnt += rank) {
+        hsize_t off = offsets[n]; /* Offset of point */
+        int     i;                /* Local index variable */
+
+        for (i = (int)rank - 1; i >= 0; i--) {
+            pnt[i] = (off % box[i]) + pnt_lst->low_bounds[i];
+            off /= box[i];
+        } /* end for */
+    }     /* end for */
+
+    /* Set the number of points */
+    pnt_lst->npoints       = npoints;
+    space->select.num_elem = npoints;
+
+done:
+    H5MM_xfree(offsets);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S__point_sort() */
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Ssort_elements
+ PURPOSE
+    Sort the points of a point selection
+ USAGE
+    herr_t H5Ssort_elements(spaceid, remove_dups)
+        hid_t spaceid;          IN: Dataspace ID of point selection to sort
+        hbool_t remove_dups;    IN: Whether to remove duplicate points
+ RETURNS
+    Non-negative on success/Negative on failure
+ DESCRIPTION
+    Sorts the points of a point selection into 'C' array order, i.e. the
+    order of their offsets in the dataspace, and optionally removes points
+    selected more than once.  This changes the order that the elements are
+    iterated through when I/O is performed, and lets selected elements that
+    are adjacent in the dataset be transferred together.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5Ssort_elements(hid_t spaceid, hbool_t remove_dups)
+{
+    H5S_t *space;               /* Dataspace to modify selection of */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", spaceid, remove_dups);
+
+    /* Check args */
+    if (NULL == (space = (H5S_t *)H5I_object_verify(spaceid, H5I_DATASPACE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataspace");
+    if (H5S_GET_SELECT_TYPE(space) != H5S_SEL_POINTS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a point selection");
+
+    /* Sort the points */
+    if (H5S__point_sort(space, remove_dups) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSORT, FAIL, "can't sort points");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Ssort_elements() */
@@ -31,7 +31,6 @@
 
 /* Forward references of package typedefs */
 typedef struct H5S_extent_t          H5S_extent_t;
-typedef struct H5S_pnt_node_t        H5S_pnt_node_t;
 typedef struct H5S_pnt_list_t        H5S_pnt_list_t;
 typedef struct H5S_hyper_span_t      H5S_hyper_span_t;
 typedef struct H5S_hyper_span_info_t H5S_hyper_span_info_t;
@@ -47,7 +46,7 @@ typedef struct H5S_hyper_dim_t {
 /* Point selection iteration container */
 typedef struct {
     H5S_pnt_list_t *pnt_lst; /* Pointer to point list */
-    H5S_pnt_node_t *curr;    /* Pointer to next node to output */
+    size_t          curr;    /* Index of next point to output */
 } H5S_point_iter_t;
 
 /* Hyperslab selection iteration container */
@@ -295,6 +294,8 @@ H5_DLL hsize_t H5S_select_iter_nelmts(const H5S_sel_iter_t *sel_iter);
 H5_DLL herr_t  H5S_select_iter_next(H5S_sel_iter_t *sel_iter, size_t nelem);
 H5_DLL herr_t H5S_select_iter_get_seq_list(H5S_sel_iter_t *iter, size_t maxseq, size_t maxbytes, size_t *nseq,
                                            size_t *nbytes, hsize_t *off, size_t *len);
+H5_DLL htri_t H5S_select_iter_get_strided_seq(H5S_sel_iter_t *iter, size_t maxelmts, size_t *nseq,
+                                              size_t *nelmts, hsize_t *off, size_t *len, hsize_t *stride);
 H5_DLL herr_t H5S_select_iter_release(H5S_sel_iter_t *sel_iter);
 H5_DLL herr_t H5S_sel_iter_close(H5S_sel_iter_t *sel_iter);
 
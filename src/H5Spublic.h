@@ -1099,6 +1099,43 @@ H5_DLL herr_t H5Sselect_copy(hid_t dst_id, hid_t src_id);
  *
  */
 H5_DLL herr_t H5Sselect_elements(hid_t space_id, H5S_seloper_t op, size_t num_elem, const hsize_t *coord);
+/**
+ * \ingroup H5S
+ *
+ * \brief Selects a list of blocks to combine with the current selection
+ *
+ * \space_id{spaceid}
+ * \param[in] op        Operation to perform on current selection
+ * \param[in] numblocks Number of blocks in \p blocks
+ * \param[in] blocks    List of blocks
+ *
+ * \return \herr_t
+ *
+ * \details H5Sselect_hyper_blocklist() combines the union of a list of
+ *          blocks with the current selection of the dataspace \p spaceid,
+ *          with the operation \p op.  The operations are the same as for
+ *          H5Sselect_hyperslab().
+ *
+ *          The \p blocks list has the same layout as the list returned by
+ *          H5Sget_select_hyper_blocklist(): for each block, the coordinates
+ *          of its start, followed by the coordinates of the diagonally
+ *          opposite corner.  The list has \p numblocks times twice the
+ *          dataspace rank elements.  The blocks may overlap and may be in
+ *          any order.
+ *
+ *          The result is the same as selecting each block in turn with
+ *          H5Sselect_hyperslab() and #H5S_SELECT_OR, then combining that
+ *          selection with the current one.  However, all the blocks are
+ *          merged into the selection in one pass, which is much faster for
+ *          large numbers of blocks.  If the blocks form a regular
+ *          hyperslab, H5Sis_regular_hyperslab() returns \c TRUE for the
+ *          resulting selection.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Sselect_hyper_blocklist(hid_t spaceid, H5S_seloper_t op, size_t numblocks,
+                                        const hsize_t *blocks);
 /**
  * \ingroup H5S
  *
@@ -1353,6 +1390,35 @@ H5_DLL herr_t H5Sset_extent_none(hid_t space_id);
  *
  */
 H5_DLL herr_t H5Sset_extent_simple(hid_t space_id, int rank, const hsize_t dims[], const hsize_t max[]);
+/**
+ * \ingroup H5S
+ *
+ * \brief Sorts the points of a point selection
+ *
+ * \space_id{spaceid}
+ * \param[in] remove_dups Whether to remove points selected more than once
+ *
+ * \return \herr_t
+ *
+ * \details H5Ssort_elements() sorts the points of the point selection of the
+ *          dataspace \p spaceid into 'C' array order, i.e. the order of
+ *          their offsets in the dataspace. If \p remove_dups is true,
+ *          points selected more than once are selected only once
+ *          afterwards.
+ *
+ *          The order of the points of a point selection specifies the order
+ *          in which the elements are iterated through when I/O is
+ *          performed, so after sorting, the elements are transferred to or
+ *          from a memory buffer in sorted order. In exchange, selected
+ *          elements that are adjacent in the dataset are transferred
+ *          together.
+ *
+ *          The selection of \p spaceid must be a point selection.
+ *
+ * \since 1.14.3
+ *
+ */
+H5_DLL herr_t H5Ssort_elements(hid_t spaceid, hbool_t remove_dups);
 
 /* Symbols defined for compatibility with previous versions of the HDF5 API.
  *
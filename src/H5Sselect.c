@@ -1292,6 +1292,38 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S_select_iter_get_seq_list() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5S_select_iter_get_strided_seq
+ *
+ * Purpose:	Retrieves the next run of sequences of the same length at a
+ *              constant stride for an iterator on a dataspace, if the
+ *              selection is a regular hyperslab.  The caller copies the run
+ *              with H5VM_memcpy_strided() instead of getting a sequence
+ *              list from H5S_SELECT_ITER_GET_SEQ_LIST(), which it falls
+ *              back to when there is no run.
+ *
+ * Return:	TRUE if a run was retrieved, FALSE if not
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5S_select_iter_get_strided_seq(H5S_sel_iter_t *iter, size_t maxelmts, size_t *nseq, size_t *nelmts,
+                                hsize_t *off, size_t *len, hsize_t *stride)
+{
+    htri_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    assert(iter);
+
+    /* Only hyperslab selections can have runs of sequences */
+    if (H5S_SEL_HYPERSLABS == iter->type->type && iter->elmt_left > 0)
+        ret_value = H5S__hyper_iter_get_strided_seq(iter, maxelmts, nseq, nelmts, off, len, stride);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_select_iter_get_strided_seq() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5S_select_iter_release
@@ -2500,7 +2532,9 @@ H5S_select_project_intersection(H5S_t *src_space, H5S_t *dst_space, H5S_t *src_i
              * point algorithm?  The search through the selection in
              * H5S_SELECT_INTERSECT_BLOCK will likely be O(N) either way.  -NAF */
             if (H5S_GET_SELECT_TYPE(src_intersect_space) == H5S_SEL_POINTS) {
-                H5S_pnt_node_t *curr_pnt = src_intersect_space->select.sel_info.pnt_lst->head;
+                const H5S_pnt_list_t *pnt_lst = src_intersect_space->select.sel_info.pnt_lst;
+                const hsize_t        *curr_pnt;
+                size_t                n;
 
                 /* Create dataspace and copy extent */
                 if (NULL == (tmp_src_intersect_space = H5S_create(H5S_SIMPLE)))
@@ -2512,11 +2546,11 @@ H5S_select_project_intersection(H5S_t *src_space, H5S_t *dst_space, H5S_t *src_i
                                 "unable to copy source intersect space extent");
 
                 /* Iterate over points */
-                for (curr_pnt = src_intersect_space->select.sel_info.pnt_lst->head; curr_pnt;
-                     curr_pnt = curr_pnt->next)
+                for (n = 0, curr_pnt = pnt_lst->coords; n < pnt_lst->npoints;
+                     n++, curr_pnt += src_intersect_space->extent.rank)
                     /* Add point to hyperslab selection */
                     if (H5S_hyper_add_span_element(tmp_src_intersect_space, src_intersect_space->extent.rank,
-                                                   curr_pnt->pnt) < 0)
+                                                   curr_pnt) < 0)
                         HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
                                     "can't add point to temporary dataspace selection");
 
@@ -196,16 +196,17 @@ done:
 
 /*--------------------------------------------------------------------------
  NAME
-    H5S__check_points_tail_ptr
+    H5S__check_points_list
  PURPOSE
-    Determine if the tail pointer of the points list are correctly set
+    Determine if the points list is consistent with the selection
  USAGE
-    herr_t H5S__check_points_tail_ptr(pnt_lst)
-        const H5S_pnt_list_t *pnt_lst;  IN: the points list to check for taill pointers
+    herr_t H5S__check_points_list(space)
+        const H5S_t *space;     IN: the dataspace with the points list to check
  RETURNS
     SUCCEED/FAIL
  DESCRIPTION
-    Checks to see if the current selection in the dataspaces has tail pointers correctly set.
+    Checks to see if the current selection in the dataspaces has the right
+    number of points and all the points are within the bounding box.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
     Only check the points selection
@@ -213,28 +214,32 @@ done:
  REVISION LOG
 --------------------------------------------------------------------------*/
 static herr_t
-H5S__check_points_tail_ptr(const H5S_pnt_list_t *pnt_lst)
+H5S__check_points_list(const H5S_t *space)
 {
-    H5S_pnt_node_t *cur_elem;
-    H5S_pnt_node_t *actual_tail = NULL;
-    htri_t          ret_value   = TRUE; /* Return value */
+    const H5S_pnt_list_t *pnt_lst;          /* Points list to check */
+    const hsize_t        *pnt;              /* Coordinates of point */
+    size_t                n;                /* Local index variable */
+    unsigned              u;                /* Local index variable */
+    htri_t                ret_value = TRUE; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
+    assert(space);
+    pnt_lst = space->select.sel_info.pnt_lst;
     assert(pnt_lst);
 
-    cur_elem = pnt_lst->head;
-    while (cur_elem) {
-        actual_tail = cur_elem;
-        cur_elem    = cur_elem->next;
-    } /* end while */
-    if (actual_tail != pnt_lst->tail)
+    if (pnt_lst->npoints != space->select.num_elem || pnt_lst->npoints > pnt_lst->nalloc)
         HGOTO_ERROR(H5E_DATASPACE, H5E_INCONSISTENTSTATE, FAIL,
-                    "the selection has inconsistent tail pointers");
+                    "the selection has an inconsistent number of points");
+    for (n = 0, pnt = pnt_lst->coords; n < pnt_lst->npoints; n++, pnt += space->extent.rank)
+        for (u = 0; u < space->extent.rank; u++)
+            if (pnt[u] < pnt_lst->low_bounds[u] || pnt[u] > pnt_lst->high_bounds[u])
+                HGOTO_ERROR(H5E_DATASPACE, H5E_INCONSISTENTSTATE, FAIL,
+                            "the selection has a point outside its bounding box");
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5S__check_points_tail_ptr */
+} /* H5S__check_points_list */
 
 /*--------------------------------------------------------------------------
  NAME
@@ -316,12 +321,10 @@ H5S__check_internal_consistency(const H5S_t *space)
                             "the selection has inconsistent tail pointers");
     } /* end if */
     else if (space->select.type->type == H5S_SEL_POINTS) {
-        H5S_pnt_list_t *pnt_lst = space->select.sel_info.pnt_lst;
-
-        if (NULL != pnt_lst)
-            if (H5S__check_points_tail_ptr(pnt_lst) < 0)
+        if (NULL != space->select.sel_info.pnt_lst)
+            if (H5S__check_points_list(space) < 0)
                 HGOTO_ERROR(H5E_DATASPACE, H5E_INCONSISTENTSTATE, FAIL,
-                            "the selection has inconsistent tail pointers");
+                            "the selection has an inconsistent point list");
     } /* end else-if */
 
 done:
@@ -1680,6 +1680,11 @@ H5T_term_package(void)
     /* Destroy the datatype object id group */
     n += (H5I_dec_type_ref(H5I_DATATYPE) > 0);
 
+#ifdef H5_HAVE_MULTITHREAD
+    /* Stop the conversion threads */
+    H5T__conv_pool_term();
+#endif /* H5_HAVE_MULTITHREAD */
+
     FUNC_LEAVE_NOAPI(n)
 } /* end H5T_term_package() */
 
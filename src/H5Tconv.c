@@ -32,6 +32,7 @@
 #include "H5MMprivate.h" /* Memory management            */
 #include "H5Pprivate.h"  /* Property lists            */
 #include "H5Tpkg.h"      /* Datatypes                */
+#include "H5VMprivate.h" /* Vectors and arrays                   */
 
 /****************/
 /* Local Macros */
@@ -246,7 +247,7 @@
 #define H5T_CONV_sS(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) <= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_sU_CORE(STYPE, DTYPE, S, D, ST, DT, D_MIN, D_MAX)                                           \
@@ -275,7 +276,7 @@
 #define H5T_CONV_sU(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) <= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_sU, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_sU, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 /* Define to 1 if overflow is possible during conversion, 0 otherwise
@@ -357,19 +358,19 @@
 #define H5T_CONV_uS(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) <= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_uS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_uS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_uU(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) <= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_Ss(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) >= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_Xx, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_Xx, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_Su_CORE(STYPE, DTYPE, S, D, ST, DT, D_MIN, D_MAX)                                           \
@@ -410,19 +411,19 @@
 #define H5T_CONV_Su(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) >= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_Su, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_Su, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_Us(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) >= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_Ux, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_Ux, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_Uu(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) >= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_Ux, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_Ux, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_su_CORE(STYPE, DTYPE, S, D, ST, DT, D_MIN, D_MAX)                                           \
@@ -453,7 +454,7 @@
 #define H5T_CONV_su(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) == sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_su, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_su, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_us_CORE(STYPE, DTYPE, S, D, ST, DT, D_MIN, D_MAX)                                           \
@@ -484,13 +485,13 @@
 #define H5T_CONV_us(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) == sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_us, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_us, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_CONV_fF(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) <= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_xX, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 /* Same as H5T_CONV_Xx_CORE, except that instead of using D_MAX and D_MIN
@@ -534,7 +535,7 @@
 #define H5T_CONV_Ff(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
         HDcompile_assert(sizeof(ST) >= sizeof(DT));                                                          \
-        H5T_CONV(H5T_CONV_Ff, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)                                         \
+        H5T_CONV(H5T_CONV_Ff, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N, N)                                      \
     }
 
 #define H5T_HI_LO_BIT_SET(TYP, V, LO, HI)                                                                    \
@@ -629,7 +630,7 @@
 
 #define H5T_CONV_xF(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
-        H5T_CONV(H5T_CONV_xF, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, Y)                                         \
+        H5T_CONV(H5T_CONV_xF, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, Y, N)                                      \
     }
 
 /* Quincey added the condition branch (else if (*(S) != (ST)((DT)(*(S))))).
@@ -687,7 +688,7 @@
 
 #define H5T_CONV_Fx(STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                                      \
     {                                                                                                        \
-        H5T_CONV(H5T_CONV_Fx, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, Y)                                         \
+        H5T_CONV(H5T_CONV_Fx, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, Y, N)                                      \
     }
 
 /* Since all "no exception" cores do the same thing (assign the value in the
@@ -702,7 +703,7 @@
 #endif /* H5_WANT_DCONV_EXCEPTION */
 
 /* The main part of every integer hardware conversion macro */
-#define H5T_CONV(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, PREC)                                             \
+#define H5T_CONV(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, PREC, PAR)                                        \
     {                                                                                                        \
         herr_t ret_value = SUCCEED; /* Return value         */                                               \
                                                                                                              \
@@ -779,6 +780,14 @@
                                                                                                              \
                     H5T_CONV_SET_PREC(PREC) /*init precision variables, or not */                            \
                                                                                                              \
+                    /* Convert packed, aligned elements in vectorizable passes, when */                      \
+                    /* there is no exception callback to call for each element */                            \
+                    if (!buf_stride && !s_mv && !d_mv && !cb_struct.func) {                                  \
+                        H5T_CONV_VEC_PAR(PAR, STYPE, DTYPE, ST, DT)                                          \
+                        H5T_CONV_VEC_LOOP(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, buf, buf, nelmts)        \
+                        break;                                                                               \
+                    }                                                                                        \
+                                                                                                             \
                     /* The outer loop of the type conversion macro, controlling which */                     \
                     /* direction the buffer is walked */                                                     \
                     while (nelmts > 0) {                                                                     \
@@ -884,6 +893,87 @@ done:
 
 #define H5T_CONV_SET_PREC_N /*don't init precision variables */
 
+/* The "no exception" guts of a conversion, for H5T_CONV_VEC_LOOP */
+#ifdef H5_WANT_DCONV_EXCEPTION
+#define H5T_CONV_VEC_GUTS(GUTS) H5_GLUE(GUTS, _NOEX_CORE)
+#else /* H5_WANT_DCONV_EXCEPTION */
+#define H5T_CONV_VEC_GUTS(GUTS) H5T_CONV_NO_EXCEPT_CORE
+#endif /* H5_WANT_DCONV_EXCEPTION */
+
+/* Fewest elements H5T_CONV_VEC_LOOP converts in one forward pass */
+#define H5T_CONV_VEC_MIN_PASS 128
+
+/* Convert N packed, aligned elements from SRC to DST, without an exception
+ * callback.  Unlike the element loop of H5T_CONV, the elements are indexed
+ * with strides known at compile time, so the compiler can vectorize the
+ * passes.  When the elements grow, the passes go from the end of the buffer,
+ * each one over the elements whose destinations lie past the sources of the
+ * elements before them, and the last few elements are converted backwards.
+ */
+#define H5T_CONV_VEC_LOOP(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, SRC, DST, N)                             \
+    {                                                                                                        \
+        const ST *vec_src = (const ST *)(const void *)(SRC); /*source elements         */                    \
+        DT       *vec_dst = (DT *)(void *)(DST);             /*destination elements    */                    \
+        size_t    vec_end = (N);                             /*end of elements left    */                    \
+        size_t    vec_start;                                 /*first element of a pass */                    \
+        size_t    vec_u;                                     /*element counter         */                    \
+                                                                                                             \
+        if (sizeof(DT) > sizeof(ST)) {                                                                       \
+            while (vec_end > 0) {                                                                            \
+                vec_start = (vec_end * sizeof(ST) + sizeof(DT) - 1) / sizeof(DT);                            \
+                if (vec_end - vec_start < H5T_CONV_VEC_MIN_PASS) {                                           \
+                    for (vec_u = vec_end; vec_u-- > 0;)                                                      \
+                        H5T_CONV_VEC_GUTS(GUTS)(STYPE, DTYPE, vec_src + vec_u, vec_dst + vec_u, ST, DT,      \
+                                                D_MIN, D_MAX)                                                \
+                    break;                                                                                   \
+                }                                                                                            \
+                for (vec_u = vec_start; vec_u < vec_end; vec_u++)                                            \
+                    H5T_CONV_VEC_GUTS(GUTS)(STYPE, DTYPE, vec_src + vec_u, vec_dst + vec_u, ST, DT,          \
+                                            D_MIN, D_MAX)                                                    \
+                vec_end = vec_start;                                                                         \
+            }                                                                                                \
+        }                                                                                                    \
+        else                                                                                                 \
+            for (vec_u = 0; vec_u < vec_end; vec_u++)                                                        \
+                H5T_CONV_VEC_GUTS(GUTS)(STYPE, DTYPE, vec_src + vec_u, vec_dst + vec_u, ST, DT,              \
+                                        D_MIN, D_MAX)                                                        \
+    }
+
+/* Split a conversion of packed elements across the threads requested for
+ * the conversion, or not, for the conversions that define a kernel with
+ * H5T_CONV_VEC_FUNC.
+ */
+#define H5T_CONV_VEC_PAR(PAR, STYPE, DTYPE, ST, DT) H5_GLUE(H5T_CONV_VEC_PAR_, PAR)(STYPE, DTYPE, ST, DT)
+
+#ifdef H5_HAVE_MULTITHREAD
+#define H5T_CONV_VEC_PAR_Y(STYPE, DTYPE, ST, DT)                                                             \
+    {                                                                                                        \
+        unsigned nthreads; /*conversion threads */                                                    \
+                                                                                                             \
+        if (H5CX_get_dt_conv_nthreads(&nthreads) < 0)                                                        \
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to get number of conversion threads");      \
+        if (nthreads > 1) {                                                                                  \
+            H5T__conv_par(H5T__conv_vec_##STYPE##_##DTYPE, buf, nelmts, sizeof(ST), sizeof(DT), nthreads);   \
+            break;                                                                                           \
+        }                                                                                                    \
+    }
+#else /* H5_HAVE_MULTITHREAD */
+#define H5T_CONV_VEC_PAR_Y(STYPE, DTYPE, ST, DT) /*convert on the calling thread */
+#endif /* H5_HAVE_MULTITHREAD */
+
+#define H5T_CONV_VEC_PAR_N(STYPE, DTYPE, ST, DT) /*convert on the calling thread */
+
+/* Define the kernel that the threads of a conversion with PAR 'Y' run */
+#ifdef H5_HAVE_MULTITHREAD
+#define H5T_CONV_VEC_FUNC(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX)                                          \
+    static void H5T__conv_vec_##STYPE##_##DTYPE(const void *src, void *dst, size_t nelmts)                   \
+    {                                                                                                        \
+        H5T_CONV_VEC_LOOP(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, src, dst, nelmts)                        \
+    }
+#else /* H5_HAVE_MULTITHREAD */
+#define H5T_CONV_VEC_FUNC(GUTS, STYPE, DTYPE, ST, DT, D_MIN, D_MAX) /*no kernel */
+#endif /* H5_HAVE_MULTITHREAD */
+
 /* Macro defining action on source data which needs to be aligned (before main action) */
 #define H5T_CONV_LOOP_PRE_SALIGN(ST)                                                                         \
     {                                                                                                        \
@@ -1048,6 +1138,25 @@ done:
         ARRAY[J] = _tmp;                                                                                     \
     } while (0)
 
+/* Define a kernel that reverses the bytes of packed elements of SIZE bytes.
+ * With the element size known at compile time, the loop is vectorized.
+ */
+#define H5T_CONV_SWAP_FUNC(SIZE)                                                                             \
+    static void H5T__conv_swap##SIZE(const void *_src, void *_dst, size_t nelmts)                            \
+    {                                                                                                        \
+        const uint8_t *src = (const uint8_t *)_src;                                                          \
+        uint8_t       *dst = (uint8_t *)_dst;                                                                \
+        uint8_t        tmp[SIZE];                                                                            \
+        size_t         u, v;                                                                                 \
+                                                                                                             \
+        for (u = 0; u < nelmts; u++, src += SIZE, dst += SIZE) {                                             \
+            for (v = 0; v < SIZE; v++)                                                                       \
+                tmp[v] = src[(SIZE - 1) - v];                                                                \
+            for (v = 0; v < SIZE; v++)                                                                       \
+                dst[v] = tmp[v];                                                                             \
+        }                                                                                                    \
+    }
+
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE 4096
 
@@ -1152,6 +1261,11 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_noop() */
 
+/* Byte swap kernels for H5T__conv_order_opt() */
+H5T_CONV_SWAP_FUNC(2)
+H5T_CONV_SWAP_FUNC(4)
+H5T_CONV_SWAP_FUNC(8)
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_order_opt
  *
@@ -1169,11 +1283,12 @@ herr_t
 H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
                     size_t H5_ATTR_UNUSED bkg_stride, void *_buf, void H5_ATTR_UNUSED *background)
 {
-    uint8_t *buf = (uint8_t *)_buf;
-    H5T_t   *src = NULL;
-    H5T_t   *dst = NULL;
-    size_t   i;
-    herr_t   ret_value = SUCCEED; /* Return value */
+    uint8_t            *buf       = (uint8_t *)_buf;
+    H5T_t              *src       = NULL;
+    H5T_t              *dst       = NULL;
+    H5T_conv_vec_func_t swap_func = NULL; /* Kernel for packed elements */
+    size_t              i;
+    herr_t              ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -1255,6 +1370,31 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmt
             } /* end if */
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
+
+            /* Swap packed elements with a kernel, on the requested number of threads */
+            if (buf_stride == src->shared->size) {
+                if (2 == buf_stride)
+                    swap_func = H5T__conv_swap2;
+                else if (4 == buf_stride)
+                    swap_func = H5T__conv_swap4;
+                else if (8 == buf_stride)
+                    swap_func = H5T__conv_swap8;
+            } /* end if */
+            if (swap_func) {
+#ifdef H5_HAVE_MULTITHREAD
+                unsigned nthreads; /* Conversion threads */
+
+                if (H5CX_get_dt_conv_nthreads(&nthreads) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL,
+                                "unable to get number of conversion threads");
+                if (nthreads > 1)
+                    H5T__conv_par(swap_func, buf, nelmts, buf_stride, buf_stride, nthreads);
+                else
+#endif /* H5_HAVE_MULTITHREAD */
+                    (swap_func)(buf, buf, nelmts);
+                break;
+            } /* end if */
+
             switch (src->shared->size) {
                 case 1:
                     /*no-op*/
@@ -1932,6 +2072,7 @@ H5T__conv_struct_free(H5T_conv_struct_t *priv)
     H5MM_xfree(src_memb_id);
     H5MM_xfree(dst_memb_id);
     H5MM_xfree(priv->memb_path);
+    H5MM_xfree(priv->subset_info.runs);
 
     FUNC_LEAVE_NOAPI((H5T_conv_struct_t *)H5MM_xfree(priv))
 } /* end H5T__conv_struct_free() */
@@ -1975,6 +2116,14 @@ H5T__conv_struct_free(H5T_conv_struct_t *priv)
  *              The optimization is simply moving data to the appropriate
  *              places in the buffer.
  *
+ *              The members which need no conversion are also merged into
+ *              runs of members that are adjacent in both the source and
+ *              the destination, which the conversion functions copy
+ *              without looking at the members.  When no member needs a
+ *              conversion, but the common members aren't a prefix of
+ *              both types, the subset is H5T_SUBSET_MEMBS and reading
+ *              the members only copies the runs.
+ *
  * Return:    Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
@@ -1985,6 +2134,8 @@ H5T__conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
     H5T_conv_struct_t *priv    = (H5T_conv_struct_t *)(cdata->priv);
     int               *src2dst = NULL;
     unsigned           src_nmembs, dst_nmembs;
+    unsigned           nmapped = 0; /* # of source members in the destination */
+    unsigned           nnoop   = 0; /* # of those members which need no conversion */
     unsigned           i, j;
     herr_t             ret_value = SUCCEED; /* Return value */
 
@@ -2076,9 +2227,47 @@ H5T__conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
         }     /* end if */
     }         /* end for */
 
+    /*
+     * (Re)build the runs of members which need no conversion.  The source
+     * members are sorted by offset, so a member extends the last run when
+     * it follows that run in both the source and the destination.
+     */
+    priv->subset_info.runs  = (H5T_subset_run_t *)H5MM_xfree(priv->subset_info.runs);
+    priv->subset_info.nruns = 0;
+    if (src_nmembs > 0 && NULL == (priv->subset_info.runs = (H5T_subset_run_t *)H5MM_malloc(
+                                       src_nmembs * sizeof(H5T_subset_run_t)))) {
+        cdata->priv = H5T__conv_struct_free(priv);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed");
+    } /* end if */
+    for (i = 0; i < src_nmembs; i++) {
+        if (src2dst[i] >= 0) {
+            const H5T_cmemb_t *src_memb = &src->shared->u.compnd.memb[i];
+            const H5T_cmemb_t *dst_memb = &dst->shared->u.compnd.memb[src2dst[i]];
+            H5T_subset_run_t  *run      = priv->subset_info.runs + priv->subset_info.nruns;
+
+            nmapped++;
+            if (!priv->memb_path[i]->is_noop)
+                continue;
+            nnoop++;
+            assert(src_memb->size == dst_memb->size);
+
+            if (priv->subset_info.nruns > 0 && run[-1].src_offset + run[-1].size == src_memb->offset &&
+                run[-1].dst_offset + run[-1].size == dst_memb->offset)
+                run[-1].size += src_memb->size;
+            else {
+                run->src_offset = src_memb->offset;
+                run->dst_offset = dst_memb->offset;
+                run->size       = src_memb->size;
+                priv->subset_info.nruns++;
+            } /* end else */
+        }     /* end if */
+    }         /* end for */
+
     /* The compound conversion functions need a background buffer */
     cdata->need_bkg = H5T_BKG_YES;
 
+    priv->subset_info.subset    = H5T_SUBSET_FALSE;
+    priv->subset_info.copy_size = 0;
     if (src_nmembs < dst_nmembs) {
         priv->subset_info.subset = H5T_SUBSET_SRC;
         for (i = 0; i < src_nmembs; i++) {
@@ -2126,6 +2315,12 @@ H5T__conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
     {
     }
 
+    /* If no member needs a conversion, the common members can be copied in
+     * their runs, wherever they are in the source and destination.
+     */
+    if (H5T_SUBSET_FALSE == priv->subset_info.subset && nmapped > 0 && nnoop == nmapped)
+        priv->subset_info.subset = H5T_SUBSET_MEMBS;
+
     cdata->recalc = FALSE;
 
 done:
@@ -2286,7 +2481,17 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             /* Conversion loop... */
             for (elmtno = 0; elmtno < nelmts; elmtno++) {
                 /*
-                 * For each source member which will be present in the
+                 * Copy the members which need no conversion to the background
+                 * buffer, a run of adjacent members at a time.
+                 */
+                for (u = 0; u < priv->subset_info.nruns; u++) {
+                    const H5T_subset_run_t *run = &priv->subset_info.runs[u];
+
+                    H5MM_memcpy(xbkg + run->dst_offset, xbuf + run->src_offset, run->size);
+                } /* end for */
+
+                /*
+                 * For each other source member which will be present in the
                  * destination, convert the member to the destination type unless
                  * it is larger than the source type.  Then move the member to the
                  * left-most unoccupied position in the buffer.  This makes the
@@ -2294,8 +2499,8 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                  * right side.
                  */
                 for (u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if (src2dst[u] < 0)
-                        continue; /*subsetting*/
+                    if (src2dst[u] < 0 || priv->memb_path[u]->is_noop)
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + u;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[u];
 
@@ -2324,8 +2529,8 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                  */
                 H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
                 for (i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if (src2dst[i] < 0)
-                        continue; /*subsetting*/
+                    if (src2dst[i] < 0 || priv->memb_path[i]->is_noop)
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + i;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[i];
 
@@ -2560,15 +2765,27 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
             }     /* end if */
             else {
                 /*
-                 * For each member where the destination is not larger than the
+                 * Copy the members which need no conversion to their final
+                 * destination in the bkg buffer, striding through all the
+                 * elements for each run of adjacent members.
+                 */
+                for (u = 0; u < priv->subset_info.nruns; u++) {
+                    const H5T_subset_run_t *run = &priv->subset_info.runs[u];
+
+                    H5VM_memcpy_strided(bkg + run->dst_offset, bkg_stride, buf + run->src_offset, buf_stride,
+                                        run->size, nelmts);
+                } /* end for */
+
+                /*
+                 * For each other member where the destination is not larger than the
                  * source, stride through all the elements converting only that member
                  * in each element and then copying the element to its final
                  * destination in the bkg buffer. Otherwise move the element as far
                  * left as possible in the buffer.
                  */
                 for (u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if (src2dst[u] < 0)
-                        continue; /*subsetting*/
+                    if (src2dst[u] < 0 || priv->memb_path[u]->is_noop)
+                        continue; /*subsetting or copied*/
                     src_memb = src->shared->u.compnd.memb + u;
                     dst_memb = dst->shared->u.compnd.memb + src2dst[u];
 
@@ -6448,6 +6665,8 @@ herr_t
                            size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg){
         H5T_CONV_us(ULLONG, LLONG, unsigned long long, long long, -, LLONG_MAX)}
 
+H5T_CONV_VEC_FUNC(H5T_CONV_xX, FLOAT, DOUBLE, float, double, -, -)
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_float_double
  *
@@ -6458,9 +6677,12 @@ herr_t
  *
  *-------------------------------------------------------------------------
  */
-herr_t H5T__conv_float_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
-                              size_t buf_stride, size_t H5_ATTR_UNUSED bkg_stride, void *buf,
-                              void H5_ATTR_UNUSED *bkg){H5T_CONV_fF(FLOAT, DOUBLE, float, double, -, -)}
+herr_t
+H5T__conv_float_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV(H5T_CONV_xX, FLOAT, DOUBLE, float, double, -, -, N, Y)
+}
 
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_float_ldouble
@@ -6477,6 +6699,8 @@ herr_t
                             size_t H5_ATTR_UNUSED bkg_stride, void *buf,
                             void H5_ATTR_UNUSED *bkg){H5T_CONV_fF(FLOAT, LDOUBLE, float, long double, -, -)}
 
+H5T_CONV_VEC_FUNC(H5T_CONV_Ff, DOUBLE, FLOAT, double, float, -FLT_MAX, FLT_MAX)
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_double_float
  *
@@ -6488,9 +6712,11 @@ herr_t
  *-------------------------------------------------------------------------
  */
 herr_t
-    H5T__conv_double_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
-                           size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg){
-        H5T_CONV_Ff(DOUBLE, FLOAT, double, float, -FLT_MAX, FLT_MAX)}
+H5T__conv_double_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV(H5T_CONV_Ff, DOUBLE, FLOAT, double, float, -FLT_MAX, FLT_MAX, N, Y)
+}
 
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_double_ldouble
@@ -6712,6 +6938,8 @@ herr_t
                              size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg){
         H5T_CONV_xF(USHORT, LDOUBLE, unsigned short, long double, -, -)}
 
+H5T_CONV_VEC_FUNC(H5T_CONV_xF, INT, FLOAT, int, float, -, -)
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_int_float
  *
@@ -6722,9 +6950,14 @@ herr_t
  *
  *-------------------------------------------------------------------------
  */
-herr_t H5T__conv_int_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
-                           size_t H5_ATTR_UNUSED bkg_stride, void *buf,
-                           void H5_ATTR_UNUSED *bkg){H5T_CONV_xF(INT, FLOAT, int, float, -, -)}
+herr_t
+H5T__conv_int_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                    size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV(H5T_CONV_xF, INT, FLOAT, int, float, -, -, Y, Y)
+}
+
+H5T_CONV_VEC_FUNC(H5T_CONV_xF, INT, DOUBLE, int, double, -, -)
 
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_int_double
@@ -6736,9 +6969,12 @@ herr_t H5T__conv_int_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_
  *
  *-------------------------------------------------------------------------
  */
-herr_t H5T__conv_int_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
-                            size_t H5_ATTR_UNUSED bkg_stride, void *buf,
-                            void H5_ATTR_UNUSED *bkg){H5T_CONV_xF(INT, DOUBLE, int, double, -, -)}
+herr_t
+H5T__conv_int_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                     size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5T_CONV(H5T_CONV_xF, INT, DOUBLE, int, double, -, -, Y, Y)
+}
 
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_int_ldouble
@@ -7176,6 +7412,8 @@ herr_t
         H5_GCC_CLANG_DIAG_OFF("float-equal") H5T_CONV_Fx(LDOUBLE, USHORT, long double, unsigned short, 0,
                                                          USHRT_MAX) H5_GCC_CLANG_DIAG_ON("float-equal")}
 
+H5T_CONV_VEC_FUNC(H5T_CONV_Fx, FLOAT, INT, float, int, INT_MIN, INT_MAX)
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_float_int
  *
@@ -7186,10 +7424,14 @@ herr_t
  *
  *-------------------------------------------------------------------------
  */
-herr_t H5T__conv_float_int(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
-                           size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg){
-    H5_GCC_CLANG_DIAG_OFF("float-equal") H5T_CONV_Fx(FLOAT, INT, float, int, INT_MIN, INT_MAX)
-        H5_GCC_CLANG_DIAG_ON("float-equal")}
+herr_t
+H5T__conv_float_int(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                    size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5_GCC_CLANG_DIAG_OFF("float-equal")
+    H5T_CONV(H5T_CONV_Fx, FLOAT, INT, float, int, INT_MIN, INT_MAX, Y, Y)
+    H5_GCC_CLANG_DIAG_ON("float-equal")
+}
 
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_float_uint
@@ -7206,6 +7448,8 @@ herr_t H5T__conv_float_uint(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size
     H5_GCC_CLANG_DIAG_OFF("float-equal") H5T_CONV_Fx(FLOAT, UINT, float, unsigned int, 0, UINT_MAX)
         H5_GCC_CLANG_DIAG_ON("float-equal")}
 
+H5T_CONV_VEC_FUNC(H5T_CONV_Fx, DOUBLE, INT, double, int, INT_MIN, INT_MAX)
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_double_int
  *
@@ -7216,10 +7460,14 @@ herr_t H5T__conv_float_uint(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size
  *
  *-------------------------------------------------------------------------
  */
-herr_t H5T__conv_double_int(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
-                            size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg){
-    H5_GCC_CLANG_DIAG_OFF("float-equal") H5T_CONV_Fx(DOUBLE, INT, double, int, INT_MIN, INT_MAX)
-        H5_GCC_CLANG_DIAG_ON("float-equal")}
+herr_t
+H5T__conv_double_int(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride,
+                     size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg)
+{
+    H5_GCC_CLANG_DIAG_OFF("float-equal")
+    H5T_CONV(H5T_CONV_Fx, DOUBLE, INT, double, int, INT_MIN, INT_MAX, Y, Y)
+    H5_GCC_CLANG_DIAG_ON("float-equal")
+}
 
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_double_uint
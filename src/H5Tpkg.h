@@ -154,6 +154,15 @@ struct H5T_stats_t {
 typedef herr_t (*H5T_lib_conv_t)(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                                  size_t buf_stride, size_t bkg_stride, void *buf, void *bkg);
 
+/*
+ * Kernel of a conversion split across threads: converts NELMTS packed,
+ * aligned elements from SRC to DST without an exception callback.  SRC and
+ * DST may be the same buffer, or overlap as for an in-place conversion.
+ * Kernels run on the threads of the conversion pool, so they must not use
+ * any library state.
+ */
+typedef void (*H5T_conv_vec_func_t)(const void *src, void *dst, size_t nelmts);
+
 /* Conversion callbacks (library internal ones don't need DXPL) */
 typedef struct H5T_conv_func_t {
     hbool_t is_app; /* Whether conversion function is registered from application */
@@ -859,6 +868,13 @@ H5_DLL int    H5T__get_array_dims(const H5T_t *dt, hsize_t dims[]);
 H5_DLL herr_t H5T__ref_reclaim(void *elem, const H5T_t *dt);
 H5_DLL htri_t H5T__ref_set_loc(H5T_t *dt, H5VL_object_t *file, H5T_loc_t loc);
 
+#ifdef H5_HAVE_MULTITHREAD
+/* Conversion thread pool functions */
+H5_DLL void H5T__conv_par(H5T_conv_vec_func_t func, void *buf, size_t nelmts, size_t src_size,
+                          size_t dst_size, unsigned nthreads);
+H5_DLL void H5T__conv_pool_term(void);
+#endif /* H5_HAVE_MULTITHREAD */
+
 /* Compound functions */
 H5_DLL herr_t             H5T__insert(H5T_t *parent, const char *name, size_t offset, const H5T_t *member);
 H5_DLL size_t             H5T__get_member_size(const H5T_t *dt, unsigned membno);
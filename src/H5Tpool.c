@@ -0,0 +1,379 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Thread pool for large datatype conversions, in multi-thread
+ *          builds.
+ *
+ *          The hardware conversions of the common native types and the
+ *          byte order conversion split large buffers of packed elements
+ *          into ranges, which the calling thread and the threads of the
+ *          pool convert with a kernel that only touches the buffer (see
+ *          H5T_conv_vec_func_t).  The pool is started on first use with as
+ *          many threads as requested with H5Pset_type_conv_threads(), and
+ *          is stopped when the library shuts down.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Tmodule.h" /* This source code file is part of the H5T module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions			*/
+#include "H5MMprivate.h" /* Memory management			*/
+#include "H5Tpkg.h"      /* Datatypes				*/
+
+#ifdef H5_HAVE_MULTITHREAD
+
+#include <pthread.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Largest number of threads a conversion is split across */
+#define H5T_POOL_MAX_THREADS 32
+
+/* Fewest bytes of the larger elements a thread converts */
+#define H5T_POOL_MIN_NBYTES (128 * 1024)
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* One range of elements to convert */
+typedef struct H5T_pool_task_t {
+    H5T_conv_vec_func_t func;   /* Conversion kernel          */
+    const void         *src;    /* First source element       */
+    void               *dst;    /* First destination element  */
+    size_t              nelmts; /* Number of elements         */
+} H5T_pool_task_t;
+
+/*
+ * The conversion thread pool.  A conversion publishes its ranges in
+ * 'tasks' and wakes the workers; every thread, including the converting
+ * one, claims ranges by advancing 'next' until none are left, and the
+ * converting thread then waits for 'ndone' to reach 'ntasks'.  The fields
+ * are protected by 'mutex', and only the thread holding 'run_mutex' uses
+ * the pool for a conversion.
+ */
+typedef struct H5T_pool_t {
+    pthread_mutex_t  run_mutex; /* Held while a conversion uses the pool  */
+    pthread_mutex_t  mutex;     /* Protects the fields below              */
+    pthread_cond_t   work_cv;   /* Signaled when ranges are published     */
+    pthread_cond_t   done_cv;   /* Signaled when the last range is done   */
+    pthread_t       *threads;   /* Worker threads                         */
+    unsigned         nthreads;  /* Number of worker threads started       */
+    H5T_pool_task_t *tasks;     /* Ranges of the current conversion       */
+    size_t           ntasks;    /* Number of ranges                       */
+    size_t           next;      /* Next range to claim                    */
+    size_t           ndone;     /* Number of ranges converted             */
+    hbool_t          shutdown;  /* Whether the workers should exit        */
+} H5T_pool_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static void  *H5T__pool_worker(void *_pool);
+static void   H5T__pool_start(unsigned nworkers);
+static size_t H5T__pool_split(H5T_conv_vec_func_t func, const uint8_t *src, uint8_t *dst, size_t nelmts,
+                              size_t src_size, size_t dst_size, unsigned nthreads);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* The conversion thread pool */
+static H5T_pool_t H5T_pool_s = {PTHREAD_MUTEX_INITIALIZER,
+                                 PTHREAD_MUTEX_INITIALIZER,
+                                 PTHREAD_COND_INITIALIZER,
+                                 PTHREAD_COND_INITIALIZER,
+                                 NULL,
+                                 0,
+                                 NULL,
+                                 0,
+                                 0,
+                                 0,
+                                 FALSE};
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__pool_worker
+ *
+ * Purpose:     Body of a pool thread: claims and converts ranges until the
+ *              pool is shut down.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5T__pool_worker(void *_pool)
+{
+    H5T_pool_t *pool = (H5T_pool_t *)_pool;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        H5T_pool_task_t *task;
+
+        while (!pool->shutdown && pool->next >= pool->ntasks)
+            pthread_cond_wait(&pool->work_cv, &pool->mutex);
+        if (pool->shutdown)
+            break;
+
+        task = &pool->tasks[pool->next++];
+        pthread_mutex_unlock(&pool->mutex);
+
+        (task->func)(task->src, task->dst, task->nelmts);
+
+        pthread_mutex_lock(&pool->mutex);
+        if (++pool->ndone == pool->ntasks)
+            pthread_cond_signal(&pool->done_cv);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+} /* end H5T__pool_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__pool_start
+ *
+ * Purpose:     Starts worker threads until the pool has NWORKERS of them.
+ *              The caller holds the pool's run_mutex.  A thread that can't
+ *              be started leaves the pool smaller, which only makes the
+ *              conversions use fewer threads.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__pool_start(unsigned nworkers)
+{
+    H5T_pool_t *pool = &H5T_pool_s;
+    pthread_t  *threads;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (nworkers > pool->nthreads &&
+        NULL != (threads = (pthread_t *)H5MM_realloc(pool->threads, nworkers * sizeof(pthread_t)))) {
+        pool->threads = threads;
+        while (pool->nthreads < nworkers &&
+               0 == pthread_create(&pool->threads[pool->nthreads], NULL, H5T__pool_worker, pool))
+            pool->nthreads++;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__pool_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__pool_split
+ *
+ * Purpose:     Converts NELMTS elements from SRC to DST with FUNC, split
+ *              across up to NTHREADS threads of the pool, including the
+ *              calling one.  No destination element of the range may
+ *              overlap a source element of another thread's part, which
+ *              holds when the source and destination elements are the
+ *              same, or when all the destination elements of the range lie
+ *              before or past all its source elements.
+ *
+ * Return:      The number of threads the range was split across
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5T__pool_split(H5T_conv_vec_func_t func, const uint8_t *src, uint8_t *dst, size_t nelmts, size_t src_size,
+                size_t dst_size, unsigned nthreads)
+{
+    H5T_pool_t     *pool = &H5T_pool_s;
+    H5T_pool_task_t tasks[H5T_POOL_MAX_THREADS]; /* Parts of the range */
+    size_t          ntasks;                      /* Number of parts */
+    size_t          per_task;                    /* Elements in each part but the last */
+    size_t          t;
+    size_t          ret_value = 1; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Give each thread enough elements to be worth waking it */
+    ntasks = (nelmts * MAX(src_size, dst_size)) / H5T_POOL_MIN_NBYTES;
+    ntasks = MIN(ntasks, (size_t)nthreads);
+    if (ntasks < 2)
+        (func)(src, dst, nelmts);
+    else {
+        per_task = nelmts / ntasks;
+        for (t = 0; t < ntasks; t++) {
+            size_t start = t * per_task;
+
+            tasks[t].func   = func;
+            tasks[t].src    = src + start * src_size;
+            tasks[t].dst    = dst + start * dst_size;
+            tasks[t].nelmts = (t == ntasks - 1) ? nelmts - start : per_task;
+        } /* end for */
+
+        pthread_mutex_lock(&pool->mutex);
+        pool->tasks  = tasks;
+        pool->ntasks = ntasks;
+        pool->next   = 0;
+        pool->ndone  = 0;
+        pthread_cond_broadcast(&pool->work_cv);
+
+        /* Convert ranges along with the workers */
+        while (pool->next < pool->ntasks) {
+            t = pool->next++;
+            pthread_mutex_unlock(&pool->mutex);
+
+            (func)(tasks[t].src, tasks[t].dst, tasks[t].nelmts);
+
+            pthread_mutex_lock(&pool->mutex);
+            pool->ndone++;
+        } /* end while */
+        while (pool->ndone < pool->ntasks)
+            pthread_cond_wait(&pool->done_cv, &pool->mutex);
+
+        pool->tasks  = NULL;
+        pool->ntasks = 0;
+        pool->next   = 0;
+        pool->ndone  = 0;
+        pthread_mutex_unlock(&pool->mutex);
+
+        ret_value = ntasks;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__pool_split() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_par
+ *
+ * Purpose:     Converts NELMTS packed elements of SRC_SIZE bytes in BUF, in
+ *              place, to elements of DST_SIZE bytes with FUNC, on up to
+ *              NTHREADS threads, including the calling one.
+ *
+ *              When the elements keep their size, the buffer is split
+ *              across the threads at once.  When they grow, the elements
+ *              whose destinations lie past all the source elements before
+ *              them are converted in parallel, from the end of the buffer,
+ *              and the rest is converted the same way, until few elements
+ *              are left.  When they shrink, a few elements at the start are
+ *              converted first, after which each step converts in parallel
+ *              the elements whose destinations fit in the space that has
+ *              been freed.
+ *
+ *              If another conversion is using the pool, or no thread can
+ *              be started, the calling thread converts all the elements.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T__conv_par(H5T_conv_vec_func_t func, void *_buf, size_t nelmts, size_t src_size, size_t dst_size,
+              unsigned nthreads)
+{
+    uint8_t *buf = (uint8_t *)_buf;
+    size_t   min_nelmts; /* Fewest elements worth splitting */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(func);
+    assert(buf);
+    assert(src_size > 0 && dst_size > 0);
+
+    nthreads = MIN(nthreads, H5T_POOL_MAX_THREADS);
+
+    /* Convert serially while another conversion uses the pool */
+    if (nthreads < 2 || 0 != pthread_mutex_trylock(&H5T_pool_s.run_mutex)) {
+        (func)(buf, buf, nelmts);
+        goto done;
+    } /* end if */
+
+    H5T__pool_start(nthreads - 1);
+    nthreads   = MIN(nthreads, H5T_pool_s.nthreads + 1);
+    min_nelmts = (2 * H5T_POOL_MIN_NBYTES) / MAX(src_size, dst_size);
+
+    if (dst_size > src_size) {
+        size_t end = nelmts; /* End of the elements left to convert */
+
+        while (end > 0) {
+            /* First element whose destination lies past the sources of the elements before it */
+            size_t start = (end * src_size + dst_size - 1) / dst_size;
+
+            if (end - start < min_nelmts) {
+                (func)(buf, buf, end);
+                break;
+            } /* end if */
+            H5T__pool_split(func, buf + start * src_size, buf + start * dst_size, end - start, src_size,
+                            dst_size, nthreads);
+            end = start;
+        } /* end while */
+    }     /* end if */
+    else if (dst_size < src_size) {
+        size_t start = MIN(nelmts, min_nelmts); /* Start of the elements left to convert */
+
+        (func)(buf, buf, start);
+        while (start < nelmts) {
+            /* End of the elements whose destinations fit before the sources left */
+            size_t end = MIN(nelmts, (start * src_size) / dst_size);
+
+            H5T__pool_split(func, buf + start * src_size, buf + start * dst_size, end - start, src_size,
+                            dst_size, nthreads);
+            start = end;
+        } /* end while */
+    }     /* end else-if */
+    else
+        H5T__pool_split(func, buf, buf, nelmts, src_size, dst_size, nthreads);
+
+    pthread_mutex_unlock(&H5T_pool_s.run_mutex);
+
+done:
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_par() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_pool_term
+ *
+ * Purpose:     Stops and joins the threads of the conversion pool.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T__conv_pool_term(void)
+{
+    H5T_pool_t *pool = &H5T_pool_s;
+    unsigned    u;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (pool->nthreads > 0) {
+        pthread_mutex_lock(&pool->mutex);
+        pool->shutdown = TRUE;
+        pthread_cond_broadcast(&pool->work_cv);
+        pthread_mutex_unlock(&pool->mutex);
+
+        for (u = 0; u < pool->nthreads; u++)
+            pthread_join(pool->threads[u], NULL);
+    } /* end if */
+
+    pool->threads  = (pthread_t *)H5MM_xfree(pool->threads);
+    pool->nthreads = 0;
+    pool->shutdown = FALSE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_pool_term() */
+
+#endif /* H5_HAVE_MULTITHREAD */
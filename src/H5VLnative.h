@@ -209,7 +209,9 @@ typedef union H5VL_native_dataset_optional_args_t {
 #define H5VL_NATIVE_FILE_GET_MPI_ATOMICITY 26 /* H5Fget_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_SET_MPI_ATOMICITY 27 /* H5Fset_mpi_atomicity                 */
 #endif
-#define H5VL_NATIVE_FILE_POST_OPEN 28 /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_POST_OPEN                    28 /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_GET_MDC_MRC                  29 /* H5Fget_mdc_mrc                       */
+#define H5VL_NATIVE_FILE_GET_METADATA_ACCUM_STATS     30 /* H5Fget_metadata_accum_stats          */
 /* NOTE: If values over 1023 are added, the H5VL_RESERVED_NATIVE_OPTIONAL macro
  *      must be updated.
  */
@@ -248,6 +250,13 @@ typedef struct H5VL_native_file_get_mdc_size_t {
     uint32_t *cur_num_entries; /* Current # of cached entries (OUT) */
 } H5VL_native_file_get_mdc_size_t;
 
+/* Parameters for native connector's file 'get metadata cache miss ratio curve' operation */
+typedef struct H5VL_native_file_get_mdc_mrc_t {
+    size_t *npoints;     /* # of points in the arrays (IN) / available (OUT) */
+    size_t *cache_sizes; /* Cache sizes at which the curve is estimated (OUT) */
+    double *miss_ratios; /* Estimated miss ratio at each cache size (OUT) */
+} H5VL_native_file_get_mdc_mrc_t;
+
 /* Parameters for native connector's file 'get VFD handle' operation */
 typedef struct H5VL_native_file_get_vfd_handle_t {
     hid_t  fapl_id;
@@ -269,6 +278,13 @@ typedef struct H5VL_native_file_get_page_buffering_stats_t {
     unsigned *bypasses;  /* Metadata/raw data page bypass counts (OUT) */
 } H5VL_native_file_get_page_buffering_stats_t;
 
+/* Parameters for native connector's file 'get metadata accumulator stats' operation */
+typedef struct H5VL_native_file_get_metadata_accum_stats_t {
+    unsigned *flushes;         /* # of writes of dirty metadata (OUT) */
+    unsigned *flushed_regions; /* # of dirty extents written (OUT) */
+    unsigned *evictions;       /* # of dirty extents written early (OUT) */
+} H5VL_native_file_get_metadata_accum_stats_t;
+
 /* Parameters for native connector's file 'get MDC image info' operation */
 typedef struct H5VL_native_file_get_mdc_image_info_t {
     haddr_t *addr; /* Address of image (OUT) */
@@ -393,6 +409,12 @@ typedef union H5VL_native_file_optional_args_t {
 
     /* H5VL_NATIVE_FILE_POST_OPEN */
     /* No args */
+
+    /* H5VL_NATIVE_FILE_GET_MDC_MRC */
+    H5VL_native_file_get_mdc_mrc_t get_mdc_mrc;
+
+    /* H5VL_NATIVE_FILE_GET_METADATA_ACCUM_STATS */
+    H5VL_native_file_get_metadata_accum_stats_t get_metadata_accum_stats;
 } H5VL_native_file_optional_args_t;
 
 /* Values for native VOL connector group optional VOL operations */
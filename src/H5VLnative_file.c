@@ -724,6 +724,30 @@ H5VL__native_file_optional(void *obj, H5VL_optional_args_t *args, hid_t H5_ATTR_
             break;
         }
 
+        /* H5Fget_mdc_mrc */
+        case H5VL_NATIVE_FILE_GET_MDC_MRC: {
+            H5VL_native_file_get_mdc_mrc_t *gmm_args = &opt_args->get_mdc_mrc;
+
+            /* Get the estimated miss ratio curve */
+            if (H5AC_get_cache_mrc(f->shared->cache, gmm_args->npoints, gmm_args->cache_sizes,
+                                   gmm_args->miss_ratios) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get metadata cache miss ratio curve");
+
+            break;
+        }
+
+        /* H5Fget_metadata_accum_stats */
+        case H5VL_NATIVE_FILE_GET_METADATA_ACCUM_STATS: {
+            H5VL_native_file_get_metadata_accum_stats_t *gmas_args = &opt_args->get_metadata_accum_stats;
+
+            /* Get the statistics */
+            if (H5F_get_metadata_accum_stats(f, gmas_args->flushes, gmas_args->flushed_regions,
+                                             gmas_args->evictions) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for metadata accumulator");
+
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation");
     } /* end switch */
@@ -157,7 +157,9 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                 case H5VL_NATIVE_FILE_GET_INFO:
                 case H5VL_NATIVE_FILE_GET_MDC_CONF:
                 case H5VL_NATIVE_FILE_GET_MDC_HR:
+                case H5VL_NATIVE_FILE_GET_MDC_MRC:
                 case H5VL_NATIVE_FILE_GET_MDC_SIZE:
+                case H5VL_NATIVE_FILE_GET_METADATA_ACCUM_STATS:
                 case H5VL_NATIVE_FILE_GET_SIZE:
                 case H5VL_NATIVE_FILE_GET_VFD_HANDLE:
                 case H5VL_NATIVE_FILE_GET_METADATA_READ_RETRY_INFO:
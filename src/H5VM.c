@@ -25,11 +25,21 @@ typedef struct H5VM_memcpy_ud_t {
 /* Local macros */
 #define H5VM_HYPER_NDIMS H5O_LAYOUT_NDIMS
 
+/* Sequence lengths that H5VM_memcpy_strided() copies with a fixed size loop */
+#define H5VM_STRIDED_LEN(L) (1 == (L) || 2 == (L) || 4 == (L) || 8 == (L) || 16 == (L))
+
+/* Copy NSEQ sequences of a fixed SIZE, at strides through the buffers */
+#define H5VM_MEMCPY_STRIDED_LOOP(SIZE)                                                                       \
+    for (u = 0; u < nseq; u++)                                                                               \
+        memcpy(dst + u * dst_stride, src + u * src_stride, SIZE);
+
 /* Local prototypes */
 static void H5VM__stride_optimize1(unsigned *np /*in,out*/, hsize_t *elmt_size /*in,out*/,
                                    const hsize_t *size, hsize_t *stride1);
 static void H5VM__stride_optimize2(unsigned *np /*in,out*/, hsize_t *elmt_size /*in,out*/,
                                    const hsize_t *size, hsize_t *stride1, hsize_t *stride2);
+static size_t H5VM__seq_run(const size_t len_arr[], const hsize_t off_arr[], size_t max_nseq,
+                            size_t *stride);
 
 /*-------------------------------------------------------------------------
  * Function:    H5VM__stride_optimize1
@@ -1305,6 +1315,108 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VM_opvv() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5VM__seq_run
+ *
+ * Purpose:     Count the sequences at the start of a sequence list that have
+ *              the length of the first one and offsets at a constant,
+ *              positive stride.
+ *
+ * Return:      The number of sequences in the run (at least 1), with the
+ *              stride between them in STRIDE
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5VM__seq_run(const size_t len_arr[], const hsize_t off_arr[], size_t max_nseq, size_t *stride)
+{
+    size_t  seq_len;       /* Length of the sequences in the run */
+    hsize_t seq_stride;    /* Stride between the sequences in the run */
+    size_t  ret_value = 1; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    assert(max_nseq > 0);
+    assert(stride);
+
+    seq_len = len_arr[0];
+    *stride = seq_len;
+    if (max_nseq > 1 && len_arr[1] == seq_len && off_arr[1] > off_arr[0]) {
+        seq_stride = off_arr[1] - off_arr[0];
+        for (ret_value = 2; ret_value < max_nseq; ret_value++)
+            if (len_arr[ret_value] != seq_len || off_arr[ret_value] - off_arr[ret_value - 1] != seq_stride)
+                break;
+
+        H5_CHECKED_ASSIGN(*stride, size_t, seq_stride, hsize_t);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VM__seq_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VM_memcpy_strided
+ *
+ * Purpose:     Copy NSEQ sequences of SIZE bytes from the source buffer
+ *              SRC, at SRC_STRIDE bytes from each other, into the
+ *              destination buffer DST, at DST_STRIDE bytes from each other.
+ *
+ *              Sequences of 1, 2, 4, 8 and 16 bytes, i.e. the elements of
+ *              strided selections of the common datatypes, are copied with
+ *              a loop of fixed size copies, which the compiler turns into
+ *              plain loads and stores (and vectorizes, where the target
+ *              allows), instead of a memcpy() call per sequence.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5VM_memcpy_strided(void *_dst, size_t dst_stride, const void *_src, size_t src_stride, size_t size,
+                    size_t nseq)
+{
+    unsigned char       *dst = (unsigned char *)_dst;       /* Destination buffer pointer */
+    const unsigned char *src = (const unsigned char *)_src; /* Source buffer pointer */
+    size_t               u;                                 /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    assert(dst);
+    assert(src);
+
+    /* Copy contiguous sequences at once */
+    if (dst_stride == size && src_stride == size)
+        H5MM_memcpy(dst, src, size * nseq);
+    else
+        switch (size) {
+            case 1:
+                H5VM_MEMCPY_STRIDED_LOOP(1)
+                break;
+
+            case 2:
+                H5VM_MEMCPY_STRIDED_LOOP(2)
+                break;
+
+            case 4:
+                H5VM_MEMCPY_STRIDED_LOOP(4)
+                break;
+
+            case 8:
+                H5VM_MEMCPY_STRIDED_LOOP(8)
+                break;
+
+            case 16:
+                H5VM_MEMCPY_STRIDED_LOOP(16)
+                break;
+
+            default:
+                for (u = 0; u < nseq; u++)
+                    H5MM_memcpy(dst + u * dst_stride, src + u * src_stride, size);
+                break;
+        } /* end switch */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5VM_memcpy_strided() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5VM_memcpyvv
  *
@@ -1318,6 +1430,10 @@ done:
  *              destination sequences, data copying stops when either the
  *              source or destination buffer runs out of sequence information.
  *
+ *              Runs of short sequences of the same length at constant
+ *              strides, e.g. the elements of a strided selection, are copied
+ *              with H5VM_memcpy_strided().
+ *
  * Note:        The algorithm in this routine is [basically] the same as for
  *              H5VM_opvv().  Changes should be made to both!
  *
@@ -1380,17 +1496,32 @@ H5VM_memcpyvv(void *_dst, size_t dst_max_nseq, size_t *dst_curr_seq, size_t dst_
 src_smaller:
         acc_len = 0;
         do {
+            size_t nseq = 1; /* Number of source sequences copied */
+            size_t run_len;  /* Number of bytes copied */
+
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_src_len);
+            if (H5VM_STRIDED_LEN(tmp_src_len) && tmp_src_len == *src_len_ptr) {
+                size_t src_stride; /* Stride between the source sequences */
+
+                /* Copy a run of short source sequences with a constant stride at once,
+                 * leaving the end of the destination sequence for the next state */
+                nseq = H5VM__seq_run(src_len_ptr, src_off_ptr, (size_t)(max_src_off_ptr - src_off_ptr),
+                                     &src_stride);
+                nseq = MIN(nseq, (tmp_dst_len - 1) / tmp_src_len);
+                H5VM_memcpy_strided(dst, tmp_src_len, src, src_stride, tmp_src_len, nseq);
+            } /* end if */
+            else
+                H5MM_memcpy(dst, src, tmp_src_len);
+            run_len = nseq * tmp_src_len;
 
             /* Accumulate number of bytes copied */
-            acc_len += tmp_src_len;
+            acc_len += run_len;
 
             /* Update destination length */
-            tmp_dst_len -= tmp_src_len;
+            tmp_dst_len -= run_len;
 
             /* Advance source offset & check for being finished */
-            src_off_ptr++;
+            src_off_ptr += nseq;
             if (src_off_ptr >= max_src_off_ptr) {
                 /* Roll accumulated changes into appropriate counters */
                 *dst_off_ptr += acc_len;
@@ -1401,10 +1532,10 @@ src_smaller:
             } /* end if */
 
             /* Update destination pointer */
-            dst += tmp_src_len;
+            dst += run_len;
 
             /* Update source information */
-            src_len_ptr++;
+            src_len_ptr += nseq;
             tmp_src_len = *src_len_ptr;
             src         = (const unsigned char *)_src + *src_off_ptr;
         } while (tmp_src_len < tmp_dst_len);
@@ -1423,17 +1554,32 @@ src_smaller:
 dst_smaller:
         acc_len = 0;
         do {
+            size_t nseq = 1; /* Number of destination sequences copied */
+            size_t run_len;  /* Number of bytes copied */
+
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_dst_len);
+            if (H5VM_STRIDED_LEN(tmp_dst_len) && tmp_dst_len == *dst_len_ptr) {
+                size_t dst_stride; /* Stride between the destination sequences */
+
+                /* Copy a run of short destination sequences with a constant stride at once,
+                 * leaving the end of the source sequence for the next state */
+                nseq = H5VM__seq_run(dst_len_ptr, dst_off_ptr, (size_t)(max_dst_off_ptr - dst_off_ptr),
+                                     &dst_stride);
+                nseq = MIN(nseq, (tmp_src_len - 1) / tmp_dst_len);
+                H5VM_memcpy_strided(dst, dst_stride, src, tmp_dst_len, tmp_dst_len, nseq);
+            } /* end if */
+            else
+                H5MM_memcpy(dst, src, tmp_dst_len);
+            run_len = nseq * tmp_dst_len;
 
             /* Accumulate number of bytes copied */
-            acc_len += tmp_dst_len;
+            acc_len += run_len;
 
             /* Update source length */
-            tmp_src_len -= tmp_dst_len;
+            tmp_src_len -= run_len;
 
             /* Advance destination offset & check for being finished */
-            dst_off_ptr++;
+            dst_off_ptr += nseq;
             if (dst_off_ptr >= max_dst_off_ptr) {
                 /* Roll accumulated changes into appropriate counters */
                 *src_off_ptr += acc_len;
@@ -1444,10 +1590,10 @@ dst_smaller:
             } /* end if */
 
             /* Update source pointer */
-            src += tmp_dst_len;
+            src += run_len;
 
             /* Update destination information */
-            dst_len_ptr++;
+            dst_len_ptr += nseq;
             tmp_dst_len = *dst_len_ptr;
             dst         = (unsigned char *)_dst + *dst_off_ptr;
         } while (tmp_dst_len < tmp_src_len);
@@ -1466,26 +1612,42 @@ dst_smaller:
 equal:
         acc_len = 0;
         do {
+            size_t nseq = 1; /* Number of sequences copied */
+
             /* Copy data */
-            H5MM_memcpy(dst, src, tmp_dst_len);
+            if (H5VM_STRIDED_LEN(tmp_dst_len) && tmp_dst_len == *dst_len_ptr &&
+                tmp_src_len == *src_len_ptr) {
+                size_t dst_stride, src_stride; /* Strides between the sequences */
+                size_t src_nseq;               /* Number of source sequences in the run */
+
+                /* Copy a run of short, whole sequences with constant strides at once */
+                nseq     = H5VM__seq_run(dst_len_ptr, dst_off_ptr, (size_t)(max_dst_off_ptr - dst_off_ptr),
+                                         &dst_stride);
+                src_nseq = H5VM__seq_run(src_len_ptr, src_off_ptr, (size_t)(max_src_off_ptr - src_off_ptr),
+                                         &src_stride);
+                nseq     = MIN(nseq, src_nseq);
+                H5VM_memcpy_strided(dst, dst_stride, src, src_stride, tmp_dst_len, nseq);
+            } /* end if */
+            else
+                H5MM_memcpy(dst, src, tmp_dst_len);
 
             /* Accumulate number of bytes copied */
-            acc_len += tmp_dst_len;
+            acc_len += nseq * tmp_dst_len;
 
             /* Advance source & destination offset & check for being finished */
-            src_off_ptr++;
-            dst_off_ptr++;
+            src_off_ptr += nseq;
+            dst_off_ptr += nseq;
             if (src_off_ptr >= max_src_off_ptr || dst_off_ptr >= max_dst_off_ptr)
                 /* Done with sequences */
                 goto finished;
 
             /* Update source information */
-            src_len_ptr++;
+            src_len_ptr += nseq;
             tmp_src_len = *src_len_ptr;
             src         = (const unsigned char *)_src + *src_off_ptr;
 
             /* Update destination information */
-            dst_len_ptr++;
+            dst_len_ptr += nseq;
             tmp_dst_len = *dst_len_ptr;
             dst         = (unsigned char *)_dst + *dst_off_ptr;
         } while (tmp_dst_len == tmp_src_len);
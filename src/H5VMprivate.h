@@ -113,6 +113,8 @@ H5_DLL hsize_t H5VM_chunk_index_scaled(unsigned ndims, const hsize_t *coord, con
 H5_DLL ssize_t H5VM_opvv(size_t dst_max_nseq, size_t *dst_curr_seq, size_t dst_len_arr[],
                          hsize_t dst_off_arr[], size_t src_max_nseq, size_t *src_curr_seq,
                          size_t src_len_arr[], hsize_t src_off_arr[], H5VM_opvv_func_t op, void *op_data);
+H5_DLL void    H5VM_memcpy_strided(void *_dst, size_t dst_stride, const void *_src, size_t src_stride,
+                                   size_t size, size_t nseq);
 H5_DLL ssize_t H5VM_memcpyvv(void *_dst, size_t dst_max_nseq, size_t *dst_curr_seq, size_t dst_len_arr[],
                              hsize_t dst_off_arr[], const void *_src, size_t src_max_nseq,
                              size_t *src_curr_seq, size_t src_len_arr[], hsize_t src_off_arr[]);
@@ -53,17 +53,30 @@ typedef struct H5Z_node {
     H5Z_num_val      value;
 } H5Z_node;
 
+/* Instruction codes of a compiled transform, which works on a stack of blocks of the values */
+typedef enum {
+    H5Z_XFORM_LOAD,    /* Push a copy of the data */
+    H5Z_XFORM_SYM_NUM, /* Apply the operation to the top block and the number */
+    H5Z_XFORM_NUM_SYM, /* Apply the operation to the number and the top block */
+    H5Z_XFORM_SYM_SYM  /* Apply the operation to the two top blocks, leaving the result in the lower one */
+} H5Z_xform_code_t;
+
+/* Instruction of a compiled transform */
+typedef struct {
+    H5Z_xform_code_t code; /* What the instruction does */
+    H5Z_token_type   op;   /* Operation (PLUS, MINUS, MULT or DIVIDE), unless a LOAD */
+    double           val;  /* The number, for SYM_NUM and NUM_SYM */
+} H5Z_xform_inst_t;
+
 struct H5Z_data_xform_t {
-    char            *xform_exp;
-    H5Z_node        *parse_root;
-    H5Z_datval_ptrs *dat_val_pointers;
+    char             *xform_exp;
+    H5Z_node         *parse_root;
+    H5Z_datval_ptrs  *dat_val_pointers;
+    H5Z_xform_inst_t *insts;  /* Instructions compiled from the parse tree */
+    size_t            ninsts; /* # of instructions */
+    unsigned          depth;  /* Largest # of blocks on the stack */
 };
 
-typedef struct result {
-    H5Z_token_type type;
-    H5Z_num_val    value;
-} H5Z_result;
-
 /* The token */
 typedef struct {
     const char *tok_expr; /* Holds the original expression        */
@@ -89,127 +102,118 @@ static void       H5Z__do_op(H5Z_node *tree);
 static hbool_t    H5Z__op_is_numbs(H5Z_node *_tree);
 static hbool_t    H5Z__op_is_numbs2(H5Z_node *_tree);
 static hid_t      H5Z__xform_find_type(const H5T_t *type);
-static herr_t     H5Z__xform_eval_full(H5Z_node *tree, size_t array_size, hid_t array_type, H5Z_result *res);
 static void       H5Z__xform_destroy_parse_tree(H5Z_node *tree);
 static void      *H5Z__xform_parse(const char *expression, H5Z_datval_ptrs *dat_val_pointers);
 static void      *H5Z__xform_copy_tree(H5Z_node *tree, H5Z_datval_ptrs *dat_val_pointers,
                                        H5Z_datval_ptrs *new_dat_val_pointers);
 static void       H5Z__xform_reduce_tree(H5Z_node *tree);
+static herr_t     H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop);
+static herr_t     H5Z__xform_compile_tree(const H5Z_node *tree, H5Z_data_xform_t *data_xform_prop,
+                                          unsigned *depth);
+
+/* # of elements a compiled transform is applied to at once.  All the instructions are applied to a block
+ * of the array before the next one, so the values stay in the cache, and the loops of the instructions
+ * are simple enough for the compiler to vectorize.
+ */
+#define H5Z_XFORM_BLOCK_SIZE 256
+
+/* The loops of the instructions, on the N values of the top block of the stack, TOP, and for SYM_SYM, the
+ * block below it, BELOW.  The conversions are those of the original tree walking evaluator.
+ */
+#define H5Z_XFORM_DO_SYM_NUM(TYPE, OP)                                                                       \
+    for (u = 0; u < n; u++)                                                                                  \
+        top[u] = (TYPE)((double)top[u] OP val);
+#define H5Z_XFORM_DO_NUM_SYM(TYPE, OP)                                                                       \
+    for (u = 0; u < n; u++)                                                                                  \
+        top[u] = (TYPE)(val OP(double) top[u]);
+#define H5Z_XFORM_DO_SYM_SYM(TYPE, OP)                                                                       \
+    for (u = 0; u < n; u++)                                                                                  \
+        below[u] = (TYPE)(below[u] OP top[u]);
+
+/* Expands the loop DO of TYPE for the operation of INST */
+#define H5Z_XFORM_SWITCH_OP(DO, TYPE, INST)                                                                  \
+    switch ((INST)->op) {                                                                                    \
+        case H5Z_XFORM_PLUS:                                                                                 \
+            DO(TYPE, +)                                                                                      \
+            break;                                                                                           \
+                                                                                                             \
+        case H5Z_XFORM_MINUS:                                                                                \
+            DO(TYPE, -)                                                                                      \
+            break;                                                                                           \
+                                                                                                             \
+        case H5Z_XFORM_MULT:                                                                                 \
+            DO(TYPE, *)                                                                                      \
+            break;                                                                                           \
+                                                                                                             \
+        case H5Z_XFORM_DIVIDE:                                                                               \
+            DO(TYPE, /)                                                                                      \
+            break;                                                                                           \
+                                                                                                             \
+        case H5Z_XFORM_ERROR:                                                                                \
+        case H5Z_XFORM_INTEGER:                                                                              \
+        case H5Z_XFORM_FLOAT:                                                                                \
+        case H5Z_XFORM_SYMBOL:                                                                               \
+        case H5Z_XFORM_LPAREN:                                                                               \
+        case H5Z_XFORM_RPAREN:                                                                               \
+        case H5Z_XFORM_END:                                                                                  \
+        default:                                                                                             \
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree");                            \
+    }
 
-/* PGCC (11.8-0) has trouble with the command *p++ = *p OP tree_val. It increments P first before
- * doing the operation.  So I break down the command into two lines:
- *     *p = *p OP tree_val; p++;
- * Actually, the behavior of *p++ = *p OP tree_val is undefined. (SLU - 2012/3/19)
+/* Applies the compiled transform to the array of TYPE, a block at a time.  When the transform uses the
+ * data more than once, the stack is in SCRATCH and the result is copied back to the array.  Otherwise the
+ * array is the only block.
  */
-#define H5Z_XFORM_DO_OP1(RESL, RESR, TYPE, OP, SIZE)                                                         \
+#define H5Z_XFORM_DO_PROG(TYPE)                                                                              \
     {                                                                                                        \
-        size_t u;                                                                                            \
+        TYPE  *data  = (TYPE *)array;                                                                        \
+        TYPE  *stack = (TYPE *)scratch;                                                                      \
+        size_t start, n, u;                                                                                  \
                                                                                                              \
-        if (((RESL).type == H5Z_XFORM_SYMBOL) && ((RESR).type != H5Z_XFORM_SYMBOL)) {                        \
-            TYPE  *p;                                                                                        \
-            double tree_val;                                                                                 \
+        for (start = 0; start < array_size; start += n) {                                                    \
+            TYPE *top = NULL;                                                                                \
                                                                                                              \
-            tree_val =                                                                                       \
-                ((RESR).type == H5Z_XFORM_INTEGER ? (double)(RESR).value.int_val : (RESR).value.float_val);  \
-            p = (TYPE *)(RESL).value.dat_val;                                                                \
+            n = MIN(array_size - start, H5Z_XFORM_BLOCK_SIZE);                                               \
+            for (i = 0; i < data_xform_prop->ninsts; i++) {                                                  \
+                const H5Z_xform_inst_t *inst = &data_xform_prop->insts[i];                                   \
+                double                  val  = inst->val;                                                    \
+                TYPE                   *below;                                                               \
                                                                                                              \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *p = (TYPE)((double)*p OP tree_val);                                                         \
-                p++;                                                                                         \
-            }                                                                                                \
-        }                                                                                                    \
-        else if (((RESR).type == H5Z_XFORM_SYMBOL) && ((RESL).type != H5Z_XFORM_SYMBOL)) {                   \
-            TYPE  *p;                                                                                        \
-            double tree_val;                                                                                 \
+                switch (inst->code) {                                                                        \
+                    case H5Z_XFORM_LOAD:                                                                     \
+                        if (stack) {                                                                         \
+                            top = top ? top + H5Z_XFORM_BLOCK_SIZE : stack;                                  \
+                            H5MM_memcpy(top, data + start, n * sizeof(TYPE));                                \
+                        }                                                                                    \
+                        else                                                                                 \
+                            top = data + start;                                                              \
+                        break;                                                                               \
                                                                                                              \
-            /* The case that the left operand is nothing, like -x or +x */                                   \
-            if ((RESL).type == H5Z_XFORM_ERROR)                                                              \
-                tree_val = 0;                                                                                \
-            else                                                                                             \
-                tree_val = ((RESL).type == H5Z_XFORM_INTEGER ? (double)(RESL).value.int_val                  \
-                                                             : (RESL).value.float_val);                      \
+                    case H5Z_XFORM_SYM_NUM:                                                                  \
+                        H5Z_XFORM_SWITCH_OP(H5Z_XFORM_DO_SYM_NUM, TYPE, inst)                                \
+                        break;                                                                               \
                                                                                                              \
-            p = (TYPE *)(RESR).value.dat_val;                                                                \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *p = (TYPE)(tree_val OP(double) * p);                                                        \
-                p++;                                                                                         \
+                    case H5Z_XFORM_NUM_SYM:                                                                  \
+                        H5Z_XFORM_SWITCH_OP(H5Z_XFORM_DO_NUM_SYM, TYPE, inst)                                \
+                        break;                                                                               \
+                                                                                                             \
+                    case H5Z_XFORM_SYM_SYM:                                                                  \
+                        below = top - H5Z_XFORM_BLOCK_SIZE;                                                  \
+                        H5Z_XFORM_SWITCH_OP(H5Z_XFORM_DO_SYM_SYM, TYPE, inst)                                \
+                        top = below;                                                                         \
+                        break;                                                                               \
+                                                                                                             \
+                    default:                                                                                 \
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid compiled transform");             \
+                }                                                                                            \
             }                                                                                                \
-        }                                                                                                    \
-        else if (((RESL).type == H5Z_XFORM_SYMBOL) && ((RESR).type == H5Z_XFORM_SYMBOL)) {                   \
-            TYPE *pl = (TYPE *)(RESL).value.dat_val;                                                         \
-            TYPE *pr = (TYPE *)(RESR).value.dat_val;                                                         \
                                                                                                              \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *pl = (TYPE)(*pl OP * pr);                                                                   \
-                pl++;                                                                                        \
-                pr++;                                                                                        \
+            if (stack) {                                                                                     \
+                assert(top == stack);                                                                        \
+                H5MM_memcpy(data + start, stack, n * sizeof(TYPE));                                          \
             }                                                                                                \
         }                                                                                                    \
-        else                                                                                                 \
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unexpected type conversion operation");               \
-    }
-
-#if CHAR_MIN >= 0
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_SCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), signed char, OP, (SIZE))                                        \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
-        else if ((TYPE) == H5T_NATIVE_LDOUBLE)                                                               \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long double, OP, (SIZE))                                        \
-    }
-#else /* CHAR_MIN >= 0 */
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_UCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned char, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
-        else if ((TYPE) == H5T_NATIVE_LDOUBLE)                                                               \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long double, OP, (SIZE))                                        \
     }
-#endif /* CHAR_MIN >= 0 */
 
 #define H5Z_XFORM_DO_OP3(OP)                                                                                 \
     {                                                                                                        \
@@ -905,19 +909,19 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5Z_xform_eval
  * Purpose:     If the transform is trivial, this function applies it.
- *              Otherwise, it calls H5Z__xform_eval_full to do the full
- *              transform.
+ *              Otherwise, it applies the instructions compiled from the
+ *              parse tree to the array.
  * Return:      SUCCEED if transform applied successfully, FAIL otherwise
  *-------------------------------------------------------------------------
  */
 herr_t
 H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size, const H5T_t *buf_type)
 {
-    H5Z_node  *tree;
-    hid_t      array_type;
-    H5Z_result res;
-    size_t     i;
-    herr_t     ret_value = SUCCEED; /* Return value */
+    H5Z_node *tree;
+    hid_t     array_type;
+    void     *scratch = NULL; /* Stack of blocks of the values */
+    size_t    i;
+    herr_t    ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
@@ -970,148 +974,52 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size
     } /* end if */
     /* Otherwise, do the full data transform */
     else {
-        /* Optimization for linear transform: */
-        if (data_xform_prop->dat_val_pointers->num_ptrs == 1)
-            data_xform_prop->dat_val_pointers->ptr_dat_val[0] = array;
-
-        /* If it's a quadratic transform, we have no choice but to store multiple copies of the data */
-        else {
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++) {
-                if (NULL == (data_xform_prop->dat_val_pointers->ptr_dat_val[i] = (void *)H5MM_malloc(
-                                 array_size * H5T_get_size((H5T_t *)H5I_object(array_type)))))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
-                                "Ran out of memory trying to allocate space for data in data transform");
-
-                H5MM_memcpy(data_xform_prop->dat_val_pointers->ptr_dat_val[i], array,
-                            array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
-            } /* end for */
-        }     /* end else */
-
-        if (H5Z__xform_eval_full(tree, array_size, array_type, &res) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform");
-
+        /* Polynomial transforms keep a copy of the data for each "x", a block at a time */
         if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            H5MM_memcpy(array, res.value.dat_val, array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
+            if (NULL == (scratch = H5MM_malloc(data_xform_prop->depth * H5Z_XFORM_BLOCK_SIZE *
+                                               H5T_get_size(buf_type))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
+                            "Ran out of memory trying to allocate space for data in data transform");
 
-        /* Free the temporary arrays we used */
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
+        if (array_type == H5T_NATIVE_CHAR)
+            H5Z_XFORM_DO_PROG(char)
+#if CHAR_MIN >= 0
+        else if (array_type == H5T_NATIVE_SCHAR)
+            H5Z_XFORM_DO_PROG(signed char)
+#else  /* CHAR_MIN >= 0 */
+        else if (array_type == H5T_NATIVE_UCHAR)
+            H5Z_XFORM_DO_PROG(unsigned char)
+#endif /* CHAR_MIN >= 0 */
+        else if (array_type == H5T_NATIVE_SHORT)
+            H5Z_XFORM_DO_PROG(short)
+        else if (array_type == H5T_NATIVE_USHORT)
+            H5Z_XFORM_DO_PROG(unsigned short)
+        else if (array_type == H5T_NATIVE_INT)
+            H5Z_XFORM_DO_PROG(int)
+        else if (array_type == H5T_NATIVE_UINT)
+            H5Z_XFORM_DO_PROG(unsigned int)
+        else if (array_type == H5T_NATIVE_LONG)
+            H5Z_XFORM_DO_PROG(long)
+        else if (array_type == H5T_NATIVE_ULONG)
+            H5Z_XFORM_DO_PROG(unsigned long)
+        else if (array_type == H5T_NATIVE_LLONG)
+            H5Z_XFORM_DO_PROG(long long)
+        else if (array_type == H5T_NATIVE_ULLONG)
+            H5Z_XFORM_DO_PROG(unsigned long long)
+        else if (array_type == H5T_NATIVE_FLOAT)
+            H5Z_XFORM_DO_PROG(float)
+        else if (array_type == H5T_NATIVE_DOUBLE)
+            H5Z_XFORM_DO_PROG(double)
+        else if (array_type == H5T_NATIVE_LDOUBLE)
+            H5Z_XFORM_DO_PROG(long double)
     } /* end else */
 
 done:
-    if (ret_value < 0) {
-        /* If we ran out of memory above copying the array for temp storage (which we easily can for
-         * polynomial transforms of high order) we free those arrays which we already allocated */
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                if (data_xform_prop->dat_val_pointers->ptr_dat_val[i])
-                    H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
-    } /* end if */
+    H5MM_xfree(scratch);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5Z_xform_eval() */
 
-/*-------------------------------------------------------------------------
- * Function:    H5Z__xform_eval_full
- *
- * Purpose:     Does a full evaluation of the parse tree contained in tree
- *              and applies this transform to array.
- *
- * Notes:       In the case of a polynomial data transform (ie, the left and right
- *              subtree are both of type H5Z_XFORM_SYMBOL), the convention is
- *              that the left hand side will accumulate changes and, at the end,
- *              the new data will be copied from the lhs.
- *
- * Return:      Nothing
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5Z__xform_eval_full(H5Z_node *tree, const size_t array_size, const hid_t array_type, H5Z_result *res)
-{
-    H5Z_result resl, resr;
-    herr_t     ret_value = SUCCEED; /* Return value */
-
-    FUNC_ENTER_PACKAGE
-
-    /* check args */
-    assert(tree);
-
-    memset(&resl, 0, sizeof(H5Z_result));
-    memset(&resr, 0, sizeof(H5Z_result));
-
-    if (tree->type == H5Z_XFORM_INTEGER) {
-        res->type          = H5Z_XFORM_INTEGER;
-        res->value.int_val = tree->value.int_val;
-    } /* end if */
-    else if (tree->type == H5Z_XFORM_FLOAT) {
-        res->type            = H5Z_XFORM_FLOAT;
-        res->value.float_val = tree->value.float_val;
-    } /* end if */
-    else if (tree->type == H5Z_XFORM_SYMBOL) {
-        res->type = H5Z_XFORM_SYMBOL;
-
-        /*since dat_val stores the address of the array which is really stored in the dat_val_pointers,
-         * here we make dat_val store a pointer to the array itself instead of the address of it so that the
-         * rest of the code below works normally. */
-        res->value.dat_val = *((void **)(tree->value.dat_val));
-    } /* end if */
-    else {
-        if (tree->lchild && H5Z__xform_eval_full(tree->lchild, array_size, array_type, &resl) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform");
-        if (H5Z__xform_eval_full(tree->rchild, array_size, array_type, &resr) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform");
-
-        res->type = H5Z_XFORM_SYMBOL;
-
-        /* For each type of operation:
-         * 1.  See if "x" is on left hand side, right hand side, or if both sides are "x"
-         * 2.  Figure out what type of data we're going to be manipulating
-         * 3.  Do the operation on the data. */
-        switch (tree->type) {
-            case H5Z_XFORM_PLUS:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, +, array_size)
-                break;
-
-            case H5Z_XFORM_MINUS:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, -, array_size)
-                break;
-
-            case H5Z_XFORM_MULT:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, *, array_size)
-                break;
-
-            case H5Z_XFORM_DIVIDE:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, /, array_size)
-                break;
-
-            case H5Z_XFORM_ERROR:
-            case H5Z_XFORM_INTEGER:
-            case H5Z_XFORM_FLOAT:
-            case H5Z_XFORM_SYMBOL:
-            case H5Z_XFORM_LPAREN:
-            case H5Z_XFORM_RPAREN:
-            case H5Z_XFORM_END:
-            default:
-                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree");
-        } /* end switch */
-
-        /* The result stores a pointer to the new data */
-        /* So, if the left hand side got its data modified, the result stores a pointers
-         * to the left hand side's data, ditto for rhs */
-        if (resl.type == H5Z_XFORM_SYMBOL)
-            res->value.dat_val = resl.value.dat_val;
-        else if (resr.type == H5Z_XFORM_SYMBOL)
-            res->value.dat_val = resr.value.dat_val;
-        else
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error during transform evaluation");
-    } /* end else */
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5Z__xform_eval_full() */
-
 /*-------------------------------------------------------------------------
  * Function:    H5Z_find_type
  *
@@ -1381,6 +1289,142 @@ H5Z__do_op(H5Z_node *tree)
     FUNC_LEAVE_NOAPI_VOID
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_compile_tree
+ *
+ * Purpose:     Appends the instructions which evaluate the (reduced) parse
+ *              tree passed in to the compiled transform, and returns the
+ *              largest # of blocks they put on the stack in DEPTH.
+ *
+ * Notes:       The instructions do the operations of the tree in the
+ *              order of a post-order walk, with the same conversions as
+ *              evaluating the tree, so the results don't change.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_compile_tree(const H5Z_node *tree, H5Z_data_xform_t *data_xform_prop, unsigned *depth)
+{
+    H5Z_xform_inst_t inst;                /* Instruction for the root of the tree */
+    hbool_t          lsym, rsym;          /* Whether the children involve the data */
+    unsigned         ldepth    = 0;       /* Depth of the left subtree */
+    unsigned         rdepth    = 0;       /* Depth of the right subtree */
+    herr_t           ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(tree);
+    assert(data_xform_prop);
+    assert(depth);
+
+    memset(&inst, 0, sizeof(inst));
+
+    switch (tree->type) {
+        case H5Z_XFORM_SYMBOL:
+            inst.code = H5Z_XFORM_LOAD;
+            *depth    = 1;
+            break;
+
+        case H5Z_XFORM_PLUS:
+        case H5Z_XFORM_MINUS:
+        case H5Z_XFORM_MULT:
+        case H5Z_XFORM_DIVIDE:
+            inst.op = tree->type;
+
+            /* Constant subtrees have been reduced to numbers */
+            lsym = tree->lchild && tree->lchild->type != H5Z_XFORM_INTEGER &&
+                   tree->lchild->type != H5Z_XFORM_FLOAT;
+            rsym = tree->rchild->type != H5Z_XFORM_INTEGER && tree->rchild->type != H5Z_XFORM_FLOAT;
+
+            if (lsym && H5Z__xform_compile_tree(tree->lchild, data_xform_prop, &ldepth) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error compiling data transform");
+            if (rsym && H5Z__xform_compile_tree(tree->rchild, data_xform_prop, &rdepth) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error compiling data transform");
+
+            if (lsym && rsym) {
+                inst.code = H5Z_XFORM_SYM_SYM;
+                *depth    = MAX(ldepth, rdepth + 1);
+            } /* end if */
+            else if (lsym) {
+                inst.code = H5Z_XFORM_SYM_NUM;
+                inst.val  = (tree->rchild->type == H5Z_XFORM_INTEGER ? (double)tree->rchild->value.int_val
+                                                                     : tree->rchild->value.float_val);
+                *depth    = ldepth;
+            } /* end if */
+            else if (rsym) {
+                inst.code = H5Z_XFORM_NUM_SYM;
+
+                /* The case that the left operand is nothing, like -x or +x */
+                if (!tree->lchild)
+                    inst.val = 0;
+                else
+                    inst.val = (tree->lchild->type == H5Z_XFORM_INTEGER ? (double)tree->lchild->value.int_val
+                                                                        : tree->lchild->value.float_val);
+                *depth = rdepth;
+            } /* end if */
+            else
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unexpected type conversion operation");
+            break;
+
+        case H5Z_XFORM_ERROR:
+        case H5Z_XFORM_INTEGER:
+        case H5Z_XFORM_FLOAT:
+        case H5Z_XFORM_LPAREN:
+        case H5Z_XFORM_RPAREN:
+        case H5Z_XFORM_END:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree");
+    } /* end switch */
+
+    /* Each instruction comes from an "x" or an operator in the expression */
+    assert(data_xform_prop->ninsts < HDstrlen(data_xform_prop->xform_exp));
+    data_xform_prop->insts[data_xform_prop->ninsts++] = inst;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_compile_tree() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_compile
+ *
+ * Purpose:     Compiles the parse tree of a data transform into the list
+ *              of instructions H5Z_xform_eval applies to the data, unless
+ *              the transform is trivial.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop)
+{
+    H5Z_node *tree;
+    herr_t    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    assert(data_xform_prop);
+    assert(data_xform_prop->parse_root);
+
+    tree = data_xform_prop->parse_root;
+
+    if (tree->type != H5Z_XFORM_INTEGER && tree->type != H5Z_XFORM_FLOAT) {
+        if (NULL == (data_xform_prop->insts = (H5Z_xform_inst_t *)H5MM_malloc(
+                         HDstrlen(data_xform_prop->xform_exp) * sizeof(H5Z_xform_inst_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
+                        "unable to allocate memory for compiled data transform");
+        data_xform_prop->ninsts = 0;
+
+        if (H5Z__xform_compile_tree(tree, data_xform_prop, &data_xform_prop->depth) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error compiling data transform");
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_compile() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Z_xform_create
  *
@@ -1457,6 +1501,10 @@ H5Z_xform_create(const char *expr)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL,
                     "error copying the parse tree, did not find correct number of \"variables\"");
 
+    /* Compile the parse tree */
+    if (H5Z__xform_compile(data_xform_prop) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "unable to compile data transform");
+
     /* Assign return value */
     ret_value = data_xform_prop;
 
@@ -1466,6 +1514,8 @@ done:
         if (data_xform_prop) {
             if (data_xform_prop->parse_root)
                 H5Z__xform_destroy_parse_tree(data_xform_prop->parse_root);
+            if (data_xform_prop->insts)
+                H5MM_xfree(data_xform_prop->insts);
             if (data_xform_prop->xform_exp)
                 H5MM_xfree(data_xform_prop->xform_exp);
             if (count > 0 && data_xform_prop->dat_val_pointers->ptr_dat_val)
@@ -1499,6 +1549,9 @@ H5Z_xform_destroy(H5Z_data_xform_t *data_xform_prop)
         /* Destroy the parse tree */
         H5Z__xform_destroy_parse_tree(data_xform_prop->parse_root);
 
+        /* Free the compiled transform */
+        H5MM_xfree(data_xform_prop->insts);
+
         /* Free the expression */
         H5MM_xfree(data_xform_prop->xform_exp);
 
@@ -1584,6 +1637,10 @@ H5Z_xform_copy(H5Z_data_xform_t **data_xform_prop)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL,
                         "error copying the parse tree, did not find correct number of \"variables\"");
 
+        /* Compile the copy of the parse tree */
+        if (H5Z__xform_compile(new_data_xform_prop) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform");
+
         /* Copy new information on top of old information */
         *data_xform_prop = new_data_xform_prop;
     } /* end if */
@@ -1594,6 +1651,8 @@ done:
         if (new_data_xform_prop) {
             if (new_data_xform_prop->parse_root)
                 H5Z__xform_destroy_parse_tree(new_data_xform_prop->parse_root);
+            if (new_data_xform_prop->insts)
+                H5MM_xfree(new_data_xform_prop->insts);
             if (new_data_xform_prop->xform_exp)
                 H5MM_xfree(new_data_xform_prop->xform_exp);
             H5MM_xfree(new_data_xform_prop);
@@ -559,6 +559,7 @@ H5_DLL void H5_bandwidth(char *buf /*out*/, size_t bufsize, double nbytes, doubl
 /* Timer functionality */
 H5_DLL time_t   H5_now(void);
 H5_DLL uint64_t H5_now_usec(void);
+H5_DLL uint64_t H5_now_nsec(void);
 H5_DLL herr_t   H5_timer_init(H5_timer_t *timer /*in,out*/);
 H5_DLL herr_t   H5_timer_start(H5_timer_t *timer /*in,out*/);
 H5_DLL herr_t   H5_timer_stop(H5_timer_t *timer /*in,out*/);
@@ -215,6 +215,17 @@
  *                     should be ignored
  */
 #define HDF5_USE_FILE_LOCKING "HDF5_USE_FILE_LOCKING"
+/**
+ * Used to select the output format of metadata cache logging enabled
+ * with H5Pset_mdc_log_options(). Valid values for this environment
+ * variable are as follows:
+ *
+ *  "json"   - Human-readable JSON log messages (the default)
+ *  "binary" - Compact, buffered fixed-size binary records, suitable
+ *             for long-running production jobs. Use the h5mdclog
+ *             tool to convert and analyze the log.
+ */
+#define HDF5_MDC_LOG_STYLE "HDF5_MDC_LOG_STYLE"
 /**
  * Used to instruct HDF5 not to cleanup files created during testing.
  */
@@ -206,6 +206,39 @@ H5_now_usec(void)
     return (now);
 } /* end H5_now_usec() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5_now_nsec
+ *
+ * Purpose:	Retrieves the current time, as nanoseconds from an arbitrary
+ *		starting point.  Only differences between two values are
+ *		meaningful.  The resolution is that of H5_now_usec() when no
+ *		monotonic clock is available.
+ *
+ * Return:	# of nanoseconds (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint64_t
+H5_now_nsec(void)
+{
+    uint64_t now; /* Current time, in nanoseconds */
+
+#if defined(H5_HAVE_CLOCK_GETTIME)
+    {
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+
+        now = ((uint64_t)ts.tv_sec * ((uint64_t)1000 * (uint64_t)1000 * (uint64_t)1000)) +
+              (uint64_t)ts.tv_nsec;
+    }
+#else  /* H5_HAVE_CLOCK_GETTIME */
+    now = H5_now_usec() * (uint64_t)1000;
+#endif /* H5_HAVE_CLOCK_GETTIME */
+
+    return (now);
+} /* end H5_now_nsec() */
+
 /*--------------------------------------------------------------------------
  * Function:    H5_get_time
  *
@@ -1090,11 +1090,31 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5_VFD_DIRECT");
                                     break;
 #endif
+#ifdef H5_HAVE_IOURING_VFD
+                                case H5_VFD_IOURING:
+                                    H5RS_acat(rs, "H5_VFD_IOURING");
+                                    break;
+#endif
 #ifdef H5_HAVE_MIRROR_VFD
                                 case H5_VFD_MIRROR:
                                     H5RS_acat(rs, "H5_VFD_MIRROR");
                                     break;
 #endif
+#ifdef H5_HAVE_MMAP_VFD
+                                case H5_VFD_MMAP:
+                                    H5RS_acat(rs, "H5_VFD_MMAP");
+                                    break;
+#endif
+#ifdef H5_HAVE_STRIPE_VFD
+                                case H5_VFD_STRIPE:
+                                    H5RS_acat(rs, "H5_VFD_STRIPE");
+                                    break;
+#endif
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+                                case H5_VFD_WRITEBEHIND:
+                                    H5RS_acat(rs, "H5_VFD_WRITEBEHIND");
+                                    break;
+#endif
 #ifdef H5_HAVE_LIBHDFS
                                 case H5_VFD_HDFS:
                                     H5RS_acat(rs, "H5_VFD_HDFS");
@@ -1113,6 +1133,9 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                 case H5_VFD_ONION:
                                     H5RS_acat(rs, "H5_VFD_ONION");
                                     break;
+                                case H5_VFD_PROFILE:
+                                    H5RS_acat(rs, "H5_VFD_PROFILE");
+                                    break;
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)class_val);
                                     break;
@@ -3698,6 +3721,14 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_FILE_POST_OPEN");
                                     break;
 
+                                case H5VL_NATIVE_FILE_GET_MDC_MRC:
+                                    H5RS_acat(rs, "H5VL_NATIVE_FILE_GET_MDC_MRC");
+                                    break;
+
+                                case H5VL_NATIVE_FILE_GET_METADATA_ACCUM_STATS:
+                                    H5RS_acat(rs, "H5VL_NATIVE_FILE_GET_METADATA_ACCUM_STATS");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
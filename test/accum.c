@@ -51,6 +51,7 @@ unsigned test_read_after(H5F_t *f);
 unsigned test_free(H5F_t *f);
 unsigned test_big(H5F_t *f);
 unsigned test_random_write(H5F_t *f);
+unsigned test_regions(H5F_t *f);
 unsigned test_swmr_write_big(hbool_t newest_format);
 
 /* Helper Function Prototypes */
@@ -131,6 +132,7 @@ main(void)
     nerrors += test_free(f);
     nerrors += test_big(f);
     nerrors += test_random_write(f);
+    nerrors += test_regions(f);
 
     /* Pop API context */
     if (api_ctx_pushed && H5CX_pop(FALSE) < 0)
@@ -2029,6 +2031,160 @@ error:
     return 1;
 } /* end test_random_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_regions
+ *
+ * Purpose:     Test that interleaved writes to separate areas of the file
+ *              are held as dirty regions rather than flushing the
+ *              accumulator, and that the regions are read back, trimmed
+ *              on free, evicted in LRU order and flushed with one write.
+ *
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+test_regions(H5F_t *f)
+{
+    unsigned       flushes0, flushed_regions0, evictions0; /* Stats before each step */
+    unsigned       flushes, flushed_regions, evictions;    /* Stats after each step */
+    int            i;
+    unsigned char *wbuf = NULL, *rbuf = NULL;
+
+    TESTING("interleaved writes to dirty metadata regions");
+
+    /* Allocate buffers */
+    wbuf = (unsigned char *)malloc(4096);
+    assert(wbuf);
+    rbuf = (unsigned char *)calloc((size_t)1, 4096);
+    assert(rbuf);
+
+    /* Fill buffer with data */
+    for (i = 0; i < 4096; i++)
+        wbuf[i] = (unsigned char)(i * 7 + 1);
+
+    if (H5F_get_metadata_accum_stats(f, &flushes0, &flushed_regions0, &evictions0) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Interleave writes to two areas of the file; neither should be flushed */
+    for (i = 0; i < 8; i++) {
+        if (accum_write(i * 64, 64, wbuf + i * 64) < 0)
+            FAIL_STACK_ERROR;
+        if (accum_write(65536 + i * 64, 64, wbuf + 1024 + i * 64) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+    if (f->shared->accum.nregions != 1)
+        TEST_ERROR;
+    if (H5F_get_metadata_accum_stats(f, &flushes, &flushed_regions, &evictions) < 0)
+        FAIL_STACK_ERROR;
+    if (flushes != flushes0 || flushed_regions != flushed_regions0 || evictions != evictions0)
+        TEST_ERROR;
+
+    /* Read back both areas */
+    if (accum_read(0, 512, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (memcmp(wbuf, rbuf, (size_t)512) != 0)
+        TEST_ERROR;
+    if (accum_read(65536, 512, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (memcmp(wbuf + 1024, rbuf, (size_t)512) != 0)
+        TEST_ERROR;
+
+    /* Flushing writes both areas with one (vector) write */
+    if (accum_flush(f) < 0)
+        FAIL_STACK_ERROR;
+    if (f->shared->accum.nregions != 0 || f->shared->accum.dirty)
+        TEST_ERROR;
+    if (H5F_get_metadata_accum_stats(f, &flushes, &flushed_regions, &evictions) < 0)
+        FAIL_STACK_ERROR;
+    if (flushes != flushes0 + 1 || flushed_regions != flushed_regions0 + 2)
+        TEST_ERROR;
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_read(0, 512, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (memcmp(wbuf, rbuf, (size_t)512) != 0)
+        TEST_ERROR;
+    if (accum_read(65536, 512, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (memcmp(wbuf + 1024, rbuf, (size_t)512) != 0)
+        TEST_ERROR;
+
+    /* Freeing the middle of a dirty region writes out its tail */
+    if (accum_write(131072, 256, wbuf + 2048) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_write(196608, 256, wbuf + 3072) < 0)
+        FAIL_STACK_ERROR;
+    if (f->shared->accum.nregions != 1)
+        TEST_ERROR;
+    if (H5F_get_metadata_accum_stats(f, &flushes0, &flushed_regions0, &evictions0) < 0)
+        FAIL_STACK_ERROR;
+    if (accum_free(f, 131072 + 64, 64) < 0)
+        FAIL_STACK_ERROR;
+    if (f->shared->accum.nregions != 1 || f->shared->accum.regions[0].size != 64)
+        TEST_ERROR;
+    if (H5F_get_metadata_accum_stats(f, &flushes, &flushed_regions, &evictions) < 0)
+        FAIL_STACK_ERROR;
+    if (flushes != flushes0 + 1)
+        TEST_ERROR;
+    if (accum_read(131072, 64, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (memcmp(wbuf + 2048, rbuf, (size_t)64) != 0)
+        TEST_ERROR;
+
+    /* Reading across the region writes it out first */
+    if (accum_read(131072 + 128, 128, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (memcmp(wbuf + 2048 + 128, rbuf, (size_t)128) != 0)
+        TEST_ERROR;
+    if (accum_read(131072 - 64, 128, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (f->shared->accum.nregions != 0)
+        TEST_ERROR;
+    if (memcmp(wbuf + 2048, rbuf + 64, (size_t)64) != 0)
+        TEST_ERROR;
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Writing to more areas than there are regions evicts the oldest region */
+    if (H5F_get_metadata_accum_stats(f, &flushes0, &flushed_regions0, &evictions0) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < H5F_ACCUM_MAX_REGIONS + 2; i++)
+        if (accum_write(i * 4096, 128, wbuf + i * 128) < 0)
+            FAIL_STACK_ERROR;
+    if (f->shared->accum.nregions != H5F_ACCUM_MAX_REGIONS)
+        TEST_ERROR;
+    if (H5F_get_metadata_accum_stats(f, &flushes, &flushed_regions, &evictions) < 0)
+        FAIL_STACK_ERROR;
+    if (evictions != evictions0 + 1 || flushes != flushes0 + 1)
+        TEST_ERROR;
+    for (i = 0; i < H5F_ACCUM_MAX_REGIONS + 2; i++) {
+        if (accum_read(i * 4096, 128, rbuf) < 0)
+            FAIL_STACK_ERROR;
+        if (memcmp(wbuf + i * 128, rbuf, (size_t)128) != 0)
+            TEST_ERROR;
+    } /* end for */
+
+    if (accum_reset(f) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    /* Release memory */
+    free(wbuf);
+    free(rbuf);
+
+    return 0;
+
+error:
+    /* Release memory */
+    free(wbuf);
+    free(rbuf);
+
+    return 1;
+} /* end test_regions() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_swmr_write_big
  *
@@ -1071,7 +1071,9 @@ smoke_check_5(int express_test, unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.5};
+        /* double      empty_reserve          = */ 0.5,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("smoke check #5P -- all clean, ins, prot, unprot, AR cache 1");
@@ -1295,7 +1297,9 @@ smoke_check_6(int express_test, unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.05};
+        /* double      empty_reserve          = */ 0.05,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("smoke check #6P -- ~1/2 dirty, ins, prot, unprot, AR cache 1");
@@ -1520,7 +1524,9 @@ smoke_check_7(int express_test, unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.1};
+        /* double      empty_reserve          = */ 0.1,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("smoke check #7P -- all clean, ins, prot, unprot, AR cache 2");
@@ -1745,7 +1751,9 @@ smoke_check_8(int express_test, unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.1};
+        /* double      empty_reserve          = */ 0.1,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("smoke check #8P -- ~1/2 dirty, ins, prot, unprot, AR cache 2");
@@ -15381,7 +15389,9 @@ check_auto_cache_resize(hbool_t cork_ageout, unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.05};
+        /* double      empty_reserve          = */ 0.05,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("automatic cache resizing (paged aggregation)");
@@ -19227,7 +19237,9 @@ check_auto_cache_resize_disable(unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.05};
+        /* double      empty_reserve          = */ 0.05,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("automatic cache resize disable (paged aggregation)");
@@ -21821,7 +21833,9 @@ check_auto_cache_resize_epoch_markers(unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.05};
+        /* double      empty_reserve          = */ 0.05,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("automatic cache resize epoch marker management (paged aggr)");
@@ -22499,7 +22513,9 @@ check_auto_cache_resize_input_errs(unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.05};
+        /* double      empty_reserve          = */ 0.05,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     H5C_auto_size_ctl_t invalid_auto_size_ctl;
     H5C_auto_size_ctl_t test_auto_size_ctl;
@@ -24720,7 +24736,9 @@ check_auto_cache_resize_aux_fcns(unsigned paged)
         /* int32_t     epochs_before_eviction = */ 3,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.5};
+        /* double      empty_reserve          = */ 0.5,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("automatic cache resize auxiliary functions (paged aggregation)");
@@ -32321,7 +32339,9 @@ cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *file_ptr)
         /* int32_t     epochs_before_eviction = */ 1,
 
         /* hbool_t     apply_empty_reserve    = */ TRUE,
-        /* double      empty_reserve          = */ 0.05};
+        /* double      empty_reserve          = */ 0.05,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     expected = malloc(36 * sizeof(struct expected_entry_status));
     if (expected == NULL) {
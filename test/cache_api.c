@@ -30,6 +30,7 @@ static const char *FILENAME[] = {"cache_api_test", NULL};
 static hbool_t              check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id);
 static hbool_t              check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id);
 static hbool_t              mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id);
+static hbool_t              check_file_mdc_mrc(unsigned paged, hid_t fcpl_id);
 static H5AC_cache_config_t *init_invalid_configs(void);
 static hbool_t              check_fapl_mdc_api_errs(void);
 static hbool_t              check_file_mdc_api_errs(unsigned paged, hid_t fcpl_id);
@@ -98,7 +99,9 @@ check_fapl_mdc_api_calls(unsigned paged, hid_t fcpl_id)
         /* double      empty_reserve          = */ 0.05,
         /* int         dirty_bytes_threshold  = */ (256 * 1024),
         /* int        metadata_write_strategy = */
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
     H5AC_cache_config_t scratch;
     H5C_auto_size_ctl_t default_auto_size_ctl;
     H5C_auto_size_ctl_t mod_auto_size_ctl;
@@ -538,7 +541,9 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
         /* double      empty_reserve          = */ 0.05,
         /* int         dirty_bytes_threshold  = */ (256 * 1024),
         /* int        metadata_write_strategy = */
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
     H5AC_cache_config_t mod_config_2 = {
         /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
         /* hbool_t     rpt_fcn_enabled        = */ TRUE,
@@ -571,7 +576,9 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
         /* double      empty_reserve          = */ 0.05,
         /* int         dirty_bytes_threshold  = */ (256 * 1024),
         /* int        metadata_write_strategy = */
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
     H5AC_cache_config_t mod_config_3 = {
         /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
         /* hbool_t     rpt_fcn_enabled        = */ FALSE,
@@ -604,7 +611,9 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
         /* double      empty_reserve          = */ 0.05,
         /* int         dirty_bytes_threshold  = */ (256 * 1024),
         /* int        metadata_write_strategy = */
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
     H5AC_cache_config_t mod_config_4 = {
         /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
         /* hbool_t     rpt_fcn_enabled        = */ FALSE,
@@ -638,7 +647,9 @@ check_file_mdc_api_calls(unsigned paged, hid_t fcpl_id)
         /* double      empty_reserve          = */ 0.1,
         /* int         dirty_bytes_threshold  = */ (256 * 1024),
         /* int        metadata_write_strategy = */
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("MDC/FILE related API calls for paged aggregation strategy");
@@ -874,7 +885,9 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
         /* double      empty_reserve          = */ 0.05,
         /* int         dirty_bytes_threshold  = */ (256 * 1024),
         /* int        metadata_write_strategy = */
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
     H5AC_cache_config_t mod_config_2 = {
         /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
         /* hbool_t     rpt_fcn_enabled        = */ FALSE,
@@ -907,7 +920,9 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
         /* double      empty_reserve          = */ 0.05,
         /* int         dirty_bytes_threshold  = */ (256 * 1024),
         /* int        metadata_write_strategy = */
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
     H5AC_cache_config_t mod_config_3 = {
         /* int         version                = */ H5C__CURR_AUTO_SIZE_CTL_VER,
         /* hbool_t     rpt_fcn_enabled        = */ FALSE,
@@ -940,7 +955,9 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
         /* double      empty_reserve          = */ 0.05,
         /* int         dirty_bytes_threshold  = */ (256 * 1024),
         /* int        metadata_write_strategy = */
-        H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+        H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+        /* double      mrc_sample_rate        = */ 0.1,
+        /* double      mrc_knee_threshold     = */ 0.01};
 
     if (paged)
         TESTING("MDC API smoke check for paged aggregation strategy");
@@ -1414,6 +1431,249 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
 
 } /* mdc_api_call_smoke_check() */
 
+/*-------------------------------------------------------------------------
+ * Function:    check_file_mdc_mrc()
+ *
+ * Purpose:     Verify that the miss ratio curve automatic resize mode
+ *              builds a plausible curve, keeps the cache within its
+ *              configured bounds, and that H5Fget_mdc_mrc() reports
+ *              the curve only while that mode is in use.
+ *
+ * Return:      Test pass status (TRUE/FALSE)
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#define MRC_NUM_GROUPS 400
+#define MRC_NUM_PASSES 20
+
+static hbool_t
+check_file_mdc_mrc(unsigned paged, hid_t fcpl_id)
+{
+    char                filename[512];
+    char                group_name[64];
+    hid_t               file_id  = -1;
+    hid_t               group_id = -1;
+    int                 i, j;
+    size_t              npoints = 0;
+    size_t              u;
+    size_t              cache_sizes[128];
+    double              miss_ratios[128];
+    double              hit_rate;
+    size_t              max_size;
+    size_t              min_clean_size;
+    size_t              cur_size;
+    int                 cur_num_entries;
+    H5AC_cache_config_t default_config = H5AC__DEFAULT_CACHE_CONFIG;
+    H5AC_cache_config_t mrc_config     = H5AC__DEFAULT_CACHE_CONFIG;
+
+    if (paged)
+        TESTING("MDC miss ratio curve resize mode for paged aggregation strategy");
+    else
+        TESTING("MDC miss ratio curve resize mode");
+
+    pass = TRUE;
+
+    mrc_config.set_initial_size   = TRUE;
+    mrc_config.initial_size       = 64 * 1024;
+    mrc_config.min_size           = H5C__MIN_MAX_CACHE_SIZE;
+    mrc_config.max_size           = 4 * 1024 * 1024;
+    mrc_config.epoch_length       = 1000;
+    mrc_config.incr_mode          = H5C_incr__mrc;
+    mrc_config.flash_incr_mode    = H5C_flash_incr__off;
+    mrc_config.decr_mode          = H5C_decr__off;
+    mrc_config.mrc_sample_rate    = 1.0;
+    mrc_config.mrc_knee_threshold = 0.01;
+
+    /* setup the file name */
+    if (pass) {
+
+        if (h5_fixname(FILENAME[0], H5P_DEFAULT, filename, sizeof(filename)) == NULL) {
+
+            pass         = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    /* create the file using the default FAPL */
+    if (pass) {
+
+        file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl_id, H5P_DEFAULT);
+
+        if (file_id < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fcreate() failed.\n";
+        }
+    }
+
+    /* no curve is reported in the default configuration */
+    if (pass) {
+
+        npoints = 1;
+        if ((H5Fget_mdc_mrc(file_id, &npoints, NULL, NULL) < 0) || (npoints != 0)) {
+
+            pass         = FALSE;
+            failure_mssg = "unexpected miss ratio curve in default config.\n";
+        }
+    }
+
+    /* switch to the miss ratio curve mode */
+    if (pass) {
+
+        if (H5Fset_mdc_config(file_id, &mrc_config) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fset_mdc_config() failed.\n";
+        }
+    }
+
+    validate_mdc_config(file_id, &mrc_config, TRUE, 1);
+
+    /* create the groups, each with enough links to give it a local heap
+     * and B-tree node of its own.
+     */
+    for (i = 0; pass && i < MRC_NUM_GROUPS; i++) {
+
+        HDsnprintf(group_name, sizeof(group_name), "/group%04d", i);
+
+        if ((group_id = H5Gcreate2(file_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Gcreate2() failed.\n";
+        }
+        else if (H5Gclose(group_id) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Gclose() failed.\n";
+        }
+    }
+
+    /* cycle through the groups to build a reuse pattern */
+    for (j = 0; pass && j < MRC_NUM_PASSES; j++) {
+        for (i = 0; pass && i < MRC_NUM_GROUPS; i++) {
+
+            HDsnprintf(group_name, sizeof(group_name), "/group%04d", i);
+
+            if ((group_id = H5Gopen2(file_id, group_name, H5P_DEFAULT)) < 0) {
+
+                pass         = FALSE;
+                failure_mssg = "H5Gopen2() failed.\n";
+            }
+            else if (H5Gclose(group_id) < 0) {
+
+                pass         = FALSE;
+                failure_mssg = "H5Gclose() failed.\n";
+            }
+        }
+    }
+
+    /* the hit rate is still available */
+    if (pass) {
+
+        if ((H5Fget_mdc_hit_rate(file_id, &hit_rate) < 0) || (hit_rate < 0.0) || (hit_rate > 1.0)) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fget_mdc_hit_rate() failed.\n";
+        }
+    }
+
+    /* query the number of points, and then the curve itself */
+    if (pass) {
+
+        npoints = 0;
+        if ((H5Fget_mdc_mrc(file_id, &npoints, NULL, NULL) < 0) || (npoints == 0) ||
+            (npoints > NELMTS(cache_sizes))) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fget_mdc_mrc() failed to report points.\n";
+        }
+    }
+
+    if (pass) {
+
+        if (H5Fget_mdc_mrc(file_id, &npoints, cache_sizes, miss_ratios) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fget_mdc_mrc() failed.\n";
+        }
+    }
+
+    /* the curve must be increasing in size and non-increasing in miss ratio */
+    for (u = 0; pass && u < npoints; u++) {
+
+        if ((miss_ratios[u] < 0.0) || (miss_ratios[u] > 1.0) || (cache_sizes[u] > mrc_config.max_size)) {
+
+            pass         = FALSE;
+            failure_mssg = "miss ratio curve point out of range.\n";
+        }
+        else if ((u > 0) && ((cache_sizes[u] <= cache_sizes[u - 1]) || (miss_ratios[u] > miss_ratios[u - 1]))) {
+
+            pass         = FALSE;
+            failure_mssg = "miss ratio curve not monotonic.\n";
+        }
+    }
+
+    /* the cache must have stayed within its configured bounds */
+    if (pass) {
+
+        if ((H5Fget_mdc_size(file_id, &max_size, &min_clean_size, &cur_size, &cur_num_entries) < 0) ||
+            (max_size < mrc_config.min_size) || (max_size > mrc_config.max_size)) {
+
+            pass         = FALSE;
+            failure_mssg = "cache size out of range in miss ratio curve mode.\n";
+        }
+    }
+
+    /* leaving the mode discards the curve */
+    if (pass) {
+
+        if (H5Fset_mdc_config(file_id, &default_config) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fset_mdc_config() failed.\n";
+        }
+    }
+
+    if (pass) {
+
+        npoints = NELMTS(cache_sizes);
+        if ((H5Fget_mdc_mrc(file_id, &npoints, cache_sizes, miss_ratios) < 0) || (npoints != 0)) {
+
+            pass         = FALSE;
+            failure_mssg = "miss ratio curve reported after leaving mode.\n";
+        }
+    }
+
+    if (file_id >= 0) {
+
+        if (H5Fclose(file_id) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+        else if (pass)
+            HDremove(filename);
+    }
+
+    if (pass) {
+
+        PASSED();
+    }
+    else {
+
+        H5_FAILED();
+    }
+
+    if (!pass) {
+
+        fprintf(stdout, "%s: failure_mssg = \"%s\".\n", __func__, failure_mssg);
+    }
+
+    return pass;
+
+} /* check_file_mdc_mrc() */
+
 /*-------------------------------------------------------------------------
  * Function:    init_invalid_configs()
  *
@@ -1430,7 +1690,7 @@ mdc_api_call_smoke_check(int express_test, unsigned paged, hid_t fcpl_id)
  *-------------------------------------------------------------------------
  */
 
-#define NUM_INVALID_CONFIGS 36
+#define NUM_INVALID_CONFIGS 40
 static H5AC_cache_config_t *invalid_configs = NULL;
 
 static H5AC_cache_config_t *
@@ -1479,6 +1739,8 @@ init_invalid_configs(void)
         configs[i].empty_reserve           = 0.1;
         configs[i].dirty_bytes_threshold   = (256 * 1024);
         configs[i].metadata_write_strategy = H5AC__DEFAULT_METADATA_WRITE_STRATEGY;
+        configs[i].mrc_sample_rate         = 0.1;
+        configs[i].mrc_knee_threshold      = 0.01;
     }
 
     /* Set badness for each config */
@@ -1602,6 +1864,24 @@ init_invalid_configs(void)
     /* 35 -- unknown metadata write strategy */
     configs[35].metadata_write_strategy = -1;
 
+    /* 36 -- mrc_sample_rate too small */
+    configs[36].incr_mode       = H5C_incr__mrc;
+    configs[36].decr_mode       = H5C_decr__off;
+    configs[36].mrc_sample_rate = 0.0;
+
+    /* 37 -- mrc_sample_rate too big */
+    configs[37].incr_mode       = H5C_incr__mrc;
+    configs[37].decr_mode       = H5C_decr__off;
+    configs[37].mrc_sample_rate = 1.00000001;
+
+    /* 38 -- mrc_knee_threshold too small */
+    configs[38].incr_mode          = H5C_incr__mrc;
+    configs[38].decr_mode          = H5C_decr__off;
+    configs[38].mrc_knee_threshold = -0.000001;
+
+    /* 39 -- miss ratio curve mode with a decr_mode */
+    configs[39].incr_mode = H5C_incr__mrc;
+
     return configs;
 
 } /* initialize_invalid_configs() */
@@ -2206,6 +2486,9 @@ main(void)
         if (!mdc_api_call_smoke_check(express_test, paged, my_fcpl))
             nerrs += 1;
 
+        if (!check_file_mdc_mrc(paged, my_fcpl))
+            nerrs += 1;
+
         if (!check_file_mdc_api_errs(paged, my_fcpl))
             nerrs += 1;
     } /* end for paged */
@@ -5037,6 +5037,10 @@ resize_configs_are_equal(const H5C_auto_size_ctl_t *a, const H5C_auto_size_ctl_t
         return (FALSE);
     else if (!H5_DBL_ABS_EQUAL(a->empty_reserve, b->empty_reserve))
         return (FALSE);
+    else if (!H5_DBL_ABS_EQUAL(a->mrc_sample_rate, b->mrc_sample_rate))
+        return (FALSE);
+    else if (!H5_DBL_ABS_EQUAL(a->mrc_knee_threshold, b->mrc_knee_threshold))
+        return (FALSE);
     return (TRUE);
 }
 
@@ -463,7 +463,9 @@ typedef struct test_entry_t {
      ((a).apply_empty_reserve == (b).apply_empty_reserve) &&                                                 \
      (H5_DBL_ABS_EQUAL((a).empty_reserve, (b).empty_reserve)) &&                                             \
      ((a).dirty_bytes_threshold == (b).dirty_bytes_threshold) &&                                             \
-     ((a).metadata_write_strategy == (b).metadata_write_strategy))
+     ((a).metadata_write_strategy == (b).metadata_write_strategy) &&                                         \
+     (H5_DBL_ABS_EQUAL((a).mrc_sample_rate, (b).mrc_sample_rate)) &&                                         \
+     (H5_DBL_ABS_EQUAL((a).mrc_knee_threshold, (b).mrc_knee_threshold)))
 
 #define XLATE_EXT_TO_INT_MDC_CONFIG(i, e)                                                                    \
     {                                                                                                        \
@@ -494,6 +496,8 @@ typedef struct test_entry_t {
         (i).epochs_before_eviction = (int)((e).epochs_before_eviction);                                      \
         (i).apply_empty_reserve    = (e).apply_empty_reserve;                                                \
         (i).empty_reserve          = (e).empty_reserve;                                                      \
+        (i).mrc_sample_rate        = (e).mrc_sample_rate;                                                    \
+        (i).mrc_knee_threshold     = (e).mrc_knee_threshold;                                                 \
     }
 
 /* misc type definitions */
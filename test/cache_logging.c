@@ -13,8 +13,10 @@
 /* Purpose: Tests the metadata cache logging framework */
 
 #include "h5test.h"
+#include "H5Cprivate.h"
 
-#define LOG_LOCATION "cache_logging.out"
+#define LOG_LOCATION        "cache_logging.out"
+#define BINARY_LOG_LOCATION "cache_logging.bin"
 
 static const char *FILENAME[] = {"cache_logging", NULL};
 
@@ -147,6 +149,94 @@ error:
     return 1;
 } /* test_logging_api() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_binary_logging
+ *
+ * Purpose:     Tests the binary mdc log format selected via the
+ *              HDF5_MDC_LOG_STYLE environment variable
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_binary_logging(void)
+{
+    hid_t   fapl = -1;
+    hid_t   fid  = -1;
+    hid_t   gid  = -1;
+    FILE   *fp   = NULL;
+    uint8_t header[H5C_LOG_BINARY_HEADER_SIZE];
+    long    log_size;
+    char    group_name[12];
+    char    filename[1024];
+    int     i;
+
+    TESTING("binary metadata cache log");
+
+    if (HDsetenv(HDF5_MDC_LOG_STYLE, "binary", 1) < 0)
+        TEST_ERROR;
+
+    fapl = h5_fileaccess();
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    /* Log everything from file open to file close */
+    if (H5Pset_mdc_log_options(fapl, TRUE, BINARY_LOG_LOCATION, TRUE) < 0)
+        TEST_ERROR;
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+
+    for (i = 0; i < N_GROUPS; i++) {
+        HDsnprintf(group_name, sizeof(group_name), "%d", i);
+        if ((gid = H5Gcreate2(fid, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Gclose(gid) < 0)
+            TEST_ERROR;
+    }
+
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    fid = -1;
+
+    /* Check the header and that the log holds whole records */
+    if (NULL == (fp = fopen(BINARY_LOG_LOCATION, "rb")))
+        TEST_ERROR;
+    if (fread(header, 1, sizeof(header), fp) != sizeof(header))
+        TEST_ERROR;
+    if (memcmp(header, H5C_LOG_BINARY_SIGNATURE, (size_t)H5C_LOG_BINARY_SIGNATURE_LEN) != 0)
+        TEST_ERROR;
+    if (HDfseek(fp, 0, SEEK_END) < 0)
+        TEST_ERROR;
+    log_size = HDftell(fp);
+    if (log_size <= H5C_LOG_BINARY_HEADER_SIZE)
+        TEST_ERROR;
+    if ((log_size - H5C_LOG_BINARY_HEADER_SIZE) % H5C_LOG_BINARY_RECORD_SIZE != 0)
+        TEST_ERROR;
+    fclose(fp);
+    fp = NULL;
+
+    /* Clean up */
+    HDunsetenv(HDF5_MDC_LOG_STYLE);
+    HDremove(BINARY_LOG_LOCATION);
+    h5_clean_files(FILENAME, fapl);
+
+    PASSED();
+    return 0;
+
+error:
+    if (fp)
+        fclose(fp);
+    HDunsetenv(HDF5_MDC_LOG_STYLE);
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY
+
+    return 1;
+} /* test_binary_logging() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -168,6 +258,7 @@ main(void)
     printf("Testing basic metadata cache logging functionality.\n");
 
     nerrors += test_logging_api();
+    nerrors += test_binary_logging();
 
     if (nerrors) {
         printf("***** %d Metadata cache logging TEST%s FAILED! *****\n", nerrors, nerrors > 1 ? "S" : "");
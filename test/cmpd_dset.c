@@ -19,7 +19,7 @@
 
 #include "h5test.h"
 
-static const char *FILENAME[] = {"cmpd_dset", "src_subset", "dst_subset", NULL};
+static const char *FILENAME[] = {"cmpd_dset", "src_subset", "dst_subset", "membs_subset", NULL};
 
 const char *DSET_NAME[] = {"contig_src_subset", "chunk_src_subset", "contig_dst_subset", "chunk_dst_subset",
                            NULL};
@@ -104,10 +104,39 @@ typedef struct {
     long long r, s, t;
 } stype4;
 
+/* Structures for testing reading and writing a few members of a larger
+ * compound type, in another order */
+typedef struct {
+    int       a;
+    double    b;
+    int       c;
+    int       d;
+    float     e;
+    double    f;
+    short     g;
+    long long h;
+} mtype_file;
+
+typedef struct {
+    double f;
+    int    c;
+    int    d;
+    short  g;
+} mtype_mem1;
+
+typedef struct {
+    long long c;
+    int       d;
+    double    b;
+} mtype_mem2;
+
 #define NX          100U
 #define NY          2000U
 #define PACK_NMEMBS 100
 
+/* # of elements of the dataset with the larger compound type */
+#define MEMBS_NELMTS 1000U
+
 /*-------------------------------------------------------------------------
  * Function:    test_compound
  *
@@ -1617,6 +1646,242 @@ error:
     return 1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_hdf5_membs_subset
+ *
+ * Purpose:     Tests reading and writing a few members of a larger compound
+ *              type, in another order than in the file, with and without
+ *              conversion of some of the members.  For example:
+ *                  struct destination {       struct source {
+ *                      TYPE6 F;      <--          TYPE1 A;
+ *                      TYPE3 C;      <--          TYPE2 B;
+ *                      TYPE4 D;      <--          TYPE3 C;
+ *                      TYPE7 G;      <--          TYPE4 D;
+ *                  };                             ...
+ *                                             };
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_hdf5_membs_subset(char *filename, hid_t fapl)
+{
+    hid_t       file     = H5I_INVALID_HID;
+    hid_t       file_tid = H5I_INVALID_HID, mem1_tid = H5I_INVALID_HID, mem2_tid = H5I_INVALID_HID;
+    hid_t       dataset  = H5I_INVALID_HID;
+    hid_t       space = H5I_INVALID_HID, mspace = H5I_INVALID_HID;
+    hid_t       dcpl = H5I_INVALID_HID, dxpl = H5I_INVALID_HID;
+    hsize_t     dims[1]  = {MEMBS_NELMTS};
+    hsize_t     chunk[1] = {MEMBS_NELMTS / 10};
+    hsize_t     start[1], stride[1], count[1];
+    mtype_file *orig = NULL, *fbuf = NULL;
+    mtype_mem1 *buf1 = NULL;
+    mtype_mem2 *buf2 = NULL;
+    size_t      u;
+
+    TESTING("reading and writing a few members in another order");
+
+    /* Build hdf5 datatypes */
+    if ((file_tid = H5Tcreate(H5T_COMPOUND, sizeof(mtype_file))) < 0)
+        goto error;
+    if (H5Tinsert(file_tid, "a", HOFFSET(mtype_file, a), H5T_NATIVE_INT) < 0 ||
+        H5Tinsert(file_tid, "b", HOFFSET(mtype_file, b), H5T_NATIVE_DOUBLE) < 0 ||
+        H5Tinsert(file_tid, "c", HOFFSET(mtype_file, c), H5T_NATIVE_INT) < 0 ||
+        H5Tinsert(file_tid, "d", HOFFSET(mtype_file, d), H5T_NATIVE_INT) < 0 ||
+        H5Tinsert(file_tid, "e", HOFFSET(mtype_file, e), H5T_NATIVE_FLOAT) < 0 ||
+        H5Tinsert(file_tid, "f", HOFFSET(mtype_file, f), H5T_NATIVE_DOUBLE) < 0 ||
+        H5Tinsert(file_tid, "g", HOFFSET(mtype_file, g), H5T_NATIVE_SHORT) < 0 ||
+        H5Tinsert(file_tid, "h", HOFFSET(mtype_file, h), H5T_NATIVE_LLONG) < 0)
+        goto error;
+
+    /* Members which need no conversion, two of them adjacent */
+    if ((mem1_tid = H5Tcreate(H5T_COMPOUND, sizeof(mtype_mem1))) < 0)
+        goto error;
+    if (H5Tinsert(mem1_tid, "f", HOFFSET(mtype_mem1, f), H5T_NATIVE_DOUBLE) < 0 ||
+        H5Tinsert(mem1_tid, "c", HOFFSET(mtype_mem1, c), H5T_NATIVE_INT) < 0 ||
+        H5Tinsert(mem1_tid, "d", HOFFSET(mtype_mem1, d), H5T_NATIVE_INT) < 0 ||
+        H5Tinsert(mem1_tid, "g", HOFFSET(mtype_mem1, g), H5T_NATIVE_SHORT) < 0)
+        goto error;
+
+    /* One member which is converted and two which are not */
+    if ((mem2_tid = H5Tcreate(H5T_COMPOUND, sizeof(mtype_mem2))) < 0)
+        goto error;
+    if (H5Tinsert(mem2_tid, "c", HOFFSET(mtype_mem2, c), H5T_NATIVE_LLONG) < 0 ||
+        H5Tinsert(mem2_tid, "d", HOFFSET(mtype_mem2, d), H5T_NATIVE_INT) < 0 ||
+        H5Tinsert(mem2_tid, "b", HOFFSET(mtype_mem2, b), H5T_NATIVE_DOUBLE) < 0)
+        goto error;
+
+    /* Allocate space and initialize data */
+    if (NULL == (orig = (mtype_file *)calloc(MEMBS_NELMTS, sizeof(mtype_file))))
+        goto error;
+    if (NULL == (fbuf = (mtype_file *)calloc(MEMBS_NELMTS, sizeof(mtype_file))))
+        goto error;
+    if (NULL == (buf1 = (mtype_mem1 *)calloc(MEMBS_NELMTS, sizeof(mtype_mem1))))
+        goto error;
+    if (NULL == (buf2 = (mtype_mem2 *)calloc(MEMBS_NELMTS, sizeof(mtype_mem2))))
+        goto error;
+    for (u = 0; u < MEMBS_NELMTS; u++) {
+        orig[u].a = (int)u;
+        orig[u].b = (double)u / 4.0;
+        orig[u].c = (int)u * 3;
+        orig[u].d = -(int)u;
+        orig[u].e = (float)u / 2.0F;
+        orig[u].f = (double)u * 1.5;
+        orig[u].g = (short)(u % 100);
+        orig[u].h = (long long)u * 1000;
+    }
+
+    /* Create the file, dataspaces and a chunked dataset */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if ((space = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((mspace = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
+        goto error;
+    if ((dataset = H5Dcreate2(file, "membs_subset", file_tid, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(dataset, file_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig) < 0)
+        goto error;
+
+    /* Read the members which need no conversion */
+    for (u = 0; u < MEMBS_NELMTS; u++) {
+        buf1[u].f = -1.0;
+        buf1[u].c = buf1[u].d = -1;
+        buf1[u].g = -1;
+    }
+    if (H5Dread(dataset, mem1_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf1) < 0)
+        goto error;
+    for (u = 0; u < MEMBS_NELMTS; u++)
+        if (!H5_DBL_ABS_EQUAL(buf1[u].f, orig[u].f) || buf1[u].c != orig[u].c || buf1[u].d != orig[u].d ||
+            buf1[u].g != orig[u].g) {
+            H5_FAILED();
+            printf("    element %zu of the members without conversion is wrong\n", u);
+            goto error;
+        }
+
+    /* Read every other element into every third element of the buffer, to
+     * check that the other elements are left alone */
+    for (u = 0; u < MEMBS_NELMTS; u++) {
+        buf1[u].f = -1.0;
+        buf1[u].c = buf1[u].d = -1;
+        buf1[u].g = -1;
+    }
+    start[0]  = 0;
+    stride[0] = 2;
+    count[0]  = MEMBS_NELMTS / 3;
+    if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        goto error;
+    stride[0] = 3;
+    if (H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        goto error;
+    if (H5Dread(dataset, mem1_tid, mspace, space, H5P_DEFAULT, buf1) < 0)
+        goto error;
+    for (u = 0; u < MEMBS_NELMTS; u++) {
+        size_t src = (u % 3 == 0 && u / 3 < count[0]) ? (u / 3) * 2 : MEMBS_NELMTS;
+
+        if (src < MEMBS_NELMTS ? (!H5_DBL_ABS_EQUAL(buf1[u].f, orig[src].f) || buf1[u].c != orig[src].c ||
+                                  buf1[u].d != orig[src].d || buf1[u].g != orig[src].g)
+                               : (!H5_DBL_ABS_EQUAL(buf1[u].f, -1.0) || buf1[u].c != -1 || buf1[u].d != -1 ||
+                                  buf1[u].g != -1)) {
+            H5_FAILED();
+            printf("    element %zu of the hyperslab read is wrong\n", u);
+            goto error;
+        }
+    }
+    if (H5Sselect_all(space) < 0 || H5Sselect_all(mspace) < 0)
+        goto error;
+
+    /* Read members of which one is converted */
+    if (H5Dread(dataset, mem2_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf2) < 0)
+        goto error;
+    for (u = 0; u < MEMBS_NELMTS; u++)
+        if (buf2[u].c != (long long)orig[u].c || buf2[u].d != orig[u].d ||
+            !H5_DBL_ABS_EQUAL(buf2[u].b, orig[u].b)) {
+            H5_FAILED();
+            printf("    element %zu of the members with conversion is wrong\n", u);
+            goto error;
+        }
+
+    /* Rewrite the members which need no conversion, keeping the others */
+    for (u = 0; u < MEMBS_NELMTS; u++) {
+        buf1[u].f = orig[u].f = (double)u * -2.5;
+        buf1[u].c = orig[u].c = (int)u + 7;
+        buf1[u].d = orig[u].d = (int)u - 7;
+        buf1[u].g = orig[u].g = (short)(u % 50);
+    }
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+    if (H5Pset_preserve(dxpl, TRUE) < 0)
+        goto error;
+    if (H5Dwrite(dataset, mem1_tid, H5S_ALL, H5S_ALL, dxpl, buf1) < 0)
+        goto error;
+    if (H5Dread(dataset, file_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, fbuf) < 0)
+        goto error;
+    for (u = 0; u < MEMBS_NELMTS; u++)
+        if (fbuf[u].a != orig[u].a || !H5_DBL_ABS_EQUAL(fbuf[u].b, orig[u].b) || fbuf[u].c != orig[u].c ||
+            fbuf[u].d != orig[u].d || !H5_FLT_ABS_EQUAL(fbuf[u].e, orig[u].e) ||
+            !H5_DBL_ABS_EQUAL(fbuf[u].f, orig[u].f) || fbuf[u].g != orig[u].g || fbuf[u].h != orig[u].h) {
+            H5_FAILED();
+            printf("    element %zu of the rewritten data is wrong\n", u);
+            goto error;
+        }
+
+    if (H5Dclose(dataset) < 0)
+        goto error;
+    if (H5Pclose(dxpl) < 0)
+        goto error;
+    if (H5Pclose(dcpl) < 0)
+        goto error;
+    if (H5Sclose(mspace) < 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Tclose(mem2_tid) < 0)
+        goto error;
+    if (H5Tclose(mem1_tid) < 0)
+        goto error;
+    if (H5Tclose(file_tid) < 0)
+        goto error;
+    if (H5Fclose(file) < 0)
+        goto error;
+
+    free(orig);
+    free(fbuf);
+    free(buf1);
+    free(buf2);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Pclose(dxpl);
+        H5Pclose(dcpl);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Tclose(mem2_tid);
+        H5Tclose(mem1_tid);
+        H5Tclose(file_tid);
+        H5Fclose(file);
+    }
+    H5E_END_TRY
+    free(orig);
+    free(fbuf);
+    free(buf1);
+    free(buf2);
+    HDputs("*** DATASET TESTS FAILED ***");
+    return 1;
+}
+
 /* Error macro that outputs the state of the randomly generated variables so the
  * failure can be reproduced */
 #define PACK_OOO_ERROR                                                                                       \
@@ -2189,6 +2454,10 @@ main(int argc, char *argv[])
     h5_fixname(FILENAME[2], fapl_id, fname, sizeof(fname));
     nerrors += test_hdf5_dst_subset(fname, fapl_id);
 
+    HDputs("Testing the optimization of when the members are in another order:");
+    h5_fixname(FILENAME[3], fapl_id, fname, sizeof(fname));
+    nerrors += test_hdf5_membs_subset(fname, fapl_id);
+
     HDputs("Testing that compound types can be packed out of order:");
     nerrors += test_pack_ooo();
 
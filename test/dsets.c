@@ -81,6 +81,8 @@ static const char *FILENAME[] = {"dataset",             /* 0 */
                                  "alloc_0sized",        /* 26 */
                                  "h5s_block",           /* 27 */
                                  "h5s_plist",           /* 28 */
+                                 "io_arena",            /* 29 */
+                                 "chunk_map_cache",     /* 30 */
                                  NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -545,7 +547,7 @@ test_simple_io(const char *env_h5_drvr, hid_t fapl)
 
     /* Can't run this test with multi-file VFDs because of HDopen/read/seek the file directly */
     if (HDstrcmp(env_h5_drvr, "split") != 0 && HDstrcmp(env_h5_drvr, "multi") != 0 &&
-        HDstrcmp(env_h5_drvr, "family") != 0) {
+        HDstrcmp(env_h5_drvr, "family") != 0 && HDstrcmp(env_h5_drvr, "stripe") != 0) {
         h5_fixname(FILENAME[4], fapl, filename, sizeof filename);
 
         /* Set up data array */
@@ -706,7 +708,7 @@ test_userblock_offset(const char *env_h5_drvr, hid_t fapl, hbool_t new_format)
 
     /* Can't run this test with multi-file VFDs because of HDopen/read/seek the file directly */
     if (HDstrcmp(env_h5_drvr, "split") != 0 && HDstrcmp(env_h5_drvr, "multi") != 0 &&
-        HDstrcmp(env_h5_drvr, "family") != 0) {
+        HDstrcmp(env_h5_drvr, "family") != 0 && HDstrcmp(env_h5_drvr, "stripe") != 0) {
         h5_fixname(FILENAME[2], fapl, filename, sizeof filename);
 
         /* Set up data array */
@@ -13081,6 +13083,364 @@ error:
     return FAIL;
 } /* end test_power2up() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_io_arena
+ *
+ * Purpose:     Tests that the temporary objects of reads and writes of a
+ *              chunked dataset are allocated from the I/O operation's arena
+ *              with fewer allocations than objects, and that the data is
+ *              correct.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define IO_ARENA_DIM   24
+#define IO_ARENA_CHUNK 4
+static herr_t
+test_io_arena(hid_t fapl)
+{
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   fid    = H5I_INVALID_HID;               /* File ID */
+    hid_t   dcpl   = H5I_INVALID_HID;               /* Dataset creation property list */
+    hid_t   sid    = H5I_INVALID_HID;               /* Dataspace ID */
+    hid_t   did    = H5I_INVALID_HID;               /* Dataset ID */
+    hsize_t dims[2]  = {IO_ARENA_DIM, IO_ARENA_DIM};     /* Dataset dimensions */
+    hsize_t chunk[2] = {IO_ARENA_CHUNK, IO_ARENA_CHUNK}; /* Chunk dimensions */
+    hsize_t start[2] = {1, 2};                           /* Start of the selection */
+    hsize_t count[2] = {20, 19};                         /* Size of the selection */
+    int     wbuf[IO_ARENA_DIM][IO_ARENA_DIM];            /* Data written */
+    short   rbuf[IO_ARENA_DIM][IO_ARENA_DIM];            /* Data read */
+    size_t  nallocs_before, nblocks_before;              /* Arena totals before the read */
+    size_t  nallocs_after, nblocks_after;                /* Arena totals after the read */
+    int     i, j;
+
+    TESTING("arena for I/O operation temporaries");
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+
+    for (i = 0; i < IO_ARENA_DIM; i++)
+        for (j = 0; j < IO_ARENA_DIM; j++)
+            wbuf[i][j] = i * IO_ARENA_DIM + j;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        FAIL_STACK_ERROR;
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Read a hyperslab that spans most of the chunks, with type conversion */
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5D__arena_stats_test(&nallocs_before, &nblocks_before) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dread(did, H5T_NATIVE_SHORT, sid, sid, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (H5D__arena_stats_test(&nallocs_after, &nblocks_after) < 0)
+        FAIL_STACK_ERROR;
+
+    /* There's at least one piece info per chunk in the selection, and many
+     * objects are allocated from each arena block
+     */
+    if (nallocs_after - nallocs_before < 36)
+        FAIL_PUTS_ERROR("too few objects allocated from the arena");
+    if (nblocks_after == nblocks_before || 4 * (nblocks_after - nblocks_before) > nallocs_after - nallocs_before)
+        FAIL_PUTS_ERROR("wrong number of arena blocks");
+
+    /* Verify the data */
+    for (i = 0; i < IO_ARENA_DIM; i++)
+        for (j = 0; j < IO_ARENA_DIM; j++) {
+            int expect = 0;
+
+            if (i >= (int)start[0] && i < (int)(start[0] + count[0]) && j >= (int)start[1] &&
+                j < (int)(start[1] + count[1]))
+                expect = wbuf[i][j];
+            if ((int)rbuf[i][j] != expect) {
+                printf("    rbuf[%d][%d] = %d, expected %d\n", i, j, (int)rbuf[i][j], expect);
+                TEST_ERROR;
+            }
+        }
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+    return FAIL;
+} /* end test_io_arena() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_map_cache
+ *
+ * Purpose:     Tests that I/O on a chunked dataset reuses the piece map of
+ *              the last I/O with the same file & memory selections, and
+ *              only then, and that the data is correct.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MAP_CACHE_DIM   20
+#define MAP_CACHE_CHUNK 5
+#define MAP_CACHE_NPNTS 6
+static herr_t
+test_chunk_map_cache(hid_t fapl)
+{
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   fid      = H5I_INVALID_HID;                            /* File ID */
+    hid_t   dcpl     = H5I_INVALID_HID;                            /* Dataset creation property list */
+    hid_t   sid      = H5I_INVALID_HID;                            /* Dataset's dataspace ID */
+    hid_t   fsid     = H5I_INVALID_HID;                            /* File dataspace ID */
+    hid_t   msid     = H5I_INVALID_HID;                            /* Memory dataspace ID */
+    hid_t   did      = H5I_INVALID_HID;                            /* Dataset ID */
+    hid_t   did2     = H5I_INVALID_HID;                            /* Dataset ID */
+    hsize_t dims[2]  = {MAP_CACHE_DIM, MAP_CACHE_DIM};             /* Dataset dimensions */
+    hsize_t max[2]   = {H5S_UNLIMITED, H5S_UNLIMITED};             /* Dataset maximum dimensions */
+    hsize_t new_dims[2] = {MAP_CACHE_DIM + 5, MAP_CACHE_DIM + 5}; /* Extended dataset dimensions */
+    hsize_t chunk[2] = {MAP_CACHE_CHUNK, MAP_CACHE_CHUNK};         /* Chunk dimensions */
+    hsize_t start[2] = {3, 3};                                     /* Start of the file selection */
+    hsize_t count[2] = {10, 10};                                   /* Size of the selections */
+    hsize_t mdims[2] = {12, 12};                                   /* Memory dataspace dimensions */
+    hsize_t mstart[2];                                             /* Start of the memory selection */
+    hsize_t coord[MAP_CACHE_NPNTS][2] = {{0, 0}, {19, 19}, {7, 2}, {2, 7}, {12, 13}, {4, 4}};
+    hsize_t npnts = MAP_CACHE_NPNTS;                               /* Number of points */
+    int     wbuf[10][10];                                          /* Data written */
+    int     rbuf[MAP_CACHE_DIM][MAP_CACHE_DIM];                    /* Data read */
+    int     mbuf[12][12];                                          /* Data read into larger buffer */
+    int     pbuf[MAP_CACHE_NPNTS];                                 /* Data for points */
+    size_t  npieces;                                               /* Number of pieces in cached map */
+    unsigned nhits;                                                /* Number of reuses of cached maps */
+    int      i, j, k;
+
+    TESTING("reuse of chunk maps for repeated selections");
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if ((sid = H5Screate_simple(2, dims, max)) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        FAIL_STACK_ERROR;
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+
+    if ((fsid = H5Scopy(sid)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sselect_hyperslab(fsid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        FAIL_STACK_ERROR;
+    if ((msid = H5Screate_simple(2, count, NULL)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* The first write maps the selection to 3x3 chunks */
+    for (k = 0; k < 2; k++) {
+        for (i = 0; i < 10; i++)
+            for (j = 0; j < 10; j++)
+                wbuf[i][j] = (k + 1) * 1000 + i * 10 + j;
+        if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR;
+        if (H5D__chunk_map_cache_test(did, &npieces, &nhits) < 0)
+            FAIL_STACK_ERROR;
+        if (npieces != 9 || nhits != (unsigned)k)
+            FAIL_PUTS_ERROR("wrong cached piece map after write");
+    } /* end for */
+
+    /* Read the whole dataset, which replaces the map */
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (H5D__chunk_map_cache_test(did, &npieces, &nhits) < 0)
+        FAIL_STACK_ERROR;
+    if (npieces != 16 || nhits != 1)
+        FAIL_PUTS_ERROR("wrong cached piece map after reading dataset");
+    for (i = 0; i < MAP_CACHE_DIM; i++)
+        for (j = 0; j < MAP_CACHE_DIM; j++) {
+            int expect = 0;
+
+            if (i >= 3 && i < 13 && j >= 3 && j < 13)
+                expect = wbuf[i - 3][j - 3];
+            if (rbuf[i][j] != expect) {
+                printf("    rbuf[%d][%d] = %d, expected %d\n", i, j, rbuf[i][j], expect);
+                TEST_ERROR;
+            }
+        }
+
+    /* Read the selection twice, the second read reuses the map */
+    for (k = 0; k < 2; k++) {
+        memset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR;
+        if (H5D__chunk_map_cache_test(did, &npieces, &nhits) < 0)
+            FAIL_STACK_ERROR;
+        if (npieces != 9 || nhits != (unsigned)(1 + k))
+            FAIL_PUTS_ERROR("wrong cached piece map after read");
+        if (memcmp(rbuf, wbuf, sizeof(wbuf)) != 0)
+            FAIL_PUTS_ERROR("wrong data read");
+    } /* end for */
+
+    /* Memory selections of the same shape elsewhere in the buffer don't reuse the map */
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR;
+    if ((msid = H5Screate_simple(2, mdims, NULL)) < 0)
+        FAIL_STACK_ERROR;
+    for (k = 1; k < 3; k++) {
+        mstart[0] = mstart[1] = (hsize_t)k;
+        if (H5Sselect_hyperslab(msid, H5S_SELECT_SET, mstart, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR;
+        memset(mbuf, 0, sizeof(mbuf));
+        if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, mbuf) < 0)
+            FAIL_STACK_ERROR;
+        if (H5D__chunk_map_cache_test(did, &npieces, &nhits) < 0)
+            FAIL_STACK_ERROR;
+        if (npieces != 9 || nhits != 2)
+            FAIL_PUTS_ERROR("cached piece map reused for different memory selection");
+        for (i = 0; i < 10; i++)
+            for (j = 0; j < 10; j++)
+                if (mbuf[i + k][j + k] != wbuf[i][j])
+                    FAIL_PUTS_ERROR("wrong data read into memory selection");
+    } /* end for */
+
+    /* Neither does the same memory selection with a different offset */
+    {
+        hssize_t offset[2] = {-1, -1}; /* Offset of memory selection */
+
+        if (H5Soffset_simple(msid, offset) < 0)
+            FAIL_STACK_ERROR;
+    }
+    memset(mbuf, 0, sizeof(mbuf));
+    if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, mbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (H5D__chunk_map_cache_test(did, &npieces, &nhits) < 0)
+        FAIL_STACK_ERROR;
+    if (npieces != 9 || nhits != 2)
+        FAIL_PUTS_ERROR("cached piece map reused for different memory offset");
+    for (i = 0; i < 10; i++)
+        for (j = 0; j < 10; j++)
+            if (mbuf[i + 1][j + 1] != wbuf[i][j])
+                FAIL_PUTS_ERROR("wrong data read into offset memory selection");
+
+    /* Point selections reuse the map too */
+    if (H5Sselect_elements(fsid, H5S_SELECT_SET, (size_t)MAP_CACHE_NPNTS, (const hsize_t *)coord) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR;
+    if ((msid = H5Screate_simple(1, &npnts, NULL)) < 0)
+        FAIL_STACK_ERROR;
+    for (k = 0; k < 2; k++) {
+        for (i = 0; i < MAP_CACHE_NPNTS; i++)
+            pbuf[i] = -(k * 100 + i);
+        if (H5Dwrite(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, pbuf) < 0)
+            FAIL_STACK_ERROR;
+        if (H5D__chunk_map_cache_test(did, &npieces, &nhits) < 0)
+            FAIL_STACK_ERROR;
+        if (npieces != 5 || nhits != (unsigned)(2 + k))
+            FAIL_PUTS_ERROR("wrong cached piece map after writing points");
+    } /* end for */
+
+    /* Single element I/O doesn't use the map */
+    if (H5Sselect_elements(fsid, H5S_SELECT_SET, (size_t)1, (const hsize_t *)coord) < 0)
+        FAIL_STACK_ERROR;
+    mstart[0] = 0;
+    if (H5Sselect_elements(msid, H5S_SELECT_SET, (size_t)1, mstart) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, pbuf) < 0)
+        FAIL_STACK_ERROR;
+    if (H5D__chunk_map_cache_test(did, &npieces, &nhits) < 0)
+        FAIL_STACK_ERROR;
+    if (npieces != 5 || nhits != 3)
+        FAIL_PUTS_ERROR("wrong cached piece map after single element read");
+
+    /* Verify the points */
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < MAP_CACHE_NPNTS; i++)
+        if (rbuf[coord[i][0]][coord[i][1]] != -(100 + i))
+            FAIL_PUTS_ERROR("wrong data read at point");
+
+    /* Changing the extent releases the map */
+    if (H5Dset_extent(did, new_dims) < 0)
+        FAIL_STACK_ERROR;
+    if (H5D__chunk_map_cache_test(did, &npieces, NULL) < 0)
+        FAIL_STACK_ERROR;
+    if (npieces != 0)
+        FAIL_PUTS_ERROR("cached piece map not released after changing extent");
+
+    /* Maps with many pieces aren't kept */
+    chunk[0] = chunk[1] = 1;
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        FAIL_STACK_ERROR;
+    if ((did2 = H5Dcreate2(fid, "dset2", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    for (k = 0; k < 2; k++)
+        if (H5Dwrite(did2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR;
+    if (H5D__chunk_map_cache_test(did2, &npieces, &nhits) < 0)
+        FAIL_STACK_ERROR;
+    if (npieces != 0 || nhits != 0)
+        FAIL_PUTS_ERROR("cached piece map with too many pieces");
+
+    if (H5Dclose(did2) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(fsid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did2);
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(msid);
+        H5Sclose(fsid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+    return FAIL;
+} /* end test_chunk_map_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -15628,6 +15988,8 @@ main(void)
                 nerrors += (test_zero_dim_dset(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_storage_size(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_power2up(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_io_arena(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_map_cache(my_fapl) < 0 ? 1 : 0);
 
                 nerrors += (test_swmr_non_latest(envval, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0 ? 1 : 0);
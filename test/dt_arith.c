@@ -763,6 +763,148 @@ error:
     return MAX((int)fails_this_test, 1);
 }
 
+/* Number of elements of the large conversions in test_large_hard_conv() */
+#define LARGE_NELMTS (1024 * 1024)
+
+/* Convert LARGE_NELMTS elements of type ST, with the values VAL of each
+ * element U, from SRC_ID to DST_ID in BUF, and compare the results with the
+ * conversions of the compiler.
+ */
+#define CHECK_LARGE_CONV(SRC_ID, DST_ID, ST, DT, VAL)                                                        \
+    do {                                                                                                     \
+        for (u = 0; u < LARGE_NELMTS; u++)                                                                   \
+            ((ST *)buf)[u] = (ST)(VAL);                                                                      \
+        if (H5Tconvert(SRC_ID, DST_ID, (size_t)LARGE_NELMTS, buf, NULL, dxpl[t]) < 0)                        \
+            goto error;                                                                                      \
+        for (u = 0; u < LARGE_NELMTS; u++) {                                                                 \
+            DT expected = (DT)(ST)(VAL);                                                                     \
+                                                                                                             \
+            if (memcmp(&expected, (DT *)buf + u, sizeof(DT)) != 0) {                                         \
+                H5_FAILED();                                                                                 \
+                printf("    %s -> %s: element %zu is wrong\n", #ST, #DT, u);                                 \
+                goto error;                                                                                  \
+            }                                                                                                \
+        }                                                                                                    \
+    } while (0)
+
+/* Reverse the byte order of LARGE_NELMTS elements of SIZE bytes from
+ * SRC_ID to DST_ID in BUF and check the bytes of the results.
+ */
+#define CHECK_LARGE_SWAP(SRC_ID, DST_ID, SIZE)                                                               \
+    do {                                                                                                     \
+        for (u = 0; u < LARGE_NELMTS * (SIZE); u++)                                                          \
+            ((unsigned char *)buf)[u] = (unsigned char)(u * 7);                                              \
+        if (H5Tconvert(SRC_ID, DST_ID, (size_t)LARGE_NELMTS, buf, NULL, dxpl[t]) < 0)                        \
+            goto error;                                                                                      \
+        for (u = 0; u < LARGE_NELMTS * (SIZE); u++) {                                                        \
+            size_t swapped = (u - u % (SIZE)) + ((SIZE)-1) - u % (SIZE);                                     \
+                                                                                                             \
+            if (((unsigned char *)buf)[u] != (unsigned char)(swapped * 7)) {                                 \
+                H5_FAILED();                                                                                 \
+                printf("    %d-byte swap: byte %zu is wrong\n", (SIZE), u);                                  \
+                goto error;                                                                                  \
+            }                                                                                                \
+        }                                                                                                    \
+    } while (0)
+
+/*-------------------------------------------------------------------------
+ * Function:    test_large_hard_conv
+ *
+ * Purpose:     Tests the hard conversions and the byte order conversions
+ *              of large buffers of packed elements, which are converted in
+ *              passes over the buffer, and split across threads in
+ *              multi-thread builds.  Each conversion is done on the calling
+ *              thread and with H5Pset_type_conv_threads().
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_large_hard_conv(void)
+{
+    hid_t    dxpl[2]  = {H5P_DEFAULT, H5I_INVALID_HID};
+    void    *buf      = NULL;
+    unsigned nthreads = 0;
+    size_t   u;
+    int      t;
+
+    TESTING("large hard conversions and byte swaps");
+
+    if (NULL == (buf = malloc(LARGE_NELMTS * sizeof(double))))
+        goto error;
+
+    if ((dxpl[1] = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+    if (H5Pget_type_conv_threads(dxpl[1], &nthreads) < 0)
+        goto error;
+    if (nthreads != 0) {
+        H5_FAILED();
+        printf("    default number of conversion threads is %u\n", nthreads);
+        goto error;
+    }
+    if (H5Pset_type_conv_threads(dxpl[1], 4) < 0)
+        goto error;
+    if (H5Pget_type_conv_threads(dxpl[1], &nthreads) < 0)
+        goto error;
+    if (nthreads != 4) {
+        H5_FAILED();
+        printf("    number of conversion threads is %u, not 4\n", nthreads);
+        goto error;
+    }
+
+    for (t = 0; t < 2; t++) {
+        /* Conversions that keep the size of the elements */
+        CHECK_LARGE_CONV(H5T_NATIVE_INT, H5T_NATIVE_FLOAT, int, float, (int)u - LARGE_NELMTS / 2);
+        CHECK_LARGE_CONV(H5T_NATIVE_FLOAT, H5T_NATIVE_INT, float, int, (float)(u % 2000) - 1000.5F);
+
+        /* Conversions that grow the elements */
+        CHECK_LARGE_CONV(H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, int, double, (int)u - LARGE_NELMTS / 2);
+        CHECK_LARGE_CONV(H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE, float, double, (float)u * 0.75F);
+        CHECK_LARGE_CONV(H5T_NATIVE_SHORT, H5T_NATIVE_INT, short, int, (int)(u % 60000) - 30000);
+
+        /* Conversions that shrink the elements */
+        CHECK_LARGE_CONV(H5T_NATIVE_DOUBLE, H5T_NATIVE_INT, double, int, (double)u * 1.5 - LARGE_NELMTS);
+        CHECK_LARGE_CONV(H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, double, float, (double)u / 3.0);
+        CHECK_LARGE_CONV(H5T_NATIVE_INT, H5T_NATIVE_SHORT, int, short, (int)(u % 60000) - 30000);
+
+        /* Byte order conversions */
+        CHECK_LARGE_SWAP(H5T_STD_I16LE, H5T_STD_I16BE, 2);
+        CHECK_LARGE_SWAP(H5T_STD_I32BE, H5T_STD_I32LE, 4);
+        CHECK_LARGE_SWAP(H5T_IEEE_F64LE, H5T_IEEE_F64BE, 8);
+    } /* end for */
+
+    if (H5Pclose(dxpl[1]) < 0)
+        goto error;
+    free(buf);
+
+    PASSED();
+
+    /* Restore the default error handler (set in h5_reset()) */
+    h5_restore_err();
+
+    reset_hdf5();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl[1]);
+    }
+    H5E_END_TRY
+    free(buf);
+
+    /* Restore the default error handler (set in h5_reset()) */
+    h5_restore_err();
+
+    reset_hdf5();
+
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    test_derived_flt
  *
@@ -5136,6 +5278,9 @@ main(void)
     /* Test a few special values for hardware float-integer conversions */
     nerrors += (unsigned long)test_particular_fp_integer();
 
+    /* Test large buffers of hardware conversions and byte swaps */
+    nerrors += (unsigned long)test_large_hard_conv();
+
     /*----------------------------------------------------------------------
      * Software tests
      *----------------------------------------------------------------------
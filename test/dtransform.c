@@ -21,6 +21,7 @@ static int test_copy(hid_t dxpl_id_c_to_f_copy, hid_t dxpl_id_polynomial_copy);
 static int test_trivial(hid_t dxpl_id_simple);
 static int test_poly(hid_t dxpl_id_polynomial);
 static int test_specials(hid_t file);
+static int test_large(hid_t file);
 static int test_set(void);
 static int test_getset(hid_t dxpl_id_simple);
 
@@ -399,6 +400,8 @@ main(void)
         TEST_ERROR;
     if (test_specials(file_id) < 0)
         TEST_ERROR;
+    if (test_large(file_id) < 0)
+        TEST_ERROR;
 
     /* Close the objects we opened/created */
     if (H5Dclose(dset_id_int) < 0)
@@ -778,6 +781,113 @@ error:
     return -1;
 }
 
+/* # of elements of the dataset for test_large, more than a block of the evaluator and not a multiple of it */
+#define LARGE_NELMTS (64 * 1024 + 37)
+
+static int
+test_large(hid_t file)
+{
+    hid_t       dxpl_id = -1, dset_id = -1, dataspace = -1;
+    hsize_t     dim     = LARGE_NELMTS;
+    int        *int_buf = NULL, *int_res = NULL;
+    double     *dbl_buf = NULL, *dbl_res = NULL;
+    size_t      u;
+    const char *poly = "x*(x*(x+1)) - (2-x)*x/(x+3) + 1.5";
+
+    TESTING("data transform, polynomial transform of a large buffer");
+
+    if (NULL == (int_buf = (int *)malloc(LARGE_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (int_res = (int *)malloc(LARGE_NELMTS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (dbl_buf = (double *)malloc(LARGE_NELMTS * sizeof(double))))
+        TEST_ERROR;
+    if (NULL == (dbl_res = (double *)malloc(LARGE_NELMTS * sizeof(double))))
+        TEST_ERROR;
+
+    /* The results with the conversions of each operation of the transform */
+    for (u = 0; u < LARGE_NELMTS; u++) {
+        int    x = (int)(u % 1000);
+        int    a = x * (x * (int)((double)x + 1));
+        int    b = ((int)(2.0 - (double)x) * x) / (int)((double)x + 3);
+        double d = (double)u / 64.0;
+
+        int_buf[u] = x;
+        int_res[u] = (int)((double)(a - b) + 1.5);
+
+        dbl_buf[u] = d;
+        dbl_res[u] = d * (d * (d + 1)) - (2 - d) * d / (d + 3) + 1.5;
+    }
+
+    if ((dataspace = H5Screate_simple(1, &dim, NULL)) < 0)
+        TEST_ERROR;
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR;
+    if (H5Pset_data_transform(dxpl_id, poly) < 0)
+        TEST_ERROR;
+
+    if ((dset_id = H5Dcreate2(file, "/large_int", H5T_NATIVE_INT, dataspace, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, int_buf) < 0)
+        TEST_ERROR;
+    memset(int_buf, 0, LARGE_NELMTS * sizeof(int));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, int_buf) < 0)
+        TEST_ERROR;
+    for (u = 0; u < LARGE_NELMTS; u++)
+        if (int_buf[u] != int_res[u]) {
+            H5_FAILED();
+            fprintf(stderr, "    ERROR: int element %zu is %d, should be %d\n", u, int_buf[u], int_res[u]);
+            goto error;
+        }
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+
+    if ((dset_id = H5Dcreate2(file, "/large_double", H5T_NATIVE_DOUBLE, dataspace, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, dbl_buf) < 0)
+        TEST_ERROR;
+    memset(dbl_buf, 0, LARGE_NELMTS * sizeof(double));
+    if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl_id, dbl_buf) < 0)
+        TEST_ERROR;
+    for (u = 0; u < LARGE_NELMTS; u++)
+        if (!H5_DBL_REL_EQUAL(dbl_buf[u], dbl_res[u], 1.0e-12)) {
+            H5_FAILED();
+            fprintf(stderr, "    ERROR: double element %zu is %g, should be %g\n", u, dbl_buf[u], dbl_res[u]);
+            goto error;
+        }
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+
+    if (H5Pclose(dxpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(dataspace) < 0)
+        TEST_ERROR;
+
+    free(int_buf);
+    free(int_res);
+    free(dbl_buf);
+    free(dbl_res);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dxpl_id);
+        H5Sclose(dataspace);
+    }
+    H5E_END_TRY
+    free(int_buf);
+    free(int_res);
+    free(dbl_buf);
+    free(dbl_res);
+    return -1;
+}
+
 static int
 test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy)
 {
@@ -168,7 +168,9 @@ main(void)
                                            FALSE,
                                            0.2,
                                            (256 * 2048),
-                                           H5AC__DEFAULT_METADATA_WRITE_STRATEGY};
+                                           H5AC__DEFAULT_METADATA_WRITE_STRATEGY,
+                                           0.1,
+                                           0.01};
 
     H5AC_cache_image_config_t my_cache_image_config = {H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION, TRUE, FALSE,
                                                        -1};
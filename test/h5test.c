@@ -1082,7 +1082,16 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
             driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
-            driver == H5FD_LOG || driver == H5FD_SPLITTER) {
+#ifdef H5_HAVE_IOURING_VFD
+            driver == H5FD_IOURING ||
+#endif /* H5_HAVE_IOURING_VFD */
+#ifdef H5_HAVE_MMAP_VFD
+            driver == H5FD_MMAP ||
+#endif /* H5_HAVE_MMAP_VFD */
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+            driver == H5FD_WRITEBEHIND ||
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
+            driver == H5FD_LOG || driver == H5FD_PROFILE || driver == H5FD_SPLITTER) {
             /* Get the file's statistics */
             if (0 == HDstat(filename, &sb))
                 return ((h5_stat_size_t)sb.st_size);
@@ -1180,7 +1189,7 @@ h5_get_file_size(const char *filename, hid_t fapl)
             /* Return total size */
             return (tot_size);
         } /* end if */
-        else if (driver == H5FD_SUBFILING) {
+        else if (driver == H5FD_SUBFILING || driver == H5FD_STRIPE) {
             hsize_t size;
             hid_t   fid = H5I_INVALID_HID;
 
@@ -2286,7 +2295,8 @@ h5_driver_uses_multiple_files(const char *drv_name, unsigned flags)
     if (drv_name) {
         if ((flags & H5_EXCLUDE_MULTIPART_DRIVERS) == 0) {
             if (!HDstrcmp(drv_name, "split") || !HDstrcmp(drv_name, "multi") ||
-                !HDstrcmp(drv_name, "family") || !HDstrcmp(drv_name, H5FD_SUBFILING_NAME))
+                !HDstrcmp(drv_name, "family") || !HDstrcmp(drv_name, "stripe") ||
+                !HDstrcmp(drv_name, H5FD_SUBFILING_NAME))
                 return TRUE;
         }
 
@@ -263,6 +263,48 @@ test_archival_index(void)
     if (558 != entry_out_p->phys_addr)
         TEST_ERROR;
 
+    /*
+     * Archival index range search routine
+     */
+
+    /* Range between entries should return zero */
+    entry_out_p = NULL;
+    if (H5FD__onion_archival_index_find_range(&aix, 10, 13, &entry_out_p) != 0)
+        TEST_ERROR;
+    /* Pointer should remain unset */
+    if (entry_out_p != NULL)
+        TEST_ERROR;
+
+    /* Range past either end should return zero */
+    if (H5FD__onion_archival_index_find_range(&aix, 0, 0, &entry_out_p) != 0)
+        TEST_ERROR;
+    if (H5FD__onion_archival_index_find_range(&aix, 21, 100, &entry_out_p) != 0)
+        TEST_ERROR;
+
+    /* Range with ends between entries should find the entries inside it */
+    if (H5FD__onion_archival_index_find_range(&aix, 3, 10, &entry_out_p) != 3)
+        TEST_ERROR;
+    if (NULL == entry_out_p || 558 != entry_out_p->phys_addr || 515 != entry_out_p[2].phys_addr)
+        TEST_ERROR;
+
+    /* Range with ends on entries should include them */
+    if (H5FD__onion_archival_index_find_range(&aix, 18, 20, &entry_out_p) != 3)
+        TEST_ERROR;
+    if (90 != entry_out_p->phys_addr)
+        TEST_ERROR;
+
+    /* Range covering the whole list should find every entry */
+    if (H5FD__onion_archival_index_find_range(&aix, 0, 100, &entry_out_p) != 8)
+        TEST_ERROR;
+    if (474 != entry_out_p->phys_addr)
+        TEST_ERROR;
+
+    /* Single-page range should match find */
+    if (H5FD__onion_archival_index_find_range(&aix, 9, 9, &entry_out_p) != 1)
+        TEST_ERROR;
+    if (515 != entry_out_p->phys_addr)
+        TEST_ERROR;
+
     /*
      * Test search edge cases
      */
@@ -35,6 +35,9 @@
 #define H5F_TESTING
 #include "H5Fpkg.h"
 
+#define H5PB_FRIEND /*suppress error about including H5PBpkg	  */
+#include "H5PBpkg.h"
+
 #define FILENAME_LEN 1024
 
 /* test routines */
@@ -54,6 +57,7 @@ static unsigned test_stats_collection(hid_t orig_fapl, const char *env_h5_drvr);
 /* helper routines */
 static unsigned create_file(char *filename, hid_t fcpl, hid_t fapl);
 static unsigned open_file(char *filename, hid_t fapl, hsize_t page_size, size_t page_buffer_size);
+static hbool_t  page_in_pb(const H5F_t *f, haddr_t addr);
 #endif /* H5_HAVE_PARALLEL */
 
 static const char *FILENAME[] = {"filepaged", NULL};
@@ -289,6 +293,22 @@ error:
     H5E_END_TRY
     return 1;
 }
+
+/*
+ *
+ *  page_in_pb():
+ *      Internal routine to check whether the page at ADDR is in the file's page buffer.
+ *
+ */
+static hbool_t
+page_in_pb(const H5F_t *f, haddr_t addr)
+{
+    H5PB_entry_t *page_entry = NULL;
+
+    H5PB__SEARCH_INDEX(f->shared->page_buf->index, addr, page_entry);
+
+    return (page_entry != NULL);
+}
 #endif /* H5_HAVE_PARALLEL */
 
 /*
@@ -591,7 +611,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
      * Get the number of pages inserted, and verify that it is the
      * the expected value.
      */
-    base_page_cnt = H5SL_count(f->shared->page_buf->slist_ptr);
+    base_page_cnt = f->shared->page_buf->clock_list_len;
     if (base_page_cnt != 1)
         TEST_ERROR;
 
@@ -617,7 +637,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count++;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* update elements 300 - 450, with values 300 -  - this will
@@ -627,7 +647,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 300), sizeof(int) * 150, data) < 0)
         FAIL_STACK_ERROR;
     page_count += 2;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* update elements 100 - 300, this will go to disk but also update
@@ -636,7 +656,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         data[i] = i + 100;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 100), sizeof(int) * 200, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* Update elements 225-300 - this will update an existing page in the PB */
@@ -645,7 +665,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         data[i] = i + 450;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 450), sizeof(int) * 150, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* Do a full page write to block 600-800 - should bypass the PB */
@@ -653,7 +673,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         data[i] = i + 600;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 600), sizeof(int) * 200, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* read elements 800 - 1200, this should not affect the PB, and should read -1s */
@@ -665,7 +685,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
             FAIL_STACK_ERROR;
         }
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         FAIL_STACK_ERROR;
 
     /* read elements 1200 - 1201, this should read -1 and bring in an
@@ -680,7 +700,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         }
     }
     page_count++;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 175 - 225, this should use the PB existing pages */
@@ -694,7 +714,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
             TEST_ERROR;
         }
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 0 - 800 using the VFD.. this should result in -1s
@@ -723,7 +743,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
      */
     if (H5F_block_read(f, H5FD_MEM_DRAW, addr, sizeof(int) * 800, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         TEST_ERROR;
     for (i = 0; i < 800; i++) {
         if (data[i] != i) {
@@ -741,7 +761,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 400), sizeof(int) * 1000, data) < 0)
         FAIL_STACK_ERROR;
     page_count -= 2;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* read elements 0 - 1000.. this should go to disk then update the
@@ -765,7 +785,7 @@ test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr)
         }
         i++;
     }
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     if (H5Fclose(file_id) < 0)
@@ -795,8 +815,8 @@ error:
 /*-------------------------------------------------------------------------
  * Function:    test_lru_processing()
  *
- * Purpose:     Basic set of tests verifying expected page buffer LRU
- *              management.
+ * Purpose:     Basic set of tests verifying expected page buffer CLOCK
+ *              replacement.
  *
  *              Any data mis-matches or failures reported by the HDF5
  *              library result in test failure.
@@ -823,7 +843,7 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
     int    *data         = NULL;
     H5F_t  *f            = NULL;
 
-    TESTING("LRU Processing");
+    TESTING("CLOCK Processing");
 
     h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
 
@@ -860,7 +880,7 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
      * Get the number of pages inserted, and verify that it is the
      * the expected value.
      */
-    base_page_cnt = H5SL_count(f->shared->page_buf->slist_ptr);
+    base_page_cnt = f->shared->page_buf->clock_list_len;
     if (base_page_cnt != 1)
         TEST_ERROR;
 
@@ -887,7 +907,7 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count++;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count + base_page_cnt)
+    if (f->shared->page_buf->clock_list_len != page_count + base_page_cnt)
         TEST_ERROR;
 
     /* update elements 300 - 450, with values 300 - 449 - this will
@@ -904,30 +924,30 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
     /* at this point, the page buffer entry created at file open should
      * have been evicted -- thus no further need to consider base_page_cnt.
      */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     /* The two pages should be the ones with address 100 and 200; 0
        should have been evicted */
     /* Changes: 200, 400 */
     search_addr = addr;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (!page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
     search_addr = addr + sizeof(int) * 400;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (!page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* update elements 150-151, this will update existing pages in the
-       page buffer and move it to the top of the LRU. */
+       page buffer and mark it referenced. */
     /* Changes: 300 - 301 */
     for (i = 0; i < 1; i++)
         data[i] = i + 300;
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 300), sizeof(int) * 1, data) < 0)
         FAIL_STACK_ERROR;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     /* read elements 600 - 601, this should read -1 and bring in an
@@ -941,22 +961,22 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
             TEST_ERROR;
         } /* end if */
     }     /* end for */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (!page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 1200 */
     search_addr = addr + sizeof(int) * 1200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (!page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
     /* read elements 175 - 225, this should move 100 to the top, evict 600 and bring in 200 */
     /* Changes: 350 - 450; 200, 1200, 400 */
@@ -968,22 +988,22 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
             TEST_ERROR;
         } /* end if */
     }     /* end for */
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 1200 */
     search_addr = addr + sizeof(int) * 1200;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (!page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (!page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* update elements 200 - 700 to value 0, this will go to disk but
@@ -994,17 +1014,17 @@ test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, addr + (sizeof(int) * 400), sizeof(int) * 1000, data) < 0)
         FAIL_STACK_ERROR;
     page_count -= 1;
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     /* Changes: 200 */
     search_addr = addr + sizeof(int) * 200;
-    if (NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (!page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
 
     /* Changes: 400 */
     search_addr = addr + sizeof(int) * 400;
-    if (NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+    if (page_in_pb(f, search_addr))
         FAIL_STACK_ERROR;
 
     if (H5Fclose(file_id) < 0)
@@ -1155,7 +1175,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5 - base_meta_cnt)
@@ -1177,7 +1197,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 800), sizeof(int) * 50, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->meta_count != 5)
@@ -1205,7 +1225,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 900), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->meta_count != 5)
@@ -1286,7 +1306,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
     if (page_buf->meta_count != 5 - base_raw_cnt)
         TEST_ERROR;
@@ -1307,7 +1327,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 800), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5)
@@ -1335,7 +1355,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 900), sizeof(int) * 50, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (page_buf->raw_count != 5)
@@ -1420,7 +1440,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         TEST_ERROR;
 
     if (f->shared->page_buf->raw_count != 5 - base_meta_cnt)
@@ -1436,7 +1456,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 400), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 3)
@@ -1460,7 +1480,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (f->shared->page_buf->raw_count != 2)
         TEST_ERROR;
 
-    /* bring existing raw entries up the LRU */
+    /* mark existing raw entries referenced */
     if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 750), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
@@ -1476,7 +1496,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (f->shared->page_buf->raw_count != 3)
         TEST_ERROR;
 
-    /* adding 2 meta entries should replace 2 entries at the bottom of the LRU */
+    /* adding 2 meta entries should replace 2 meta entries */
     if (H5F_block_read(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 98), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
@@ -1547,26 +1567,28 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
 
     page_count += 5;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
-    /* add 2 meta entries evicting 2 raw entries */
+    /* add 2 meta entries evicting 2 raw entries; the superblock page has
+     * been referenced since it was loaded, so CLOCK gives it a second chance
+     */
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 200), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
-    if (f->shared->page_buf->meta_count != 2)
+    if (f->shared->page_buf->meta_count != 3)
         TEST_ERROR;
 
-    if (f->shared->page_buf->raw_count != 3)
+    if (f->shared->page_buf->raw_count != 2)
         TEST_ERROR;
 
-    /* bring the rest of the raw entries up the LRU */
+    /* mark the rest of the raw entries referenced */
     if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 500), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
@@ -1580,7 +1602,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 100), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -1595,7 +1617,7 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * 300), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -1604,13 +1626,12 @@ test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr)
     if (f->shared->page_buf->raw_count != 4)
         TEST_ERROR;
 
-    /* write a metadata entry that should replace the metadata entry
-     * at the bottom of the LRU
+    /* write a metadata entry that should replace the only metadata entry
      */
     if (H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 500), sizeof(int) * 100, data) < 0)
         FAIL_STACK_ERROR;
 
-    if (H5SL_count(f->shared->page_buf->slist_ptr) != page_count)
+    if (f->shared->page_buf->clock_list_len != page_count)
         FAIL_STACK_ERROR;
 
     if (f->shared->page_buf->meta_count != 1)
@@ -1884,6 +1905,24 @@ test_stats_collection(hid_t orig_fapl, const char *env_h5_drvr)
         if (evictions[1] != 9 + base_raw_cnt)
             TEST_ERROR;
 
+        /* All the accesses were made by this thread */
+        {
+            unsigned thread_accesses[2];
+            unsigned thread_hits[2];
+            unsigned thread_misses[2];
+
+            if (H5PB_get_thread_stats(f->shared->page_buf, H5TS_thread_id(), thread_accesses, thread_hits,
+                                      thread_misses) < 0)
+                FAIL_STACK_ERROR;
+
+            if (thread_accesses[0] != accesses[0] || thread_accesses[1] != accesses[1])
+                TEST_ERROR;
+            if (thread_hits[0] != hits[0] || thread_hits[1] != hits[1])
+                TEST_ERROR;
+            if (thread_misses[0] != misses[0] || thread_misses[1] != misses[1])
+                TEST_ERROR;
+        }
+
         if (H5Freset_page_buffering_stats(file_id) < 0)
             FAIL_STACK_ERROR;
         if (H5Fget_page_buffering_stats(file_id, accesses, hits, misses, evictions, bypasses) < 0)
@@ -1935,6 +1974,141 @@ error:
 
     return 1;
 } /* test_stats_collection */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_readahead()
+ *
+ * Purpose:     Verify that sequential raw data reads through the page
+ *              buffer trigger readahead, that the prefetched pages hold
+ *              the correct data, and that subsequent reads hit them.
+ *
+ * Return:      0 if test is successful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_readahead(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char     filename[FILENAME_LEN]; /* Filename to use */
+    hid_t    file_id = -1;           /* File ID */
+    hid_t    fcpl    = -1;
+    hid_t    fapl    = -1;
+    int      i;
+    int      num_elements = 3200;
+    unsigned npages       = 0;
+    haddr_t  raw_addr     = HADDR_UNDEF;
+    int     *data         = NULL;
+    int     *rdata        = NULL;
+    H5F_t   *f            = NULL;
+
+    TESTING("Sequential Readahead");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if ((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR;
+
+    if (set_multi_split(env_h5_drvr, fapl, sizeof(int) * 200) != 0)
+        TEST_ERROR;
+
+    if ((data = (int *)calloc((size_t)num_elements, sizeof(int))) == NULL)
+        TEST_ERROR;
+    if ((rdata = (int *)calloc((size_t)num_elements, sizeof(int))) == NULL)
+        TEST_ERROR;
+
+    if ((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_file_space_page_size(fcpl, sizeof(int) * 200) < 0)
+        TEST_ERROR;
+
+    /* keep 8 pages at max in the page buffer, prefetch 3 pages ahead */
+    if (H5Pset_page_buffer_size(fapl, sizeof(int) * 1600, 0, 0) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_page_buffer_readahead(fapl, 3) < 0)
+        TEST_ERROR;
+
+    /* verify the property round trips */
+    if (H5Pget_page_buffer_readahead(fapl, &npages) < 0)
+        TEST_ERROR;
+    if (npages != 3)
+        TEST_ERROR;
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Get a pointer to the internal file object */
+    if (NULL == (f = (H5F_t *)H5VL_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    if (f->shared->page_buf->readahead != 3)
+        TEST_ERROR;
+
+    /* allocate 16 pages of raw data and write them in one (bypassing) write */
+    if (HADDR_UNDEF == (raw_addr = H5MF_alloc(f, H5FD_MEM_DRAW, sizeof(int) * (size_t)num_elements)))
+        FAIL_STACK_ERROR;
+
+    for (i = 0; i < num_elements; i++)
+        data[i] = i;
+
+    if (H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * (size_t)num_elements, data) < 0)
+        FAIL_STACK_ERROR;
+
+    if (H5Freset_page_buffering_stats(file_id) < 0)
+        FAIL_STACK_ERROR;
+
+    /* read the raw data back sequentially, half a page at a time */
+    for (i = 0; i < num_elements; i += 100)
+        if (H5F_block_read(f, H5FD_MEM_DRAW, raw_addr + (sizeof(int) * (size_t)i), sizeof(int) * 100,
+                           rdata + i) < 0)
+            FAIL_STACK_ERROR;
+
+    for (i = 0; i < num_elements; i++)
+        if (rdata[i] != data[i])
+            TEST_ERROR;
+
+    /* pages must have been prefetched and the sequential reads should
+     * have hit them, leaving far fewer misses than pages read
+     */
+    if (f->shared->page_buf->readahead_pages == 0)
+        TEST_ERROR;
+    if (f->shared->page_buf->readahead_hits == 0)
+        TEST_ERROR;
+    if (f->shared->page_buf->misses[1] >= 16)
+        TEST_ERROR;
+
+    if (H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    free(data);
+    free(rdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if (data)
+            free(data);
+        if (rdata)
+            free(rdata);
+    }
+    H5E_END_TRY
+
+    return 1;
+} /* test_readahead */
 #endif /* #ifndef H5_HAVE_PARALLEL */
 
 /*-------------------------------------------------------------------------
@@ -2109,6 +2283,7 @@ main(void)
     nerrors += test_lru_processing(fapl, env_h5_drvr);
     nerrors += test_min_threshold(fapl, env_h5_drvr);
     nerrors += test_stats_collection(fapl, env_h5_drvr);
+    nerrors += test_readahead(fapl, env_h5_drvr);
 
 #endif /* H5_HAVE_PARALLEL */
 
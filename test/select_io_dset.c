@@ -2826,6 +2826,19 @@ error:
     return FAIL;
 } /* test_set_get_select_io_mode() */
 
+/*
+ * Check whether the VFD selected through the HDF5_DRIVER environment variable
+ * implements the vector or selection I/O callbacks itself
+ */
+static hbool_t
+driver_has_vector_or_selection_io(void)
+{
+    const char *env_h5_drvr = HDgetenv(HDF5_DRIVER);
+
+    return (env_h5_drvr && (!HDstrcmp(env_h5_drvr, "core") || !HDstrcmp(env_h5_drvr, "core_paged") ||
+                            !HDstrcmp(env_h5_drvr, "stripe")));
+}
+
 /*
  * To test with various test_mode that no selelction I/O is performed
  *
@@ -2967,6 +2980,16 @@ test_no_selection_io_cause_mode(const char *filename, hid_t fapl, uint32_t test_
         no_selection_io_cause_read_expected |= H5D_SEL_IO_PAGE_BUFFER;
     }
 
+    /* If the driver implements vector or selection I/O, selection I/O is on by default, so the sieve
+     * buffer is never set up, and I/O never falls back to scalar calls at the VFL */
+    if (driver_has_vector_or_selection_io()) {
+        uint32_t vfl_causes = H5D_SEL_IO_DEFAULT_OFF | H5D_SEL_IO_NO_VECTOR_OR_SELECTION_IO_CB |
+                              H5D_SEL_IO_CONTIGUOUS_SIEVE_BUFFER;
+
+        no_selection_io_cause_write_expected &= ~vfl_causes;
+        no_selection_io_cause_read_expected &= ~vfl_causes;
+    }
+
     /* Create 1d data space */
     dims[0] = DSET_SELECT_DIM;
     if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
@@ -3109,6 +3132,207 @@ error:
     }
 }
 
+/*
+ * Check the H5Pget_actual_type_conv() value of DXPL after an I/O call
+ */
+static herr_t
+check_actual_type_conv(hid_t dxpl, uint32_t expected, const char *op, const char *dset_name)
+{
+    uint32_t actual_type_conv = 0;
+
+    if (H5Pget_actual_type_conv(dxpl, &actual_type_conv) < 0)
+        FAIL_STACK_ERROR;
+
+    if (actual_type_conv != expected) {
+        H5_FAILED();
+        printf("    %s of %s: actual type conversion 0x%x, expected 0x%x\n", op, dset_name,
+               (unsigned)actual_type_conv, (unsigned)expected);
+        TEST_ERROR;
+    }
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+}
+
+/*
+ * Test H5Pget_actual_type_conv() with reads and writes of data in the
+ * opposite byte order of the native one:
+ *  --contiguous & chunked datasets, read into a contiguous memory
+ *    selection: converted in the application buffer, in each selection
+ *    I/O mode and with a type conversion buffer smaller than the data
+ *  --strided memory selection or compact dataset: converted in the type
+ *    conversion buffer
+ *  --writes are converted in the application buffer with
+ *    H5Pset_modify_write_buf() only
+ *  --no type conversion: neither
+ */
+static herr_t
+test_get_actual_type_conv(const char *filename, hid_t fapl)
+{
+    const H5D_selection_io_mode_t modes[]      = {H5D_SELECTION_IO_MODE_OFF, H5D_SELECTION_IO_MODE_DEFAULT,
+                                                  H5D_SELECTION_IO_MODE_ON};
+    const H5D_layout_t            layouts[]    = {H5D_CONTIGUOUS, H5D_CHUNKED, H5D_COMPACT};
+    const char                   *dset_names[] = {"contig", "chunked", "compact"};
+    hid_t                         fid          = H5I_INVALID_HID;
+    hid_t                         sid          = H5I_INVALID_HID;
+    hid_t                         msid         = H5I_INVALID_HID;
+    hid_t                         dcpl         = H5I_INVALID_HID;
+    hid_t                         dxpl         = H5I_INVALID_HID;
+    hid_t                         did          = H5I_INVALID_HID;
+    hid_t                         ftid;
+    hsize_t                       dims[1]      = {DSET_SELECT_DIM};
+    hsize_t                       cdims[1]     = {DSET_SELECT_CHUNK_DIM};
+    hsize_t                       mdims[1]     = {2 * DSET_SELECT_DIM};
+    hsize_t                       start[1]     = {0};
+    hsize_t                       stride[1]    = {2};
+    hsize_t                       count[1]     = {DSET_SELECT_DIM};
+    double                        wbuf[DSET_SELECT_DIM];
+    double                        rbuf[2 * DSET_SELECT_DIM];
+    size_t                        m, l;
+    int                           i;
+
+    TESTING("H5Pget_actual_type_conv()");
+
+    /* Use the opposite byte order of the native one in the file */
+    ftid = H5T_ORDER_LE == H5Tget_order(H5T_NATIVE_DOUBLE) ? H5T_IEEE_F64BE : H5T_IEEE_F64LE;
+
+    /* Reset page buffering, set by test_get_no_selection_io_cause() */
+    if (H5Pset_page_buffer_size(fapl, 0, 0, 0) < 0)
+        FAIL_STACK_ERROR;
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Memory selection of every other element */
+    if ((msid = H5Screate_simple(1, mdims, NULL)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sselect_hyperslab(msid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        FAIL_STACK_ERROR;
+
+    for (l = 0; l < sizeof(layouts) / sizeof(layouts[0]); l++) {
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            FAIL_STACK_ERROR;
+        if (layouts[l] == H5D_CHUNKED) {
+            if (H5Pset_chunk(dcpl, 1, cdims) < 0)
+                FAIL_STACK_ERROR;
+        }
+        else if (H5Pset_layout(dcpl, layouts[l]) < 0)
+            FAIL_STACK_ERROR;
+        if ((did = H5Dcreate2(fid, dset_names[l], ftid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR;
+
+        for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+            uint32_t in_place = layouts[l] == H5D_COMPACT ? H5D_TYPE_CONV_BUFFER : H5D_TYPE_CONV_IN_PLACE;
+
+            if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+                FAIL_STACK_ERROR;
+            if (H5Pset_selection_io(dxpl, modes[m]) < 0)
+                FAIL_STACK_ERROR;
+
+            /* Make the type conversion buffer smaller than the data */
+            if (H5Pset_buffer(dxpl, (size_t)DSET_SELECT_CHUNK_DIM * sizeof(double), NULL, NULL) < 0)
+                FAIL_STACK_ERROR;
+
+            for (i = 0; i < DSET_SELECT_DIM; i++)
+                wbuf[i] = (double)i * 1.5 + (double)m;
+
+            /* Write without modifying the write buffer */
+            if (H5Dwrite(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, wbuf) < 0)
+                FAIL_STACK_ERROR;
+            if (check_actual_type_conv(dxpl, H5D_TYPE_CONV_BUFFER, "write", dset_names[l]) < 0)
+                goto error;
+
+            /* Read into a contiguous memory selection */
+            memset(rbuf, 0, sizeof(rbuf));
+            if (H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+                FAIL_STACK_ERROR;
+            if (check_actual_type_conv(dxpl, in_place, "read", dset_names[l]) < 0)
+                goto error;
+            for (i = 0; i < DSET_SELECT_DIM; i++)
+                if (!H5_DBL_ABS_EQUAL(rbuf[i], wbuf[i])) {
+                    H5_FAILED();
+                    printf("    Read different values than written at index %d of %s.\n", i, dset_names[l]);
+                    TEST_ERROR;
+                }
+
+            /* Read into a strided memory selection */
+            memset(rbuf, 0, sizeof(rbuf));
+            if (H5Dread(did, H5T_NATIVE_DOUBLE, msid, H5S_ALL, dxpl, rbuf) < 0)
+                FAIL_STACK_ERROR;
+            if (check_actual_type_conv(dxpl, H5D_TYPE_CONV_BUFFER, "strided read", dset_names[l]) < 0)
+                goto error;
+            for (i = 0; i < DSET_SELECT_DIM; i++)
+                if (!H5_DBL_ABS_EQUAL(rbuf[2 * i], wbuf[i]) || !H5_DBL_ABS_EQUAL(rbuf[2 * i + 1], 0.0)) {
+                    H5_FAILED();
+                    printf("    Read different values than written at index %d of %s.\n", i, dset_names[l]);
+                    TEST_ERROR;
+                }
+
+            /* Read without type conversion */
+            if (H5Dread(did, ftid, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+                FAIL_STACK_ERROR;
+            if (check_actual_type_conv(dxpl, 0, "unconverted read", dset_names[l]) < 0)
+                goto error;
+
+            /* Write, allowing the library to modify the write buffer */
+            if (H5Pset_modify_write_buf(dxpl, TRUE) < 0)
+                FAIL_STACK_ERROR;
+            if (H5Dwrite(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, wbuf) < 0)
+                FAIL_STACK_ERROR;
+            if (check_actual_type_conv(dxpl, in_place, "modifying write", dset_names[l]) < 0)
+                goto error;
+
+            /* The data still reads back */
+            for (i = 0; i < DSET_SELECT_DIM; i++)
+                wbuf[i] = (double)i * 1.5 + (double)m;
+            if (H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+                FAIL_STACK_ERROR;
+            for (i = 0; i < DSET_SELECT_DIM; i++)
+                if (!H5_DBL_ABS_EQUAL(rbuf[i], wbuf[i])) {
+                    H5_FAILED();
+                    printf("    Read different values than written at index %d of %s.\n", i, dset_names[l]);
+                    TEST_ERROR;
+                }
+
+            if (H5Pclose(dxpl) < 0)
+                FAIL_STACK_ERROR;
+        }
+
+        if (H5Dclose(did) < 0)
+            FAIL_STACK_ERROR;
+        if (H5Pclose(dcpl) < 0)
+            FAIL_STACK_ERROR;
+    }
+
+    if (H5Sclose(msid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl);
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+
+    return FAIL;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -3271,6 +3495,8 @@ main(void)
     /* Use own file */
     nerrors += test_get_no_selection_io_cause(filename, fapl);
 
+    nerrors += test_get_actual_type_conv(filename, fapl);
+
     if (nerrors)
         goto error;
 
@@ -62,6 +62,17 @@
 /* Number of random hyperslab tests performed */
 #define NRAND_HYPER 100
 
+/* Chunked 2-D dataset for sorting point selections */
+#define POINT_SORT_DIM     20
+#define POINT_SORT_CHUNK   5
+#define POINT_SORT_NPOINTS 300
+
+/* 2-D memory buffer for strided memory selections */
+#define STRIDED_MEM_DIM1  16
+#define STRIDED_MEM_DIM2  24
+#define STRIDED_MEM_CHUNK 10
+#define STRIDED_MEM_NSEL  6
+
 /* 5-D dataset with fixed dimensions */
 #define SPACE5_NAME "Space5"
 #define SPACE5_RANK 5
@@ -15818,6 +15829,610 @@ test_select_intersect_block(void)
     CHECK(ret, FAIL, "H5Sclose");
 } /* test_select_intersect_block() */
 
+/****************************************************************
+**
+**  select_blocks_to_map(): Mark the elements selected in a 3-D
+**      dataspace, for test_select_hyper_blocklist().
+**
+****************************************************************/
+static void
+select_blocks_to_map(hid_t sid, uint8_t *map)
+{
+    hsize_t *blocks = NULL; /* List of blocks selected */
+    hssize_t nblocks;       /* # of blocks selected */
+    hsize_t  i, x, y, z;    /* Local index variables */
+    herr_t   ret;           /* Generic return value */
+
+    memset(map, 0, SPACE4_DIM1 * SPACE4_DIM2 * SPACE4_DIM3);
+    if (H5Sget_select_type(sid) == H5S_SEL_NONE)
+        return;
+
+    nblocks = H5Sget_select_hyper_nblocks(sid);
+    CHECK(nblocks, FAIL, "H5Sget_select_hyper_nblocks");
+    if (nblocks <= 0)
+        return;
+    blocks = (hsize_t *)malloc((size_t)nblocks * 2 * SPACE4_RANK * sizeof(hsize_t));
+    CHECK_PTR(blocks, "malloc");
+    ret = H5Sget_select_hyper_blocklist(sid, (hsize_t)0, (hsize_t)nblocks, blocks);
+    CHECK(ret, FAIL, "H5Sget_select_hyper_blocklist");
+
+    for (i = 0; i < (hsize_t)nblocks; i++) {
+        const hsize_t *blk = blocks + i * 2 * SPACE4_RANK;
+
+        for (x = blk[0]; x <= blk[3]; x++)
+            for (y = blk[1]; y <= blk[4]; y++)
+                for (z = blk[2]; z <= blk[5]; z++)
+                    map[(x * SPACE4_DIM2 + y) * SPACE4_DIM3 + z]++;
+    } /* end for */
+
+    free(blocks);
+} /* select_blocks_to_map() */
+
+/****************************************************************
+**
+**  test_select_hyper_blocklist(): Test selecting lists of blocks
+**      with H5Sselect_hyper_blocklist(), against selecting each
+**      block with H5Sselect_hyperslab().
+**
+****************************************************************/
+static void
+test_select_hyper_blocklist(void)
+{
+    hid_t         sid1, sid2, sid3;   /* Dataspace IDs */
+    hsize_t       dims[SPACE4_RANK] = {SPACE4_DIM1, SPACE4_DIM2, SPACE4_DIM3}; /* Dataspace dimensions */
+    hsize_t       blocks[NHYPERSLABS * 4 * 2 * SPACE4_RANK];                  /* List of blocks */
+    hsize_t       start[SPACE4_RANK];  /* Starting location of hyperslab */
+    hsize_t       stride[SPACE4_RANK]; /* Stride of hyperslab */
+    hsize_t       count[SPACE4_RANK];  /* Element count of hyperslab */
+    hsize_t       block[SPACE4_RANK];  /* Block size of hyperslab */
+    uint8_t      *map1, *map2;         /* Elements selected */
+    size_t        nblocks;             /* # of blocks in list */
+    H5S_seloper_t op;                  /* Selection operation */
+    unsigned      seed;                /* Random # seed */
+    unsigned      test_num;            /* Test # */
+    size_t        i, j;                /* Local index variables */
+    hssize_t      npoints1, npoints2;  /* # of elements selected */
+    H5S_sel_type  sel_type;            /* Selection type */
+    htri_t        check;               /* Regular hyperslab check return value */
+    herr_t        ret;                 /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Selecting Lists of Blocks\n"));
+
+    map1 = (uint8_t *)malloc(SPACE4_DIM1 * SPACE4_DIM2 * SPACE4_DIM3);
+    CHECK_PTR(map1, "malloc");
+    map2 = (uint8_t *)malloc(SPACE4_DIM1 * SPACE4_DIM2 * SPACE4_DIM3);
+    CHECK_PTR(map2, "malloc");
+
+    sid1 = H5Screate_simple(SPACE4_RANK, dims, NULL);
+    CHECK(sid1, FAIL, "H5Screate_simple");
+    sid2 = H5Screate_simple(SPACE4_RANK, dims, NULL);
+    CHECK(sid2, FAIL, "H5Screate_simple");
+    sid3 = H5Screate_simple(SPACE4_RANK, dims, NULL);
+    CHECK(sid3, FAIL, "H5Screate_simple");
+
+    /* Try bad parameters */
+    blocks[0] = 2;
+    blocks[1] = 2;
+    blocks[2] = 2;
+    blocks[3] = 1; /* End before start */
+    blocks[4] = 3;
+    blocks[5] = 3;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_SET, 1, blocks);
+    }
+    H5E_END_TRY
+    VERIFY(ret, FAIL, "H5Sselect_hyper_blocklist");
+    H5E_BEGIN_TRY
+    {
+        ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_SET, 1, NULL);
+    }
+    H5E_END_TRY
+    VERIFY(ret, FAIL, "H5Sselect_hyper_blocklist");
+
+    /* A list of blocks forming a regular hyperslab, in reverse order */
+    nblocks = 0;
+    for (i = 3; i > 0; i--)
+        for (j = 4; j > 0; j--) {
+            hsize_t *blk = blocks + nblocks * 2 * SPACE4_RANK;
+
+            blk[0] = 1 + (i - 1) * 3;
+            blk[1] = 2 + (j - 1) * 3;
+            blk[2] = 0;
+            blk[3] = blk[0] + 1;
+            blk[4] = blk[1] + 1;
+            blk[5] = SPACE4_DIM3 - 1;
+            nblocks++;
+        } /* end for */
+    ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_SET, nblocks, blocks);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    check = H5Sis_regular_hyperslab(sid1);
+    VERIFY(check, TRUE, "H5Sis_regular_hyperslab");
+    ret = H5Sget_regular_hyperslab(sid1, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sget_regular_hyperslab");
+    VERIFY(start[0], 1, "H5Sget_regular_hyperslab");
+    VERIFY(start[1], 2, "H5Sget_regular_hyperslab");
+    VERIFY(stride[0], 3, "H5Sget_regular_hyperslab");
+    VERIFY(stride[1], 3, "H5Sget_regular_hyperslab");
+    VERIFY(count[0], 3, "H5Sget_regular_hyperslab");
+    VERIFY(count[1], 4, "H5Sget_regular_hyperslab");
+    VERIFY(block[0], 2, "H5Sget_regular_hyperslab");
+    VERIFY(block[1], 2, "H5Sget_regular_hyperslab");
+    VERIFY(block[2], SPACE4_DIM3, "H5Sget_regular_hyperslab");
+    npoints1 = H5Sget_select_npoints(sid1);
+    VERIFY(npoints1, 12 * 4 * SPACE4_DIM3, "H5Sget_select_npoints");
+
+    /* An empty list selects nothing */
+    ret = H5Sselect_hyper_blocklist(sid1, H5S_SELECT_SET, 0, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+    sel_type = H5Sget_select_type(sid1);
+    VERIFY(sel_type, H5S_SEL_NONE, "H5Sget_select_type");
+
+    /* Get initial random # seed */
+    seed = (unsigned)HDtime(NULL) + (unsigned)HDclock();
+
+    /* Compare random lists of overlapping blocks, with each selection operation */
+    for (test_num = 0; test_num < NRAND_HYPER; test_num++) {
+        /* Save random # seed for later use */
+        /* (Used in case of errors, to regenerate the list of blocks) */
+        seed += (unsigned)HDclock();
+        HDsrandom(seed);
+
+        /* Select the blocks one at a time, in sid2 */
+        nblocks = (size_t)(HDrandom() % (NHYPERSLABS * 4)) + 1;
+        for (i = 0; i < nblocks; i++) {
+            hsize_t *blk = blocks + i * 2 * SPACE4_RANK;
+
+            for (j = 0; j < SPACE4_RANK; j++) {
+                blk[j]               = (hsize_t)HDrandom() % dims[j];
+                blk[SPACE4_RANK + j] = blk[j] + ((hsize_t)HDrandom() % (dims[j] - blk[j]));
+                start[j]             = blk[j];
+                count[j]             = blk[SPACE4_RANK + j] - blk[j] + 1;
+            } /* end for */
+            ret = H5Sselect_hyperslab(sid2, (i == 0 ? H5S_SELECT_SET : H5S_SELECT_OR), start, NULL, count,
+                                      NULL);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        } /* end for */
+
+        /* Combine a regular selection with the blocks in sid1 and sid3 */
+        op = (H5S_seloper_t)(H5S_SELECT_SET + (int)(test_num % (H5S_SELECT_NOTA - H5S_SELECT_SET + 1)));
+        for (j = 0; j < SPACE4_RANK; j++) {
+            start[j]  = (hsize_t)HDrandom() % 3;
+            stride[j] = 3;
+            count[j]  = (dims[j] - start[j]) / 3;
+            block[j]  = 2;
+        } /* end for */
+        ret = H5Sselect_hyperslab(sid1, H5S_SELECT_SET, start, stride, count, block);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        ret = H5Sselect_hyperslab(sid3, H5S_SELECT_SET, start, stride, count, block);
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+
+        ret = H5Sselect_hyper_blocklist(sid1, op, nblocks, blocks);
+        CHECK(ret, FAIL, "H5Sselect_hyper_blocklist");
+        if (op == H5S_SELECT_SET) {
+            ret = H5Sselect_copy(sid3, sid2);
+            CHECK(ret, FAIL, "H5Sselect_copy");
+        } /* end if */
+        else {
+            ret = H5Smodify_select(sid3, op, sid2);
+            CHECK(ret, FAIL, "H5Smodify_select");
+        } /* end else */
+
+        /* Verify the same elements are selected */
+        npoints1 = H5Sget_select_npoints(sid1);
+        npoints2 = H5Sget_select_npoints(sid3);
+        VERIFY(npoints1, npoints2, "H5Sget_select_npoints");
+        select_blocks_to_map(sid1, map1);
+        select_blocks_to_map(sid3, map2);
+        if (memcmp(map1, map2, SPACE4_DIM1 * SPACE4_DIM2 * SPACE4_DIM3) != 0)
+            TestErrPrintf("Selected elements differ, op = %d, random seed = %u\n", (int)op, seed);
+        for (i = 0; i < SPACE4_DIM1 * SPACE4_DIM2 * SPACE4_DIM3; i++)
+            if (map1[i] > 1) {
+                TestErrPrintf("Blocks of selection overlap, random seed = %u\n", seed);
+                break;
+            } /* end if */
+
+        /* Stop if any errors */
+        if (GetTestNumErrs() > 0)
+            break;
+    } /* end for */
+
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid2);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid3);
+    CHECK(ret, FAIL, "H5Sclose");
+    free(map1);
+    free(map2);
+} /* test_select_hyper_blocklist() */
+
+/****************************************************************
+**
+**  test_select_point_sort(): Test sorting point selections with
+**      H5Ssort_elements(), and reading the elements of sorted
+**      and unsorted point selections from a chunked dataset.
+**
+****************************************************************/
+static void
+test_select_point_sort(void)
+{
+    hid_t    fid;                                         /* File ID */
+    hid_t    dcpl;                                        /* Dataset creation property list ID */
+    hid_t    did;                                         /* Dataset ID */
+    hid_t    sid, sid_sorted, mid;                        /* Dataspace IDs */
+    hid_t    iter_id;                                     /* Selection iterator ID */
+    hsize_t  dims[2]  = {POINT_SORT_DIM, POINT_SORT_DIM}; /* Dataspace dimensions */
+    hsize_t  cdims[2] = {POINT_SORT_CHUNK, POINT_SORT_CHUNK}; /* Chunk dimensions */
+    hsize_t  mdims[1] = {POINT_SORT_NPOINTS};                 /* Memory dataspace dimensions */
+    hsize_t(*coord)[2];                                       /* Coordinates of points */
+    hsize_t(*sorted)[2];                                      /* Coordinates of sorted points */
+    int      wbuf[POINT_SORT_DIM][POINT_SORT_DIM];            /* Dataset contents */
+    int      rbuf[POINT_SORT_NPOINTS];                        /* Elements read */
+    uint8_t  map[POINT_SORT_DIM][POINT_SORT_DIM];             /* Times each element is selected */
+    hsize_t  off[POINT_SORT_DIM];                             /* Sequence offsets */
+    size_t   len[POINT_SORT_DIM];                             /* Sequence lengths */
+    size_t   nseq, nbytes;                                    /* # of sequences / bytes */
+    hssize_t npoints;                                         /* # of points selected */
+    size_t   nunique;                                         /* # of distinct points */
+    size_t   i, j;                                            /* Local index variables */
+    herr_t   ret;                                             /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Sorting Point Selections\n"));
+
+    coord = (hsize_t(*)[2])malloc(POINT_SORT_NPOINTS * sizeof(coord[0]));
+    CHECK_PTR(coord, "malloc");
+    sorted = (hsize_t(*)[2])malloc(POINT_SORT_NPOINTS * sizeof(sorted[0]));
+    CHECK_PTR(sorted, "malloc");
+
+    /* Create a chunked dataset with a known value in each element */
+    for (i = 0; i < POINT_SORT_DIM; i++)
+        for (j = 0; j < POINT_SORT_DIM; j++)
+            wbuf[i][j] = (int)(i * POINT_SORT_DIM + j);
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, H5I_INVALID_HID, "H5Fcreate");
+    sid = H5Screate_simple(2, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, 2, cdims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    did = H5Dcreate2(fid, "point_sort", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Can't sort selections that aren't point selections */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Ssort_elements(sid, TRUE);
+    }
+    H5E_END_TRY
+    VERIFY(ret, FAIL, "H5Ssort_elements");
+
+    /* Select random points, some of them more than once, in pieces */
+    memset(map, 0, sizeof(map));
+    for (i = 0; i < POINT_SORT_NPOINTS; i++) {
+        coord[i][0] = (hsize_t)HDrandom() % POINT_SORT_DIM;
+        coord[i][1] = (hsize_t)HDrandom() % POINT_SORT_DIM;
+        map[coord[i][0]][coord[i][1]]++;
+    } /* end for */
+    ret = H5Sselect_elements(sid, H5S_SELECT_SET, POINT_SORT_NPOINTS / 3,
+                             (const hsize_t *)coord[POINT_SORT_NPOINTS / 3]);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+    ret = H5Sselect_elements(sid, H5S_SELECT_PREPEND, POINT_SORT_NPOINTS / 3, (const hsize_t *)coord);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+    for (i = 2 * (POINT_SORT_NPOINTS / 3); i < POINT_SORT_NPOINTS; i++) {
+        ret = H5Sselect_elements(sid, H5S_SELECT_APPEND, (size_t)1, (const hsize_t *)coord[i]);
+        CHECK(ret, FAIL, "H5Sselect_elements");
+    } /* end for */
+    npoints = H5Sget_select_npoints(sid);
+    VERIFY(npoints, POINT_SORT_NPOINTS, "H5Sget_select_npoints");
+
+    /* Check that the points are in the order they were selected in */
+    ret = H5Sget_select_elem_pointlist(sid, (hsize_t)0, (hsize_t)POINT_SORT_NPOINTS, (hsize_t *)sorted);
+    CHECK(ret, FAIL, "H5Sget_select_elem_pointlist");
+    if (memcmp(sorted, coord, POINT_SORT_NPOINTS * sizeof(coord[0])) != 0)
+        TestErrPrintf("point list doesn't match the points selected\n");
+    ret = H5Sget_select_elem_pointlist(sid, (hsize_t)(POINT_SORT_NPOINTS - 2), (hsize_t)10,
+                                       (hsize_t *)sorted);
+    CHECK(ret, FAIL, "H5Sget_select_elem_pointlist");
+    if (memcmp(sorted, coord[POINT_SORT_NPOINTS - 2], 2 * sizeof(coord[0])) != 0)
+        TestErrPrintf("end of point list doesn't match the points selected\n");
+
+    /* Read the points in the order they were selected in */
+    mid = H5Screate_simple(1, mdims, NULL);
+    CHECK(mid, H5I_INVALID_HID, "H5Screate_simple");
+    ret = H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    for (i = 0; i < POINT_SORT_NPOINTS; i++)
+        if (rbuf[i] != wbuf[coord[i][0]][coord[i][1]])
+            TestErrPrintf("point %zu: read %d, expected %d\n", i, rbuf[i], wbuf[coord[i][0]][coord[i][1]]);
+
+    /* Sort the points, keeping duplicates */
+    sid_sorted = H5Scopy(sid);
+    CHECK(sid_sorted, H5I_INVALID_HID, "H5Scopy");
+    ret = H5Ssort_elements(sid_sorted, FALSE);
+    CHECK(ret, FAIL, "H5Ssort_elements");
+    npoints = H5Sget_select_npoints(sid_sorted);
+    VERIFY(npoints, POINT_SORT_NPOINTS, "H5Sget_select_npoints");
+    ret = H5Sget_select_elem_pointlist(sid_sorted, (hsize_t)0, (hsize_t)npoints, (hsize_t *)sorted);
+    CHECK(ret, FAIL, "H5Sget_select_elem_pointlist");
+    for (i = 0; i < (size_t)npoints; i++) {
+        if (i > 0 && (sorted[i][0] < sorted[i - 1][0] ||
+                      (sorted[i][0] == sorted[i - 1][0] && sorted[i][1] < sorted[i - 1][1])))
+            TestErrPrintf("point %zu is out of order\n", i);
+        map[sorted[i][0]][sorted[i][1]]--;
+    } /* end for */
+    for (i = 0; i < POINT_SORT_DIM; i++)
+        for (j = 0; j < POINT_SORT_DIM; j++)
+            if (map[i][j] != 0)
+                TestErrPrintf("element (%zu,%zu) selected the wrong number of times\n", i, j);
+
+    /* Sort the points, removing duplicates */
+    for (i = 0, nunique = 0; i < POINT_SORT_NPOINTS; i++) {
+        if (map[coord[i][0]][coord[i][1]] == 0)
+            nunique++;
+        map[coord[i][0]][coord[i][1]] = 1;
+    } /* end for */
+    ret = H5Ssort_elements(sid, TRUE);
+    CHECK(ret, FAIL, "H5Ssort_elements");
+    npoints = H5Sget_select_npoints(sid);
+    VERIFY(npoints, nunique, "H5Sget_select_npoints");
+    ret = H5Sget_select_elem_pointlist(sid, (hsize_t)0, (hsize_t)npoints, (hsize_t *)sorted);
+    CHECK(ret, FAIL, "H5Sget_select_elem_pointlist");
+    for (i = 0; i < (size_t)npoints; i++) {
+        if (i > 0 && (sorted[i][0] < sorted[i - 1][0] ||
+                      (sorted[i][0] == sorted[i - 1][0] && sorted[i][1] <= sorted[i - 1][1])))
+            TestErrPrintf("point %zu is out of order or duplicated\n", i);
+        if (map[sorted[i][0]][sorted[i][1]] != 1)
+            TestErrPrintf("point %zu wasn't selected\n", i);
+    } /* end for */
+
+    /* Read the sorted points, which are in order in the file */
+    mdims[0] = (hsize_t)npoints;
+    ret      = H5Sset_extent_simple(mid, 1, mdims, NULL);
+    CHECK(ret, FAIL, "H5Sset_extent_simple");
+    ret = H5Dread(did, H5T_NATIVE_INT, mid, sid, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    for (i = 0; i < (size_t)npoints; i++)
+        if (rbuf[i] != wbuf[sorted[i][0]][sorted[i][1]])
+            TestErrPrintf("sorted point %zu: read %d, expected %d\n", i, rbuf[i],
+                          wbuf[sorted[i][0]][sorted[i][1]]);
+
+    /* Select a row of points in reverse order, which become one sequence when sorted */
+    for (i = 0; i < POINT_SORT_DIM; i++) {
+        coord[i][0] = 3;
+        coord[i][1] = POINT_SORT_DIM - 1 - i;
+    } /* end for */
+    ret = H5Sselect_elements(sid, H5S_SELECT_SET, POINT_SORT_DIM, (const hsize_t *)coord);
+    CHECK(ret, FAIL, "H5Sselect_elements");
+    iter_id = H5Ssel_iter_create(sid, sizeof(int), 0);
+    CHECK(iter_id, H5I_INVALID_HID, "H5Ssel_iter_create");
+    ret = H5Ssel_iter_get_seq_list(iter_id, (size_t)POINT_SORT_DIM, (size_t)POINT_SORT_DIM, &nseq, &nbytes,
+                                   off, len);
+    CHECK(ret, FAIL, "H5Ssel_iter_get_seq_list");
+    VERIFY(nseq, POINT_SORT_DIM, "H5Ssel_iter_get_seq_list");
+    VERIFY(nbytes, POINT_SORT_DIM, "H5Ssel_iter_get_seq_list");
+    ret = H5Ssel_iter_close(iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+
+    ret = H5Ssort_elements(sid, TRUE);
+    CHECK(ret, FAIL, "H5Ssort_elements");
+    iter_id = H5Ssel_iter_create(sid, sizeof(int), 0);
+    CHECK(iter_id, H5I_INVALID_HID, "H5Ssel_iter_create");
+    ret = H5Ssel_iter_get_seq_list(iter_id, (size_t)POINT_SORT_DIM, (size_t)POINT_SORT_DIM, &nseq, &nbytes,
+                                   off, len);
+    CHECK(ret, FAIL, "H5Ssel_iter_get_seq_list");
+    VERIFY(nseq, 1, "H5Ssel_iter_get_seq_list");
+    VERIFY(nbytes, POINT_SORT_DIM, "H5Ssel_iter_get_seq_list");
+    VERIFY(off[0], 3 * POINT_SORT_DIM * sizeof(int), "H5Ssel_iter_get_seq_list");
+    VERIFY(len[0], POINT_SORT_DIM * sizeof(int), "H5Ssel_iter_get_seq_list");
+    ret = H5Ssel_iter_close(iter_id);
+    CHECK(ret, FAIL, "H5Ssel_iter_close");
+
+    ret = H5Sclose(mid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid_sorted);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    free(coord);
+    free(sorted);
+} /* test_select_point_sort() */
+
+/****************************************************************
+**
+**  test_select_strided_mem(): Test writing & reading with strided
+**      hyperslab selections in memory, whose elements are copied as
+**      runs of sequences at constant strides, for elements of 1, 2,
+**      3, 4, 8 & 16 bytes, with & without datatype conversion.
+**
+****************************************************************/
+static void
+test_select_strided_mem(void)
+{
+    /* The memory selections: runs along the rows, runs down the columns, and an irregular selection */
+    const hsize_t sel[STRIDED_MEM_NSEL - 1][4][2] = {
+        {{0, 1}, {1, 3}, {16, 8}, {1, 1}}, /* Every 3rd element of each row */
+        {{1, 0}, {1, 5}, {7, 4}, {1, 2}},  /* Pairs of elements in some rows */
+        {{2, 5}, {1, 1}, {1, 1}, {12, 2}}, /* Two columns in one block */
+        {{1, 7}, {2, 1}, {8, 1}, {1, 1}},  /* One column in every other row */
+        {{0, 3}, {4, 1}, {4, 1}, {3, 1}}   /* One column in blocks of rows */
+    };
+    const size_t  esize[]     = {1, 2, 4, 8, 3, 16}; /* Element sizes */
+    const hid_t   le_types[]  = {H5T_STD_U8LE, H5T_STD_U16LE, H5T_STD_U32LE, H5T_STD_U64LE};
+    const hid_t   be_types[]  = {H5T_STD_U8BE, H5T_STD_U16BE, H5T_STD_U32BE, H5T_STD_U64BE};
+    hsize_t       mdims[2]    = {STRIDED_MEM_DIM1, STRIDED_MEM_DIM2}; /* Memory dataspace dimensions */
+    hsize_t       cdims[1];                                           /* Chunk dimensions */
+    hsize_t       fdims[1];                                           /* File dataspace dimensions */
+    hid_t         fid;                                                /* File ID */
+    hid_t         dcpl;                                               /* Dataset creation property list */
+    hid_t         dxpl;                                               /* Dataset transfer property list */
+    hid_t         mid, fsid;                                          /* Dataspace IDs */
+    hid_t         did;                                                /* Dataset ID */
+    hid_t         mtid, ftid;                                         /* Datatype IDs */
+    uint8_t      *wbuf, *rbuf, *fbuf;                                 /* Buffers written & read */
+    hbool_t      *mask;                                               /* Whether elements are selected */
+    char          dname[32];                                          /* Dataset name */
+    unsigned      s_idx, t, conv, layout, small_buf;                  /* Local index variables */
+    size_t        i, j, k, n;                                         /* Local index variables */
+    herr_t        ret;                                                /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing Strided Memory Selections\n"));
+
+    wbuf = (uint8_t *)malloc(STRIDED_MEM_DIM1 * STRIDED_MEM_DIM2 * 16);
+    CHECK_PTR(wbuf, "malloc");
+    rbuf = (uint8_t *)malloc(STRIDED_MEM_DIM1 * STRIDED_MEM_DIM2 * 16);
+    CHECK_PTR(rbuf, "malloc");
+    fbuf = (uint8_t *)malloc(STRIDED_MEM_DIM1 * STRIDED_MEM_DIM2 * 16);
+    CHECK_PTR(fbuf, "malloc");
+    mask = (hbool_t *)malloc(STRIDED_MEM_DIM1 * STRIDED_MEM_DIM2 * sizeof(hbool_t));
+    CHECK_PTR(mask, "malloc");
+
+    for (i = 0; i < STRIDED_MEM_DIM1 * STRIDED_MEM_DIM2 * 16; i++)
+        wbuf[i] = (uint8_t)(i * 7 + 1);
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, H5I_INVALID_HID, "H5Fcreate");
+    mid = H5Screate_simple(2, mdims, NULL);
+    CHECK(mid, H5I_INVALID_HID, "H5Screate_simple");
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(dxpl, H5I_INVALID_HID, "H5Pcreate");
+
+    for (s_idx = 0; s_idx < STRIDED_MEM_NSEL; s_idx++) {
+        hssize_t npoints; /* # of elements selected */
+
+        /* Select the elements in memory */
+        if (s_idx < STRIDED_MEM_NSEL - 1)
+            ret = H5Sselect_hyperslab(mid, H5S_SELECT_SET, sel[s_idx][0], sel[s_idx][1], sel[s_idx][2],
+                                      sel[s_idx][3]);
+        else {
+            ret = H5Sselect_hyperslab(mid, H5S_SELECT_SET, sel[0][0], sel[0][1], sel[0][2], sel[0][3]);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+            ret = H5Sselect_hyperslab(mid, H5S_SELECT_OR, sel[4][0], sel[4][1], sel[4][2], sel[4][3]);
+        }
+        CHECK(ret, FAIL, "H5Sselect_hyperslab");
+        npoints = H5Sget_select_npoints(mid);
+        CHECK(npoints, FAIL, "H5Sget_select_npoints");
+        fdims[0] = (hsize_t)npoints;
+        cdims[0] = MIN(fdims[0], STRIDED_MEM_CHUNK);
+        fsid     = H5Screate_simple(1, fdims, NULL);
+        CHECK(fsid, H5I_INVALID_HID, "H5Screate_simple");
+
+        /* Find the selected elements */
+        for (i = 0; i < STRIDED_MEM_DIM1; i++)
+            for (j = 0; j < STRIDED_MEM_DIM2; j++) {
+                hsize_t coord[2] = {i, j};
+                htri_t  status   = H5Sselect_intersect_block(mid, coord, coord);
+
+                CHECK(status, FAIL, "H5Sselect_intersect_block");
+                mask[i * STRIDED_MEM_DIM2 + j] = (status > 0);
+            }
+
+        for (t = 0; t < NELMTS(esize); t++)
+            for (conv = 0; conv < (esize[t] == 3 || esize[t] == 16 ? 1U : 2U); conv++)
+                for (layout = 0; layout < 3; layout++)
+                    for (small_buf = 0; small_buf < 2; small_buf++) {
+                        size_t es = esize[t];
+
+                        /* Integers are converted to the other byte order in the file, others are opaque */
+                        if (es == 3 || es == 16) {
+                            mtid = H5Tcreate(H5T_OPAQUE, es);
+                            CHECK(mtid, H5I_INVALID_HID, "H5Tcreate");
+                            ftid = H5Tcopy(mtid);
+                        }
+                        else {
+                            mtid = H5Tcopy(le_types[t]);
+                            CHECK(mtid, H5I_INVALID_HID, "H5Tcopy");
+                            ftid = H5Tcopy(conv ? be_types[t] : le_types[t]);
+                        }
+                        CHECK(ftid, H5I_INVALID_HID, "H5Tcopy");
+
+                        dcpl = H5Pcreate(H5P_DATASET_CREATE);
+                        CHECK(dcpl, H5I_INVALID_HID, "H5Pcreate");
+                        if (layout == 1) {
+                            ret = H5Pset_layout(dcpl, H5D_COMPACT);
+                            CHECK(ret, FAIL, "H5Pset_layout");
+                        }
+                        else if (layout == 2) {
+                            ret = H5Pset_chunk(dcpl, 1, cdims);
+                            CHECK(ret, FAIL, "H5Pset_chunk");
+                        }
+
+                        /* Stop the runs of sequences where the conversion buffer is full */
+                        ret = H5Pset_buffer(dxpl, small_buf ? 7 * es : (size_t)(1024 * 1024), NULL, NULL);
+                        CHECK(ret, FAIL, "H5Pset_buffer");
+
+                        snprintf(dname, sizeof(dname), "strided_%u_%u_%u_%u_%u", s_idx, t, conv, layout,
+                                 small_buf);
+                        did = H5Dcreate2(fid, dname, ftid, fsid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+                        CHECK(did, H5I_INVALID_HID, "H5Dcreate2");
+
+                        /* Gather the selected elements into the dataset */
+                        ret = H5Dwrite(did, mtid, mid, H5S_ALL, dxpl, wbuf);
+                        CHECK(ret, FAIL, "H5Dwrite");
+
+                        /* Check that the dataset has the selected elements, in order */
+                        ret = H5Dread(did, mtid, H5S_ALL, H5S_ALL, dxpl, fbuf);
+                        CHECK(ret, FAIL, "H5Dread");
+                        for (k = 0, n = 0; k < STRIDED_MEM_DIM1 * STRIDED_MEM_DIM2; k++)
+                            if (mask[k]) {
+                                if (memcmp(fbuf + n * es, wbuf + k * es, es) != 0)
+                                    TestErrPrintf("%d: element %zu of dataset %s differs\n", __LINE__, n,
+                                                  dname);
+                                n++;
+                            }
+                        VERIFY(n, (size_t)npoints, "H5Dread");
+
+                        /* Scatter the elements back into the selection */
+                        memset(rbuf, 0, STRIDED_MEM_DIM1 * STRIDED_MEM_DIM2 * es);
+                        ret = H5Dread(did, mtid, mid, H5S_ALL, dxpl, rbuf);
+                        CHECK(ret, FAIL, "H5Dread");
+                        for (k = 0; k < STRIDED_MEM_DIM1 * STRIDED_MEM_DIM2; k++)
+                            for (n = 0; n < es; n++)
+                                if (rbuf[k * es + n] != (mask[k] ? wbuf[k * es + n] : 0)) {
+                                    TestErrPrintf("%d: element %zu read with dataset %s differs\n",
+                                                  __LINE__, k, dname);
+                                    break;
+                                }
+
+                        ret = H5Dclose(did);
+                        CHECK(ret, FAIL, "H5Dclose");
+                        ret = H5Pclose(dcpl);
+                        CHECK(ret, FAIL, "H5Pclose");
+                        ret = H5Tclose(ftid);
+                        CHECK(ret, FAIL, "H5Tclose");
+                        ret = H5Tclose(mtid);
+                        CHECK(ret, FAIL, "H5Tclose");
+                    }
+
+        ret = H5Sclose(fsid);
+        CHECK(ret, FAIL, "H5Sclose");
+    }
+
+    ret = H5Pclose(dxpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Sclose(mid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    free(wbuf);
+    free(rbuf);
+    free(fbuf);
+    free(mask);
+} /* test_select_strided_mem() */
+
 /****************************************************************
 **
 **  test_hyper_io_1d():
@@ -16238,6 +16853,15 @@ test_select(void)
     /* Test selection intersection with block  */
     test_select_intersect_block();
 
+    /* Test selecting lists of blocks */
+    test_select_hyper_blocklist();
+
+    /* Test sorting point selections */
+    test_select_point_sort();
+
+    /* Test strided memory selections */
+    test_select_strided_mem();
+
     /* Test reading of 1-d disjoint file space to 1-d single block memory space */
     test_hyper_io_1d();
 
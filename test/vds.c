@@ -28,7 +28,8 @@ typedef enum {
 
 static const char *FILENAME[] = {"vds_virt_0", "vds_virt_1", "vds_src_0",  "vds_src_1", "vds%%_src",
                                  "vds_dapl",   "vds_virt_2", "vds_virt_3", "vds_src_2", "vds_src_3",
-                                 "vds%%_src2", "vds_dapl2",  NULL};
+                                 "vds%%_src2", "vds_dapl2",  "vds_virt_4", "vds_src_4", "vds_src_5",
+                                 NULL};
 
 /* Define to enable verbose test output */
 /* #define VDS_TEST_VERBOSE 1 */
@@ -103,6 +104,12 @@ char vds_test_str_g[128]   = "";
 
 #define TMPDIR "tmp_vds/"
 
+/* Size of the dataset with many mappings, in tiles of MANY_TILE x MANY_TILE
+ * elements */
+#define MANY_NTILES 4
+#define MANY_TILE   4
+#define MANY_DIM    (MANY_NTILES * MANY_TILE)
+
 /*-------------------------------------------------------------------------
  * Function:    vds_select_equal
  *
@@ -12154,6 +12161,7 @@ test_dapl_values(hid_t fapl_id)
     hsize_t        max_dims;       /* dataset max size                     */
     H5D_vds_view_t view;           /* view from dapl                       */
     hsize_t        gap_size;       /* gap size from dapl                   */
+    size_t         max_open;       /* max # of open sources from dapl      */
     char           filename[1024]; /* file names                           */
 
     TESTING_2("H5Dget_access_plist() returns dapl w/ correct values");
@@ -12203,6 +12211,8 @@ test_dapl_values(hid_t fapl_id)
         FAIL_STACK_ERROR;
     if (H5Pset_virtual_printf_gap(dapl_id2, 123) < 0)
         FAIL_STACK_ERROR;
+    if (H5Pset_virtual_max_open_sources(dapl_id2, 7) < 0)
+        FAIL_STACK_ERROR;
 
     /* Create the datasets */
     if ((did1 = H5Dcreate2(fid, "dset1", H5T_NATIVE_INT, vds_sid, H5P_DEFAULT, dcpl_id, dapl_id1)) < 0)
@@ -12230,6 +12240,10 @@ test_dapl_values(hid_t fapl_id)
         FAIL_STACK_ERROR;
     if (H5D_VDS_FIRST_MISSING != view)
         TEST_ERROR;
+    if (H5Pget_virtual_max_open_sources(dapl_id1, &max_open) < 0)
+        FAIL_STACK_ERROR;
+    if (max_open != 0)
+        TEST_ERROR;
     /* dapl 2 */
     if (H5Pget_virtual_view(dapl_id2, &view) < 0)
         FAIL_STACK_ERROR;
@@ -12239,6 +12253,10 @@ test_dapl_values(hid_t fapl_id)
         FAIL_STACK_ERROR;
     if (gap_size != 123)
         TEST_ERROR;
+    if (H5Pget_virtual_max_open_sources(dapl_id2, &max_open) < 0)
+        FAIL_STACK_ERROR;
+    if (max_open != 7)
+        TEST_ERROR;
 
     /* Close everything */
     if (H5Sclose(vds_sid) < 0)
@@ -12277,6 +12295,402 @@ error:
     return 1;
 } /* end test_dapl_values() */
 
+/*-------------------------------------------------------------------------
+ * Function:    many_mappings_check_hyper
+ *
+ * Purpose:     Reads the block of count[0] x count[1] elements at start
+ *              from the virtual dataset and compares it with the expected
+ *              values.
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static int
+many_mappings_check_hyper(hid_t vdset, const hsize_t start[2], const hsize_t count[2],
+                          int evbuf[MANY_DIM][MANY_DIM])
+{
+    hid_t   filespace = -1;
+    hid_t   memspace  = -1;
+    int     rbuf[MANY_DIM * MANY_DIM];
+    hsize_t i, j;
+
+    if ((filespace = H5Dget_space(vdset)) < 0)
+        TEST_ERROR;
+    if (H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if ((memspace = H5Screate_simple(2, count, NULL)) < 0)
+        TEST_ERROR;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(vdset, H5T_NATIVE_INT, memspace, filespace, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    for (i = 0; i < count[0]; i++)
+        for (j = 0; j < count[1]; j++)
+            if (rbuf[i * count[1] + j] != evbuf[start[0] + i][start[1] + j])
+                TEST_ERROR;
+
+    if (H5Sclose(memspace) < 0)
+        TEST_ERROR;
+    if (H5Sclose(filespace) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(memspace);
+        H5Sclose(filespace);
+    }
+    H5E_END_TRY
+    return -1;
+} /* end many_mappings_check_hyper() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_many_mappings
+ *
+ * Purpose:     Tests I/O on a virtual dataset with a mapping for each of
+ *              its tiles, in two source files, but one unmapped tile,
+ *              and if overlap is set, a last mapping across four tiles.
+ *              The I/O only examines the mappings intersecting the
+ *              selection, and with a limit on the open source datasets,
+ *              closes and reopens them.  Without the last mapping, the
+ *              mappings are disjoint, and reads gather the source
+ *              datasets of each source file into one read.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *-------------------------------------------------------------------------
+ */
+static int
+test_many_mappings(hid_t vds_fapl, hid_t src_fapl, hbool_t overlap)
+{
+    char   *vfilename          = NULL;
+    char   *srcfilename[2]     = {NULL, NULL};
+    char   *srcfilename_map[2] = {NULL, NULL};
+    char    dset_name[32];
+    hid_t   srcfile[2]  = {-1, -1};                                     /* Files with source dsets */
+    hid_t   vfile       = -1;                                           /* File with virtual dset */
+    hid_t   dcpl        = -1;                                           /* Dataset creation property list */
+    hid_t   srcdcpl     = -1;                                           /* Chunked source dset DCPL */
+    hid_t   dapl        = -1;                                           /* Dataset access property list */
+    hid_t   dxpl        = -1;                                           /* Dataset transfer property list */
+    hid_t   srcspace    = -1;                                           /* Source dataspace */
+    hid_t   vspace      = -1;                                           /* Virtual dset dataspace */
+    hid_t   memspace    = -1;                                           /* Memory dataspace */
+    hid_t   srcdset     = -1;                                           /* Source dataset */
+    hid_t   vdset       = -1;                                           /* Virtual dataset */
+    hsize_t dims[2]     = {MANY_DIM, MANY_DIM};                         /* Virtual dset dimensions */
+    hsize_t tdims[2]    = {MANY_TILE, MANY_TILE};                       /* Tile dimensions */
+    hsize_t odims[2]    = {2, 2};                                       /* Dimensions of the last mapping */
+    hsize_t cdims[2]    = {2, 2};                                       /* Chunk dimensions */
+    hsize_t coord[5][2] = {{0, 0}, {3, 4}, {9, 13}, {12, 11}, {15, 0}}; /* Points, all mapped */
+    hsize_t npoints     = 5;                                            /* # of points */
+    hsize_t start[2];                                                   /* Hyperslab start */
+    hsize_t count[2];                                                   /* Hyperslab count */
+    int     buf[MANY_DIM * MANY_DIM];                                   /* Write buffer */
+    int     rbuf[MANY_DIM][MANY_DIM];                                   /* Read buffer */
+    short   sbuf[MANY_DIM][MANY_DIM];                                   /* Read buffer, converted */
+    int     evbuf[MANY_DIM][MANY_DIM];                                  /* Expected VDS "buffer" */
+    int     fill        = -1;                                           /* Fill value */
+    size_t  max_open;
+    int     round;
+    int     i, j, k;
+
+    if (overlap)
+        TESTING_2("I/O on a virtual dataset with many overlapping mappings");
+    else
+        TESTING_2("I/O on a virtual dataset with many disjoint mappings");
+
+    if ((vfilename = (char *)calloc(FILENAME_BUF_SIZE, sizeof(char))) == NULL)
+        TEST_ERROR;
+    for (i = 0; i < 2; i++) {
+        if ((srcfilename[i] = (char *)calloc(FILENAME_BUF_SIZE, sizeof(char))) == NULL)
+            TEST_ERROR;
+        if ((srcfilename_map[i] = (char *)calloc(FILENAME_BUF_SIZE, sizeof(char))) == NULL)
+            TEST_ERROR;
+    }
+
+    h5_fixname(FILENAME[12], vds_fapl, vfilename, FILENAME_BUF_SIZE);
+    for (i = 0; i < 2; i++) {
+        h5_fixname(FILENAME[13 + i], src_fapl, srcfilename[i], FILENAME_BUF_SIZE);
+        h5_fixname_printf(FILENAME[13 + i], src_fapl, srcfilename_map[i], FILENAME_BUF_SIZE);
+    }
+
+    /* Create DCPL */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0)
+        TEST_ERROR;
+
+    /* Create DCPL for the chunked source datasets */
+    if ((srcdcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(srcdcpl, 2, cdims) < 0)
+        TEST_ERROR;
+
+    /* Create the source files */
+    for (i = 0; i < 2; i++)
+        if ((srcfile[i] = H5Fcreate(srcfilename[i], H5F_ACC_TRUNC, H5P_DEFAULT, src_fapl)) < 0)
+            TEST_ERROR;
+
+    for (i = 0; i < MANY_DIM; i++)
+        for (j = 0; j < MANY_DIM; j++)
+            evbuf[i][j] = fill;
+
+    /* Map each tile but the last to a source dataset, alternating between
+     * the source files, with every third one chunked */
+    if ((vspace = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((srcspace = H5Screate_simple(2, tdims, NULL)) < 0)
+        TEST_ERROR;
+    for (k = 0; k < MANY_NTILES * MANY_NTILES - 1; k++) {
+        snprintf(dset_name, sizeof(dset_name), "src%d", k);
+        start[0] = (hsize_t)(k / MANY_NTILES) * MANY_TILE;
+        start[1] = (hsize_t)(k % MANY_NTILES) * MANY_TILE;
+        for (i = 0; i < MANY_TILE; i++)
+            for (j = 0; j < MANY_TILE; j++) {
+                buf[i * MANY_TILE + j]                              = k * 100 + i * MANY_TILE + j;
+                evbuf[start[0] + (hsize_t)i][start[1] + (hsize_t)j] = buf[i * MANY_TILE + j];
+            }
+
+        if ((srcdset = H5Dcreate2(srcfile[k % 2], dset_name, H5T_NATIVE_INT, srcspace, H5P_DEFAULT,
+                                  k % 3 ? H5P_DEFAULT : srcdcpl, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(srcdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR;
+        if (H5Dclose(srcdset) < 0)
+            TEST_ERROR;
+        srcdset = -1;
+
+        if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, start, NULL, tdims, NULL) < 0)
+            TEST_ERROR;
+        if (H5Pset_virtual(dcpl, vspace, srcfilename_map[k % 2], dset_name, srcspace) < 0)
+            TEST_ERROR;
+    }
+    if (H5Sclose(srcspace) < 0)
+        TEST_ERROR;
+    srcspace = -1;
+
+    /* Map the corner of four tiles again, so the last mapping wins */
+    if (overlap) {
+        if ((srcspace = H5Screate_simple(2, odims, NULL)) < 0)
+            TEST_ERROR;
+        start[0] = start[1] = MANY_TILE - 1;
+        for (i = 0; i < 2; i++)
+            for (j = 0; j < 2; j++) {
+                buf[i * 2 + j]                                      = 10000 + i * 2 + j;
+                evbuf[start[0] + (hsize_t)i][start[1] + (hsize_t)j] = buf[i * 2 + j];
+            }
+        if ((srcdset = H5Dcreate2(srcfile[0], "overlap", H5T_NATIVE_INT, srcspace, H5P_DEFAULT,
+                                  H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(srcdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR;
+        if (H5Dclose(srcdset) < 0)
+            TEST_ERROR;
+        srcdset = -1;
+        if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, start, NULL, odims, NULL) < 0)
+            TEST_ERROR;
+        if (H5Pset_virtual(dcpl, vspace, srcfilename_map[0], "overlap", srcspace) < 0)
+            TEST_ERROR;
+        if (H5Sclose(srcspace) < 0)
+            TEST_ERROR;
+        srcspace = -1;
+    }
+
+    for (i = 0; i < 2; i++) {
+        if (H5Fclose(srcfile[i]) < 0)
+            TEST_ERROR;
+        srcfile[i] = -1;
+    }
+
+    /* Create the virtual dataset */
+    if ((vfile = H5Fcreate(vfilename, H5F_ACC_TRUNC, H5P_DEFAULT, vds_fapl)) < 0)
+        TEST_ERROR;
+    if ((vdset = H5Dcreate2(vfile, "v_dset", H5T_NATIVE_INT, vspace, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dclose(vdset) < 0)
+        TEST_ERROR;
+    vdset = -1;
+    if (H5Sselect_all(vspace) < 0)
+        TEST_ERROR;
+
+    /* Read with no limit on the open source datasets, then with a limit
+     * which closes some of them after each read */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR;
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR;
+    if (H5Pset_selection_io(dxpl, H5D_SELECTION_IO_MODE_ON) < 0)
+        TEST_ERROR;
+    for (max_open = 0; max_open <= 2; max_open += 2) {
+        if (H5Pset_virtual_max_open_sources(dapl, max_open) < 0)
+            TEST_ERROR;
+        if ((vdset = H5Dopen2(vfile, "v_dset", dapl)) < 0)
+            TEST_ERROR;
+
+        /* Read twice, so the second reads reopen the source datasets */
+        for (round = 0; round < 2; round++) {
+            /* Within a tile */
+            start[0] = start[1] = 5;
+            count[0] = count[1] = 2;
+            if (many_mappings_check_hyper(vdset, start, count, evbuf) < 0)
+                TEST_ERROR;
+
+            /* Across nine tiles and the last mapping */
+            start[0] = start[1] = 2;
+            count[0] = count[1] = 6;
+            if (many_mappings_check_hyper(vdset, start, count, evbuf) < 0)
+                TEST_ERROR;
+
+            /* Within the unmapped tile */
+            start[0] = start[1] = 12;
+            count[0] = count[1] = 4;
+            if (many_mappings_check_hyper(vdset, start, count, evbuf) < 0)
+                TEST_ERROR;
+
+            /* All */
+            start[0] = start[1] = 0;
+            count[0] = count[1] = MANY_DIM;
+            if (many_mappings_check_hyper(vdset, start, count, evbuf) < 0)
+                TEST_ERROR;
+
+            /* All, converted */
+            memset(sbuf, 0, sizeof(sbuf));
+            if (H5Dread(vdset, H5T_NATIVE_SHORT, H5S_ALL, H5S_ALL, H5P_DEFAULT, sbuf) < 0)
+                TEST_ERROR;
+            for (i = 0; i < MANY_DIM; i++)
+                for (j = 0; j < MANY_DIM; j++)
+                    if (sbuf[i][j] != evbuf[i][j])
+                        TEST_ERROR;
+
+            /* All, with selection I/O, so disjoint mappings read the source
+             * datasets of each file together with any file driver */
+            memset(rbuf, 0, sizeof(rbuf));
+            if (H5Dread(vdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0)
+                TEST_ERROR;
+            memset(sbuf, 0, sizeof(sbuf));
+            if (H5Dread(vdset, H5T_NATIVE_SHORT, H5S_ALL, H5S_ALL, dxpl, sbuf) < 0)
+                TEST_ERROR;
+            for (i = 0; i < MANY_DIM; i++)
+                for (j = 0; j < MANY_DIM; j++)
+                    if (rbuf[i][j] != evbuf[i][j] || sbuf[i][j] != evbuf[i][j])
+                        TEST_ERROR;
+
+            /* Points */
+            if (H5Sselect_elements(vspace, H5S_SELECT_SET, (size_t)npoints, (const hsize_t *)coord) < 0)
+                TEST_ERROR;
+            if ((memspace = H5Screate_simple(1, &npoints, NULL)) < 0)
+                TEST_ERROR;
+            memset(rbuf, 0, sizeof(rbuf));
+            if (H5Dread(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, rbuf[0]) < 0)
+                TEST_ERROR;
+            for (k = 0; k < (int)npoints; k++)
+                if (rbuf[0][k] != evbuf[coord[k][0]][coord[k][1]])
+                    TEST_ERROR;
+            if (H5Sclose(memspace) < 0)
+                TEST_ERROR;
+            memspace = -1;
+        }
+
+        if (H5Dclose(vdset) < 0)
+            TEST_ERROR;
+        vdset = -1;
+    }
+
+    /* Write across nine tiles, with the limit.  Writes may not select elements
+     * mapped twice, so this leaves out the last mapping */
+    if ((vdset = H5Dopen2(vfile, "v_dset", dapl)) < 0)
+        TEST_ERROR;
+    start[0] = 5;
+    start[1] = 1;
+    count[0] = count[1] = 10;
+    for (i = 0; i < (int)count[0]; i++)
+        for (j = 0; j < (int)count[1]; j++) {
+            buf[i * (int)count[1] + j]                          = 20000 + i * (int)count[1] + j;
+            evbuf[start[0] + (hsize_t)i][start[1] + (hsize_t)j] = buf[i * (int)count[1] + j];
+        }
+    if (H5Sselect_hyperslab(vspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if ((memspace = H5Screate_simple(2, count, NULL)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(vdset, H5T_NATIVE_INT, memspace, vspace, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR;
+    if (H5Sclose(memspace) < 0)
+        TEST_ERROR;
+    memspace = -1;
+    if (H5Dclose(vdset) < 0)
+        TEST_ERROR;
+    vdset = -1;
+
+    /* Read the data back, without the limit */
+    if ((vdset = H5Dopen2(vfile, "v_dset", H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    start[0] = start[1] = 0;
+    count[0] = count[1] = MANY_DIM;
+    if (many_mappings_check_hyper(vdset, start, count, evbuf) < 0)
+        TEST_ERROR;
+
+    /* Close */
+    if (H5Dclose(vdset) < 0)
+        TEST_ERROR;
+    vdset = -1;
+    if (H5Fclose(vfile) < 0)
+        TEST_ERROR;
+    vfile = -1;
+    if (H5Sclose(vspace) < 0)
+        TEST_ERROR;
+    vspace = -1;
+    if (H5Pclose(dxpl) < 0)
+        TEST_ERROR;
+    dxpl = -1;
+    if (H5Pclose(dapl) < 0)
+        TEST_ERROR;
+    dapl = -1;
+    if (H5Pclose(srcdcpl) < 0)
+        TEST_ERROR;
+    srcdcpl = -1;
+    if (H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+    dcpl = -1;
+
+    free(vfilename);
+    for (i = 0; i < 2; i++) {
+        free(srcfilename[i]);
+        free(srcfilename_map[i]);
+    }
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (i = 0; i < 2; i++)
+            H5Fclose(srcfile[i]);
+        H5Dclose(srcdset);
+        H5Dclose(vdset);
+        H5Fclose(vfile);
+        H5Sclose(srcspace);
+        H5Sclose(vspace);
+        H5Sclose(memspace);
+        H5Pclose(dxpl);
+        H5Pclose(dapl);
+        H5Pclose(srcdcpl);
+        H5Pclose(dcpl);
+    }
+    H5E_END_TRY
+
+    free(vfilename);
+    for (i = 0; i < 2; i++) {
+        free(srcfilename[i]);
+        free(srcfilename_map[i]);
+    }
+
+    return 1;
+} /* end test_many_mappings() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -12419,6 +12833,8 @@ main(void)
 #endif /* VDS_TEST_VERBOSE */
 
             nerrors += test_dapl_values(vds_fapl);
+            nerrors += test_many_mappings(vds_fapl, src_fapl, TRUE);
+            nerrors += test_many_mappings(vds_fapl, src_fapl, FALSE);
 
             /* Verify symbol table messages are cached */
             nerrors += (h5_verify_cached_stabs(FILENAME, vds_fapl) < 0 ? 1 : 0);
@@ -44,6 +44,29 @@
 #define DSET2_DIM  4
 #endif /* H5_HAVE_DIRECT */
 
+/* Macros for io_uring VFD */
+#ifdef H5_HAVE_IOURING_VFD
+#define IOURING_QUEUE_DEPTH 8
+#define IOURING_NFIXED_BUFS 4
+#define IOURING_FIXED_SIZE  (4 * KB)
+#endif /* H5_HAVE_IOURING_VFD */
+
+/* Macros for the read-only mmap VFD */
+#ifdef H5_HAVE_MMAP_VFD
+#define MMAP_READAHEAD (64 * KB)
+#endif /* H5_HAVE_MMAP_VFD */
+
+/* Macros for the striping VFD */
+#ifdef H5_HAVE_STRIPE_VFD
+#define STRIPE_NMEMBERS 4
+#define STRIPE_SIZE     (4 * KB)
+#endif /* H5_HAVE_STRIPE_VFD */
+
+/* Macros for the write-behind VFD */
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+#define WRITEBEHIND_BUFFER_SIZE (64 * KB)
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
+
 static const char *FILENAME[] = {"sec2_file",            /*0*/
                                  "core_file",            /*1*/
                                  "family_file",          /*2*/
@@ -60,9 +83,15 @@ static const char *FILENAME[] = {"sec2_file",            /*0*/
                                  "splitter.log",         /*13*/
                                  "ctl_file",             /*14*/
                                  "ctl_splitter_wo_file", /*15*/
+                                 "iouring_file",         /*16*/
+                                 "mmap_file",            /*17*/
+                                 "stripe_file",          /*18*/
+                                 "writebehind_file",     /*19*/
+                                 "profile_file",         /*20*/
                                  NULL};
 
-#define LOG_FILENAME "log_vfd_out.log"
+#define LOG_FILENAME     "log_vfd_out.log"
+#define PROFILE_FILENAME "profile_vfd_out.json"
 
 #define COMPAT_BASENAME       "family_v16"
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
@@ -831,54 +860,935 @@ test_direct(void)
     if ((space2 = H5Screate_simple(1, dims2, NULL)) < 0)
         TEST_ERROR;
 
-    /* Create the dset2 */
-    if ((dset2 =
-             H5Dcreate2(file, DSET2_NAME, H5T_NATIVE_INT, space2, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+    /* Create the dset2 */
+    if ((dset2 =
+             H5Dcreate2(file, DSET2_NAME, H5T_NATIVE_INT, space2, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Write the data to the dset1 */
+    if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata2) < 0)
+        TEST_ERROR;
+
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR;
+
+    if ((dset2 = H5Dopen2(file, DSET2_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Read the data back from dset1 */
+    if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata2) < 0)
+        TEST_ERROR;
+
+    /* Check that the values read are the same as the values written */
+    for (i = 0; i < DSET2_DIM; i++)
+        if (wdata2[i] != rdata2[i]) {
+            H5_FAILED();
+            printf("    Read different values than written in data set 2.\n");
+            printf("    At index %d\n", i);
+            TEST_ERROR;
+        } /* end if */
+
+    if (H5Sclose(space1) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset1) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space2) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset2) < 0)
+        TEST_ERROR;
+
+    free(points);
+    free(check);
+
+    /* Close and delete the file */
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[5], fapl);
+
+    /* Close the fapl */
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Sclose(space1);
+        H5Dclose(dset1);
+        H5Sclose(space2);
+        H5Dclose(dset2);
+        H5Fclose(file);
+    }
+    H5E_END_TRY
+
+    if (proto_points)
+        free(proto_points);
+    if (proto_check)
+        free(proto_check);
+
+    return -1;
+#endif /*H5_HAVE_DIRECT*/
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the file handle interface for the io_uring driver,
+ *              and that data written through it in batches (contiguous
+ *              and many-chunk datasets) reads back through both the
+ *              io_uring and the sec2 drivers.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING_VFD
+    hid_t         fid = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID, fapl_id_out = H5I_INVALID_HID;
+    hid_t         sec2_fapl_id = H5I_INVALID_HID, dcpl_id = H5I_INVALID_HID;
+    hid_t         dset = H5I_INVALID_HID, space = H5I_INVALID_HID;
+    unsigned long driver_flags = 0;
+    unsigned      queue_depth, nfixed_bufs;
+    size_t        fixed_size;
+    char          filename[1024];
+    void         *os_file_handle = NULL;
+    hsize_t       dims[2]        = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t       chunk_dims[2]  = {1, DSET1_DIM2};
+    int          *points = NULL, *check = NULL;
+    int           pass, i;
+#endif /* H5_HAVE_IOURING_VFD */
+
+    TESTING("io_uring file driver");
+
+#ifndef H5_HAVE_IOURING_VFD
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_IOURING_VFD */
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_iouring(fapl_id, IOURING_QUEUE_DEPTH, IOURING_NFIXED_BUFS, IOURING_FIXED_SIZE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[16], fapl_id, filename, sizeof(filename));
+
+    /* Verify the file access properties */
+    if (H5Pget_fapl_iouring(fapl_id, &queue_depth, &nfixed_bufs, &fixed_size) < 0)
+        TEST_ERROR;
+    if (queue_depth != IOURING_QUEUE_DEPTH || nfixed_bufs != IOURING_NFIXED_BUFS ||
+        fixed_size != IOURING_FIXED_SIZE)
+        TEST_ERROR;
+
+    /* The driver should advertise the same features as sec2 */
+    if (H5FDdriver_query(H5Pget_driver(fapl_id), &driver_flags) < 0)
+        TEST_ERROR;
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
+                         H5FD_FEAT_SUPPORTS_SWMR_IO | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+        TEST_ERROR;
+
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    }
+    H5E_END_TRY
+    if (fid < 0) {
+        H5Pclose(fapl_id);
+        SKIPPED();
+        printf("  Probably the kernel doesn't support io_uring\n");
+        return 0;
+    }
+
+    /* Check that the driver is correct */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+    if (H5FD_IOURING != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+    fapl_id_out = H5I_INVALID_HID;
+
+    /* Check file handle API */
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (os_file_handle == NULL || *(int *)os_file_handle < 0)
+        TEST_ERROR;
+
+    if (NULL == (points = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    /* A contiguous dataset, larger than a staging buffer */
+    if ((dset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    /* A dataset with many small chunks, written as one batch that is much
+     * deeper than the queue and than the staging pool
+     */
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(fid, DSET3_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    fid = H5I_INVALID_HID;
+
+    /* Read both datasets back with this driver, then with sec2 */
+    if ((sec2_fapl_id = h5_fileaccess()) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_sec2(sec2_fapl_id) < 0)
+        TEST_ERROR;
+    for (pass = 0; pass < 2; pass++) {
+        if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, pass ? sec2_fapl_id : fapl_id)) < 0)
+            TEST_ERROR;
+
+        if ((dset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("contiguous dataset read back incorrectly");
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+
+        if ((dset = H5Dopen2(fid, DSET3_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("chunked dataset read back incorrectly");
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+
+        if (H5Fclose(fid) < 0)
+            TEST_ERROR;
+        fid = H5I_INVALID_HID;
+    }
+
+    h5_delete_test_file(FILENAME[16], fapl_id);
+
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(sec2_fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    free(points);
+    free(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Pclose(dcpl_id);
+        H5Pclose(sec2_fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Pclose(fapl_id);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+
+    free(points);
+    free(check);
+
+    return -1;
+#endif /* H5_HAVE_IOURING_VFD */
+} /* end test_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only mmap driver: that it refuses to create
+ *              or write files, that it lends out buffers through the
+ *              borrow buffer ctl request, and that contiguous and chunked
+ *              datasets written with sec2 read back correctly through it,
+ *              both whole and by hyperslab.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP_VFD
+    hid_t                         fid = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
+    hid_t                         fapl_id_out = H5I_INVALID_HID, sec2_fapl_id = H5I_INVALID_HID;
+    hid_t                         dcpl_id = H5I_INVALID_HID, dset = H5I_INVALID_HID;
+    hid_t                         space = H5I_INVALID_HID, mspace = H5I_INVALID_HID;
+    H5FD_t                       *file_drv = NULL;
+    H5FD_ctl_borrow_buffer_args_t args;
+    void                         *borrowed = NULL;
+    haddr_t                       dset_addr;
+    size_t                        readahead;
+    char                          filename[1024];
+    void                         *os_file_handle = NULL;
+    hsize_t                       dims[2]        = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t                       chunk_dims[2]  = {1, DSET1_DIM2};
+    hsize_t                       start[2], count[2];
+    int                          *points = NULL, *check = NULL;
+    int                           i;
+#endif /* H5_HAVE_MMAP_VFD */
+
+    TESTING("read-only mmap file driver");
+
+#ifndef H5_HAVE_MMAP_VFD
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_MMAP_VFD */
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_mmap(fapl_id, MMAP_READAHEAD) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[17], fapl_id, filename, sizeof(filename));
+
+    /* Verify the file access properties */
+    if (H5Pget_fapl_mmap(fapl_id, &readahead) < 0)
+        TEST_ERROR;
+    if (readahead != MMAP_READAHEAD)
+        TEST_ERROR;
+
+    /* The driver is read-only */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    }
+    H5E_END_TRY
+    if (fid >= 0)
+        FAIL_PUTS_ERROR("file created with the mmap driver");
+
+    /* Write the test file with sec2 */
+    if ((sec2_fapl_id = h5_fileaccess()) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_sec2(sec2_fapl_id) < 0)
+        TEST_ERROR;
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, sec2_fapl_id)) < 0)
+        TEST_ERROR;
+
+    if (NULL == (points = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    if ((dset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (HADDR_UNDEF == (dset_addr = H5Dget_offset(dset)))
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(fid, DSET3_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    fid = H5I_INVALID_HID;
+
+    /* Read-write opens must fail */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id);
+    }
+    H5E_END_TRY
+    if (fid >= 0)
+        FAIL_PUTS_ERROR("file opened read-write with the mmap driver");
+
+    /* The driver lends out the contiguous dataset's storage */
+    if (NULL == (file_drv = H5FDopen(filename, H5F_ACC_RDONLY, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR;
+    if (H5FDset_eoa(file_drv, H5FD_MEM_DRAW, H5FDget_eof(file_drv, H5FD_MEM_DRAW)) < 0)
+        TEST_ERROR;
+    args.type = H5FD_MEM_DRAW;
+    args.addr = dset_addr;
+    args.size = DSET1_DIM1 * DSET1_DIM2 * sizeof(int);
+    if (H5FDctl(file_drv, H5FD_CTL_BORROW_BUFFER_OPCODE, H5FD_CTL_FAIL_IF_UNKNOWN_FLAG, &args, &borrowed) <
+        0)
+        TEST_ERROR;
+    if (NULL == borrowed || memcmp(borrowed, points, args.size) != 0)
+        FAIL_PUTS_ERROR("borrowed buffer doesn't hold the dataset");
+
+    /* ...but not ranges past the end of the file */
+    args.addr = H5FDget_eof(file_drv, H5FD_MEM_DRAW) - 1;
+    args.size = 2;
+    if (H5FDctl(file_drv, H5FD_CTL_BORROW_BUFFER_OPCODE, H5FD_CTL_FAIL_IF_UNKNOWN_FLAG, &args, &borrowed) <
+        0)
+        TEST_ERROR;
+    if (NULL != borrowed)
+        FAIL_PUTS_ERROR("borrowed buffer extends past the end of the file");
+    if (H5FDclose(file_drv) < 0)
+        TEST_ERROR;
+    file_drv = NULL;
+
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+    if (H5FD_MMAP != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+    fapl_id_out = H5I_INVALID_HID;
+
+    /* Check file handle API */
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (os_file_handle == NULL || *(int *)os_file_handle < 0)
+        TEST_ERROR;
+
+    /* Whole contiguous dataset */
+    if ((dset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("contiguous dataset read back incorrectly");
+
+    /* Consecutive blocks of rows, then a column, which reads one element per row */
+    count[0] = DSET1_DIM1 / 8;
+    count[1] = DSET1_DIM2;
+    if ((mspace = H5Screate_simple(2, count, NULL)) < 0)
+        TEST_ERROR;
+    for (start[0] = 0, start[1] = 0; start[0] < DSET1_DIM1; start[0] += count[0]) {
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (memcmp(points + start[0] * DSET1_DIM2, check, count[0] * count[1] * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("contiguous dataset hyperslab read back incorrectly");
+    }
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR;
+
+    start[0] = 0;
+    start[1] = 3;
+    count[0] = DSET1_DIM1;
+    count[1] = 1;
+    if ((mspace = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(dset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1; i++)
+        if (check[i] != points[i * DSET1_DIM2 + 3])
+            FAIL_PUTS_ERROR("contiguous dataset column read back incorrectly");
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    mspace = H5I_INVALID_HID;
+    if (H5Sselect_all(space) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    /* Chunked dataset */
+    if ((dset = H5Dopen2(fid, DSET3_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("chunked dataset read back incorrectly");
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    fid = H5I_INVALID_HID;
+
+    h5_delete_test_file(FILENAME[17], sec2_fapl_id);
+
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(sec2_fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    free(points);
+    free(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (file_drv)
+            H5FDclose(file_drv);
+        H5Dclose(dset);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Pclose(dcpl_id);
+        H5Pclose(sec2_fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Pclose(fapl_id);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+
+    free(points);
+    free(check);
+
+    return -1;
+#endif /* H5_HAVE_MMAP_VFD */
+} /* end test_mmap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_stripe
+ *
+ * Purpose:     Tests the file handle interface for the striping driver,
+ *              that data written through it (contiguous and many-chunk
+ *              datasets) is spread over every member and reads back both
+ *              with the thread pool and serially, and that a file can't
+ *              be opened with a different stripe layout.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_stripe(void)
+{
+#ifdef H5_HAVE_STRIPE_VFD
+    hid_t     fid = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID, fapl_id_out = H5I_INVALID_HID;
+    hid_t     serial_fapl_id = H5I_INVALID_HID, dcpl_id = H5I_INVALID_HID;
+    hid_t     dset = H5I_INVALID_HID, space = H5I_INVALID_HID;
+    unsigned  nmembers, nthreads;
+    hsize_t   stripe_size, file_size;
+    char      filename[1024];
+    char      memb_name[1024 + 16];
+    void     *os_file_handle = NULL;
+    hsize_t   dims[2]        = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t   chunk_dims[2]  = {1, DSET1_DIM2};
+    h5_stat_t sb;
+    int      *points = NULL, *check = NULL;
+    int       pass, i;
+    unsigned  u;
+#endif /* H5_HAVE_STRIPE_VFD */
+
+    TESTING("striping file driver");
+
+#ifndef H5_HAVE_STRIPE_VFD
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_STRIPE_VFD */
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_stripe(fapl_id, STRIPE_NMEMBERS, STRIPE_SIZE, 0) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[18], fapl_id, filename, sizeof(filename));
+
+    /* Verify the file access properties */
+    if (H5Pget_fapl_stripe(fapl_id, &nmembers, &stripe_size, &nthreads) < 0)
+        TEST_ERROR;
+    if (nmembers != STRIPE_NMEMBERS || stripe_size != STRIPE_SIZE || nthreads != 0)
+        TEST_ERROR;
+
+    /* Out of range settings are rejected */
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_fapl_stripe(fapl_id, H5FD_STRIPE_NMEMBERS_MAX + 1, STRIPE_SIZE, 0) >= 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_stripe(fapl_id, STRIPE_NMEMBERS, STRIPE_SIZE, H5FD_STRIPE_NTHREADS_MAX + 1) >= 0)
+            TEST_ERROR;
+    }
+    H5E_END_TRY
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+    if (H5FD_STRIPE != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+    fapl_id_out = H5I_INVALID_HID;
+
+    /* Check file handle API */
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (os_file_handle == NULL || *(int *)os_file_handle < 0)
+        TEST_ERROR;
+
+    if (NULL == (points = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    /* A contiguous dataset, spanning many stripes */
+    if ((dset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    /* A dataset with many small chunks, written as one vector */
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(fid, DSET3_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    fid = H5I_INVALID_HID;
+
+    /* Every member holds its share of the file */
+    if ((file_size = (hsize_t)h5_get_file_size(filename, fapl_id)) == (hsize_t)-1)
+        TEST_ERROR;
+    if (file_size < 2 * DSET1_DIM1 * DSET1_DIM2 * sizeof(int))
+        TEST_ERROR;
+    for (u = 0; u < STRIPE_NMEMBERS; u++) {
+        HDsnprintf(memb_name, sizeof(memb_name), "%s.%u", filename, u);
+        if (HDstat(memb_name, &sb) < 0)
+            TEST_ERROR;
+        if ((hsize_t)sb.st_size < file_size / STRIPE_NMEMBERS - STRIPE_SIZE)
+            TEST_ERROR;
+    }
+
+    /* Read both datasets back with the thread pool, then serially */
+    if ((serial_fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_stripe(serial_fapl_id, STRIPE_NMEMBERS, STRIPE_SIZE, 1) < 0)
+        TEST_ERROR;
+    for (pass = 0; pass < 2; pass++) {
+        if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, pass ? serial_fapl_id : fapl_id)) < 0)
+            TEST_ERROR;
+
+        if ((dset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("contiguous dataset read back incorrectly");
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+
+        if ((dset = H5Dopen2(fid, DSET3_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("chunked dataset read back incorrectly");
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+
+        if (H5Fclose(fid) < 0)
+            TEST_ERROR;
+        fid = H5I_INVALID_HID;
+    }
+
+    /* Opening with a different stripe size must fail */
+    if (H5Pset_fapl_stripe(serial_fapl_id, STRIPE_NMEMBERS, 2 * STRIPE_SIZE, 1) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fopen(filename, H5F_ACC_RDONLY, serial_fapl_id);
+    }
+    H5E_END_TRY
+    if (fid >= 0)
+        FAIL_PUTS_ERROR("file opened with the wrong stripe layout");
+
+    h5_delete_test_file(FILENAME[18], fapl_id);
+
+    /* The members are gone */
+    HDsnprintf(memb_name, sizeof(memb_name), "%s.%u", filename, 0);
+    if (HDaccess(memb_name, F_OK) == 0)
+        TEST_ERROR;
+
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(serial_fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    free(points);
+    free(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Pclose(dcpl_id);
+        H5Pclose(serial_fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Pclose(fapl_id);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY
+
+    free(points);
+    free(check);
+
+    return -1;
+#endif /* H5_HAVE_STRIPE_VFD */
+} /* end test_stripe() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_writebehind
+ *
+ * Purpose:     Tests the file handle interface for the write-behind
+ *              driver, that rewrites of staged data read back before they
+ *              are stored, and that the file holds everything once closed.
+ *              The staging buffer is much smaller than the data, so writes
+ *              wait for space, wrap around the buffer, and bypass it.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_writebehind(void)
+{
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+    hid_t   fid = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID, fapl_id_out = H5I_INVALID_HID;
+    hid_t   under_fapl_id = H5I_INVALID_HID, core_fapl_id = H5I_INVALID_HID, dcpl_id = H5I_INVALID_HID;
+    hid_t   dset = H5I_INVALID_HID, space = H5I_INVALID_HID, mspace = H5I_INVALID_HID;
+    size_t  buffer_size;
+    char    filename[1024];
+    void   *os_file_handle = NULL;
+    hsize_t dims[2]        = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t chunk_dims[2]  = {1, DSET1_DIM2};
+    hsize_t start[2]       = {DSET1_DIM1 / 4, 0};
+    hsize_t count[2]       = {DSET1_DIM1 / 2, DSET1_DIM2};
+    int    *points = NULL, *check = NULL;
+    int     pass, i;
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
+
+    TESTING("write-behind file driver");
+
+#ifndef H5_HAVE_WRITEBEHIND_VFD
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_WRITEBEHIND_VFD */
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_writebehind(fapl_id, H5P_DEFAULT, WRITEBEHIND_BUFFER_SIZE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[19], fapl_id, filename, sizeof(filename));
+
+    /* Verify the file access properties */
+    if (H5Pget_fapl_writebehind(fapl_id, &under_fapl_id, &buffer_size) < 0)
+        TEST_ERROR;
+    if (buffer_size != WRITEBEHIND_BUFFER_SIZE)
+        TEST_ERROR;
+    if (H5FD_SEC2 != H5Pget_driver(under_fapl_id))
+        TEST_ERROR;
+    if (H5Pclose(under_fapl_id) < 0)
+        TEST_ERROR;
+    under_fapl_id = H5I_INVALID_HID;
+
+    /* A driver that may not be stacked underneath is rejected */
+    if ((core_fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_core(core_fapl_id, (size_t)CORE_INCREMENT, TRUE) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_fapl_writebehind(fapl_id, core_fapl_id, WRITEBEHIND_BUFFER_SIZE) >= 0)
+            TEST_ERROR;
+    }
+    H5E_END_TRY
+    if (H5Pclose(core_fapl_id) < 0)
+        TEST_ERROR;
+    core_fapl_id = H5I_INVALID_HID;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
         TEST_ERROR;
 
-    /* Write the data to the dset1 */
-    if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata2) < 0)
+    /* Check that the driver is correct */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
         TEST_ERROR;
+    if (H5FD_WRITEBEHIND != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+    fapl_id_out = H5I_INVALID_HID;
 
-    if (H5Dclose(dset2) < 0)
+    if (NULL == (points = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
         TEST_ERROR;
+    if (NULL == (check = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
 
-    if ((dset2 = H5Dopen2(file, DSET2_NAME, H5P_DEFAULT)) < 0)
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
         TEST_ERROR;
 
-    /* Read the data back from dset1 */
-    if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata2) < 0)
+    /* A contiguous dataset, larger than the staging buffer */
+    if ((dset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
         TEST_ERROR;
 
-    /* Check that the values read are the same as the values written */
-    for (i = 0; i < DSET2_DIM; i++)
-        if (wdata2[i] != rdata2[i]) {
-            H5_FAILED();
-            printf("    Read different values than written in data set 2.\n");
-            printf("    At index %d\n", i);
-            TEST_ERROR;
-        } /* end if */
+    /* A dataset with many small chunks, which are all staged */
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(fid, DSET3_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
 
-    if (H5Sclose(space1) < 0)
+    /* Rewrite the middle half at once, so the new chunk data is staged
+     * behind the old, and read everything back before it's stored.
+     */
+    for (i = (int)(start[0] * DSET1_DIM2); i < (int)((start[0] + count[0]) * DSET1_DIM2); i++)
+        points[i] = -i;
+    if ((mspace = H5Scopy(space)) < 0)
         TEST_ERROR;
-    if (H5Dclose(dset1) < 0)
+    if (H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
         TEST_ERROR;
-    if (H5Sclose(space2) < 0)
+    if (H5Dwrite(dset, H5T_NATIVE_INT, mspace, mspace, H5P_DEFAULT, points) < 0)
         TEST_ERROR;
-    if (H5Dclose(dset2) < 0)
+    memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("staged data read back incorrectly");
+    if (H5Dclose(dset) < 0)
         TEST_ERROR;
 
-    free(points);
-    free(check);
+    /* Flushing stores everything; the handle is then safe to use */
+    if (H5Fflush(fid, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (os_file_handle == NULL || *(int *)os_file_handle < 0)
+        TEST_ERROR;
 
-    /* Close and delete the file */
-    if (H5Fclose(file) < 0)
+    if (H5Fclose(fid) < 0)
         TEST_ERROR;
-    h5_delete_test_file(FILENAME[5], fapl);
+    fid = H5I_INVALID_HID;
 
-    /* Close the fapl */
-    if (H5Pclose(fapl) < 0)
+    /* Read both datasets back with the sec2 driver, then with this one */
+    for (pass = 0; pass < 2; pass++) {
+        if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, pass ? fapl_id : H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+
+        if ((dset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+            if (check[i] != i)
+                FAIL_PUTS_ERROR("contiguous dataset read back incorrectly");
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+
+        if ((dset = H5Dopen2(fid, DSET3_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        memset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("chunked dataset read back incorrectly");
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+
+        if (H5Fclose(fid) < 0)
+            TEST_ERROR;
+        fid = H5I_INVALID_HID;
+    }
+
+    h5_delete_test_file(FILENAME[19], fapl_id);
+
+    if (H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space) < 0)
         TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    free(points);
+    free(check);
 
     PASSED();
     return 0;
@@ -886,23 +1796,24 @@ test_direct(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Pclose(fapl);
-        H5Sclose(space1);
-        H5Dclose(dset1);
-        H5Sclose(space2);
-        H5Dclose(dset2);
-        H5Fclose(file);
+        H5Dclose(dset);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Pclose(dcpl_id);
+        H5Pclose(core_fapl_id);
+        H5Pclose(under_fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Pclose(fapl_id);
+        H5Fclose(fid);
     }
     H5E_END_TRY
 
-    if (proto_points)
-        free(proto_points);
-    if (proto_check)
-        free(proto_check);
+    free(points);
+    free(check);
 
     return -1;
-#endif /*H5_HAVE_DIRECT*/
-}
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
+} /* end test_writebehind() */
 
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
@@ -2008,6 +2919,185 @@ error:
     return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_profile
+ *
+ * Purpose:     Tests the file handle interface for the profiling driver,
+ *              and that a profile is written for each file closed, both
+ *              on top of sec2 and on top of the core driver.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_profile(void)
+{
+    hid_t    file = H5I_INVALID_HID, fapl = H5I_INVALID_HID, access_fapl = H5I_INVALID_HID;
+    hid_t    under_fapl = H5I_INVALID_HID, core_fapl = H5I_INVALID_HID;
+    hid_t    dset = H5I_INVALID_HID, space = H5I_INVALID_HID;
+    hsize_t  dims[2] = {DSET1_DIM1, DSET1_DIM2};
+    char     filename[1024];
+    char     out_path[64];
+    char    *line    = NULL;
+    FILE    *fp      = NULL;
+    int     *fhandle = NULL;
+    int     *points = NULL, *check = NULL;
+    unsigned sample_interval;
+    int      nlines, i;
+    herr_t   ret = SUCCEED;
+
+    TESTING("profiling file driver");
+
+    HDremove(PROFILE_FILENAME);
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+
+    /* Make sure calling with an invalid fapl doesn't crash */
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_fapl_profile(H5I_INVALID_HID, H5P_DEFAULT, PROFILE_FILENAME, 0);
+    }
+    H5E_END_TRY
+    if (SUCCEED == ret)
+        TEST_ERROR;
+
+    if (H5Pset_fapl_profile(fapl, H5P_DEFAULT, PROFILE_FILENAME, 4) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[20], fapl, filename, sizeof filename);
+
+    /* Verify the file access properties */
+    if (H5Pget_fapl_profile(fapl, &under_fapl, out_path, sizeof(out_path), &sample_interval) < 0)
+        TEST_ERROR;
+    if (H5FD_SEC2 != H5Pget_driver(under_fapl))
+        TEST_ERROR;
+    if (HDstrcmp(out_path, PROFILE_FILENAME) != 0 || sample_interval != 4)
+        TEST_ERROR;
+    if (H5Pclose(under_fapl) < 0)
+        TEST_ERROR;
+    under_fapl = H5I_INVALID_HID;
+
+    if (NULL == (points = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)malloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    /* Create the test file */
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if ((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if (H5FD_PROFILE != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if (H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+    access_fapl = H5I_INVALID_HID;
+
+    /* Check file handle API */
+    if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if (*fhandle < 0)
+        TEST_ERROR;
+
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR;
+    if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+    file = H5I_INVALID_HID;
+
+    /* Read the data back through the core driver */
+    if ((core_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_core(core_fapl, (size_t)CORE_INCREMENT, FALSE) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_profile(fapl, core_fapl, PROFILE_FILENAME, 0) < 0)
+        TEST_ERROR;
+    if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if ((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    if (memcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("data read back incorrectly");
+    if (H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+    file = H5I_INVALID_HID;
+
+    /* Each file closed appends one line, which records the raw data */
+    if (NULL == (line = (char *)malloc(64 * KB)))
+        TEST_ERROR;
+    if (NULL == (fp = fopen(PROFILE_FILENAME, "r")))
+        TEST_ERROR;
+    for (nlines = 0; fgets(line, 64 * KB, fp); nlines++) {
+        if (line[0] != '{' || line[HDstrlen(line) - 1] != '\n')
+            FAIL_PUTS_ERROR("profile isn't one object per line");
+        if (!HDstrstr(line, nlines ? "\"driver\":\"core\"" : "\"driver\":\"sec2\""))
+            FAIL_PUTS_ERROR("profile doesn't name the underlying driver");
+        if (!HDstrstr(line, nlines ? "\"read\":{" : "\"write\":{") ||
+            !HDstrstr(HDstrstr(line, nlines ? "\"read\":{" : "\"write\":{"), "\"draw\":{\"requests\":"))
+            FAIL_PUTS_ERROR("profile is missing the raw data requests");
+        if (!HDstrstr(line, "\"latency_ns\":[") || !HDstrstr(line, "\"seek_forward\":["))
+            FAIL_PUTS_ERROR("profile is missing the histograms");
+    }
+    if (nlines != 2)
+        FAIL_PUTS_ERROR("wrong number of profiles");
+    fclose(fp);
+    fp = NULL;
+
+    h5_delete_test_file(FILENAME[20], fapl);
+    HDremove(PROFILE_FILENAME);
+
+    if (H5Sclose(space) < 0)
+        TEST_ERROR;
+    if (H5Pclose(core_fapl) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    free(line);
+    free(points);
+    free(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Pclose(core_fapl);
+        H5Pclose(under_fapl);
+        H5Pclose(access_fapl);
+        H5Pclose(fapl);
+        H5Fclose(file);
+    }
+    H5E_END_TRY
+
+    if (fp)
+        fclose(fp);
+    free(line);
+    free(points);
+    free(check);
+
+    return -1;
+} /* end test_profile() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_stdio
  *
@@ -4539,6 +5629,61 @@ test_vector_io(const char *vfd_name)
 
         h5_fixname(FILENAME[7], fapl_id, filename, sizeof filename);
     }
+    else if (HDstrcmp(vfd_name, "core") == 0) {
+
+        /* Use a backing store with small write tracking pages, so that the
+         * vector writes' dirty regions are tracked and flushed separately
+         */
+        if (H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, TRUE) < 0)
+            TEST_ERROR;
+        if (H5Pset_core_write_tracking(fapl_id, TRUE, (size_t)CORE_INCREMENT) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[1], fapl_id, filename, sizeof filename);
+    }
+#ifdef H5_HAVE_DIRECT
+    else if (HDstrcmp(vfd_name, "direct") == 0) {
+
+        if (H5Pset_fapl_direct(fapl_id, MBOUNDARY, FBSIZE, CBSIZE) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[5], fapl_id, filename, sizeof filename);
+    }
+#endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_IOURING_VFD
+    else if (HDstrcmp(vfd_name, "iouring") == 0) {
+
+        if (H5Pset_fapl_iouring(fapl_id, IOURING_QUEUE_DEPTH, IOURING_NFIXED_BUFS, IOURING_FIXED_SIZE) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[16], fapl_id, filename, sizeof filename);
+    }
+#endif /* H5_HAVE_IOURING_VFD */
+#ifdef H5_HAVE_STRIPE_VFD
+    else if (HDstrcmp(vfd_name, "stripe") == 0) {
+
+        if (H5Pset_fapl_stripe(fapl_id, STRIPE_NMEMBERS, STRIPE_SIZE, 0) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[18], fapl_id, filename, sizeof filename);
+    }
+#endif /* H5_HAVE_STRIPE_VFD */
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+    else if (HDstrcmp(vfd_name, "writebehind") == 0) {
+
+        if (H5Pset_fapl_writebehind(fapl_id, H5P_DEFAULT, WRITEBEHIND_BUFFER_SIZE) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[19], fapl_id, filename, sizeof filename);
+    }
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
+    else if (HDstrcmp(vfd_name, "profile") == 0) {
+
+        if (H5Pset_fapl_profile(fapl_id, H5P_DEFAULT, PROFILE_FILENAME, 0) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[20], fapl_id, filename, sizeof filename);
+    }
     else {
 
         fprintf(stdout, "un-supported VFD\n");
@@ -5072,6 +6217,61 @@ test_selection_io(const char *vfd_name)
 
         h5_fixname(FILENAME[7], fapl_id, filename, sizeof filename);
     }
+    else if (HDstrcmp(vfd_name, "core") == 0) {
+
+        /* Use a backing store with small write tracking pages, so that the
+         * vector writes' dirty regions are tracked and flushed separately
+         */
+        if (H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, TRUE) < 0)
+            TEST_ERROR;
+        if (H5Pset_core_write_tracking(fapl_id, TRUE, (size_t)CORE_INCREMENT) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[1], fapl_id, filename, sizeof filename);
+    }
+#ifdef H5_HAVE_DIRECT
+    else if (HDstrcmp(vfd_name, "direct") == 0) {
+
+        if (H5Pset_fapl_direct(fapl_id, MBOUNDARY, FBSIZE, CBSIZE) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[5], fapl_id, filename, sizeof filename);
+    }
+#endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_IOURING_VFD
+    else if (HDstrcmp(vfd_name, "iouring") == 0) {
+
+        if (H5Pset_fapl_iouring(fapl_id, IOURING_QUEUE_DEPTH, IOURING_NFIXED_BUFS, IOURING_FIXED_SIZE) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[16], fapl_id, filename, sizeof filename);
+    }
+#endif /* H5_HAVE_IOURING_VFD */
+#ifdef H5_HAVE_STRIPE_VFD
+    else if (HDstrcmp(vfd_name, "stripe") == 0) {
+
+        if (H5Pset_fapl_stripe(fapl_id, STRIPE_NMEMBERS, STRIPE_SIZE, 0) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[18], fapl_id, filename, sizeof filename);
+    }
+#endif /* H5_HAVE_STRIPE_VFD */
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+    else if (HDstrcmp(vfd_name, "writebehind") == 0) {
+
+        if (H5Pset_fapl_writebehind(fapl_id, H5P_DEFAULT, WRITEBEHIND_BUFFER_SIZE) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[19], fapl_id, filename, sizeof filename);
+    }
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
+    else if (HDstrcmp(vfd_name, "profile") == 0) {
+
+        if (H5Pset_fapl_profile(fapl_id, H5P_DEFAULT, PROFILE_FILENAME, 0) < 0)
+            TEST_ERROR;
+
+        h5_fixname(FILENAME[20], fapl_id, filename, sizeof filename);
+    }
     else {
 
         fprintf(stdout, "un-supported VFD\n");
@@ -5892,12 +7092,17 @@ main(void)
     nerrors += test_sec2() < 0 ? 1 : 0;
     nerrors += test_core() < 0 ? 1 : 0;
     nerrors += test_direct() < 0 ? 1 : 0;
+    nerrors += test_iouring() < 0 ? 1 : 0;
+    nerrors += test_mmap() < 0 ? 1 : 0;
+    nerrors += test_stripe() < 0 ? 1 : 0;
+    nerrors += test_writebehind() < 0 ? 1 : 0;
     nerrors += test_family() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
     nerrors += test_family_member_fapl() < 0 ? 1 : 0;
     nerrors += test_multi() < 0 ? 1 : 0;
     nerrors += test_multi_compat() < 0 ? 1 : 0;
     nerrors += test_log() < 0 ? 1 : 0;
+    nerrors += test_profile() < 0 ? 1 : 0;
     nerrors += test_stdio() < 0 ? 1 : 0;
     nerrors += test_windows() < 0 ? 1 : 0;
     nerrors += test_ros3() < 0 ? 1 : 0;
@@ -5906,6 +7111,27 @@ main(void)
     nerrors += test_vector_io("stdio") < 0 ? 1 : 0;
     nerrors += test_selection_io("sec2") < 0 ? 1 : 0;
     nerrors += test_selection_io("stdio") < 0 ? 1 : 0;
+    nerrors += test_vector_io("core") < 0 ? 1 : 0;
+    nerrors += test_selection_io("core") < 0 ? 1 : 0;
+    nerrors += test_vector_io("profile") < 0 ? 1 : 0;
+    nerrors += test_selection_io("profile") < 0 ? 1 : 0;
+    HDremove(PROFILE_FILENAME);
+#ifdef H5_HAVE_DIRECT
+    nerrors += test_vector_io("direct") < 0 ? 1 : 0;
+    nerrors += test_selection_io("direct") < 0 ? 1 : 0;
+#endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_IOURING_VFD
+    nerrors += test_vector_io("iouring") < 0 ? 1 : 0;
+    nerrors += test_selection_io("iouring") < 0 ? 1 : 0;
+#endif /* H5_HAVE_IOURING_VFD */
+#ifdef H5_HAVE_STRIPE_VFD
+    nerrors += test_vector_io("stripe") < 0 ? 1 : 0;
+    nerrors += test_selection_io("stripe") < 0 ? 1 : 0;
+#endif /* H5_HAVE_STRIPE_VFD */
+#ifdef H5_HAVE_WRITEBEHIND_VFD
+    nerrors += test_vector_io("writebehind") < 0 ? 1 : 0;
+    nerrors += test_selection_io("writebehind") < 0 ? 1 : 0;
+#endif /* H5_HAVE_WRITEBEHIND_VFD */
     nerrors += test_ctl() < 0 ? 1 : 0;
 
     if (nerrors) {
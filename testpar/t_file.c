@@ -234,7 +234,7 @@ test_page_buffer_access(void)
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * (size_t)num_elements, data);
         VRFY((ret == 0), "");
 
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         /* update the first 50 elements */
         for (i = 0; i < 50; i++)
@@ -245,7 +245,7 @@ test_page_buffer_access(void)
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
         page_count += 2;
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         /* update the second 50 elements */
         for (i = 0; i < 50; i++)
@@ -254,7 +254,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 50), sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         /* update 100 - 200 */
         for (i = 0; i < 100; i++)
@@ -263,7 +263,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 100), sizeof(int) * 100, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         ret = H5PB_flush(f->shared);
         VRFY((ret == 0), "");
@@ -271,24 +271,24 @@ test_page_buffer_access(void)
         /* read elements 0 - 200 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
 
@@ -342,7 +342,7 @@ test_page_buffer_access(void)
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * (size_t)num_elements, data);
         VRFY((ret == 0), "");
 
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         /* update the first 50 elements */
         for (i = 0; i < 50; i++)
@@ -351,7 +351,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         /* update the second 50 elements */
         for (i = 0; i < 50; i++)
@@ -360,7 +360,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 50), sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         /* update 100 - 200 */
         for (i = 0; i < 100; i++)
@@ -369,7 +369,7 @@ test_page_buffer_access(void)
         VRFY((ret == 0), "");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr + (sizeof(int) * 100), sizeof(int) * 100, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         ret = H5Fflush(file_id, H5F_SCOPE_GLOBAL);
         VRFY((ret == 0), "");
@@ -377,25 +377,25 @@ test_page_buffer_access(void)
         /* read elements 0 - 200 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 200, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 200; i++)
             VRFY((data[i] == i), "Read different values than written");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
         page_count += 1;
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == i), "Read different values than written");
 
@@ -405,20 +405,20 @@ test_page_buffer_access(void)
             data[i] = -1;
         ret = H5F_block_write(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         ret = H5F_block_write(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
 
         /* read elements 0 - 50 */
         ret = H5F_block_read(f, H5FD_MEM_DRAW, raw_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == -1), "Read different values than written");
         ret = H5F_block_read(f, H5FD_MEM_SUPER, meta_addr, sizeof(int) * 50, data);
         VRFY((ret == 0), "");
-        VRFY((H5SL_count(f->shared->page_buf->slist_ptr) == page_count), "Wrong number of pages in PB");
+        VRFY((f->shared->page_buf->clock_list_len == page_count), "Wrong number of pages in PB");
         for (i = 0; i < 50; i++)
             VRFY((data[i] == -1), "Read different values than written");
 
@@ -1186,6 +1186,14 @@ set_vfd(parameters *param)
          * and copy buffer size to the default values. */
         if (H5Pset_fapl_direct(my_fapl, 1024, 4096, 8 * 4096) < 0)
             return -1;
+#endif
+    }
+    else if (vfd == iouring) {
+#ifdef H5_HAVE_IOURING_VFD
+        /* Linux io_uring submission of vector and selection I/O.  Use the
+         * default queue depth and registered buffer pool. */
+        if (H5Pset_fapl_iouring(my_fapl, 0, H5FD_IOURING_NFIXED_BUFS_DEF, 0) < 0)
+            return -1;
 #endif
     }
     else {
@@ -774,6 +774,9 @@ report_parameters(struct options *opts)
         else if (opts->vfd == direct) {
             fprintf(output, "direct\n");
         }
+        else if (opts->vfd == iouring) {
+            fprintf(output, "iouring\n");
+        }
     }
 
     {
@@ -1023,6 +1026,9 @@ parse_command_line(int argc, const char *const *argv)
                 else if (!HDstrcasecmp(H5_optarg, "direct")) {
                     cl_opts->vfd = direct;
                 }
+                else if (!HDstrcasecmp(H5_optarg, "iouring")) {
+                    cl_opts->vfd = iouring;
+                }
                 else {
                     fprintf(stderr, "sio_perf: invalid --api option %s\n", H5_optarg);
                     exit(EXIT_FAILURE);
@@ -1255,7 +1261,7 @@ usage(const char *prog)
     printf("      the total size of the object increases exponentially.\n");
     printf("\n");
     printf("  VFD  - is an HDF5 file driver specifier. Valid values are:\n");
-    printf("          sec2, stdio, core, split, multi, family, direct\n");
+    printf("          sec2, stdio, core, split, multi, family, direct, iouring\n");
     printf("\n");
     printf("  Dimension access order:\n");
     printf("      Data access starts at the cardinal origin of the dataset using the\n");
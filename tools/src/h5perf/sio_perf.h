@@ -38,7 +38,8 @@ typedef enum vfdtype_ {
     split,
     multi,
     family,
-    direct
+    direct,
+    iouring
     /*NUM_TYPES*/
 } vfdtype;
 
@@ -0,0 +1,678 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Offline analyzer for binary metadata cache logs, i.e. logs
+ *          written with HDF5_MDC_LOG_STYLE=binary.  It can:
+ *      (1) -j, --json:     convert the log to JSON on stdout
+ *      (2) (default)       print a summary of the log: record counts,
+ *                          working-set size, a reuse distance histogram
+ *                          and the LRU miss-ratio curve for a set of
+ *                          candidate cache sizes
+ *      (3) --sizes=LIST:   comma-separated candidate cache sizes (bytes)
+ *                          for the miss-ratio curve
+ */
+#include "hdf5.h"
+#include "H5private.h"
+#include "H5Cprivate.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME "h5mdclog"
+
+/* Maximum number of candidate cache sizes */
+#define MAX_SIZES 64
+
+/* Number of power-of-two reuse distance buckets */
+#define NUM_DIST_BUCKETS 32
+
+/* A decoded log record */
+typedef struct mdclog_rec_t {
+    uint64_t timestamp;
+    uint64_t addr;
+    uint64_t aux;
+    uint32_t flags;
+    uint8_t  action;
+    uint8_t  type_id;
+    uint8_t  failed;
+} mdclog_rec_t;
+
+/* Per-address state for the reuse distance computation */
+typedef struct mdclog_entry_t {
+    uint64_t addr; /* Entry address (key)                                 */
+    hbool_t  used; /* Whether this hash table slot is occupied            */
+    int64_t  last; /* Access index of last reference (-1 if not resident) */
+    uint64_t size; /* Last known size of the entry                        */
+} mdclog_entry_t;
+
+/* Action names, indexed by H5C_log_binary_action_t */
+static const char *action_names_g[H5C_LOG_BINARY_NUM_ACTIONS] = {
+    "logging start", "logging stop", "create", "destroy", "evict", "expunge",
+    "flush", "insert", "dirty", "clean", "unserialized", "serialized",
+    "move", "pin", "create_fd", "protect", "resize", "unpin",
+    "destroy_fd", "unprotect", "set_config", "remove"};
+
+/* Default candidate cache sizes: 256 KiB .. 64 MiB */
+static const uint64_t default_sizes_g[] = {256 * 1024,       512 * 1024,       1024 * 1024,
+                                           2 * 1024 * 1024,  4 * 1024 * 1024,  8 * 1024 * 1024,
+                                           16 * 1024 * 1024, 32 * 1024 * 1024, 64 * 1024 * 1024};
+
+static char    *fname_g     = NULL;
+static hbool_t  to_json_g   = FALSE;
+static uint64_t sizes_g[MAX_SIZES];
+static unsigned nsizes_g = 0;
+
+/*
+ * Command-line options: only publicize long options
+ */
+static const char            *s_opts   = "hVjs:";
+static struct h5_long_options l_opts[] = {{"help", no_arg, 'h'},
+                                          {"version", no_arg, 'V'},
+                                          {"json", no_arg, 'j'},
+                                          {"sizes", require_arg, 's'},
+                                          {NULL, 0, '\0'}};
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    fprintf(stdout, "usage: %s [OPTIONS] log_file\n", prog);
+    fprintf(stdout, "  OPTIONS\n");
+    fprintf(stdout, "   -h, --help                Print a usage message and exit\n");
+    fprintf(stdout, "   -V, --version             Print version number and exit\n");
+    fprintf(stdout, "   -j, --json                Convert the binary log to JSON on stdout\n");
+    fprintf(stdout, "   --sizes=S1,S2,...         Candidate cache sizes (in bytes) for the\n");
+    fprintf(stdout, "                             miss-ratio curve\n");
+    fprintf(stdout, "\n");
+    fprintf(stdout, "  log_file is a metadata cache log written with the environment\n");
+    fprintf(stdout, "  variable %s set to \"binary\".\n", HDF5_MDC_LOG_STYLE);
+} /* usage() */
+
+/*-------------------------------------------------------------------------
+ * Function: parse_sizes
+ *
+ * Purpose:  Parses a comma-separated list of cache sizes
+ *
+ * Return:   Success: 0
+ *           Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_sizes(const char *list)
+{
+    const char *p = list;
+
+    nsizes_g = 0;
+    while (*p) {
+        char              *end;
+        unsigned long long val = strtoull(p, &end, 10);
+
+        if (end == p || 0 == val || nsizes_g == MAX_SIZES)
+            return -1;
+        sizes_g[nsizes_g++] = (uint64_t)val;
+
+        if (*end == ',')
+            end++;
+        else if (*end != '\0')
+            return -1;
+        p = end;
+    }
+
+    return nsizes_g > 0 ? 0 : -1;
+} /* parse_sizes() */
+
+/*-------------------------------------------------------------------------
+ * Function: parse_command_line
+ *
+ * Purpose: Parses command line and sets up global variable to control output
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_command_line(int argc, const char *const *argv)
+{
+    int opt;
+
+    /* no arguments */
+    if (argc == 1) {
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    }
+
+    /* parse command line options */
+    while ((opt = H5_get_option(argc, argv, s_opts, l_opts)) != EOF) {
+        switch ((char)opt) {
+            case 'h':
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'V':
+                print_version(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'j':
+                to_json_g = TRUE;
+                break;
+
+            case 's':
+                if (parse_sizes(H5_optarg) < 0) {
+                    error_msg("invalid cache size list: %s\n", H5_optarg);
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            default:
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_FAILURE);
+                goto error;
+        } /* end switch */
+    }     /* end while */
+
+    /* check for file name to be processed */
+    if (argc <= H5_optind) {
+        error_msg("missing file name\n");
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    } /* end if */
+
+    fname_g = HDstrdup(argv[H5_optind]);
+
+done:
+    return (0);
+
+error:
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    read_log
+ *
+ * Purpose:     Reads and decodes all records in a binary cache log
+ *
+ * Return:      Success: array of records (caller frees)
+ *              Failure: NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static mdclog_rec_t *
+read_log(const char *name, size_t *nrecs)
+{
+    FILE         *fp = NULL;
+    uint8_t       header[H5C_LOG_BINARY_HEADER_SIZE];
+    uint8_t       raw[H5C_LOG_BINARY_RECORD_SIZE];
+    const uint8_t *p;
+    uint32_t      version, rec_size;
+    mdclog_rec_t *recs  = NULL;
+    size_t        nalloc = 0;
+    size_t        n      = 0;
+
+    if (NULL == (fp = fopen(name, "rb"))) {
+        error_msg("unable to open log file %s\n", name);
+        goto error;
+    }
+
+    /* Check the header */
+    if (fread(header, 1, sizeof(header), fp) != sizeof(header) ||
+        memcmp(header, H5C_LOG_BINARY_SIGNATURE, (size_t)H5C_LOG_BINARY_SIGNATURE_LEN) != 0) {
+        error_msg("%s is not a binary metadata cache log\n", name);
+        goto error;
+    }
+    p = header + H5C_LOG_BINARY_SIGNATURE_LEN;
+    UINT32DECODE(p, version);
+    UINT32DECODE(p, rec_size);
+    if (version != H5C_LOG_BINARY_VERSION || rec_size != H5C_LOG_BINARY_RECORD_SIZE) {
+        error_msg("unsupported log version %u (record size %u)\n", (unsigned)version, (unsigned)rec_size);
+        goto error;
+    }
+
+    /* Decode the records.  A short trailing record means the writer died
+     * before its last buffer was complete, so it is silently ignored.
+     */
+    while (fread(raw, 1, sizeof(raw), fp) == sizeof(raw)) {
+        mdclog_rec_t *rec;
+
+        if (n == nalloc) {
+            mdclog_rec_t *tmp;
+
+            nalloc = nalloc ? 2 * nalloc : 4096;
+            if (NULL == (tmp = (mdclog_rec_t *)realloc(recs, nalloc * sizeof(mdclog_rec_t)))) {
+                error_msg("unable to allocate memory for log records\n");
+                goto error;
+            }
+            recs = tmp;
+        }
+
+        rec = &recs[n++];
+        p   = raw;
+        UINT64DECODE(p, rec->timestamp);
+        UINT64DECODE(p, rec->addr);
+        UINT64DECODE(p, rec->aux);
+        UINT32DECODE(p, rec->flags);
+        rec->action  = *p++;
+        rec->type_id = *p++;
+        rec->failed  = *p++;
+    }
+
+    fclose(fp);
+    *nrecs = n;
+    return recs;
+
+error:
+    if (fp)
+        fclose(fp);
+    free(recs);
+    return NULL;
+} /* read_log() */
+
+/*-------------------------------------------------------------------------
+ * Function:    dump_json
+ *
+ * Purpose:     Writes the decoded records as JSON, in the same layout as
+ *              the JSON cache log
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+dump_json(const mdclog_rec_t *recs, size_t nrecs)
+{
+    size_t u;
+
+    fprintf(stdout, "{\n\"HDF5 metadata cache log messages\" : [\n");
+    for (u = 0; u < nrecs; u++) {
+        const mdclog_rec_t *rec = &recs[u];
+        const char         *name =
+            rec->action < H5C_LOG_BINARY_NUM_ACTIONS ? action_names_g[rec->action] : "unknown";
+
+        fprintf(stdout, "{\"timestamp_us\":%" PRIu64 ",\"action\":\"%s\"", rec->timestamp, name);
+        if (rec->addr != (uint64_t)HADDR_UNDEF)
+            fprintf(stdout, ",\"address\":\"0x%" PRIx64 "\"", rec->addr);
+        switch (rec->action) {
+            case H5C_LOG_BINARY_MOVE:
+                fprintf(stdout, ",\"new_address\":\"0x%" PRIx64 "\"", rec->aux);
+                break;
+            case H5C_LOG_BINARY_CREATE_FD:
+            case H5C_LOG_BINARY_DESTROY_FD:
+                fprintf(stdout, ",\"child_addr\":\"0x%" PRIx64 "\"", rec->aux);
+                break;
+            case H5C_LOG_BINARY_SET_CONFIG:
+                fprintf(stdout, ",\"max_size\":%" PRIu64, rec->aux);
+                break;
+            case H5C_LOG_BINARY_INSERT:
+            case H5C_LOG_BINARY_PROTECT:
+            case H5C_LOG_BINARY_DIRTY:
+            case H5C_LOG_BINARY_CLEAN:
+            case H5C_LOG_BINARY_UNSERIALIZED:
+            case H5C_LOG_BINARY_SERIALIZED:
+            case H5C_LOG_BINARY_PIN:
+            case H5C_LOG_BINARY_UNPIN:
+            case H5C_LOG_BINARY_REMOVE:
+                fprintf(stdout, ",\"size\":%" PRIu64, rec->aux);
+                break;
+            case H5C_LOG_BINARY_RESIZE:
+                fprintf(stdout, ",\"new_size\":%" PRIu64, rec->aux);
+                break;
+            default:
+                break;
+        }
+        if (rec->type_id != H5C_LOG_BINARY_NO_TYPE)
+            fprintf(stdout, ",\"type_id\":%u", (unsigned)rec->type_id);
+        if (rec->flags)
+            fprintf(stdout, ",\"flags\":%u", (unsigned)rec->flags);
+        fprintf(stdout, ",\"returned\":%d}%s\n", rec->failed ? -1 : 0, (u + 1 < nrecs) ? "," : "");
+    }
+    fprintf(stdout, "]}\n");
+} /* dump_json() */
+
+/*-------------------------------------------------------------------------
+ * Function:    entry_lookup
+ *
+ * Purpose:     Finds (or creates) the hash table slot for an address,
+ *              using open addressing with linear probing
+ *
+ * Return:      Pointer to the slot (never NULL, table is never full)
+ *
+ *-------------------------------------------------------------------------
+ */
+static mdclog_entry_t *
+entry_lookup(mdclog_entry_t *table, size_t mask, uint64_t addr, hbool_t *created)
+{
+    size_t idx = (size_t)((addr * 0x9E3779B97F4A7C15ULL) >> 17) & mask;
+
+    *created = FALSE;
+    while (table[idx].used && table[idx].addr != addr)
+        idx = (idx + 1) & mask;
+
+    if (!table[idx].used) {
+        table[idx].used = TRUE;
+        table[idx].addr = addr;
+        table[idx].last = -1;
+        table[idx].size = 0;
+        *created        = TRUE;
+    }
+
+    return &table[idx];
+} /* entry_lookup() */
+
+/* Fenwick (binary indexed) tree helpers, 1-based positions */
+static void
+fenwick_add(int64_t *tree, size_t n, size_t pos, int64_t delta)
+{
+    for (pos++; pos <= n; pos += pos & (~pos + 1))
+        tree[pos] += delta;
+}
+
+static int64_t
+fenwick_sum(const int64_t *tree, size_t pos)
+{
+    int64_t sum = 0;
+
+    for (pos++; pos > 0; pos -= pos & (~pos + 1))
+        sum += tree[pos];
+
+    return sum;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    analyze
+ *
+ * Purpose:     Computes and prints working-set, reuse distance and LRU
+ *              miss-ratio curve statistics for the protect stream.
+ *
+ *              Every successful protect or insert is an access.  The
+ *              reuse (stack) distance of an access is the number of
+ *              distinct entries (and their total size in bytes) touched
+ *              since the previous access to the same entry.  An LRU
+ *              cache of C bytes misses exactly when that byte distance
+ *              exceeds C, so a single pass yields the whole curve.
+ *              Inserts never miss (the entry is created in the cache),
+ *              and expunged/removed entries leave the reuse stack.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+analyze(const mdclog_rec_t *recs, size_t nrecs)
+{
+    uint64_t        action_counts[H5C_LOG_BINARY_NUM_ACTIONS];
+    uint64_t        dist_hist[NUM_DIST_BUCKETS];
+    uint64_t        size_misses[MAX_SIZES];
+    mdclog_entry_t *table     = NULL;
+    int64_t        *cnt_tree  = NULL;
+    int64_t        *byte_tree = NULL;
+    size_t          nslots, mask;
+    size_t          ntotal    = 0;
+    size_t          naccess   = 0;
+    uint64_t        protects  = 0;
+    uint64_t        cold      = 0;
+    uint64_t        distinct  = 0;
+    int64_t         resident  = 0;
+    int64_t         peak      = 0;
+    size_t          u;
+    unsigned        v;
+    int             ret_value = 0;
+
+    memset(action_counts, 0, sizeof(action_counts));
+    memset(dist_hist, 0, sizeof(dist_hist));
+    memset(size_misses, 0, sizeof(size_misses));
+
+    /* Count accesses to size the Fenwick trees */
+    for (u = 0; u < nrecs; u++)
+        if (!recs[u].failed &&
+            (recs[u].action == H5C_LOG_BINARY_PROTECT || recs[u].action == H5C_LOG_BINARY_INSERT))
+            ntotal++;
+
+    /* There can't be more distinct addresses than records */
+    for (nslots = 1024; nslots < 2 * nrecs; nslots *= 2)
+        ;
+    mask = nslots - 1;
+
+    if (NULL == (table = (mdclog_entry_t *)calloc(nslots, sizeof(mdclog_entry_t))) ||
+        NULL == (cnt_tree = (int64_t *)calloc(ntotal + 1, sizeof(int64_t))) ||
+        NULL == (byte_tree = (int64_t *)calloc(ntotal + 1, sizeof(int64_t)))) {
+        error_msg("unable to allocate memory for analysis\n");
+        ret_value = -1;
+        goto done;
+    }
+
+    for (u = 0; u < nrecs; u++) {
+        const mdclog_rec_t *rec = &recs[u];
+        mdclog_entry_t     *ent;
+        hbool_t             created;
+
+        if (rec->action < H5C_LOG_BINARY_NUM_ACTIONS)
+            action_counts[rec->action]++;
+        if (rec->failed)
+            continue;
+
+        switch (rec->action) {
+            case H5C_LOG_BINARY_PROTECT:
+            case H5C_LOG_BINARY_INSERT:
+                ent = entry_lookup(table, mask, rec->addr, &created);
+                if (created)
+                    distinct++;
+
+                if (rec->action == H5C_LOG_BINARY_PROTECT)
+                    protects++;
+
+                if (ent->last >= 0) {
+                    int64_t  dist_cnt;
+                    int64_t  dist_bytes;
+                    unsigned bucket = 0;
+
+                    /* Distinct entries referenced since the last access,
+                     * including this one
+                     */
+                    dist_cnt = fenwick_sum(cnt_tree, naccess - 1) - fenwick_sum(cnt_tree, (size_t)ent->last);
+                    dist_bytes =
+                        fenwick_sum(byte_tree, naccess - 1) - fenwick_sum(byte_tree, (size_t)ent->last);
+                    dist_cnt += 1;
+                    dist_bytes += (int64_t)rec->aux;
+
+                    if (rec->action == H5C_LOG_BINARY_PROTECT) {
+                        while (bucket < NUM_DIST_BUCKETS - 1 && ((int64_t)1 << (bucket + 1)) <= dist_cnt)
+                            bucket++;
+                        dist_hist[bucket]++;
+
+                        for (v = 0; v < nsizes_g; v++)
+                            if ((uint64_t)dist_bytes > sizes_g[v])
+                                size_misses[v]++;
+                    }
+
+                    /* Drop the old position from the reuse stack */
+                    fenwick_add(cnt_tree, ntotal, (size_t)ent->last, -1);
+                    fenwick_add(byte_tree, ntotal, (size_t)ent->last, -(int64_t)ent->size);
+                    resident -= (int64_t)ent->size;
+                }
+                else if (rec->action == H5C_LOG_BINARY_PROTECT) {
+                    /* Compulsory miss for every cache size */
+                    cold++;
+                    for (v = 0; v < nsizes_g; v++)
+                        size_misses[v]++;
+                }
+
+                /* Push the entry on top of the reuse stack */
+                ent->last = (int64_t)naccess;
+                ent->size = rec->aux;
+                fenwick_add(cnt_tree, ntotal, naccess, 1);
+                fenwick_add(byte_tree, ntotal, naccess, (int64_t)ent->size);
+                resident += (int64_t)ent->size;
+                if (resident > peak)
+                    peak = resident;
+                naccess++;
+                break;
+
+            case H5C_LOG_BINARY_RESIZE:
+                ent = entry_lookup(table, mask, rec->addr, &created);
+                if (ent->last >= 0) {
+                    fenwick_add(byte_tree, ntotal, (size_t)ent->last, (int64_t)rec->aux - (int64_t)ent->size);
+                    resident += (int64_t)rec->aux - (int64_t)ent->size;
+                    if (resident > peak)
+                        peak = resident;
+                }
+                ent->size = rec->aux;
+                break;
+
+            case H5C_LOG_BINARY_MOVE: {
+                mdclog_entry_t *new_ent;
+                int64_t         last;
+                uint64_t        size;
+
+                ent  = entry_lookup(table, mask, rec->addr, &created);
+                last = ent->last;
+                size = ent->size;
+
+                ent->last = -1;
+                new_ent   = entry_lookup(table, mask, rec->aux, &created);
+                if (created)
+                    distinct++;
+                new_ent->last = last;
+                new_ent->size = size;
+                break;
+            }
+
+            case H5C_LOG_BINARY_EXPUNGE:
+            case H5C_LOG_BINARY_REMOVE:
+                ent = entry_lookup(table, mask, rec->addr, &created);
+                if (ent->last >= 0) {
+                    fenwick_add(cnt_tree, ntotal, (size_t)ent->last, -1);
+                    fenwick_add(byte_tree, ntotal, (size_t)ent->last, -(int64_t)ent->size);
+                    resident -= (int64_t)ent->size;
+                    ent->last = -1;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /* Report */
+    fprintf(stdout, "Records:                  %zu\n", nrecs);
+    for (v = 0; v < H5C_LOG_BINARY_NUM_ACTIONS; v++)
+        if (action_counts[v])
+            fprintf(stdout, "    %-22s%" PRIu64 "\n", action_names_g[v], action_counts[v]);
+    fprintf(stdout, "Protects:                 %" PRIu64 "\n", protects);
+    fprintf(stdout, "Distinct entries:         %" PRIu64 "\n", distinct);
+    fprintf(stdout, "Peak working set (bytes): %" PRId64 "\n", peak);
+    fprintf(stdout, "Compulsory misses:        %" PRIu64 "\n", cold);
+
+    fprintf(stdout, "\nReuse distance (distinct entries) histogram:\n");
+    for (v = 0; v < NUM_DIST_BUCKETS; v++)
+        if (dist_hist[v])
+            fprintf(stdout, "    [%" PRIu64 ", %" PRIu64 "): %" PRIu64 "\n", (uint64_t)1 << v,
+                    (uint64_t)1 << (v + 1), dist_hist[v]);
+
+    fprintf(stdout, "\nLRU miss-ratio curve:\n");
+    fprintf(stdout, "    %16s  %10s  %10s\n", "cache size", "misses", "miss ratio");
+    for (v = 0; v < nsizes_g; v++)
+        fprintf(stdout, "    %16" PRIu64 "  %10" PRIu64 "  %10.4f\n", sizes_g[v], size_misses[v],
+                protects ? (double)size_misses[v] / (double)protects : 0.0);
+
+done:
+    free(table);
+    free(cnt_tree);
+    free(byte_tree);
+
+    return ret_value;
+} /* analyze() */
+
+/*-------------------------------------------------------------------------
+ * Function:    leave
+ *
+ * Purpose:     Close the tools library and exit
+ *
+ * Return:      Does not return
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+leave(int ret)
+{
+    h5tools_close();
+    exit(ret);
+} /* leave() */
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Convert or analyze a binary metadata cache log
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    mdclog_rec_t *recs  = NULL;
+    size_t        nrecs = 0;
+
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* initialize h5tools lib */
+    h5tools_init();
+
+    /* Parse command line options */
+    if (parse_command_line(argc, (const char *const *)argv) < 0)
+        goto done;
+
+    if (fname_g == NULL)
+        goto done;
+
+    /* Use the default candidate sizes unless some were given */
+    if (0 == nsizes_g) {
+        nsizes_g = (unsigned)NELMTS(default_sizes_g);
+        memcpy(sizes_g, default_sizes_g, sizeof(default_sizes_g));
+    }
+
+    if (NULL == (recs = read_log(fname_g, &nrecs))) {
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    if (to_json_g)
+        dump_json(recs, nrecs);
+    else if (analyze(recs, nrecs) < 0)
+        h5tools_setstatus(EXIT_FAILURE);
+
+done:
+    free(recs);
+    if (fname_g)
+        free(fname_g);
+
+    leave(h5tools_getstatus());
+} /* main() */
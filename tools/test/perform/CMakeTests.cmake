@@ -146,6 +146,63 @@ if (HDF5_TEST_SERIAL)
       FIXTURES_REQUIRED clear_perform
   )
 
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_select_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:select_perf> -o 1000 1000 10000)
+  else ()
+    add_test (NAME PERFORM_select_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:select_perf>"
+        -D "TEST_ARGS:STRING=-o;1000;1000;10000"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=select_perf.txt"
+        #-D "TEST_REFERENCE=select_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_select_perf PROPERTIES
+      FIXTURES_REQUIRED clear_perform
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_map_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:map_perf> 1000)
+  else ()
+    add_test (NAME PERFORM_map_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:map_perf>"
+        -D "TEST_ARGS:STRING=1000"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=map_perf.txt"
+        #-D "TEST_REFERENCE=map_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_map_perf PROPERTIES
+      FIXTURES_REQUIRED clear_perform
+  )
+
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_xform_perf COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:xform_perf> 100000)
+  else ()
+    add_test (NAME PERFORM_xform_perf COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:xform_perf>"
+        -D "TEST_ARGS:STRING=100000"
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=xform_perf.txt"
+        #-D "TEST_REFERENCE=xform_perf.out"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_xform_perf PROPERTIES
+      FIXTURES_REQUIRED clear_perform
+  )
+
   if (HDF5_ENABLE_USING_MEMCHECKER)
     add_test (NAME PERFORM_zip_perf_help COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:zip_perf> "-h")
   else ()
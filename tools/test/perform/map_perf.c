@@ -0,0 +1,255 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:  Measures the time of repeated small writes to a chunked dataset,
+ *           with the same selections for each write, which reuse the piece
+ *           map of the previous write, and with two alternating selections,
+ *           which map the selections to the chunks for each write.
+ */
+
+#include "hdf5.h"
+#include "H5private.h"
+
+#define RANK  2
+#define DIM   1024
+#define CHUNK 64
+
+/* Size of the hyperslabs written, which span 2x2 chunks */
+#define HYPER_SIZE 16
+
+/* # of points written, in different chunks */
+#define NPOINTS 64
+
+/* Default # of writes for each measurement */
+#define DEFAULT_NWRITES 100000
+
+/*-------------------------------------------------------------------------
+ * Function:  usage
+ *
+ * Purpose:  Prints a usage message and exits.
+ *
+ * Return:  never returns
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [NWRITES]\n", prog);
+    fprintf(stderr, "\
+    Writes a %dx%d hyperslab and %d points NWRITES times each to a %dx%d\n\
+    dataset with %dx%d chunks, in a file in memory.  The default number of\n\
+    writes is %d.\n",
+            HYPER_SIZE, HYPER_SIZE, NPOINTS, DIM, DIM, CHUNK, CHUNK, DEFAULT_NWRITES);
+    exit(1);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  select_hyper
+ *
+ * Purpose:  Selects the hyperslab across the chunk corner at (ROW, COL).
+ *
+ * Return:  Success:  0
+ *          Failure:  -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+select_hyper(hid_t fsid, hsize_t row, hsize_t col)
+{
+    hsize_t start[RANK] = {row - HYPER_SIZE / 2, col - HYPER_SIZE / 2};
+    hsize_t count[RANK] = {HYPER_SIZE, HYPER_SIZE};
+
+    return H5Sselect_hyperslab(fsid, H5S_SELECT_SET, start, NULL, count, NULL) < 0 ? -1 : 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  select_points
+ *
+ * Purpose:  Selects a point in each of NPOINTS chunks, SHIFT elements
+ *           into the chunks.
+ *
+ * Return:  Success:  0
+ *          Failure:  -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+select_points(hid_t fsid, hsize_t shift)
+{
+    hsize_t coord[NPOINTS][RANK];
+    size_t  u;
+
+    for (u = 0; u < NPOINTS; u++) {
+        coord[u][0] = (u % (DIM / CHUNK)) * CHUNK + shift;
+        coord[u][1] = (u / (DIM / CHUNK)) * CHUNK + shift;
+    }
+
+    return H5Sselect_elements(fsid, H5S_SELECT_SET, (size_t)NPOINTS, (const hsize_t *)coord) < 0 ? -1 : 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  measure
+ *
+ * Purpose:  Writes NWRITES times with the selections in FSID[0] &
+ *           MSID[0], or alternately with those and the selections in
+ *           FSID[1] & MSID[1], and prints the time.
+ *
+ * Return:  Success:  0
+ *          Failure:  -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+measure(hid_t did, const char *pattern, const char *sel, const hid_t fsid[2], const hid_t msid[2],
+        size_t nwrites, const int *buf)
+{
+    double t_start, t_write;
+    size_t u;
+
+    t_start = H5_get_time();
+    for (u = 0; u < nwrites; u++)
+        if (H5Dwrite(did, H5T_NATIVE_INT, msid[u % 2], fsid[u % 2], H5P_DEFAULT, buf) < 0)
+            return -1;
+    t_write = H5_get_time() - t_start;
+
+    printf("%-9s %-9s %9zu %12.6f %12.3f\n", pattern, sel, nwrites, t_write,
+           1.0e6 * t_write / (double)nwrites);
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  main
+ *
+ * Purpose:  See file prologue.
+ *
+ * Return:  Success:  0
+ *          Failure:  1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    hsize_t dims[RANK]  = {DIM, DIM};
+    hsize_t chunk[RANK] = {CHUNK, CHUNK};
+    hsize_t mdims[RANK] = {HYPER_SIZE, HYPER_SIZE};
+    hsize_t npoints     = NPOINTS;
+    size_t  nwrites     = DEFAULT_NWRITES;
+    int     buf[HYPER_SIZE * HYPER_SIZE];
+    hid_t   fapl        = H5I_INVALID_HID;
+    hid_t   dcpl        = H5I_INVALID_HID;
+    hid_t   fid         = H5I_INVALID_HID;
+    hid_t   sid         = H5I_INVALID_HID;
+    hid_t   did         = H5I_INVALID_HID;
+    hid_t   fsid[2]     = {H5I_INVALID_HID, H5I_INVALID_HID};
+    hid_t   msid[2]     = {H5I_INVALID_HID, H5I_INVALID_HID};
+    hid_t   same_fsid[2], same_msid[2];
+    size_t  u;
+
+    if (argc > 2)
+        usage(argv[0]);
+    if (argc == 2 && 0 == (nwrites = (size_t)strtoul(argv[1], NULL, 0)))
+        usage(argv[0]);
+
+    for (u = 0; u < HYPER_SIZE * HYPER_SIZE; u++)
+        buf[u] = (int)u;
+
+    /* Keep the file in memory, to measure the library's work */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if (H5Pset_fapl_core(fapl, (size_t)(1024 * 1024), FALSE) < 0)
+        goto error;
+    if ((fid = H5Fcreate("map_perf.h5", H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+
+    if ((sid = H5Screate_simple(RANK, dims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dcpl, RANK, chunk) < 0)
+        goto error;
+    if ((did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+
+    for (u = 0; u < 2; u++)
+        if ((fsid[u] = H5Scopy(sid)) < 0)
+            goto error;
+
+    printf("%-9s %-9s %9s %12s %12s\n", "pattern", "selection", "nwrites", "time(s)", "write(us)");
+
+    /* Hyperslabs */
+    if ((msid[0] = H5Screate_simple(RANK, mdims, NULL)) < 0)
+        goto error;
+    if ((msid[1] = H5Scopy(msid[0])) < 0)
+        goto error;
+    if (select_hyper(fsid[0], CHUNK, CHUNK) < 0 || select_hyper(fsid[1], 2 * CHUNK, CHUNK) < 0)
+        goto error;
+    same_fsid[0] = same_fsid[1] = fsid[0];
+    same_msid[0] = same_msid[1] = msid[0];
+    if (measure(did, "same", "hyperslab", same_fsid, same_msid, nwrites, buf) < 0)
+        goto error;
+    if (measure(did, "alternate", "hyperslab", fsid, msid, nwrites, buf) < 0)
+        goto error;
+
+    /* Points */
+    for (u = 0; u < 2; u++) {
+        if (H5Sclose(msid[u]) < 0)
+            goto error;
+        if ((msid[u] = H5Screate_simple(1, &npoints, NULL)) < 0)
+            goto error;
+        if (select_points(fsid[u], (hsize_t)u) < 0)
+            goto error;
+    }
+    same_fsid[0] = same_fsid[1] = fsid[0];
+    same_msid[0] = same_msid[1] = msid[0];
+    if (measure(did, "same", "points", same_fsid, same_msid, nwrites, buf) < 0)
+        goto error;
+    if (measure(did, "alternate", "points", fsid, msid, nwrites, buf) < 0)
+        goto error;
+
+    for (u = 0; u < 2; u++)
+        if (H5Sclose(fsid[u]) < 0 || H5Sclose(msid[u]) < 0)
+            goto error;
+    if (H5Dclose(did) < 0)
+        goto error;
+    if (H5Sclose(sid) < 0)
+        goto error;
+    if (H5Pclose(dcpl) < 0)
+        goto error;
+    if (H5Fclose(fid) < 0)
+        goto error;
+    if (H5Pclose(fapl) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (u = 0; u < 2; u++) {
+            H5Sclose(fsid[u]);
+            H5Sclose(msid[u]);
+        }
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY
+
+    fprintf(stderr, "map_perf failed\n");
+    return 1;
+}
@@ -0,0 +1,247 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:  Measures the time to build irregular hyperslab selections from
+ *           lists of blocks, with one H5Sselect_hyper_blocklist() call and
+ *           with one H5Sselect_hyperslab(H5S_SELECT_OR) call per block.
+ */
+
+#include "hdf5.h"
+#include "H5private.h"
+
+#define RANK 2
+#define DIM0 (1024 * 1024)
+#define DIM1 4096
+
+/* Longest block, in the fastest changing dimension */
+#define MAX_BLOCK 16
+
+/* Default largest # of blocks to select one at a time */
+#define DEFAULT_MAX_OR 10000
+
+/* Default # of blocks for each measurement */
+static const size_t default_nblocks[] = {1000, 10000, 100000, 1000000};
+
+/*-------------------------------------------------------------------------
+ * Function:  usage
+ *
+ * Purpose:  Prints a usage message and exits.
+ *
+ * Return:  never returns
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-o MAX_OR] [NBLOCKS ...]\n", prog);
+    fprintf(stderr, "\
+    Builds selections of NBLOCKS random blocks in a %dx%d dataspace, and\n\
+    selections of NBLOCKS blocks of a shuffled regular pattern.  The default\n\
+    numbers of blocks are 1000, 10000, 100000 and 1000000.\n\
+\n\
+    -o MAX_OR   Select the blocks one at a time with H5S_SELECT_OR too, for\n\
+                up to MAX_OR blocks (default %d).  This is quadratic in the\n\
+                number of blocks.\n",
+            DIM0, DIM1, DEFAULT_MAX_OR);
+    exit(1);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  make_blocks
+ *
+ * Purpose:  Fills BLOCKS with NBLOCKS random blocks, in the layout of
+ *           H5Sget_select_hyper_blocklist().  If REGULAR is set, the blocks
+ *           are those of a regular hyperslab, in random order.
+ *
+ * Return:  void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+make_blocks(hsize_t *blocks, size_t nblocks, hbool_t regular)
+{
+    size_t u;
+
+    for (u = 0; u < nblocks; u++) {
+        hsize_t *blk = blocks + u * 2 * RANK;
+
+        if (regular) {
+            /* 64 blocks of 4x8 per row of blocks, with a stride of 8x16 */
+            blk[0] = (u / 64) * 8;
+            blk[1] = (u % 64) * 16;
+            blk[2] = blk[0] + 3;
+            blk[3] = blk[1] + 7;
+        }
+        else {
+            blk[0] = (hsize_t)HDrandom() % DIM0;
+            blk[1] = (hsize_t)HDrandom() % (DIM1 - MAX_BLOCK);
+            blk[2] = blk[0];
+            blk[3] = blk[1] + (hsize_t)HDrandom() % MAX_BLOCK;
+        }
+    }
+
+    /* Shuffle the regular blocks */
+    if (regular)
+        for (u = nblocks - 1; u > 0; u--) {
+            size_t  v = (size_t)HDrandom() % (u + 1);
+            hsize_t tmp[2 * RANK];
+
+            memcpy(tmp, blocks + u * 2 * RANK, sizeof(tmp));
+            memcpy(blocks + u * 2 * RANK, blocks + v * 2 * RANK, sizeof(tmp));
+            memcpy(blocks + v * 2 * RANK, tmp, sizeof(tmp));
+        }
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  measure
+ *
+ * Purpose:  Builds the selection of NBLOCKS blocks with each method and
+ *           prints the times.
+ *
+ * Return:  Success:  0
+ *          Failure:  -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+measure(hid_t sid, const char *pattern, const hsize_t *blocks, size_t nblocks, size_t max_or)
+{
+    double   t_start, t_list, t_or = -1.0;
+    hssize_t npoints, nlist;
+    htri_t   regular;
+    size_t   u;
+
+    /* All the blocks at once */
+    t_start = H5_get_time();
+    if (H5Sselect_hyper_blocklist(sid, H5S_SELECT_SET, nblocks, blocks) < 0)
+        return -1;
+    t_list = H5_get_time() - t_start;
+    if ((npoints = H5Sget_select_npoints(sid)) < 0)
+        return -1;
+    if ((nlist = H5Sget_select_hyper_nblocks(sid)) < 0)
+        return -1;
+    if ((regular = H5Sis_regular_hyperslab(sid)) < 0)
+        return -1;
+
+    /* One block at a time */
+    if (nblocks <= max_or) {
+        t_start = H5_get_time();
+        if (H5Sselect_none(sid) < 0)
+            return -1;
+        for (u = 0; u < nblocks; u++) {
+            const hsize_t *blk = blocks + u * 2 * RANK;
+            hsize_t        count[RANK];
+
+            count[0] = blk[2] - blk[0] + 1;
+            count[1] = blk[3] - blk[1] + 1;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_OR, blk, NULL, count, NULL) < 0)
+                return -1;
+        }
+        t_or = H5_get_time() - t_start;
+
+        if (H5Sget_select_npoints(sid) != npoints) {
+            fprintf(stderr, "selections of %zu %s blocks differ\n", nblocks, pattern);
+            return -1;
+        }
+    }
+
+    printf("%-8s %9zu %12" PRIdHSIZE " %9" PRIdHSIZE " %-7s %12.6f ", pattern, nblocks, npoints, nlist,
+           regular ? "yes" : "no", t_list);
+    if (t_or >= 0.0)
+        printf("%12.6f\n", t_or);
+    else
+        printf("%12s\n", "-");
+
+    return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  main
+ *
+ * Purpose:  See file prologue.
+ *
+ * Return:  Success:  0
+ *          Failure:  1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    hsize_t       dims[RANK] = {DIM0, DIM1};
+    const size_t *nblocks    = default_nblocks;
+    size_t        nnblocks   = sizeof(default_nblocks) / sizeof(default_nblocks[0]);
+    size_t       *arg_nblocks = NULL;
+    size_t        max_or      = DEFAULT_MAX_OR;
+    hsize_t      *blocks      = NULL;
+    hid_t         sid         = H5I_INVALID_HID;
+    int           argno       = 1;
+    size_t        u;
+
+    if (argno + 1 < argc && !strcmp(argv[argno], "-o")) {
+        max_or = (size_t)strtoul(argv[argno + 1], NULL, 0);
+        argno += 2;
+    }
+    if (argno < argc) {
+        if ('-' == argv[argno][0])
+            usage(argv[0]);
+        nnblocks = (size_t)(argc - argno);
+        if (NULL == (arg_nblocks = (size_t *)calloc(nnblocks, sizeof(size_t))))
+            goto error;
+        for (u = 0; u < nnblocks; u++)
+            if (0 == (arg_nblocks[u] = (size_t)strtoul(argv[argno + (int)u], NULL, 0)))
+                usage(argv[0]);
+        nblocks = arg_nblocks;
+    }
+
+    if ((sid = H5Screate_simple(RANK, dims, NULL)) < 0)
+        goto error;
+
+    HDsrandom(0);
+
+    printf("%-8s %9s %12s %9s %-7s %12s %12s\n", "pattern", "nblocks", "npoints", "nlist", "regular",
+           "blocklist(s)", "or(s)");
+    for (u = 0; u < nnblocks; u++) {
+        if (NULL == (blocks = (hsize_t *)malloc(nblocks[u] * 2 * RANK * sizeof(hsize_t))))
+            goto error;
+
+        make_blocks(blocks, nblocks[u], FALSE);
+        if (measure(sid, "random", blocks, nblocks[u], max_or) < 0)
+            goto error;
+        make_blocks(blocks, nblocks[u], TRUE);
+        if (measure(sid, "regular", blocks, nblocks[u], max_or) < 0)
+            goto error;
+
+        free(blocks);
+        blocks = NULL;
+    }
+
+    if (H5Sclose(sid) < 0)
+        goto error;
+    free(arg_nblocks);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(sid);
+    }
+    H5E_END_TRY
+    free(blocks);
+    free(arg_nblocks);
+
+    fprintf(stderr, "select_perf failed\n");
+    return 1;
+}
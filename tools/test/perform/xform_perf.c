@@ -0,0 +1,188 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:  Measures the time to read a dataset with data transforms of
+ *           increasing complexity, from no transform to a polynomial.
+ */
+
+#include "hdf5.h"
+#include "H5private.h"
+
+/* Default # of elements of the dataset */
+#define DEFAULT_NELMTS (4 * 1024 * 1024)
+
+/* The transforms measured, with NULL for none */
+static const char *xforms[] = {NULL, "2*x+1", "(9/5.0)*x + 32", "x*x - 2*x + 1", "x*x*x - 2*x*x + 3*x - 4"};
+
+/*-------------------------------------------------------------------------
+ * Function:  usage
+ *
+ * Purpose:  Prints a usage message and exits.
+ *
+ * Return:  never returns
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [NELMTS]\n", prog);
+    fprintf(stderr, "\
+    Reads a dataset of NELMTS ints and one of NELMTS doubles, in a file in\n\
+    memory, with each data transform.  The default number of elements is\n\
+    %d.\n",
+            DEFAULT_NELMTS);
+    exit(1);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  measure
+ *
+ * Purpose:  Reads the dataset with the transform XFORM and prints the
+ *           time.
+ *
+ * Return:  Success:  0
+ *          Failure:  -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+measure(hid_t did, hid_t mem_type, const char *type_name, const char *xform, size_t nelmts, void *buf)
+{
+    hid_t  dxpl = H5I_INVALID_HID;
+    double t_start, t_read;
+
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        return -1;
+    if (xform && H5Pset_data_transform(dxpl, xform) < 0)
+        goto error;
+
+    t_start = H5_get_time();
+    if (H5Dread(did, mem_type, H5S_ALL, H5S_ALL, dxpl, buf) < 0)
+        goto error;
+    t_read = H5_get_time() - t_start;
+
+    printf("%-7s %-25s %12zu %12.6f %12.2f\n", type_name, xform ? xform : "(none)", nelmts, t_read,
+           (double)nelmts / t_read / 1.0e6);
+
+    if (H5Pclose(dxpl) < 0)
+        return -1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl);
+    }
+    H5E_END_TRY
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:  main
+ *
+ * Purpose:  See file prologue.
+ *
+ * Return:  Success:  0
+ *          Failure:  1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    size_t  nelmts = DEFAULT_NELMTS;
+    hsize_t dims[1];
+    int    *ibuf = NULL;
+    double *dbuf = NULL;
+    hid_t   fapl = H5I_INVALID_HID;
+    hid_t   fid  = H5I_INVALID_HID;
+    hid_t   sid  = H5I_INVALID_HID;
+    hid_t   did  = H5I_INVALID_HID;
+    size_t  u;
+
+    if (argc > 2)
+        usage(argv[0]);
+    if (argc == 2 && 0 == (nelmts = (size_t)strtoul(argv[1], NULL, 0)))
+        usage(argv[0]);
+    dims[0] = nelmts;
+
+    if (NULL == (ibuf = (int *)malloc(nelmts * sizeof(int))))
+        goto error;
+    if (NULL == (dbuf = (double *)malloc(nelmts * sizeof(double))))
+        goto error;
+    for (u = 0; u < nelmts; u++) {
+        ibuf[u] = (int)(u % 1000);
+        dbuf[u] = (double)(u % 1000) / 8.0;
+    }
+
+    /* Keep the file in memory, to measure the library's work */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if (H5Pset_fapl_core(fapl, (size_t)(16 * 1024 * 1024), FALSE) < 0)
+        goto error;
+    if ((fid = H5Fcreate("xform_perf.h5", H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+
+    printf("%-7s %-25s %12s %12s %12s\n", "type", "transform", "nelmts", "time(s)", "Melmts/s");
+
+    if ((did = H5Dcreate2(fid, "int", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, ibuf) < 0)
+        goto error;
+    for (u = 0; u < sizeof(xforms) / sizeof(xforms[0]); u++)
+        if (measure(did, H5T_NATIVE_INT, "int", xforms[u], nelmts, ibuf) < 0)
+            goto error;
+    if (H5Dclose(did) < 0)
+        goto error;
+
+    if ((did = H5Dcreate2(fid, "double", H5T_NATIVE_DOUBLE, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        goto error;
+    if (H5Dwrite(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, dbuf) < 0)
+        goto error;
+    for (u = 0; u < sizeof(xforms) / sizeof(xforms[0]); u++)
+        if (measure(did, H5T_NATIVE_DOUBLE, "double", xforms[u], nelmts, dbuf) < 0)
+            goto error;
+    if (H5Dclose(did) < 0)
+        goto error;
+
+    if (H5Sclose(sid) < 0)
+        goto error;
+    if (H5Fclose(fid) < 0)
+        goto error;
+    if (H5Pclose(fapl) < 0)
+        goto error;
+    free(ibuf);
+    free(dbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY
+    free(ibuf);
+    free(dbuf);
+
+    fprintf(stderr, "xform_perf failed\n");
+    return 1;
+}